@@ -659,6 +659,8 @@ private:
   su2double AoA,              /*!< \brief Angle of attack (just external flow). */
   iH, AoS, AoA_Offset,
   AoS_Offset, AoA_Sens;       /*!< \brief Angle of sideSlip (just external flow). */
+  unsigned short nSweep_AoA;  /*!< \brief Number of angles of attack of the sweep. */
+  su2double* Sweep_AoA;       /*!< \brief Angles of attack solved one after the other on the same mesh. */
   bool Fixed_CL_Mode;         /*!< \brief Activate fixed CL mode (external flow only). */
   bool Eval_dOF_dCX;          /*!< \brief Activate fixed CL mode (external flow only). */
   bool Discard_InFiles;       /*!< \brief Discard angle of attack in solution and geometry files. */
@@ -686,6 +688,12 @@ private:
   unsigned short Res_FEM_CRIT;        /*!< \brief Criteria to apply to the FEM convergence (absolute/relative). */
   unsigned long StartConv_Iter;       /*!< \brief Start convergence criteria at iteration. */
   su2double Cauchy_Eps;               /*!< \brief Epsilon used for the convergence. */
+  unsigned short nRestart_Blend_Files,  /*!< \brief Number of converged solutions blended to form the restart. */
+  nRestart_Blend_Params,               /*!< \brief Number of parameters of the blended solutions. */
+  nRestart_Blend_Coords;               /*!< \brief Number of values in Restart_Blend_Coords. */
+  string *Restart_Blend_Files;         /*!< \brief Converged solutions blended to form the restart. */
+  BLEND_PARAM *Restart_Blend_Params;   /*!< \brief Parameters of the blended solutions. */
+  su2double *Restart_Blend_Coords;     /*!< \brief Values of the parameters for each blended solution. */
   bool Restart,                       /*!< \brief Restart solution (for direct, adjoint, and linearized problems).*/
   Read_Binary_Restart,                /*!< \brief Read binary SU2 native restart files.*/
   Wrt_Restart_Overwrite,              /*!< \brief Overwrite restart files or append iteration number.*/
@@ -770,7 +778,9 @@ private:
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
   unsigned long StartWindowIteration; /*!< \brief Starting Iteration for long time Windowing apporach . */
   unsigned short nCFL_AdaptParam;     /*!< \brief Number of CFL parameters provided in config. */
+  unsigned short nCFL_AdaptCostParam; /*!< \brief Number of cost-aware CFL parameters provided in config. */
   bool CFL_Adapt;        /*!< \brief Use adaptive CFL number. */
+  bool CFL_Adapt_Cost;   /*!< \brief Adapt the CFL limit and linear solver settings to the cost. */
   bool HB_Precondition;  /*!< \brief Flag to turn on harmonic balance source term preconditioning */
   su2double RefArea,     /*!< \brief Reference area for coefficient computation. */
   RefElemLength,         /*!< \brief Reference element length for computing the slope limiting epsilon. */
@@ -780,6 +790,7 @@ private:
   *RefOriginMoment_Y,    /*!< \brief Y Origin for moment computation. */
   *RefOriginMoment_Z,    /*!< \brief Z Origin for moment computation. */
   *CFL_AdaptParam,       /*!< \brief Information about the CFL ramp. */
+  *CFL_AdaptCostParam,   /*!< \brief Parameters of the cost-aware CFL adaption. */
   *RelaxFactor_Giles,    /*!< \brief Information about the under relaxation factor for Giles BC. */
   *CFL,                  /*!< \brief CFL number. */
   DomainVolume;          /*!< \brief Volume of the computational grid. */
@@ -806,11 +817,17 @@ private:
   SurfSens_FileName,             /*!< \brief Output file for the sensitivity on the surface (discrete adjoint). */
   VolSens_FileName,              /*!< \brief Output file for the sensitivity in the volume (discrete adjoint). */
   ObjFunc_Hess_FileName,         /*!< \brief Hessian approximation obtained by the Sobolev smoothing solver. */
+  Profiling_FileName,            /*!< \brief Output file of the runtime profiler (w/o extension). */
   *DataDriven_Method_FileNames;    /*!< \brief Dataset information for data-driven fluid models. */
 
   bool
   Wrt_Performance,           /*!< \brief Write the performance summary at the end of a calculation.  */
+  Profiling,                 /*!< \brief Time the main phases of the solver with the runtime profiler.  */
+  Profiling_Counters,        /*!< \brief Read hardware counters in the regions of the runtime profiler.  */
+  Profiling_Comms,           /*!< \brief Record the MPI communication with the runtime profiler.  */
+  Profiling_Roofline,        /*!< \brief Roofline analysis of the kernels in the runtime profiler.  */
   Wrt_AD_Statistics,         /*!< \brief Write the tape statistics (discrete adjoint).  */
+  Wrt_MemoryReport,          /*!< \brief Write the memory used by each subsystem.  */
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
   Wrt_MultiGrid,             /*!< \brief Write the coarse grids to the visualization files.  */
   Wrt_Projected_Sensitivity, /*!< \brief Write projected sensitivities (dJ/dx) on surfaces to ASCII file. */
@@ -925,6 +942,7 @@ private:
   su2double AitkenStatRelax;      /*!< \brief Aitken's relaxation factor (if set as static) */
   su2double AitkenDynMaxInit;     /*!< \brief Aitken's maximum dynamic relaxation factor for the first iteration */
   su2double AitkenDynMinInit;     /*!< \brief Aitken's minimum dynamic relaxation factor for the first iteration */
+  unsigned short nQuasiNewtonSamples_BGS; /*!< \brief Number of samples used by the interface quasi-Newton accelerator. */
   bool RampAndRelease;            /*!< \brief option for ramp load and release */
   bool Sine_Load;                 /*!< \brief option for sine load */
   su2double Thermal_Diffusivity;  /*!< \brief Thermal diffusivity used in the heat solver. */
@@ -1038,6 +1056,7 @@ private:
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint;                /*!< \brief AD-based discrete adjoint mode. */
+  bool DiscAdj_Reuse_Primal_Prec;      /*!< \brief Symmetric systems reuse the primal preconditioner in the adjoint. */
   su2double Const_DES;                 /*!< \brief Detached Eddy Simulation Constant. */
   WINDOW_FUNCTION Kind_WindowFct;      /*!< \brief Type of window (weight) function for objective functional. */
   unsigned short Kind_HybridRANSLES;   /*!< \brief Kind of Hybrid RANS/LES. */
@@ -1076,7 +1095,7 @@ private:
   unsigned short top_optim_nKernel;        /*!< \brief Number of kernels specified. */
   unsigned short top_optim_nKernelParams;  /*!< \brief Number of kernel parameters specified. */
   unsigned short top_optim_nRadius;        /*!< \brief Number of radius values specified. */
-  unsigned short top_optim_search_lim;     /*!< \brief Limit the maximum "logical radius" considered during filtering. */
+  unsigned short top_optim_search_lim;     /*!< \brief Not used, the filter neighbourhood search is exact (kept for compatibility). */
   su2double *top_optim_kernel_params;  /*!< \brief The kernel parameters. */
   su2double *top_optim_filter_radius;  /*!< \brief Radius of the filter(s) used on the design density for topology optimization. */
   ENUM_PROJECTION_FUNCTION top_optim_proj_type;  /*!< \brief The projection function used in topology optimization. */
@@ -1093,8 +1112,11 @@ private:
   su2double *Wall_Emissivity;          /*!< \brief Emissivity of the wall. */
   bool Radiation;                      /*!< \brief Determines if a radiation model is incorporated. */
   su2double CFL_Rad;                   /*!< \brief CFL Number for the radiation solver. */
+  unsigned long Rad_Update_Freq;       /*!< \brief Solve the radiation equation every this many flow iterations. */
+  su2double Rad_Update_Residual;       /*!< \brief Log10 of the radiation RMS residual below which updates may be skipped. */
 
   array<su2double,5> default_cfl_adapt;  /*!< \brief Default CFL adapt param array for the COption class. */
+  array<su2double,4> default_cfl_adapt_cost;  /*!< \brief Default cost-aware CFL adapt params. */
   su2double vel_init[3], /*!< \brief initial velocity array for the COption class. */
   vel_inf[3],            /*!< \brief freestream velocity array for the COption class. */
   eng_cyl[7],            /*!< \brief engine box array for the COption class. */
@@ -1150,6 +1172,10 @@ private:
   unsigned short nVolumeOutputFiles=0;/*!< \brief Number of File formats to output */
   unsigned short nVolumeOutputFrequencies; /*!< \brief Number of frequencies for the volume outputs */
   unsigned long *VolumeOutputFrequencies; /*!< \brief list containing the writing frequencies */
+  unsigned long Profiling_Freq;       /*!< \brief Frequency at which the profiler statistics are written to file. */
+  PROFILING_FORMAT Profiling_Format;  /*!< \brief Format of the profiler output file. */
+  unsigned short nProfiling_Raw_Events;  /*!< \brief Number of CPU-specific hardware events. */
+  string *Profiling_Raw_Events;          /*!< \brief CPU-specific hardware events read by the profiler. */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool Wrt_ZoneConv;              /*!< \brief Write the convergence history of each individual zone to screen. */
@@ -1176,6 +1202,7 @@ private:
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  bool edgeColorAutotune;           /*!< \brief Tune the edge coloring group size from measured loop times. */
 
   INLET_SPANWISE_INTERP Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   INLET_INTERP_TYPE Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -1187,6 +1214,10 @@ private:
   POD_KIND POD_Basis_Gen;                   /*!< \brief Type of POD basis generation (static or incremental). */
   unsigned short maxBasisDim,               /*!< \brief Maximum number of POD basis dimensions. */
   rom_save_freq;                            /*!< \brief Frequency of unsteady time steps to save. */
+  ROM_KIND Kind_ROM;                        /*!< \brief Type of reduced-order model. */
+  unsigned short nROM_Snapshot_Files;       /*!< \brief Number of snapshots used to build the reduced-order model. */
+  string *ROM_Snapshot_Files;               /*!< \brief Snapshots used to build the reduced-order model. */
+  unsigned long nROM_Sample_Points;         /*!< \brief Number of points where the ROM residual is sampled (0 for all). */
 
   unsigned short nSpecies = 0;              /*!< \brief Number of transported species equations (for NEMO and species transport)*/
 
@@ -1626,6 +1657,19 @@ public:
    */
   bool GetCFL_Adapt(void) const { return CFL_Adapt; }
 
+  /*!
+   * \brief Get the value of the cost-aware CFL adaption flag.
+   * \return <code>TRUE</code> if the CFL limit and linear solver settings adapt to the convergence rate per second.
+   */
+  bool GetCFL_Adapt_Cost(void) const { return CFL_Adapt_Cost; }
+
+  /*!
+   * \brief Get the values of the cost-aware CFL adaption parameters (iterations per window, min and max
+   *        linear solver tolerance, max linear solves between preconditioner builds).
+   * \return Value of the parameter.
+   */
+  su2double GetCFL_AdaptCostParam(unsigned short val_index) const { return CFL_AdaptCostParam[val_index]; }
+
   /*!
    * \brief Get the value of the limits for the sections.
    * \return Value of the limits for the sections.
@@ -2716,6 +2760,17 @@ public:
    */
   su2double GetAoA(void) const { return AoA; }
 
+  /*!
+   * \brief Get the number of angles of attack of the sweep (SWEEP_AOA), 0 if there is no sweep.
+   */
+  unsigned short GetnSweep_AoA(void) const { return nSweep_AoA; }
+
+  /*!
+   * \brief Get an angle of attack of the sweep (degrees).
+   * \param[in] val_index - Index of the angle in the sweep.
+   */
+  su2double GetSweep_AoA(unsigned short val_index) const { return Sweep_AoA[val_index]; }
+
   /*!
    * \brief Get the off set angle of attack of the body. The solution and the geometry
    *        file are able to modifity the angle of attack in the config file
@@ -3228,12 +3283,61 @@ public:
    */
   bool GetWrt_Performance(void) const { return Wrt_Performance; }
 
+  /*!
+   * \brief Get whether the main phases of the solver are timed by the runtime profiler.
+   * \return <code>TRUE</code> if the profiler is enabled.
+   */
+  bool GetProfiling(void) const { return Profiling; }
+
+  /*!
+   * \brief Get the frequency (iterations) at which the profiler statistics are written to file.
+   * \return Frequency, 0 to write them only at the end of the calculation.
+   */
+  unsigned long GetProfiling_Freq(void) const { return Profiling_Freq; }
+
+  /*!
+   * \brief Get the format of the profiler output file.
+   */
+  PROFILING_FORMAT GetProfiling_Format(void) const { return Profiling_Format; }
+
+  /*!
+   * \brief Get the name of the profiler output file (w/o extension).
+   */
+  const string& GetProfiling_FileName(void) const { return Profiling_FileName; }
+
+  /*!
+   * \brief Get whether hardware counters are read in the regions of the runtime profiler.
+   */
+  bool GetProfiling_Counters(void) const { return Profiling_Counters; }
+
+  /*!
+   * \brief Get whether the MPI communication is recorded by the runtime profiler.
+   */
+  bool GetProfiling_Comms(void) const { return Profiling_Comms; }
+
+  /*!
+   * \brief Get whether the machine limits are measured for the roofline analysis of the runtime profiler.
+   */
+  bool GetProfiling_Roofline(void) const { return Profiling_Roofline; }
+
+  /*!
+   * \brief Get the CPU-specific hardware events (raw codes) read by the profiler in addition to the generic ones.
+   */
+  vector<string> GetProfiling_Raw_Events(void) const {
+    return vector<string>(Profiling_Raw_Events, Profiling_Raw_Events + nProfiling_Raw_Events);
+  }
+
   /*!
    * \brief Get information about the computational graph (e.g. memory usage) when using AD in reverse mode.
    * \return <code>TRUE</code> means that the tape statistics will be written after each recording.
    */
   bool GetWrt_AD_Statistics(void) const { return Wrt_AD_Statistics; }
 
+  /*!
+   * \brief Get whether the memory used by each subsystem is reported after preprocessing and at the end.
+   */
+  bool GetWrt_MemoryReport(void) const { return Wrt_MemoryReport; }
+
   /*!
    * \brief Get information about writing the mesh quality metrics to the visualization files.
    * \return <code>TRUE</code> means that the mesh quality metrics will be written to the visualization files.
@@ -4303,6 +4407,12 @@ public:
    */
   unsigned short GetKind_DiscAdj_Linear_Prec(void) const { return Kind_DiscAdj_Linear_Prec; }
 
+  /*!
+   * \brief Check if the adjoint linear solves of symmetric systems (linear elasticity) reuse the primal preconditioner.
+   * \return <code>TRUE</code> if the matrix is not transposed and the preconditioner is not rebuilt for the adjoint.
+   */
+  bool GetDiscAdj_Reuse_Primal_Prec(void) const { return DiscAdj_Reuse_Primal_Prec; }
+
   /*!
    * \brief Get the kind of preconditioner for the implicit solver.
    * \return Numerical preconditioner for implicit formulation (solving the linear system).
@@ -5418,6 +5528,43 @@ public:
    */
   bool GetRead_Binary_Restart(void) const { return Read_Binary_Restart; }
 
+  /*!
+   * \brief Get the number of converged solutions blended to form the restart (0 if the restart is read directly).
+   */
+  unsigned short GetnRestart_Blend_Files(void) const { return nRestart_Blend_Files; }
+
+  /*!
+   * \brief Get the name of a converged solution blended to form the restart.
+   * \param[in] iFile - Index of the solution.
+   */
+  const string& GetRestart_Blend_File(unsigned short iFile) const { return Restart_Blend_Files[iFile]; }
+
+  /*!
+   * \brief Get the number of parameters that define the position of the blended solutions in parameter space.
+   */
+  unsigned short GetnRestart_Blend_Params(void) const { return nRestart_Blend_Params; }
+
+  /*!
+   * \brief Get a parameter that defines the position of the blended solutions in parameter space.
+   * \param[in] iParam - Index of the parameter.
+   */
+  BLEND_PARAM GetRestart_Blend_Param(unsigned short iParam) const { return Restart_Blend_Params[iParam]; }
+
+  /*!
+   * \brief Get the value of a parameter for one of the blended solutions.
+   * \param[in] iFile - Index of the solution.
+   * \param[in] iParam - Index of the parameter.
+   */
+  su2double GetRestart_Blend_Coord(unsigned short iFile, unsigned short iParam) const {
+    return Restart_Blend_Coords[iFile * nRestart_Blend_Params + iParam];
+  }
+
+  /*!
+   * \brief Get the value of a parameter for the current problem.
+   * \param[in] param - The parameter.
+   */
+  su2double GetBlend_Param_Value(BLEND_PARAM param) const;
+
   /*!
    * \brief Flag for whether restart solution files are overwritten.
    * \return Flag for overwriting. If Flag=false, iteration nr is appended to filename
@@ -8720,25 +8867,6 @@ public:
    */
   unsigned long GetNonphysical_Reconstr(void) const { return Nonphys_Reconstr; }
 
-  /*!
-   * \brief Start the timer for profiling subroutines.
-   * \param[in] val_start_time - the value of the start time.
-   */
-  void Tick(double *val_start_time);
-
-  /*!
-   * \brief Stop the timer for profiling subroutines and store results.
-   * \param[in] val_start_time - the value of the start time.
-   * \param[in] val_function_name - string for the name of the profiled subroutine.
-   * \param[in] val_group_id - string for the name of the profiled subroutine.
-   */
-  void Tock(double val_start_time, const string& val_function_name, int val_group_id);
-
-  /*!
-   * \brief Write a CSV file containing the results of the profiling.
-   */
-  void SetProfilingCSV(void);
-
   /*!
    * \brief Start the timer for profiling subroutines.
    * \param[in] val_start_time - the value of the start time.
@@ -8820,6 +8948,12 @@ public:
    */
   su2double GetAitkenDynMinInit(void) const { return AitkenDynMinInit; }
 
+  /*!
+   * \brief Get the number of samples used by the interface quasi-Newton (IQN-ILS) accelerator.
+   * \return Number of samples.
+   */
+  unsigned short GetnQuasiNewtonSamples_BGS(void) const { return nQuasiNewtonSamples_BGS; }
+
   /*!
    * \brief Decide whether to apply dead loads to the model.
    * \return <code>TRUE</code> if the dead loads are to be applied, <code>FALSE</code> otherwise.
@@ -9306,6 +9440,7 @@ public:
 
   /*!
    * \brief Get the maximum "logical radius" (degree of neighborhood) to consider in the neighbor search.
+   * \note Not used, the filter neighbourhood search is exact.
    */
   unsigned short GetTopology_Search_Limit(void) const { return top_optim_search_lim; }
 
@@ -9438,6 +9573,18 @@ public:
    */
   su2double GetCFL_Rad(void) const { return CFL_Rad; }
 
+  /*!
+   * \brief Get the number of flow iterations between updates of the radiation solution.
+   * \return Radiation update frequency (1 means every iteration).
+   */
+  unsigned long GetRad_Update_Freq(void) const { return Rad_Update_Freq; }
+
+  /*!
+   * \brief Get the residual level below which radiation updates are only done every GetRad_Update_Freq iterations.
+   * \return Log10 of the radiation RMS residual.
+   */
+  su2double GetRad_Update_Residual(void) const { return Rad_Update_Residual; }
+
   /*!
    * \brief Determines if radiation needs to be incorporated to the analysis.
    * \return Radiation boolean
@@ -9665,6 +9812,11 @@ public:
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Get whether the edge coloring group size is tuned at runtime from measured loop times.
+   */
+  bool GetEdgeColoringAutotune(void) const { return edgeColorAutotune; }
+
   /*!
    * \brief Get the ParMETIS load balancing tolerance.
    */
@@ -9717,6 +9869,28 @@ public:
    */
   unsigned short GetRom_SaveFreq(void) const { return rom_save_freq; }
 
+  /*!
+   * \brief Get the type of reduced-order model used to solve the flow equations.
+   */
+  ROM_KIND GetKind_ROM(void) const { return Kind_ROM; }
+
+  /*!
+   * \brief Get the number of snapshots used to build the reduced-order model.
+   */
+  unsigned short GetnROM_Snapshot_Files(void) const { return nROM_Snapshot_Files; }
+
+  /*!
+   * \brief Get the name of a snapshot used to build the reduced-order model.
+   * \param[in] iFile - Index of the snapshot.
+   */
+  string GetROM_Snapshot_File(unsigned short iFile) const { return ROM_Snapshot_Files[iFile]; }
+
+  /*!
+   * \brief Get the (global) number of points where the residual of the reduced-order model is sampled.
+   * \return 0 if the residual is evaluated on the full mesh (no hyper-reduction).
+   */
+  unsigned long GetnROM_Sample_Points(void) const { return nROM_Sample_Points; }
+
   /*!
    * \brief Check if the gradient smoothing is active
    * \return true means that smoothing is applied to the sensitivities
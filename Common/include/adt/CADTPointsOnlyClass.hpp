@@ -69,6 +69,19 @@ class CADTPointsOnlyClass : public CADTBaseClass {
     DetermineNearestNode_impl(FrontLeaves[iThread], FrontLeavesNew[iThread], coor, dist, pointID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines all the nodes in the ADT within a given distance of a coordinate.
+   * \note This simply forwards the call to the implementation function selecting the right
+   *       working variables for the current thread. The search is passive (not recorded by AD).
+   * \param[in]  coor     Coordinate of the center of the search.
+   * \param[in]  radius   Radius of the search.
+   * \param[out] pointIDs Local point IDs of the nodes within the radius (unsorted).
+   */
+  inline void DetermineNodesInRadius(const su2double* coor, su2double radius, vector<unsigned long>& pointIDs) {
+    const auto iThread = omp_get_thread_num();
+    DetermineNodesInRadius_impl(FrontLeaves[iThread], FrontLeavesNew[iThread], coor, radius, pointIDs);
+  }
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -81,4 +94,11 @@ class CADTPointsOnlyClass : public CADTBaseClass {
    */
   void DetermineNearestNode_impl(vector<unsigned long>& frontLeaves, vector<unsigned long>& frontLeavesNew,
                                  const su2double* coor, su2double& dist, unsigned long& pointID, int& rankID) const;
+
+  /*!
+   * \brief Implementation of DetermineNodesInRadius.
+   * \note Working variables (first two) passed explicitly for thread safety.
+   */
+  void DetermineNodesInRadius_impl(vector<unsigned long>& frontLeaves, vector<unsigned long>& frontLeavesNew,
+                                   const su2double* coor, su2double radius, vector<unsigned long>& pointIDs) const;
 };
@@ -61,6 +61,12 @@ inline bool TapeActive() { return false; }
  */
 inline void PrintStatistics() {}
 
+/*!
+ * \brief Get the memory used by the tape.
+ * \return Memory in bytes.
+ */
+inline double GetTapeMemory() { return 0.0; }
+
 /*!
  * \brief Registers the variable as an input. I.e. as a leaf of the computational graph.
  * \param[in] data - The variable to be registered as input.
@@ -337,6 +343,8 @@ FORCEINLINE bool TapeActive() { return AD::getTape().isActive(); }
 
 FORCEINLINE void PrintStatistics() { AD::getTape().printStatistics(); }
 
+FORCEINLINE double GetTapeMemory() { return AD::getTape().getTapeValues().getUsedMemorySize() * 1024.0 * 1024.0; }
+
 FORCEINLINE void ClearAdjoints() { AD::getTape().clearAdjoints(); }
 
 FORCEINLINE void ComputeAdjoint() {
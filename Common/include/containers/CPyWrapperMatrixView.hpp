@@ -28,6 +28,7 @@
 #pragma once
 
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -35,6 +36,19 @@
 #include "../parallelization/mpi_structure.hpp"
 #include "C2DContainer.hpp"
 
+/*!
+ * \brief Returns the address of the passive value of an su2double.
+ * \note In AD builds the values are interleaved with the derivative information, the strides to access them
+ * are then multiples of sizeof(su2double), and they must not be modified directly.
+ */
+inline const passivedouble* PassiveAddress(const su2double& val) {
+#if defined(CODI_FORWARD_TYPE) || defined(CODI_REVERSE_TYPE)
+  return &val.getValue();
+#else
+  return &val;
+#endif
+}
+
 /*!
  * \brief Python wrapper matrix interface
  * The accessors in this macro provide a passive double interface to matrix of
@@ -43,7 +57,9 @@
  * via the functions "Access(row, col) -> su2double&" (const and non-const versions).
  * We use a macro because it is diffult to use modern C++ idioms (e.g. CRTP) with
  * SWIG. In addition to "Access" classes must have member variables "rows_", "cols_",
- * and "read_only_".
+ * "read_only_", "data_" (start of the underlying storage) and "buffer_rows_" (its number of rows).
+ * The "Buffer" functions describe the underlying storage to allow zero-copy access from
+ * Python (see pySU2 for the NumPy interface built on them).
  */
 #define PY_WRAPPER_MATRIX_INTERFACE                                                                              \
   /*! \brief Returns the shape of the matrix. */                                                                 \
@@ -71,7 +87,21 @@
   void Set(unsigned long row, std::vector<passivedouble> vals) {                                                 \
     unsigned long j = 0;                                                                                         \
     for (const auto& val : vals) Set(row, j++, val);                                                             \
-  }
+  }                                                                                                              \
+                                                                                                                 \
+  /*! \brief Returns the number of rows of the underlying storage (all the mesh nodes for marker views). */      \
+  unsigned long BufferRows() const { return buffer_rows_; }                                                      \
+                                                                                                                 \
+  /*! \brief Returns the distance in bytes between consecutive rows and columns of the underlying storage. */    \
+  std::pair<unsigned long, unsigned long> BufferStrides() const {                                                \
+    return std::make_pair(cols_ * sizeof(su2double), sizeof(su2double));                                         \
+  }                                                                                                              \
+                                                                                                                 \
+  /*! \brief Returns whether the storage can be modified directly, without clearing derivative information. */  \
+  bool IsBufferWritable() const { return !read_only_ && std::is_same<su2double, passivedouble>::value; }         \
+                                                                                                                 \
+  /*! \brief Returns the address of the first passive value of the underlying storage. */                       \
+  const passivedouble* BufferData() const { return buffer_rows_ ? PassiveAddress(data_[0]) : nullptr; }
 
 /*!
  * \class CPyWrapperMatrixView
@@ -83,7 +113,7 @@ class CPyWrapperMatrixView {
  protected:
   static_assert(su2activematrix::IsRowMajor, "");
   su2double* data_ = nullptr;
-  unsigned long rows_ = 0, cols_ = 0;
+  unsigned long rows_ = 0, cols_ = 0, buffer_rows_ = 0;
   std::string name_;
   bool read_only_ = false;
 
@@ -107,7 +137,19 @@ class CPyWrapperMatrixView {
    * \note "read_only" can be set to true to prevent the data from being modified.
    */
   CPyWrapperMatrixView(su2activematrix& mat, const std::string& name, bool read_only)
-      : data_(mat.data()), rows_(mat.rows()), cols_(mat.cols()), name_(name), read_only_(read_only) {}
+      : data_(mat.data()),
+        rows_(mat.rows()),
+        cols_(mat.cols()),
+        buffer_rows_(mat.rows()),
+        name_(name),
+        read_only_(read_only) {}
+
+  /*!
+   * \brief Construct the view of contiguous row-major data (e.g. the blocks of a CSysVector).
+   */
+  CPyWrapperMatrixView(su2double* data, unsigned long rows, unsigned long cols, const std::string& name,
+                       bool read_only)
+      : data_(data), rows_(rows), cols_(cols), buffer_rows_(rows), name_(name), read_only_(read_only) {}
 
   /*--- Use the macro to generate the interface. ---*/
   PY_WRAPPER_MATRIX_INTERFACE
@@ -124,7 +166,7 @@ class CPyWrapperMarkerMatrixView {
   static_assert(su2activematrix::IsRowMajor, "");
   su2double* data_ = nullptr;
   const CVertex* const* vertices_ = nullptr;
-  unsigned long rows_ = 0, cols_ = 0;
+  unsigned long rows_ = 0, cols_ = 0, buffer_rows_ = 0;
   std::string name_;
   bool read_only_ = false;
 
@@ -153,6 +195,7 @@ class CPyWrapperMarkerMatrixView {
         vertices_(vertices),
         rows_(n_vertices),
         cols_(mat.cols()),
+        buffer_rows_(mat.rows()),
         name_(name),
         read_only_(read_only) {
     if (mat.rows() < n_vertices) {
@@ -162,4 +205,13 @@ class CPyWrapperMarkerMatrixView {
 
   /*--- Use the macro to generate the interface. ---*/
   PY_WRAPPER_MATRIX_INTERFACE
+
+  /*!
+   * \brief Returns the indices of the mesh nodes of the marker, i.e. the rows of the underlying storage.
+   */
+  std::vector<unsigned long> GetNodes() const {
+    std::vector<unsigned long> nodes(rows_);
+    for (unsigned long i = 0; i < rows_; ++i) nodes[i] = vertices_[i]->GetNode();
+    return nodes;
+  }
 };
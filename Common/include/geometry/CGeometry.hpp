@@ -224,8 +224,23 @@ class CGeometry {
     std::vector<uint8_t> lineletColor; /*!< \brief Coloring transfered to points, for visualization. */
   };
 
+  /*!< \brief Sparse operators of the element filter (e.g. density filter of topology optimization). */
+  struct CElementFilterInfo {
+    vector<pair<ENUM_FILTER_KERNEL, passivedouble>> kernels; /*!< \brief Kernels the operators were built for. */
+    vector<passivedouble> radius;                             /*!< \brief Radius of each stage. */
+
+    vector<unsigned long> sendElem; /*!< \brief Local elements sent to other ranks, ordered by rank. */
+    vector<unsigned long> recvElem; /*!< \brief Position of the received elements in the extended set. */
+    vector<int> sendCounts, sendDispls, recvCounts, recvDispls; /*!< \brief Layout of the exchanges. */
+    unsigned long nElemExt = 0; /*!< \brief Number of local plus halo-extended elements. */
+
+    vector<CCompressedSparsePatternUL> pattern; /*!< \brief Neighbourhood of each local element, per stage. */
+    vector<su2vector<passivedouble>> weights;   /*!< \brief Normalized weights of the neighbours, per stage. */
+  };
+
  protected:
   mutable CLineletInfo lineletInfo;
+  mutable CElementFilterInfo elementFilterInfo;
 
  public:
   /*--- Main geometric elements of the grid. ---*/
@@ -396,6 +411,31 @@ class CGeometry {
    */
   void AllocatePeriodicComms(unsigned short val_countPerPeriodicPoint);
 
+  /*!
+   * \brief Get the size of the point-to-point and periodic communication buffers (for the memory report).
+   * \return Size in bytes.
+   */
+  long long GetCommBufferBytes() const;
+
+  /*!
+   * \brief Record a point-to-point exchange in the communication profiler (see CCommProfiler).
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] mpiType - Enumerated type for the datatype of the quantity.
+   * \param[in] reverse - Whether the communication is reversed (see PostP2PSends).
+   */
+  void ProfileP2PComms(unsigned short commType, unsigned short countPerPoint, unsigned short mpiType,
+                       bool reverse) const;
+
+  /*!
+   * \brief Record a periodic exchange in the communication profiler (see CCommProfiler).
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] countPerPeriodicPoint - Number of variables per point.
+   * \param[in] mpiType - Enumerated type for the datatype of the quantity.
+   */
+  void ProfilePeriodicComms(unsigned short commType, unsigned short countPerPeriodicPoint,
+                            unsigned short mpiType) const;
+
   /*!
    * \brief Routine to launch non-blocking recvs only for all periodic communication with neighboring partitions.
    * \note This routine is called by any class that has loaded data into the generic communication buffers.
@@ -1012,7 +1052,9 @@ class CGeometry {
   void ComputeSurf_Curvature(CConfig* config);
 
   /*!
-   * \brief A virtual member.
+   * \brief Intersect the surface with a plane to extract an airfoil section.
+   * \note The extraction is only recorded by AD for the deformed surface (original_surface = false),
+   *       that is, when the section depends on the vertex coordinate variations.
    * \param[in] config - Definition of the particular problem.
    */
   void ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Normal, su2double MinXCoord, su2double MaxXCoord,
@@ -1021,6 +1063,26 @@ class CGeometry {
                               vector<su2double>& Ycoord_Airfoil, vector<su2double>& Zcoord_Airfoil,
                               vector<su2double>& Variable_Airfoil, bool original_surface, CConfig* config);
 
+  /*!
+   * \brief Intersect the surface with several planes at once (batched version of ComputeAirfoil_Section).
+   * \note The boundary elements are binned once along each distinct plane normal, planes are cut in parallel
+   *       (threads), and the segments of each section are chained on a different rank (plane index modulo
+   *       the number of ranks). The sections are returned on the master node, as in ComputeAirfoil_Section.
+   * \param[in] nPlane - Number of planes.
+   * \param[in] Plane_P0 - Point of each plane.
+   * \param[in] Plane_Normal - Normal of each plane.
+   * \param[out] Xcoord_Airfoil - X coordinates of each section.
+   * \param[out] Ycoord_Airfoil - Y coordinates of each section.
+   * \param[out] Zcoord_Airfoil - Z coordinates of each section.
+   * \param[out] Variable_Airfoil - Interpolated variable of each section (zero, no flow variable is given).
+   * \param[in] original_surface - Cut the original surface or the surface with the vertex coordinate variations.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAirfoil_Sections(unsigned short nPlane, su2double* const* Plane_P0, su2double* const* Plane_Normal,
+                               vector<su2double>* Xcoord_Airfoil, vector<su2double>* Ycoord_Airfoil,
+                               vector<su2double>* Zcoord_Airfoil, vector<su2double>* Variable_Airfoil,
+                               bool original_surface, CConfig* config);
+
   /*!
    * \brief A virtual member.
    */
@@ -1632,37 +1694,13 @@ class CGeometry {
 
   /*!
    * \brief Filter values given at the element CG by performing a weighted average over a radial neighbourhood.
+   * \note The filter operators are built on the first call and reused while the parameters do not change.
    * \param[in] filter_radius - Parameter defining the size of the neighbourhood.
    * \param[in] kernels - Kernel types and respective parameter, size of vector defines number of filter recursions.
-   * \param[in] search_limit - Max degree of neighborhood considered for neighbor search, avoids excessive work in fine
-   * regions. \param[in,out] values - On entry, the "raw" values, on exit, the filtered values.
+   * \param[in,out] values - On entry, the "raw" values, on exit, the filtered values.
    */
   void FilterValuesAtElementCG(const vector<su2double>& filter_radius,
-                               const vector<pair<ENUM_FILTER_KERNEL, su2double>>& kernels,
-                               const unsigned short search_limit, su2double* values) const;
-
-  /*!
-   * \brief Build the global (entire mesh!) adjacency matrix for the elements in compressed format.
-   *        Used by FilterValuesAtElementCG to search for geometrically close neighbours.
-   * \param[out] neighbour_start - i'th position stores the start position in "neighbour_idx" for the immediate
-   *             neighbours of global element "i". Size nElemDomain+1
-   * \param[out] neighbour_idx - Global index of the neighbours, mush be NULL on entry and free'd by calling function.
-   */
-  void GetGlobalElementAdjacencyMatrix(vector<unsigned long>& neighbour_start, long*& neighbour_idx) const;
-
-  /*!
-   * \brief Get the neighbours of the global element in the first position of "neighbours" that are within "radius" of
-   * it. \param[in] iElem_global - Element of interest. \param[in] radius - Parameter defining the size of the
-   * neighbourhood. \param[in] search_limit - Maximum "logical radius" to consider, limits cost in refined regions, use
-   * 0 for unlimited. \param[in] neighbour_start - See GetGlobalElementAdjacencyMatrix. \param[in] neighbour_idx - See
-   * GetGlobalElementAdjacencyMatrix. \param[in] cg_elem - Global element centroid coordinates in row major format
-   * {x0,y0,x1,y1,...}. Size nDim*nElemDomain. \param[in,out] neighbours - The neighbours of iElem_global.
-   * \param[in,out] is_neighbor - Working vector of size nElemGlobal, MUST be all false on entry (if so, on exit it will
-   * be the same). \return true if the search was successful, i.e. not limited.
-   */
-  bool GetRadialNeighbourhood(const unsigned long iElem_global, const passivedouble radius, size_t search_limit,
-                              const vector<unsigned long>& neighbour_start, const long* neighbour_idx,
-                              const su2double* cg_elem, vector<long>& neighbours, vector<bool>& is_neighbor) const;
+                               const vector<pair<ENUM_FILTER_KERNEL, su2double>>& kernels, su2double* values) const;
 
   /*!
    * \brief Compute and store the volume of the primal elements.
@@ -1725,6 +1763,13 @@ class CGeometry {
    */
   const CCompressedSparsePatternUL& GetEdgeColoring(su2double* efficiency = nullptr);
 
+  /*!
+   * \brief Compute a coloring of the edges with a given group size, without storing it.
+   * \param[in] groupSize - Number of consecutive edges of a color that are assigned to the same thread.
+   * \return The coloring, empty if the coloring failed.
+   */
+  CCompressedSparsePatternUL ColorEdges(unsigned long groupSize) const;
+
   /*!
    * \brief Force the natural (sequential) edge coloring.
    */
@@ -1760,6 +1805,20 @@ class CGeometry {
    */
   const CLineletInfo& GetLineletInfo(const CConfig* config) const;
 
+ protected:
+  /*!
+   * \brief Get the operators of the element filter, these are (re)built if the filter parameters change.
+   * \note The neighbourhoods are found with a radius search over the local elements, extended with the
+   *       elements of other ranks that are within the largest radius of the local bounding box.
+   * \param[in] filter_radius - Radius of each filter stage.
+   * \param[in] kernels - Kernel types and respective parameter.
+   * \return Sparse filter matrices and communication pattern.
+   */
+  const CElementFilterInfo& GetElementFilterInfo(const vector<su2double>& filter_radius,
+                                                 const vector<pair<ENUM_FILTER_KERNEL, su2double>>& kernels) const;
+
+ public:
+
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
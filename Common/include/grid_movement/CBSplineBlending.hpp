@@ -44,6 +44,8 @@ class CBSplineBlending : public CFreeFormBlending {
   vector<vector<su2double> > N; /*!< \brief The temporary matrix holding the j+p basis functions up to order p. */
   unsigned short KnotSize;      /*!< \brief The size of the knot vector. */
 
+  static constexpr int MAXORDER_STACK = 16; /*!< \brief Maximum order for which GetAllBasis uses the stack. */
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -70,6 +72,17 @@ class CBSplineBlending : public CFreeFormBlending {
    */
   su2double GetDerivative(short val_i, su2double val_t, short val_order_der) override;
 
+  /*!
+   * \brief Evaluate all the basis functions, and their first and second derivatives, at a point.
+   * \note Contrary to GetBasis and GetDerivative this does not use temporaries of the object, it can be called
+   *       concurrently by multiple threads.
+   * \param[in] val_t - Point at which we want to evaluate the basis.
+   * \param[out] val_N - Values of the basis functions (one per control point).
+   * \param[out] val_dN - First derivatives of the basis functions.
+   * \param[out] val_d2N - Second derivatives of the basis functions.
+   */
+  void GetAllBasis(su2double val_t, su2double* val_N, su2double* val_dN, su2double* val_d2N) const override;
+
   /*!
    * \brief Set the order and number of control points.
    * \param[in] val_order - The new order of the function.
@@ -68,6 +68,17 @@ class CFreeFormBlending {
    */
   inline virtual su2double GetDerivative(short val_i, su2double val_t, short val_order) { return 0.0; }
 
+  /*!
+   * \brief A pure virtual member, evaluate all the basis functions, and their first and second derivatives, at a point.
+   * \note Contrary to GetBasis and GetDerivative this does not use temporaries of the object, it can be called
+   *       concurrently by multiple threads.
+   * \param[in] val_t - Point at which we want to evaluate the basis.
+   * \param[out] val_N - Values of the basis functions (one per control point).
+   * \param[out] val_dN - First derivatives of the basis functions.
+   * \param[out] val_d2N - Second derivatives of the basis functions.
+   */
+  inline virtual void GetAllBasis(su2double val_t, su2double* val_N, su2double* val_dN, su2double* val_d2N) const {}
+
   /*!
    * \brief A pure virtual member.
    * \param[in] val_order - The new order of the function.
@@ -260,6 +260,17 @@ class CFreeFormDefBox : public CGridMovement {
     return ParamCoord_;
   }
 
+  /*!
+   * \brief Get the parametric coordinates without using temporaries of the box (thread-safe).
+   * \param[in] val_iSurfacePoints - Surface point of the FFD box.
+   * \param[out] val_coord - Parametric coordinates.
+   */
+  inline void Get_ParametricCoord(unsigned long val_iSurfacePoints, su2double* val_coord) const {
+    val_coord[0] = ParametricCoord[0][val_iSurfacePoints];
+    val_coord[1] = ParametricCoord[1][val_iSurfacePoints];
+    val_coord[2] = ParametricCoord[2][val_iSurfacePoints];
+  }
+
   /*!
    * \brief Get number of surface points.
    */
@@ -565,6 +576,18 @@ class CFreeFormDefBox : public CGridMovement {
   su2double* GetParametricCoord_Iterative(unsigned long iPoint, su2double* xyz, const su2double* guess,
                                           CConfig* config);
 
+  /*!
+   * \brief Iterative strategy for computing the parametric coordinates (thread-safe version).
+   * \param[in] iPoint - Index of the point, used for output and to seed the random restarts.
+   * \param[in] xyz - Cartesians coordinates of the target point.
+   * \param[in] guess - Initial guess for doing the parametric coordinates search.
+   * \param[out] uvw - Parametric coordinates of the point.
+   * \param[in] config - Definition of the particular problem.
+   * \return True if the iterative method converged.
+   */
+  bool GetParametricCoord_Iterative(unsigned long iPoint, const su2double* xyz, const su2double* guess,
+                                    su2double* uvw, const CConfig* config) const;
+
   /*!
    * \brief Compute the cross product.
    * \param[in] v1 - First input vector.
@@ -596,6 +619,29 @@ class CFreeFormDefBox : public CGridMovement {
    */
   su2double* EvalCartesianCoord(su2double* ParamCoord) const;
 
+  /*!
+   * \brief Evaluate the cartesian coordinates of a point, and optionally their first and second derivatives
+   *        with respect to the parametric coordinates (thread-safe version).
+   * \note The basis functions are evaluated once per direction, and the sum over control points is factorized
+   *       one direction at a time, i.e. the cost is O(lmn) instead of O(lmn (l+m+n)) per coordinate and derivative.
+   * \param[in] uvw - Parametric coordinates of a point.
+   * \param[out] xyz - Cartesian coordinates of the point.
+   * \param[out] dxyz - Derivatives, dxyz[a][iDim] = d xyz[iDim] / d uvw[a] (optional).
+   * \param[out] d2xyz - Second derivatives, d2xyz[a][b][iDim] = d^2 xyz[iDim] / d uvw[a] d uvw[b] (optional).
+   */
+  void EvalCartesianCoord(const su2double* uvw, su2double* xyz, su2double (*dxyz)[3] = nullptr,
+                          su2double (*d2xyz)[3][3] = nullptr) const;
+
+  /*!
+   * \brief Add the contribution of a point to the sensitivities w.r.t. the control points, i.e. apply the
+   *        transpose of EvalCartesianCoord (the cartesian coordinates are linear in the control points).
+   * \note Thread-safe, but concurrent calls must use different output arrays.
+   * \param[in] uvw - Parametric coordinates of the point.
+   * \param[in] val - Sensitivity w.r.t. the cartesian coordinates of the point.
+   * \param[in,out] cpSens - Sensitivities w.r.t. the control points (i,j,k,iDim), size lOrder*mOrder*nOrder*3.
+   */
+  void AddControlPointSensitivity(const su2double* uvw, const su2double* val, su2double* cpSens) const;
+
   /*!
    * \brief Get the order in the l direction of the FFD FFDBox.
    * \return Order in the l direction of the FFD FFDBox.
@@ -162,6 +162,29 @@ class CSysMatrix {
   mutable vector<vector<ScalarType> >
       LineletVector; /*!< \brief Solution and RHS of the tri-diag system (working memory). */
 
+  /*!
+   * \brief Level of the algebraic multigrid (AMG) hierarchy. Level 0 is a view of the matrix itself
+   *        (without the halo columns), coarser levels are obtained by plain aggregation of the points.
+   */
+  struct AMGLevel {
+    unsigned long nPoint = 0;               /*!< \brief Number of (block) rows. */
+    const unsigned long* rowPtr = nullptr;  /*!< \brief Pointers to the first element in each row. */
+    const unsigned long* colInd = nullptr;  /*!< \brief Column index for each of the blocks. */
+    const ScalarType* values = nullptr;     /*!< \brief Blocks of the level matrix. */
+    vector<unsigned long> row_ptr, col_ind; /*!< \brief Storage of the sparse pattern (coarse levels). */
+    vector<ScalarType> val;                 /*!< \brief Storage of the blocks (coarse levels). */
+    vector<ScalarType> invDiag;             /*!< \brief Inverse diagonal blocks of the l1-Jacobi smoother. */
+    vector<unsigned long> aggregate;        /*!< \brief Row of the next (coarser) level each row belongs to. */
+    vector<unsigned long> agg_ptr, agg_idx; /*!< \brief Rows of this level in each row of the next level. */
+    mutable vector<ScalarType> sol, rhs, res; /*!< \brief Working vectors of the V-cycle. */
+  };
+  vector<AMGLevel> AMGLevels;  /*!< \brief Hierarchy of the AMG preconditioner, finest first. */
+  vector<ScalarType> AMGCoarseInv; /*!< \brief Dense inverse of the coarsest level (empty if it is smoothed). */
+
+  enum : unsigned long { AMG_COARSE_SIZE = 64 }; /*!< \brief Stop coarsening below this number of rows. */
+  enum : unsigned long { AMG_MAX_LEVELS = 20 };  /*!< \brief Maximum number of levels of the hierarchy. */
+  enum : unsigned long { AMG_MAX_DENSE = 512 };  /*!< \brief Max. size of the coarsest level for a dense solve. */
+
 #ifdef USE_MKL
   using gemm_t = typename mkl_jit_wrapper<ScalarType>::gemm_t;
   void* MatrixMatrixProductJitter;               /*!< \brief Jitter handle for MKL JIT based GEMM. */
@@ -391,6 +414,19 @@ class CSysMatrix {
    */
   void SetValDiagonalZero(void);
 
+  /*!
+   * \brief Copy all the entries of the sparse matrix, e.g. to restore them with SetValues.
+   * \param[out] values - Entries of the matrix (resized to the size of the sparse pattern).
+   */
+  void GetValues(std::vector<ScalarType>& values) const;
+
+  /*!
+   * \brief Overwrite all the entries of the sparse matrix with values previously obtained with GetValues.
+   * \note Can be called from inside parallel regions (all threads must call it).
+   * \param[in] values - Entries of the matrix.
+   */
+  void SetValues(const std::vector<ScalarType>& values);
+
   /*!
    * \brief Get a pointer to the start of block "ij"
    * \param[in] block_i - Row index.
@@ -798,7 +834,7 @@ class CSysMatrix {
   /*!
    * \brief Modifies this matrix (A) and a rhs vector (b) such that (A^-1 * b)_i = x_i.
    * \param[in] node_i - Index of the node for which to enforce the solution of all DOF's.
-   * \param[in] x_i - Values to enforce (nVar sized).
+   * \param[in] x_i - Values to enforce (sized as the blocks of b, which may hold several right-hand sides).
    * \param[in,out] b - The rhs vector (b := b - A_{*,i} * x_i;  b_i = x_i).
    */
   template <class OtherType>
@@ -830,6 +866,8 @@ class CSysMatrix {
 
   /*!
    * \brief Performs the product of a sparse matrix by a CSysVector.
+   * \note The vectors may hold several right-hand sides (a multiple of nVar variables per point),
+   *       in which case the matrix is applied to each of them in the same pass over its blocks.
    * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
@@ -838,6 +876,16 @@ class CSysMatrix {
   void MatrixVectorProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                            const CConfig* config) const;
 
+  /*!
+   * \brief Performs the product of some rows of a sparse matrix by a CSysVector, without communications
+   *        (the other rows of the product are not modified). Multiple right-hand sides as above.
+   * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
+   * \param[in] rows - Rows (non-halo points) of the product.
+   * \param[out] prod - Result of the product.
+   */
+  void MatrixVectorProductRows(const CSysVector<ScalarType>& vec, const std::vector<unsigned long>& rows,
+                               CSysVector<ScalarType>& prod) const;
+
   /*!
    * \brief Build the Jacobi preconditioner.
    */
@@ -845,6 +893,7 @@ class CSysMatrix {
 
   /*!
    * \brief Multiply CSysVector by the preconditioner
+   * \note The vectors may hold several right-hand sides (a multiple of nVar variables per point).
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
    * \param[out] prod - Result of the product A*vec.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -891,6 +940,24 @@ class CSysMatrix {
   void ComputeLineletPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                     CGeometry* geometry, const CConfig* config) const;
 
+  /*!
+   * \brief Build the algebraic multigrid (AMG) preconditioner.
+   * \note The hierarchy is built by plain aggregation of the strongly connected points owned by
+   *       this rank, i.e. like ILU it acts as a block-Jacobi method across MPI ranks.
+   */
+  void BuildAMGPreconditioner();
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V-cycle with l1-Jacobi smoothing).
+   * \note The vectors may hold several right-hand sides (a multiple of nVar variables per point).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                const CConfig* config) const;
+
   /*!
    * \brief Compute the linear residual.
    * \param[in] sol - Solution (x).
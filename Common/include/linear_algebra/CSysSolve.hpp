@@ -113,6 +113,10 @@ class CSysSolve {
       LinearToleranceType::ABSOLUTE; /*!< \brief How the linear solvers interpret the tolerance. */
   bool xIsZero = false;              /*!< \brief If true assume the initial solution is always 0. */
   bool recomputeRes = false;         /*!< \brief Recompute the residual after inner iterations, if monitoring. */
+  bool symmetricSystem = false;      /*!< \brief The matrix is symmetric, the adjoint can reuse the primal factorization. */
+  bool reusePrecond = false;         /*!< \brief The matrix did not change, the preconditioner does not need to be rebuilt. */
+  passivedouble tolOverride = 0.0;   /*!< \brief If positive, replaces the tolerance of the config. */
+  unsigned long iterOverride = 0;    /*!< \brief If positive, replaces the max iterations of the config. */
   unsigned long monitorFreq = 10;    /*!< \brief Monitoring frequency. */
 
   /*!
@@ -410,6 +414,29 @@ class CSysSolve {
    */
   inline void SetxIsZero(bool isZero) { xIsZero = isZero; }
 
+  /*!
+   * \brief Declare the matrix as symmetric, the discrete adjoint then reuses the preconditioner built
+   *        for the primal solve instead of transposing the matrix and building a new one.
+   */
+  inline void SetSymmetricSystem(bool symmetric) { symmetricSystem = symmetric; }
+
+  /*!
+   * \brief Declare that the matrix did not change since the last call to Solve, the preconditioner
+   *        (or direct factorization) that was built then is reused.
+   */
+  inline void SetReusePreconditioner(bool reuse) { reusePrecond = reuse; }
+
+  /*!
+   * \brief Replace the tolerance and maximum iterations of the config in the standard mode (e.g. when they
+   *        are adapted during the solution), 0 restores the values of the config.
+   * \param[in] tolerance - Tolerance of the linear solver.
+   * \param[in] maxIter - Maximum number of iterations.
+   */
+  inline void SetSolverParameters(passivedouble tolerance, unsigned long maxIter) {
+    tolOverride = tolerance;
+    iterOverride = maxIter;
+  }
+
   /*!
    * \brief Set whether to recompute residuals at the end (while monitoring only).
    */
@@ -1593,11 +1593,13 @@ enum class BGS_RELAXATION {
   NONE,       /*!< \brief No relaxation in the strongly coupled approach. */
   FIXED,      /*!< \brief Relaxation with a fixed parameter. */
   AITKEN,     /*!< \brief Relaxation using Aitken's dynamic parameter. */
+  IQN_ILS,    /*!< \brief Interface quasi-Newton acceleration (inverse least squares) of the transferred data. */
 };
 static const MapType<std::string, BGS_RELAXATION> AitkenForm_Map = {
   MakePair("NONE", BGS_RELAXATION::NONE)
   MakePair("FIXED_PARAMETER", BGS_RELAXATION::FIXED)
   MakePair("AITKEN_DYNAMIC", BGS_RELAXATION::AITKEN)
+  MakePair("IQN_ILS", BGS_RELAXATION::IQN_ILS)
 };
 
 /*!
@@ -2034,6 +2036,18 @@ static const MapType<std::string, OUTPUT_TYPE> Output_Map = {
   MakePair("STL_BINARY", OUTPUT_TYPE::STL_BINARY)
 };
 
+/*!
+ * \brief Format of the profiling output files.
+ */
+enum class PROFILING_FORMAT {
+  CSV,   /*!< \brief One row per region, appended to at each write. */
+  JSON,  /*!< \brief Latest statistics of all regions. */
+};
+static const MapType<std::string, PROFILING_FORMAT> Profiling_Format_Map = {
+  MakePair("CSV", PROFILING_FORMAT::CSV)
+  MakePair("JSON", PROFILING_FORMAT::JSON)
+};
+
 /*!
  * \brief Return true if format is one of the Paraview options.
  */
@@ -2279,6 +2293,7 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  AMG,            /*!< \brief Algebraic multigrid (smoothed by l1-Jacobi) preconditioner. */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -2288,6 +2303,7 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("AMG", AMG)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
@@ -2601,6 +2617,38 @@ static const MapType<std::string, POD_KIND> POD_Map = {
   MakePair("INCREMENTAL_POD", POD_KIND::INCREMENTAL)
 };
 
+/*!
+ * \brief Parameters that define the position of a restart in the parameter space of RESTART_BLEND_FILES.
+ */
+enum class BLEND_PARAM {
+  MACH,                  /*!< \brief Mach number. */
+  AOA,                   /*!< \brief Angle of attack. */
+  SIDESLIP,              /*!< \brief Angle of sideslip. */
+  REYNOLDS,              /*!< \brief Reynolds number. */
+  FREESTREAM_PRESSURE,   /*!< \brief Free-stream pressure. */
+  FREESTREAM_TEMPERATURE,/*!< \brief Free-stream temperature. */
+};
+static const MapType<std::string, BLEND_PARAM> Blend_Param_Map = {
+  MakePair("MACH_NUMBER",            BLEND_PARAM::MACH)
+  MakePair("AOA",                    BLEND_PARAM::AOA)
+  MakePair("SIDESLIP_ANGLE",         BLEND_PARAM::SIDESLIP)
+  MakePair("REYNOLDS_NUMBER",        BLEND_PARAM::REYNOLDS)
+  MakePair("FREESTREAM_PRESSURE",    BLEND_PARAM::FREESTREAM_PRESSURE)
+  MakePair("FREESTREAM_TEMPERATURE", BLEND_PARAM::FREESTREAM_TEMPERATURE)
+};
+
+/*!
+ * \brief Type of reduced-order model used to solve the flow equations.
+ */
+enum class ROM_KIND {
+  NONE,              /*!< \brief Full-order model. */
+  POD_LSPG,          /*!< \brief Least-squares Petrov-Galerkin projection onto a POD basis. */
+};
+static const MapType<std::string, ROM_KIND> ROM_Map = {
+  MakePair("NONE",     ROM_KIND::NONE)
+  MakePair("POD_LSPG", ROM_KIND::POD_LSPG)
+};
+
 /*!
  * \brief Type of operation for the linear system solver, changes the source of solver options.
  */
@@ -42,6 +42,7 @@
 #endif
 
 #include "omp_structure.hpp"
+#include "../toolboxes/CCommProfiler.hpp"
 
 /* Depending on the compiler, define the correct macro to get the current function name */
 
@@ -84,6 +85,30 @@ class CBaseMPIWrapper;
 typedef CBaseMPIWrapper SU2_MPI;
 #endif  // defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
 
+/*!
+ * \brief RAII helper that reports the size and duration of a collective to CCommProfiler, when it is enabled.
+ */
+class CCollectiveTimer {
+ private:
+  int kind = -1;
+  double bytes = 0.0, start = 0.0;
+
+ public:
+  CCollectiveTimer(int collective, long count, MPI_Datatype datatype) {
+    if (!CCommProfiler::IsEnabled()) return;
+    int size = 0;
+    MPI_Type_size(datatype, &size);
+    kind = collective;
+    bytes = static_cast<double>(count) * size;
+    start = CCommProfiler::Time();
+  }
+  ~CCollectiveTimer() {
+    if (kind >= 0) CCommProfiler::AddCollective(kind, bytes, CCommProfiler::Time() - start);
+  }
+  CCollectiveTimer(const CCollectiveTimer&) = delete;
+  CCollectiveTimer& operator=(const CCollectiveTimer&) = delete;
+};
+
 /*!
  * \class CMPIWrapper
  * \brief Class for defining the MPI wrapper routines; this class features as a base class for
@@ -104,6 +129,16 @@ class CBaseMPIWrapper {
   static bool winMinRankErrorInUse;
   static Win winMinRankError;
 
+  /*--- Total count sent by an all-to-all-v, only computed when the communication is profiled. ---*/
+  static inline long CollectiveCount(const int* counts, Comm comm) {
+    if (!CCommProfiler::IsEnabled()) return 0;
+    int size = 0;
+    MPI_Comm_size(comm, &size);
+    long total = 0;
+    for (int i = 0; i < size; ++i) total += counts[i];
+    return total;
+  }
+
  public:
   static void CopyData(const void* sendbuf, void* recvbuf, int size, Datatype datatype, int recvshift = 0,
                        int sendshift = 0);
@@ -156,7 +191,10 @@ class CBaseMPIWrapper {
     MPI_Finalize();
   }
 
-  static inline void Barrier(Comm comm) { MPI_Barrier(comm); }
+  static inline void Barrier(Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::BARRIER, 0, MPI_CHAR);
+    MPI_Barrier(comm);
+  }
 
   static inline void Abort(Comm comm, int error) { MPI_Abort(comm, error); }
 
@@ -196,46 +234,61 @@ class CBaseMPIWrapper {
   }
 
   static inline void Bcast(void* buf, int count, Datatype datatype, int root, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::BCAST, count, datatype);
     MPI_Bcast(buf, count, datatype, root, comm);
   }
 
   static inline void Reduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, int root,
                             Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::REDUCE, count, datatype);
     MPI_Reduce(sendbuf, recvbuf, count, datatype, op, root, comm);
   }
 
   static inline void Allreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::ALLREDUCE, count, datatype);
     MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
   }
 
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::GATHER, sendcnt, sendtype);
     MPI_Gather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
   }
 
+  static inline void Gatherv(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, const int* recvcnt,
+                             const int* displs, Datatype recvtype, int root, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::GATHERV, sendcnt, sendtype);
+    MPI_Gatherv(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, displs, recvtype, root, comm);
+  }
+
   static inline void Scatter(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                              Datatype recvtype, int root, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::SCATTER, sendcnt, sendtype);
     MPI_Scatter(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
   }
 
   static inline void Allgather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                                Datatype recvtype, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::ALLGATHER, sendcnt, sendtype);
     MPI_Allgather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, comm);
   }
 
   static inline void Allgatherv(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf,
                                 const int* recvcounts, const int* displs, Datatype recvtype, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::ALLGATHERV, sendcount, sendtype);
     MPI_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm);
   }
 
   static inline void Alltoall(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf, int recvcount,
                               Datatype recvtype, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::ALLTOALL, sendcount, sendtype);
     MPI_Alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm);
   }
 
   static inline void Alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls, Datatype sendtype,
                                void* recvbuf, const int* recvcounts, const int* recvdispls, Datatype recvtype,
                                Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::ALLTOALLV, CollectiveCount(sendcounts, comm), sendtype);
     MPI_Alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, recvdispls, recvtype, comm);
   }
 
@@ -359,7 +412,10 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Finalize();
   }
 
-  static inline void Barrier(Comm comm) { AMPI_Barrier(convertComm(comm)); }
+  static inline void Barrier(Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::BARRIER, 0, MPI_CHAR);
+    AMPI_Barrier(convertComm(comm));
+  }
 
   static inline void Abort(Comm comm, int error) { AMPI_Abort(convertComm(comm), error); }
 
@@ -401,44 +457,59 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
   }
 
   static inline void Bcast(void* buf, int count, Datatype datatype, int root, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::BCAST, count, datatype);
     AMPI_Bcast(buf, count, convertDatatype(datatype), root, convertComm(comm));
   }
 
   static inline void Reduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, int root,
                             Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::REDUCE, count, datatype);
     AMPI_Reduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), root, convertComm(comm));
   }
 
   static inline void Allreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::ALLREDUCE, count, datatype);
     AMPI_Allreduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), convertComm(comm));
   }
 
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::GATHER, sendcnt, sendtype);
     AMPI_Gather(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, convertDatatype(recvtype), root,
                 convertComm(comm));
   }
 
+  static inline void Gatherv(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, const int* recvcnt,
+                             const int* displs, Datatype recvtype, int root, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::GATHERV, sendcnt, sendtype);
+    AMPI_Gatherv(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, displs, convertDatatype(recvtype),
+                 root, convertComm(comm));
+  }
+
   static inline void Scatter(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                              Datatype recvtype, int root, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::SCATTER, sendcnt, sendtype);
     AMPI_Scatter(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, convertDatatype(recvtype), root,
                  convertComm(comm));
   }
 
   static inline void Allgather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                                Datatype recvtype, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::ALLGATHER, sendcnt, sendtype);
     AMPI_Allgather(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, convertDatatype(recvtype),
                    convertComm(comm));
   }
 
   static inline void Allgatherv(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf,
                                 const int* recvcounts, const int* displs, Datatype recvtype, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::ALLGATHERV, sendcount, sendtype);
     AMPI_Allgatherv(sendbuf, sendcount, convertDatatype(sendtype), recvbuf, recvcounts, displs,
                     convertDatatype(recvtype), convertComm(comm));
   }
 
   static inline void Alltoall(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf, int recvcount,
                               Datatype recvtype, Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::ALLTOALL, sendcount, sendtype);
     AMPI_Alltoall(sendbuf, sendcount, convertDatatype(sendtype), recvbuf, recvcount, convertDatatype(recvtype),
                   convertComm(comm));
   }
@@ -446,6 +517,7 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
   static inline void Alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls, Datatype sendtype,
                                void* recvbuf, const int* recvcounts, const int* recvdispls, Datatype recvtype,
                                Comm comm) {
+    const CCollectiveTimer timer(CCommProfiler::ALLTOALLV, CollectiveCount(sendcounts, comm), sendtype);
     AMPI_Alltoallv(sendbuf, sendcounts, sdispls, convertDatatype(sendtype), recvbuf, recvcounts, recvdispls,
                    convertDatatype(recvtype), comm);
   }
@@ -567,6 +639,11 @@ class CBaseMPIWrapper {
     CopyData(sendbuf, recvbuf, sendcnt, sendtype);
   }
 
+  static inline void Gatherv(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, const int* recvcnt,
+                             const int* displs, Datatype recvtype, int root, Comm comm) {
+    CopyData(sendbuf, recvbuf, sendcnt, sendtype, displs[0]);
+  }
+
   static inline void Scatter(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                              Datatype recvtype, int root, Comm comm) {
     CopyData(sendbuf, recvbuf, sendcnt, sendtype);
@@ -0,0 +1,240 @@
+/*!
+ * \file CCFLCostController.hpp
+ * \brief Selection of the CFL limit and linear solver settings that maximize the convergence rate per second.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/*!
+ * \brief Adjusts the parameters of a pseudo-time iteration to maximize the residual reduction per second.
+ * \note The iterations are grouped in windows, the owner measures the convergence rate of each window (e.g. orders
+ * of magnitude per second) and passes it to Update. This is a pattern search: after a "base" window, one parameter
+ * is moved by its factor (trial), it is kept if the rate improves by more than a margin, in which case it is moved
+ * again in the same direction, otherwise it is restored, its direction is reversed, and the next parameter is tried
+ * after a new base window. Comparing consecutive windows (rather than against an old reference) makes the search
+ * tolerant of the convergence rate changing slowly over the run. All decisions depend only on the measured rates,
+ * therefore, if these are the same on all ranks so are the parameters. The controller is not thread-safe.
+ * \ingroup Toolboxes
+ */
+class CCFLCostController {
+ public:
+  /*! \brief Parameters that are controlled. */
+  enum PARAMETER : int {
+    CFL_MAX,      /*!< \brief Upper limit of the local CFL numbers. */
+    LINSOL_TOL,   /*!< \brief Tolerance of the linear solver. */
+    LINSOL_ITER,  /*!< \brief Maximum number of linear solver iterations. */
+    PREC_PERIOD,  /*!< \brief Number of linear solves between preconditioner builds. */
+    N_PARAMETERS
+  };
+
+ private:
+  /*! \brief A parameter moves multiplicatively between bounds. */
+  struct Parameter {
+    double value = 1.0;   /*!< \brief Current value. */
+    double lower = 1.0;   /*!< \brief Lower bound, if equal to the upper bound the parameter is fixed. */
+    double upper = 1.0;   /*!< \brief Upper bound. */
+    double factor = 2.0;  /*!< \brief Multiplicative step. */
+    int direction = -1;   /*!< \brief Direction of the next move (+1 up, -1 down). */
+    bool integer = false; /*!< \brief The value is rounded (away from the current value). */
+  };
+
+  std::array<Parameter, N_PARAMETERS> params; /*!< \brief The parameters. */
+  unsigned long windowSize = 10;              /*!< \brief Iterations per window. */
+  unsigned long iteration = 0;                /*!< \brief Iterations in the current window. */
+  unsigned long nWarmup = 0;                  /*!< \brief Windows left before the search starts. */
+  unsigned long sinceBuild = 0;               /*!< \brief Linear solves since the last preconditioner build. */
+  unsigned long nAccepted = 0;                /*!< \brief Number of trials that were kept. */
+  double margin = 0.05;                       /*!< \brief Relative improvement required to keep a trial. */
+  double baseRate = 0.0;                      /*!< \brief Rate of the last window with accepted parameters. */
+  double lastRate = 0.0;                      /*!< \brief Rate of the last window. */
+  double trialPrevious = 0.0;                 /*!< \brief Value of the trial parameter before the move. */
+  int trial = -1;                             /*!< \brief Parameter being tried, -1 for a base window. */
+  int next = 0;                               /*!< \brief Next parameter to try. */
+
+  /*!
+   * \brief Move a parameter one step in its direction.
+   * \return False if it could not be moved (bound reached).
+   */
+  static bool Move(Parameter& p) {
+    double v = p.value * std::pow(p.factor, p.direction);
+    if (p.integer) v = (p.direction > 0) ? std::ceil(v) : std::floor(v);
+    v = std::min(std::max(v, p.lower), p.upper);
+    if (v == p.value) return false;
+    p.value = v;
+    return true;
+  }
+
+  /*!
+   * \brief Try moving a parameter, reversing its direction if allowed and needed.
+   * \return True if a trial was started.
+   */
+  bool TryParameter(int iParam, bool canReverse) {
+    auto& p = params[iParam];
+    if (p.lower >= p.upper) return false;
+    const double previous = p.value;
+    bool moved = Move(p);
+    if (!moved && canReverse) {
+      p.direction = -p.direction;
+      moved = Move(p);
+    }
+    if (moved) {
+      trial = iParam;
+      trialPrevious = previous;
+    }
+    return moved;
+  }
+
+  /*!
+   * \brief Start the next trial, continuing with the same parameter if the last trial was kept.
+   * \param[in] continuing - Whether the last trial was kept.
+   */
+  void StartTrial(bool continuing) {
+    if (continuing && TryParameter(trial, false)) return;
+    if (continuing) next = (trial + 1) % N_PARAMETERS;
+    trial = -1;
+    for (int k = 0; k < N_PARAMETERS; ++k) {
+      if (TryParameter((next + k) % N_PARAMETERS, true)) return;
+    }
+  }
+
+ public:
+  /*!
+   * \brief Reset the search, the parameters must be set afterwards.
+   * \param[in] iterations - Number of iterations per window (at least 1).
+   * \param[in] warmup - Number of windows before the search starts (e.g. to let the CFL ramp up).
+   * \param[in] minImprovement - Relative improvement of the rate required to keep a trial.
+   */
+  void Initialize(unsigned long iterations, unsigned long warmup, double minImprovement) {
+    params = {};
+    windowSize = std::max(iterations, 1ul);
+    nWarmup = warmup;
+    margin = minImprovement;
+    iteration = 0;
+    sinceBuild = 0;
+    nAccepted = 0;
+    baseRate = lastRate = 0.0;
+    trial = -1;
+    next = 0;
+  }
+
+  /*!
+   * \brief Set the initial value and the range of a parameter, the first move is down if possible.
+   * \param[in] iParam - The parameter (PARAMETER).
+   * \param[in] value - Initial value.
+   * \param[in] lower - Lower bound, if it is not less than "upper" the parameter is fixed.
+   * \param[in] upper - Upper bound.
+   * \param[in] factor - Multiplicative step (greater than 1).
+   * \param[in] integer - Whether the value is an integer.
+   */
+  void SetParameter(int iParam, double value, double lower, double upper, double factor, bool integer = false) {
+    auto& p = params[iParam];
+    p.lower = lower;
+    p.upper = std::max(lower, upper);
+    p.value = std::min(std::max(value, p.lower), p.upper);
+    p.factor = factor;
+    p.integer = integer;
+    p.direction = (p.value > p.lower) ? -1 : 1;
+  }
+
+  /*! \brief Current value of a parameter. */
+  inline double GetValue(int iParam) const { return params[iParam].value; }
+
+  /*! \brief Rate of the last complete window. */
+  inline double GetRate() const { return lastRate; }
+
+  /*! \brief Number of trials that were kept. */
+  inline unsigned long GetAccepted() const { return nAccepted; }
+
+  /*! \brief Parameter being tried in the current window, -1 if none. */
+  inline int GetTrial() const { return trial; }
+
+  /*! \brief Whether the search has not started yet, the parameters should not be applied during the warm-up. */
+  inline bool InWarmup() const { return nWarmup > 0; }
+
+  /*!
+   * \brief Count an iteration.
+   * \return True if the window is complete, the owner should then measure the rate and call Update.
+   */
+  inline bool Iterate() { return ++iteration >= windowSize; }
+
+  /*!
+   * \brief Count a linear solve.
+   * \return True if the preconditioner should be built for this solve.
+   */
+  inline bool BuildPreconditioner() {
+    if (sinceBuild == 0 || sinceBuild >= params[PREC_PERIOD].value) {
+      sinceBuild = 1;
+      return true;
+    }
+    ++sinceBuild;
+    return false;
+  }
+
+  /*!
+   * \brief Discard the current window (e.g. because the iteration was restarted), a trial in progress is undone.
+   */
+  void Restart() {
+    iteration = 0;
+    sinceBuild = 0;
+    if (trial >= 0) {
+      params[trial].value = trialPrevious;
+      next = trial;
+      trial = -1;
+    }
+  }
+
+  /*!
+   * \brief Update the parameters at the end of a window.
+   * \param[in] rate - Convergence rate measured for the window (higher is better).
+   */
+  void Update(double rate) {
+    iteration = 0;
+    lastRate = rate;
+
+    if (nWarmup > 0) {
+      --nWarmup;
+      return;
+    }
+    if (trial < 0) {
+      baseRate = rate;
+      StartTrial(false);
+      return;
+    }
+    if (rate > baseRate + margin * std::abs(baseRate)) {
+      baseRate = rate;
+      ++nAccepted;
+      StartTrial(true);
+      return;
+    }
+    /*--- Reject, the next window measures the base rate again. ---*/
+    auto& p = params[trial];
+    p.value = trialPrevious;
+    p.direction = -p.direction;
+    next = (trial + 1) % N_PARAMETERS;
+    trial = -1;
+  }
+};
@@ -0,0 +1,191 @@
+/*!
+ * \file CCommProfiler.hpp
+ * \brief Statistics of the MPI communication, halo exchanges by quantity and collectives by call site.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Accumulates statistics of the MPI communication of the calling rank.
+ * \note Point-to-point exchanges are identified by the quantity communicated (MPI_QUANTITIES for halo
+ * exchanges, PERIODIC_QUANTITIES for periodic ones), for each one the number of calls, messages, neighbors,
+ * bytes sent, and time spent waiting for the messages are recorded, as well as the bytes sent to each rank.
+ * Collectives are reported by the MPI wrappers, their call site is the innermost region of CProfiler that
+ * is open when they are called. Only the master thread records (MPI is used in funneled mode). This header
+ * is included by the MPI wrappers, hence it should not include other SU2 headers.
+ * \ingroup Toolboxes
+ */
+class CCommProfiler {
+ public:
+  /*! \brief Kinds of collectives. */
+  enum COLLECTIVE : int {
+    ALLREDUCE, REDUCE, BCAST, GATHER, GATHERV, SCATTER, ALLGATHER, ALLGATHERV, ALLTOALL, ALLTOALLV, BARRIER,
+    N_COLLECTIVES
+  };
+
+  /*! \brief Number of halo (MPI_QUANTITIES) and periodic (PERIODIC_QUANTITIES) exchange types. */
+  enum : int { N_HALO = 25, N_PERIODIC = 24, N_EXCHANGES = N_HALO + N_PERIODIC };
+
+  /*! \brief Statistics of an exchange type, reduced over ranks. */
+  struct ExchangeStats {
+    std::string name;           /*!< \brief Name of the quantity. */
+    unsigned long calls = 0;    /*!< \brief Number of exchanges (average over ranks). */
+    double messages = 0.0;      /*!< \brief Messages sent per exchange (average over ranks). */
+    double maxNeighbors = 0.0;  /*!< \brief Maximum number of neighbors of a rank. */
+    double sumBytes = 0.0;      /*!< \brief Bytes sent, sum over ranks. */
+    double maxBytes = 0.0;      /*!< \brief Bytes sent, max over ranks. */
+    double avgWait = 0.0;       /*!< \brief Time waiting for messages, average over ranks. */
+    double maxWait = 0.0;       /*!< \brief Time waiting for messages, max over ranks. */
+  };
+
+  /*! \brief Statistics of a kind of collective at a call site, reduced over ranks. */
+  struct CollectiveStats {
+    std::string site;         /*!< \brief Path of the profiler region from which the collective was called. */
+    std::string kind;         /*!< \brief Kind of collective. */
+    unsigned long calls = 0;  /*!< \brief Number of calls (average over ranks). */
+    double bytes = 0.0;       /*!< \brief Bytes contributed by each rank (average over ranks). */
+    double avgTime = 0.0;     /*!< \brief Time in the collective, average over ranks. */
+    double maxTime = 0.0;     /*!< \brief Time in the collective, max over ranks. */
+  };
+
+  /*! \brief Bytes sent in point-to-point exchanges from a rank to another. */
+  struct Volume {
+    int rank = 0;        /*!< \brief Sending rank. */
+    int dest = 0;        /*!< \brief Receiving rank. */
+    double bytes = 0.0;  /*!< \brief Bytes sent. */
+  };
+
+ private:
+  static bool enabled; /*!< \brief Whether communication is being recorded. */
+
+ public:
+  /*!
+   * \brief Enable or disable the profiler and reset all the data (collective).
+   * \note The call sites of the collectives are only known if CProfiler is enabled, in which case this
+   * should be called after CProfiler::Initialize.
+   * \param[in] enable - Whether to record the communication.
+   */
+  static void Initialize(bool enable);
+
+  /*! \brief Whether the profiler is enabled. */
+  static inline bool IsEnabled() { return enabled; }
+
+  /*! \brief Current time in seconds. */
+  static inline double Time() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  /*! \brief Identifier of a halo exchange. */
+  static inline int HaloId(unsigned short commType) { return commType; }
+
+  /*! \brief Identifier of a periodic exchange. */
+  static inline int PeriodicId(unsigned short commType) { return N_HALO + commType; }
+
+  /*!
+   * \brief Record the start of an exchange.
+   * \param[in] id - Identifier of the exchange (see HaloId and PeriodicId).
+   * \param[in] nNeighbors - Number of ranks to which messages are sent.
+   */
+  static void AddExchange(int id, int nNeighbors);
+
+  /*!
+   * \brief Record a message of an exchange.
+   * \param[in] id - Identifier of the exchange.
+   * \param[in] dest - Rank to which the message is sent.
+   * \param[in] bytes - Size of the message.
+   */
+  static void AddMessage(int id, int dest, double bytes);
+
+  /*!
+   * \brief Record the time spent waiting for the messages of an exchange.
+   * \param[in] id - Identifier of the exchange.
+   * \param[in] time - Time spent waiting.
+   */
+  static void AddWait(int id, double time);
+
+  /*!
+   * \brief Record a collective, this is done by the MPI wrappers.
+   * \param[in] kind - Kind of collective (COLLECTIVE).
+   * \param[in] bytes - Bytes contributed by the rank.
+   * \param[in] time - Time spent in the collective.
+   */
+  static void AddCollective(int kind, double bytes, double time);
+
+  /*!
+   * \brief Reduce the statistics over ranks (collective, outside parallel regions).
+   * \param[out] exchanges - Statistics of the exchange types used by any rank.
+   * \param[out] collectives - Statistics of the collectives by call site, sorted by decreasing max time.
+   * \param[out] volumes - Non-zero rank-to-rank volumes, sorted by rank and destination, only on the master rank.
+   */
+  static void Reduce(std::vector<ExchangeStats>& exchanges, std::vector<CollectiveStats>& collectives,
+                     std::vector<Volume>& volumes);
+
+  /*!
+   * \brief Print the statistics to the screen (collective).
+   */
+  static void Print();
+
+  /*!
+   * \brief Write the statistics to CSV files (collective).
+   * \note The exchanges and collectives are written to "fileName_comms.csv" and the non-zero rank-to-rank
+   * volumes (one line per pair of ranks) to "fileName_comm_matrix.csv", both are overwritten.
+   * \param[in] fileName - Base name of the files.
+   */
+  static void Write(const std::string& fileName);
+};
+
+/*!
+ * \brief RAII helper to time the wait for the messages of an exchange.
+ * \ingroup Toolboxes
+ */
+class CCommWaitTimer {
+ private:
+  int id = -1;
+  double start = 0.0;
+
+ public:
+  explicit CCommWaitTimer(int exchangeId) {
+    if (CCommProfiler::IsEnabled()) {
+      id = exchangeId;
+      start = CCommProfiler::Time();
+    }
+  }
+  ~CCommWaitTimer() {
+    if (id >= 0) CCommProfiler::AddWait(id, CCommProfiler::Time() - start);
+  }
+  CCommWaitTimer(const CCommWaitTimer&) = delete;
+  CCommWaitTimer& operator=(const CCommWaitTimer&) = delete;
+};
+
+#define SU2_COMM_CONCAT_(A, B) A##B
+#define SU2_COMM_CONCAT(A, B) SU2_COMM_CONCAT_(A, B)
+
+/*!
+ * \brief Time the rest of the enclosing scope as waiting for the messages of an exchange.
+ * \param[in] ID - Identifier of the exchange (see CCommProfiler::HaloId and CCommProfiler::PeriodicId).
+ */
+#define SU2_COMM_WAIT(ID) const CCommWaitTimer SU2_COMM_CONCAT(su2_comm_wait_, __LINE__)(ID)
@@ -0,0 +1,114 @@
+/*!
+ * \file CHardwareCounters.hpp
+ * \brief Per-thread hardware performance counters based on Linux perf_event_open.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Hardware counters of the calling thread (user space only), used by CProfiler.
+ * \note The generic events (cycles, instructions, last level cache references and misses) are always
+ * requested, CPU-specific events (e.g. packed/scalar floating point instructions to measure the degree of
+ * vectorization) can be added as raw event codes. The events are opened individually (not as a group) so
+ * that they can be multiplexed by the kernel when there are more events than hardware counters, the values
+ * are scaled accordingly. On platforms other than Linux, opening the counters always fails.
+ * \ingroup Toolboxes
+ */
+class CHardwareCounters {
+ public:
+  enum : int { MAX_EVENTS = 8 }; /*!< \brief Maximum number of events (generic + raw). */
+
+  /*! \brief Raw values of the counters at some point in time. */
+  struct Reading {
+    double value[MAX_EVENTS] = {};   /*!< \brief Counts. */
+    double enabled[MAX_EVENTS] = {}; /*!< \brief Time during which the event was enabled. */
+    double running[MAX_EVENTS] = {}; /*!< \brief Time during which the event was counted. */
+  };
+
+ private:
+  std::vector<int> fds; /*!< \brief File descriptors of the events. */
+
+ public:
+  CHardwareCounters() = default;
+
+  /*--- The counters own file descriptors, they can be moved but not copied. ---*/
+  CHardwareCounters(const CHardwareCounters&) = delete;
+  CHardwareCounters& operator=(const CHardwareCounters&) = delete;
+
+  CHardwareCounters(CHardwareCounters&& other) noexcept : fds(std::move(other.fds)) { other.fds.clear(); }
+
+  CHardwareCounters& operator=(CHardwareCounters&& other) noexcept {
+    if (this != &other) {
+      Close();
+      fds = std::move(other.fds);
+      other.fds.clear();
+    }
+    return *this;
+  }
+
+  /*! \brief Closes the counters that are still open. */
+  ~CHardwareCounters() { Close(); }
+
+  /*!
+   * \brief Names of the events that are opened for a set of raw events.
+   * \param[in] rawEvents - CPU-specific event codes.
+   */
+  static std::vector<std::string> EventNames(const std::vector<unsigned long>& rawEvents);
+
+  /*!
+   * \brief Open the counters for the calling thread.
+   * \param[in] rawEvents - CPU-specific event codes, at most MAX_EVENTS minus the number of generic events.
+   * \return Empty string on success, otherwise the reason for the failure.
+   */
+  std::string Open(const std::vector<unsigned long>& rawEvents);
+
+  /*! \brief Close the counters (can be called from any thread). */
+  void Close();
+
+  /*! \brief Number of open events. */
+  inline int GetnEvents() const { return fds.size(); }
+
+  /*!
+   * \brief Read the counters of the thread that opened them.
+   * \param[out] reading - Values of the counters.
+   */
+  void Read(Reading& reading) const;
+
+  /*!
+   * \brief Accumulate the counts between two readings, scaled to compensate for multiplexing.
+   * \param[in] start - Initial reading.
+   * \param[in] end - Final reading.
+   * \param[in,out] counts - Accumulated counts of each event.
+   */
+  void AddDelta(const Reading& start, const Reading& end, double* counts) const {
+    for (int i = 0; i < GetnEvents(); ++i) {
+      const double running = end.running[i] - start.running[i];
+      const double enabled = end.enabled[i] - start.enabled[i];
+      if (running > 0) counts[i] += (end.value[i] - start.value[i]) * (enabled / running);
+    }
+  }
+};
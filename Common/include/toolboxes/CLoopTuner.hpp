@@ -0,0 +1,92 @@
+/*!
+ * \file CLoopTuner.hpp
+ * \brief Selection of a loop parameter (e.g. a chunk size) from measured run times.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+/*!
+ * \brief Tries each candidate value of a loop parameter for a number of calls and keeps the fastest.
+ * \note The owner of the loop applies GetValue before each call and passes the time of the call to Record.
+ * The first calls with each value are not timed (warm-up), the time of a candidate is the minimum over the
+ * timed calls, which is less sensitive to noise than the average. The tuner is not thread-safe, it should be
+ * used by the master thread (with the other threads synchronized when the value changes).
+ * \ingroup Toolboxes
+ */
+class CLoopTuner {
+ private:
+  std::vector<unsigned long> candidates; /*!< \brief Values being tried. */
+  std::vector<double> times;             /*!< \brief Best time of each candidate. */
+  unsigned long nWarmup = 0;             /*!< \brief Number of calls that are not timed. */
+  unsigned long nSamples = 0;            /*!< \brief Number of calls that are timed. */
+  unsigned long iCandidate = 0;          /*!< \brief Current candidate. */
+  unsigned long iCall = 0;               /*!< \brief Calls with the current candidate. */
+  bool tuning = false;                   /*!< \brief Whether candidates are still being tried. */
+
+ public:
+  /*!
+   * \brief Start tuning, the first candidate is used first and should be the default value.
+   * \param[in] values - Candidate values, if there is only one there is nothing to tune.
+   * \param[in] warmup - Number of calls with each value that are not timed.
+   * \param[in] samples - Number of calls with each value that are timed (at least 1).
+   */
+  void Initialize(std::vector<unsigned long> values, unsigned long warmup, unsigned long samples) {
+    candidates = std::move(values);
+    times.assign(candidates.size(), std::numeric_limits<double>::max());
+    nWarmup = warmup;
+    nSamples = std::max(samples, 1ul);
+    iCandidate = 0;
+    iCall = 0;
+    tuning = candidates.size() > 1;
+  }
+
+  /*! \brief Whether the calls should be timed. */
+  inline bool IsTuning() const { return tuning; }
+
+  /*! \brief Value to use in the next call. */
+  inline unsigned long GetValue() const { return candidates.empty() ? 0 : candidates[iCandidate]; }
+
+  /*!
+   * \brief Record the time of a call made with the current value.
+   * \param[in] time - Run time of the call.
+   * \return True if the value to use in the next call is different.
+   */
+  bool Record(double time) {
+    if (!tuning) return false;
+
+    if (iCall >= nWarmup) times[iCandidate] = std::min(times[iCandidate], time);
+    if (++iCall < nWarmup + nSamples) return false;
+
+    const auto previous = GetValue();
+    iCall = 0;
+    if (++iCandidate == candidates.size()) {
+      iCandidate = std::min_element(times.begin(), times.end()) - times.begin();
+      tuning = false;
+    }
+    return GetValue() != previous;
+  }
+};
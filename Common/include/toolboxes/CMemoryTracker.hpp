@@ -0,0 +1,156 @@
+/*!
+ * \file CMemoryTracker.hpp
+ * \brief Accounting of the memory allocated by each subsystem (owner).
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Tracks the current and peak memory of each owner (geometry, Jacobian, etc.) in the calling rank.
+ * \note The allocations of MemoryAllocation::aligned_alloc (and so of C2DContainer, CSysVector, CSysMatrix)
+ * are attributed to the owner that is current when they are made, which is set with CMemoryScope (see
+ * SU2_MEMORY_SCOPE). Memory managed by other means can be accounted explicitly with Account.
+ * The owner set outside parallel regions applies to all threads, an owner set inside a parallel region only
+ * applies to the calling thread (until it is restored).
+ * \ingroup Toolboxes
+ */
+class CMemoryTracker {
+ public:
+  enum : int { MAX_OWNERS = 64 }; /*!< \brief Maximum number of owners, additional ones are counted as "Other". */
+
+  /*! \brief Statistics of an owner, reduced over ranks. */
+  struct OwnerStats {
+    std::string name;       /*!< \brief Name of the owner. */
+    double sumCurrent = 0;  /*!< \brief Current memory, sum over ranks. */
+    double maxCurrent = 0;  /*!< \brief Current memory, max over ranks. */
+    double sumPeak = 0;     /*!< \brief High-water mark, sum over ranks. */
+    double maxPeak = 0;     /*!< \brief High-water mark, max over ranks. */
+  };
+
+ private:
+  static const char* names[MAX_OWNERS];                 /*!< \brief Names of the owners (string literals). */
+  static std::atomic<int> nOwners;                      /*!< \brief Number of owners registered. */
+  static std::atomic<int> sharedOwner;                  /*!< \brief Owner set outside parallel regions. */
+  static thread_local int threadOwner;                  /*!< \brief Owner of the thread, -1 to use the shared one. */
+  static std::atomic<long long> current[MAX_OWNERS + 1]; /*!< \brief Current bytes, the last entry is the total. */
+  static std::atomic<long long> peak[MAX_OWNERS + 1];    /*!< \brief Peak bytes, the last entry is the total. */
+
+  /*! \brief Update a high-water mark. */
+  static inline void UpdatePeak(std::atomic<long long>& mark, long long value) {
+    auto prev = mark.load(std::memory_order_relaxed);
+    while (prev < value && !mark.compare_exchange_weak(prev, value, std::memory_order_relaxed)) {
+    }
+  }
+
+ public:
+  /*!
+   * \brief Get the index of an owner, registering it if needed (thread-safe).
+   * \param[in] name - Name of the owner (string literal, the pointer is stored).
+   */
+  static int GetOwner(const char* name);
+
+  /*! \brief Get the owner of the allocations being made. */
+  static inline int GetCurrentOwner() {
+    const int owner = threadOwner;
+    return owner >= 0 ? owner : sharedOwner.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * \brief Set the owner of the allocations being made, for all threads if called outside parallel regions,
+   * otherwise for the calling thread.
+   * \return The previous owner (to be restored by the same thread).
+   */
+  static int SetCurrentOwner(int owner);
+
+  /*!
+   * \brief Record an allocation (positive bytes) or deallocation (negative bytes), thread-safe.
+   * \param[in] owner - Index of the owner.
+   * \param[in] bytes - Change of the allocated memory.
+   */
+  static inline void Record(int owner, long long bytes) {
+    const auto ownerBytes = current[owner].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    const auto totalBytes = current[MAX_OWNERS].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    if (bytes > 0) {
+      UpdatePeak(peak[owner], ownerBytes);
+      UpdatePeak(peak[MAX_OWNERS], totalBytes);
+    }
+  }
+
+  /*!
+   * \brief Account for memory not allocated via MemoryAllocation (e.g. with new[]).
+   * \param[in] name - Name of the owner (string literal).
+   * \param[in] bytes - Change of the allocated memory.
+   */
+  static inline void Account(const char* name, long long bytes) { Record(GetOwner(name), bytes); }
+
+  /*!
+   * \brief Set the memory of an owner that is measured rather than tracked (e.g. the AD tape).
+   * \param[in] name - Name of the owner (string literal).
+   * \param[in] bytes - Current memory of the owner.
+   */
+  static inline void Set(const char* name, long long bytes) {
+    const int owner = GetOwner(name);
+    Record(owner, bytes - current[owner].load(std::memory_order_relaxed));
+  }
+
+  /*!
+   * \brief Reduce the statistics of all owners over ranks (collective).
+   * \param[out] total - Statistics of the total tracked memory.
+   * \return Statistics of the owners with non-zero peak, sorted by decreasing peak.
+   */
+  static std::vector<OwnerStats> Reduce(OwnerStats& total);
+
+  /*!
+   * \brief Print a table of the memory used by each owner (collective).
+   * \param[in] title - When the report is printed, e.g. "after preprocessing".
+   */
+  static void Print(const std::string& title);
+};
+
+/*!
+ * \brief RAII helper that attributes the allocations made until the end of the scope to an owner.
+ * \ingroup Toolboxes
+ */
+class CMemoryScope {
+ private:
+  int previous;
+
+ public:
+  explicit CMemoryScope(const char* name) : previous(CMemoryTracker::SetCurrentOwner(CMemoryTracker::GetOwner(name))) {}
+  ~CMemoryScope() { CMemoryTracker::SetCurrentOwner(previous); }
+  CMemoryScope(const CMemoryScope&) = delete;
+  CMemoryScope& operator=(const CMemoryScope&) = delete;
+};
+
+#define SU2_MEMORY_CONCAT_(A, B) A##B
+#define SU2_MEMORY_CONCAT(A, B) SU2_MEMORY_CONCAT_(A, B)
+
+/*!
+ * \brief Attribute the allocations made in the rest of the enclosing scope to an owner.
+ * \param[in] NAME - Name of the owner (string literal).
+ */
+#define SU2_MEMORY_SCOPE(NAME) const CMemoryScope SU2_MEMORY_CONCAT(su2_memory_scope_, __LINE__)(NAME)
@@ -0,0 +1,115 @@
+/*!
+ * \file CPODBasis.hpp
+ * \brief Proper orthogonal decomposition (POD) basis of a set of distributed solution snapshots.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <vector>
+#include "../containers/C2DContainer.hpp"
+#include "../parallelization/mpi_structure.hpp"
+
+/*!
+ * \brief Affine POD basis, u = u_ref + sum_k q_k phi_k, of snapshots distributed over the MPI ranks.
+ * \note The basis is computed with the method of snapshots, i.e. from the eigen-decomposition of the
+ * (small) correlation matrix of the snapshots, which only requires one global reduction. The reference
+ * state is the mean of the snapshots, and the inner product is scaled per variable (by the RMS of the
+ * reference state) so that variables with different magnitudes contribute evenly to the modes.
+ * The modes are orthonormal w.r.t. that inner product.
+ * \ingroup BLAS
+ */
+class CPODBasis {
+ private:
+  su2passivematrix reference;           /*!< \brief Reference (mean) state, nPoint x nVar. */
+  std::vector<su2passivematrix> modes;  /*!< \brief POD modes, each nPoint x nVar. */
+  su2passivevector weights;             /*!< \brief Inner product weight of each variable. */
+  su2passivevector eigenvalues;         /*!< \brief Eigenvalues (energy) of the retained modes. */
+  passivedouble energyFraction = 0.0;   /*!< \brief Fraction of the snapshot energy captured by the modes. */
+
+ public:
+  /*!
+   * \brief Compute the basis from a set of snapshots.
+   * \param[in] snapshots - Snapshots (local points x variables), all with the same shape.
+   * \param[in] maxModes - Maximum number of modes to keep.
+   * \param[in] tolerance - Modes with eigenvalues below tolerance times the largest one are discarded.
+   */
+  void Build(const std::vector<su2passivematrix>& snapshots, unsigned long maxModes, passivedouble tolerance = 1e-12);
+
+  /*! \brief Number of modes. */
+  inline unsigned long GetnModes() const { return modes.size(); }
+
+  /*! \brief Number of (local) points. */
+  inline unsigned long GetnPoint() const { return reference.rows(); }
+
+  /*! \brief Number of variables per point. */
+  inline unsigned long GetnVar() const { return reference.cols(); }
+
+  /*! \brief Reference state. */
+  inline const su2passivematrix& GetReference() const { return reference; }
+
+  /*! \brief Mode iMode. */
+  inline const su2passivematrix& GetMode(unsigned long iMode) const { return modes[iMode]; }
+
+  /*! \brief Inner product weight of a variable. */
+  inline passivedouble GetWeight(unsigned long iVar) const { return weights[iVar]; }
+
+  /*! \brief Eigenvalue of mode iMode. */
+  inline passivedouble GetEigenvalue(unsigned long iMode) const { return eigenvalues[iMode]; }
+
+  /*! \brief Fraction of the energy of the snapshots captured by the modes. */
+  inline passivedouble GetEnergyFraction() const { return energyFraction; }
+
+  /*!
+   * \brief Project a state onto the basis (includes a global reduction).
+   * \param[in] state - Accessor to the state, state(iPoint, iVar).
+   * \param[out] coords - Reduced coordinates, size GetnModes().
+   */
+  template <class StateAccessor>
+  void Project(const StateAccessor& state, passivedouble* coords) const {
+    std::vector<passivedouble> local(GetnModes(), 0.0);
+    for (auto iMode = 0ul; iMode < GetnModes(); ++iMode) {
+      for (auto iPoint = 0ul; iPoint < GetnPoint(); ++iPoint) {
+        for (auto iVar = 0ul; iVar < GetnVar(); ++iVar) {
+          local[iMode] += weights[iVar] * modes[iMode](iPoint, iVar) * (state(iPoint, iVar) - reference(iPoint, iVar));
+        }
+      }
+    }
+    SelectMPIWrapper<passivedouble>::W::Allreduce(local.data(), coords, GetnModes(), MPI_DOUBLE, MPI_SUM,
+                                                  SU2_MPI::GetComm());
+  }
+
+  /*!
+   * \brief Reconstruct the state of a point from reduced coordinates.
+   * \param[in] iPoint - Local index of the point.
+   * \param[in] coords - Reduced coordinates, size GetnModes().
+   * \param[out] state - State of the point, size GetnVar().
+   */
+  template <class Vector>
+  void Reconstruct(unsigned long iPoint, const passivedouble* coords, Vector& state) const {
+    for (auto iVar = 0ul; iVar < GetnVar(); ++iVar) {
+      passivedouble val = reference(iPoint, iVar);
+      for (auto iMode = 0ul; iMode < GetnModes(); ++iMode) val += coords[iMode] * modes[iMode](iPoint, iVar);
+      state[iVar] = val;
+    }
+  }
+};
@@ -0,0 +1,276 @@
+/*!
+ * \file CProfiler.hpp
+ * \brief Hierarchical, thread-aware runtime profiler based on scoped regions.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include "../parallelization/omp_structure.hpp"
+#include "../option_structure.hpp"
+#include "CHardwareCounters.hpp"
+
+/*!
+ * \brief Runtime profiler, accumulates the wall time spent in named regions that can be nested.
+ * \note Regions are entered and left via CProfileRegion (see SU2_PROFILE_REGION). Each thread accumulates
+ * into its own tree of regions, the regions entered by the worker threads of a parallel region are nested
+ * under the regions that the master thread had open when the parallel region started. When the profiler
+ * is disabled, entering a region only costs the check of a flag.
+ * The report is reduced over threads (slowest thread) and over MPI ranks (min/avg/max). For regions
+ * entered by several threads, e.g. worksharing loops timed with SU2_OMP_FOR_DYN_PROFILED, the load
+ * imbalance between threads is also reported.
+ * Optionally, hardware counters (see CHardwareCounters) are read when regions are entered and left, their
+ * counts are summed over threads and ranks. If the counters cannot be opened on some thread, they are not
+ * reported and only the times are.
+ * Regions that declare their work (see AddWork) can be compared with the limits of the machine measured by
+ * MeasureMachine (roofline analysis), i.e. their arithmetic intensity, achieved bandwidth and flop rate.
+ * \ingroup Toolboxes
+ */
+class CProfiler {
+ public:
+  /*! \brief Statistics of a region, reduced over threads and ranks. */
+  struct RegionStats {
+    std::string path;          /*!< \brief Names of the region and its parents separated by "/". */
+    unsigned short depth = 0;  /*!< \brief Nesting level, 0 for top level regions. */
+    unsigned long calls = 0;   /*!< \brief Number of calls (average over ranks). */
+    double minTime = 0.0;      /*!< \brief Minimum over ranks of the time spent in the region. */
+    double avgTime = 0.0;      /*!< \brief Average over ranks of the time spent in the region. */
+    double maxTime = 0.0;      /*!< \brief Maximum over ranks of the time spent in the region. */
+    double imbalance = 0.0;    /*!< \brief Slowest over average thread minus one, max over ranks. */
+    double bytes = 0.0;        /*!< \brief Bytes moved, as declared via AddWork (sum over ranks). */
+    double flops = 0.0;        /*!< \brief Floating point operations, as declared via AddWork (sum over ranks). */
+    std::vector<double> counts;  /*!< \brief Hardware counts (sum over threads and ranks), empty if unavailable. */
+  };
+
+  /*! \brief Accumulated totals of the regions with a given name, in the calling rank. */
+  struct RegionTotals {
+    double time = 0.0;        /*!< \brief Time spent in the regions. */
+    double bytes = 0.0;       /*!< \brief Bytes moved, as declared via AddWork. */
+    double flops = 0.0;       /*!< \brief Floating point operations, as declared via AddWork. */
+    unsigned long calls = 0;  /*!< \brief Number of calls. */
+  };
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Region {
+    const char* name = nullptr;  /*!< \brief Name, string literals are expected (the pointer is stored). */
+    int parent = -1;             /*!< \brief Index of the parent region. */
+    std::vector<int> children;   /*!< \brief Indices of the children. */
+    double time = 0.0;           /*!< \brief Accumulated time. */
+    double bytes = 0.0;          /*!< \brief Accumulated bytes moved. */
+    double flops = 0.0;          /*!< \brief Accumulated floating point operations. */
+    unsigned long calls = 0;     /*!< \brief Number of calls. */
+    double counts[CHardwareCounters::MAX_EVENTS] = {};  /*!< \brief Accumulated hardware counts. */
+  };
+
+  struct ThreadData {
+    std::vector<Region> tree;  /*!< \brief Regions of the thread, the root (index 0) is not a region. */
+    int current = 0;           /*!< \brief Innermost open region. */
+    int depth = 0;             /*!< \brief Number of open regions. */
+    CHardwareCounters counters;  /*!< \brief Hardware counters of the thread. */
+    int countersState = 0;       /*!< \brief 0 if not opened yet, 1 if open, -1 if unavailable. */
+    std::string countersError;   /*!< \brief Why the counters could not be opened. */
+    std::vector<CHardwareCounters::Reading> readings;  /*!< \brief Counters when the open regions were entered. */
+    char padding[64];          /*!< \brief Avoids false sharing between threads. */
+  };
+
+  static bool enabled;                         /*!< \brief Whether regions are timed. */
+  static std::vector<ThreadData> threads;      /*!< \brief Per-thread data. */
+  static std::vector<const char*> forkPath;    /*!< \brief Regions open in the master thread, outside parallel. */
+  static Clock::time_point startTime;          /*!< \brief Time at which the profiler was (re)started. */
+  static bool useCounters;                     /*!< \brief Whether hardware counters are requested. */
+  static bool countersWarned;                  /*!< \brief Whether the unavailability of the counters was reported. */
+  static std::vector<unsigned long> rawEvents; /*!< \brief CPU-specific events requested in addition. */
+  static double streamBandwidth;               /*!< \brief STREAM triad bandwidth (B/s, sum over ranks). */
+  static double peakFlops;                     /*!< \brief Attainable flop rate (flop/s, sum over ranks). */
+
+  /*! \brief Find or create the child "name" of region "parent" in "tree". */
+  static int FindChild(std::vector<Region>& tree, int parent, const char* name);
+
+ public:
+  /*!
+   * \brief Enable or disable the profiler and reset all the data, must be called outside parallel regions.
+   * \param[in] enable - Whether to time the regions.
+   * \param[in] counters - Whether to also read hardware counters.
+   * \param[in] raw - CPU-specific events, as decimal or hexadecimal (0x prefix) codes.
+   */
+  static void Initialize(bool enable, bool counters = false, const std::vector<std::string>& raw = {});
+
+  /*!
+   * \brief Measure the memory bandwidth (STREAM triad) and the attainable flop rate of each rank, with all the
+   * threads of all ranks running concurrently, for the roofline analysis of Print (collective, outside parallel
+   * regions).
+   * \note The flop rate is that of an in-cache multiply-add loop as vectorized by the compiler, i.e. the peak
+   * that this build can attain rather than the nominal peak of the processor.
+   */
+  static void MeasureMachine();
+
+  /*! \brief Names of the hardware counters of RegionStats::counts. */
+  static inline std::vector<std::string> GetCounterNames() { return CHardwareCounters::EventNames(rawEvents); }
+
+  /*! \brief Whether the profiler is enabled. */
+  static inline bool IsEnabled() { return enabled; }
+
+  /*! \brief Current time in seconds. */
+  static inline double Time() { return std::chrono::duration<double>(Clock::now().time_since_epoch()).count(); }
+
+  /*!
+   * \brief Open a region in the calling thread.
+   * \param[in] name - Name of the region (string literal).
+   * \return Index of the region, to be passed to Leave, or -1 if the region is not timed.
+   */
+  static int Enter(const char* name);
+
+  /*!
+   * \brief Close a region of the calling thread.
+   * \param[in] region - Index returned by Enter.
+   * \param[in] elapsed - Time spent in the region.
+   */
+  static void Leave(int region, double elapsed);
+
+  /*!
+   * \brief Add work to the innermost open region of the master thread, used to compute achieved rates.
+   * \note Can be called by all threads, only the master thread counts, thus the work of the entire rank
+   * should be passed.
+   * \param[in] bytes - Bytes moved to/from memory (estimate).
+   * \param[in] flops - Floating point operations.
+   */
+  static inline void AddWork(double bytes, double flops) {
+    if (!enabled || omp_get_thread_num() != 0 || threads.empty()) return;
+    auto& data = threads[0];
+    if (data.depth == 0) return;
+    data.tree[data.current].bytes += bytes;
+    data.tree[data.current].flops += flops;
+  }
+
+  /*!
+   * \brief Innermost open region of the master thread, 0 if there is none or if the profiler is disabled.
+   */
+  static inline int GetCurrentRegion() {
+    if (!enabled || threads.empty()) return 0;
+    return threads[0].current;
+  }
+
+  /*!
+   * \brief Path of a region of the master thread, names of the region and its parents separated by "/".
+   * \param[in] region - Index returned by GetCurrentRegion, 0 gives an empty path.
+   */
+  static std::string GetRegionPath(int region);
+
+  /*!
+   * \brief Union of the names of all ranks in order of first appearance (collective).
+   * \param[in] names - Names of the calling rank.
+   */
+  static std::vector<std::string> UnionOverRanks(const std::vector<std::string>& names);
+
+  /*!
+   * \brief Totals of the regions called "name" of the master thread of the calling rank (not collective).
+   * \note Regions nested in a region with the same name are not counted twice, open regions are not counted.
+   * \param[in] name - Name of the regions.
+   */
+  static RegionTotals GetTotals(const char* name);
+
+  /*!
+   * \brief Reduce the statistics of all regions over threads and ranks (collective, outside parallel regions).
+   * \param[out] totalTime - Wall time since the profiler was started (max over ranks).
+   * \return Statistics of the regions in depth-first order, the same on all ranks.
+   */
+  static std::vector<RegionStats> Reduce(double& totalTime);
+
+  /*!
+   * \brief Print a summary table of the regions to the screen (collective).
+   */
+  static void Print();
+
+  /*!
+   * \brief Write the statistics of the regions to file (collective).
+   * \note CSV files have one row per region and label and are appended to after the first call,
+   * JSON files are overwritten with the latest statistics.
+   * \param[in] fileName - Name of the file without extension.
+   * \param[in] format - CSV or JSON.
+   * \param[in] label - Label of the statistics, e.g. the iteration.
+   */
+  static void Write(const std::string& fileName, PROFILING_FORMAT format, const std::string& label);
+};
+
+/*!
+ * \brief RAII helper to time a region of CProfiler from its construction to the end of the scope.
+ * \ingroup Toolboxes
+ */
+class CProfileRegion {
+ private:
+  int region = -1;
+  double start = 0.0;
+
+ public:
+  explicit CProfileRegion(const char* name) {
+    if (CProfiler::IsEnabled()) {
+      region = CProfiler::Enter(name);
+      start = CProfiler::Time();
+    }
+  }
+  ~CProfileRegion() {
+    if (region >= 0) CProfiler::Leave(region, CProfiler::Time() - start);
+  }
+  CProfileRegion(const CProfileRegion&) = delete;
+  CProfileRegion& operator=(const CProfileRegion&) = delete;
+};
+
+#define SU2_PROFILE_CONCAT_(A, B) A##B
+#define SU2_PROFILE_CONCAT(A, B) SU2_PROFILE_CONCAT_(A, B)
+
+/*!
+ * \brief Time the rest of the enclosing scope as a region of the profiler.
+ * \param[in] NAME - Name of the region (string literal).
+ */
+#define SU2_PROFILE_REGION(NAME) const CProfileRegion SU2_PROFILE_CONCAT(su2_profile_region_, __LINE__)(NAME)
+
+/*!
+ * \brief Dynamic worksharing loop whose busy time is measured in each thread as a region of the profiler.
+ * \note The region is left before the barrier of the loop, the wait for other threads is the idle time that
+ * is reported as load imbalance. The loop must be closed with END_SU2_OMP_FOR_PROFILED.
+ * \param[in] NAME - Name of the region (string literal).
+ * \param[in] CHUNK - Chunk size of the dynamic schedule.
+ */
+#define SU2_OMP_FOR_DYN_PROFILED(NAME, CHUNK) \
+  {                                           \
+    SU2_PROFILE_REGION(NAME);                 \
+    SU2_OMP_FOR_(schedule(dynamic, CHUNK) SU2_NOWAIT)
+
+/*!
+ * \brief Static version of SU2_OMP_FOR_DYN_PROFILED, for loops of uniform cost (e.g. over points).
+ * \param[in] NAME - Name of the region (string literal).
+ * \param[in] CHUNK - Chunk size of the static schedule.
+ */
+#define SU2_OMP_FOR_STAT_PROFILED(NAME, CHUNK) \
+  {                                            \
+    SU2_PROFILE_REGION(NAME);                  \
+    SU2_OMP_FOR_(schedule(static, CHUNK) SU2_NOWAIT)
+
+#define END_SU2_OMP_FOR_PROFILED \
+  END_SU2_OMP_FOR                \
+  }                              \
+  SU2_OMP_BARRIER
@@ -40,14 +40,31 @@
 
 #include <cassert>
 
+#include "CMemoryTracker.hpp"
+
 namespace MemoryAllocation {
 
 inline constexpr bool is_power_of_two(size_t x) { return x && !(x & (x - 1)); }
 
 inline constexpr size_t round_up(size_t multiple, size_t x) { return ((x + multiple - 1) / multiple) * multiple; }
 
+/*!
+ * \brief Information stored just before the memory returned by aligned_alloc, to track the memory of each owner.
+ */
+struct AllocationHeader {
+  size_t size;      /*!< \brief Size of the entire block, in bytes. */
+  int owner;        /*!< \brief Owner of the allocation (see CMemoryTracker). */
+  unsigned offset;  /*!< \brief Offset of the returned pointer from the start of the block. */
+};
+
+/*--- The header is placed in the padding of one alignment unit, which must fit it. ---*/
+constexpr size_t MIN_ALIGNMENT = 16;
+static_assert(sizeof(AllocationHeader) <= MIN_ALIGNMENT, "The allocation header does not fit the minimum alignment.");
+
 /*!
  * \brief Aligned memory allocation compatible across platforms.
+ * \note The allocation is recorded by CMemoryTracker under the current owner, this costs one alignment unit
+ * (at least MIN_ALIGNMENT bytes) of padding per allocation.
  * \param[in] alignment, in bytes, of the memory being allocated.
  * \param[in] size, also in bytes.
  * \tparam ZeroInit, initialize memory to 0.
@@ -57,23 +74,33 @@ template <class T, bool ZeroInit = false>
 inline T* aligned_alloc(size_t alignment, size_t size) noexcept {
   assert(is_power_of_two(alignment));
 
-  if (alignment < alignof(void*)) alignment = alignof(void*);
+  if (alignment < MIN_ALIGNMENT) alignment = MIN_ALIGNMENT;
 
   size = round_up(alignment, size);
+  const size_t blockSize = size + alignment;
 
-  void* ptr = nullptr;
+  void* block = nullptr;
 
 #if defined(__APPLE__)
-  if (::posix_memalign(&ptr, alignment, size) != 0) {
-    ptr = nullptr;
+  if (::posix_memalign(&block, alignment, blockSize) != 0) {
+    block = nullptr;
   }
 #elif defined(_WIN32)
-  ptr = _aligned_malloc(size, alignment);
+  block = _aligned_malloc(blockSize, alignment);
 #else
-  ptr = ::aligned_alloc(alignment, size);
+  block = ::aligned_alloc(alignment, blockSize);
 #endif
+  if (block == nullptr) return nullptr;
+
+  char* ptr = static_cast<char*>(block) + alignment;
+  auto* header = reinterpret_cast<AllocationHeader*>(ptr) - 1;
+  header->size = blockSize;
+  header->owner = CMemoryTracker::GetCurrentOwner();
+  header->offset = alignment;
+  CMemoryTracker::Record(header->owner, blockSize);
+
   if (ZeroInit) memset(ptr, 0, size);
-  return static_cast<T*>(ptr);
+  return reinterpret_cast<T*>(ptr);
 }
 
 /*!
@@ -82,10 +109,17 @@ inline T* aligned_alloc(size_t alignment, size_t size) noexcept {
  */
 template <class T>
 inline void aligned_free(T* ptr) noexcept {
+  if (ptr == nullptr) return;
+
+  char* data = static_cast<char*>(const_cast<void*>(static_cast<const void*>(ptr)));
+  const auto* header = reinterpret_cast<const AllocationHeader*>(data) - 1;
+  CMemoryTracker::Record(header->owner, -static_cast<long long>(header->size));
+  void* block = data - header->offset;
+
 #if defined(_WIN32)
-  _aligned_free(ptr);
+  _aligned_free(block);
 #else
-  free(ptr);
+  free(block);
 #endif
 }
 
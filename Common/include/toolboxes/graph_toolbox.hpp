@@ -646,6 +646,26 @@ struct DummyGridColor {
   inline IteratorLikeInt end() const { return IteratorLikeInt(size); }
 };
 
+/*!
+ * \brief A subset of the indices {0,1,...,n-1} (e.g. of the points of a grid) given by a sorted list,
+ * or all of them (without storage) when there is no list. Used to restrict point loops.
+ */
+template <typename T = unsigned long>
+struct IndexSubset {
+  static_assert(std::is_integral<T>::value, "");
+
+  const T size;
+  const T* const indices;
+
+  IndexSubset(const std::vector<T>* list, T n) : size(list ? list->size() : n), indices(list ? list->data() : nullptr) {}
+
+  /*! \brief The k-th index of the subset. */
+  inline T operator[](T k) const { return indices ? indices[k] : k; }
+
+  /*! \brief Check if an index is in the subset. */
+  inline bool contains(T i) const { return indices ? std::binary_search(indices, indices + size, i) : (i < size); }
+};
+
 /*!
  * \brief Computes the efficiency of a grid coloring for given number of threads and chunk size.
  */
@@ -45,11 +45,6 @@ using namespace PrintingToolbox;
 #endif
 #endif
 
-vector<string> Profile_Function_tp;       /*!< \brief Vector of string names for profiled functions. */
-vector<double> Profile_Time_tp;           /*!< \brief Vector of elapsed time for profiled functions. */
-vector<double> Profile_ID_tp;             /*!< \brief Vector of group ID number for profiled functions. */
-map<string, vector<int> > Profile_Map_tp; /*!< \brief Map containing the final results for profiled functions. */
-
 map<CLong3T, int> GEMM_Profile_MNK;       /*!< \brief Map, which maps the GEMM size to the index where
                                                       the data for this GEMM is stored in several vectors. */
 vector<long>   GEMM_Profile_NCalls;       /*!< \brief Vector, which stores the number of calls to this
@@ -58,8 +53,6 @@ vector<double> GEMM_Profile_TotTime;      /*!< \brief Total time spent for this
 vector<double> GEMM_Profile_MinTime;      /*!< \brief Minimum time spent for this GEMM size. */
 vector<double> GEMM_Profile_MaxTime;      /*!< \brief Maximum time spent for this GEMM size. */
 
-//#pragma omp threadprivate(Profile_Function_tp, Profile_Time_tp, Profile_ID_tp, Profile_Map_tp)
-
 
 CConfig::CConfig(char case_filename[MAX_STRING_SIZE], SU2_COMPONENT val_software, bool verb_high) {
 
@@ -945,6 +938,8 @@ void CConfig::SetPointersNull() {
   Aeroelastic_pitch   = nullptr;
 
   CFL_AdaptParam      = nullptr;
+  CFL_AdaptCostParam  = nullptr;
+  Sweep_AoA           = nullptr;
   CFL                 = nullptr;
   PlaneTag            = nullptr;
   ParamDV             = nullptr;
@@ -1152,6 +1147,13 @@ void CConfig::SetConfig_Options() {
 
   /*!\brief RESTART_SOL \n DESCRIPTION: Restart solution from native solution file \n Options: NO, YES \ingroup Config */
   addBoolOption("RESTART_SOL", Restart, false);
+  /*!\brief RESTART_BLEND_FILES \n DESCRIPTION: Converged solutions blended, by inverse distance weighting in the
+   * space of RESTART_BLEND_PARAM, to form the restart (instead of reading SOLUTION_FILENAME). \ingroup Config */
+  addStringListOption("RESTART_BLEND_FILES", nRestart_Blend_Files, Restart_Blend_Files);
+  /*!\brief RESTART_BLEND_PARAM \n DESCRIPTION: Parameters that define the position of the blended solutions. \ingroup Config */
+  addEnumListOption("RESTART_BLEND_PARAM", nRestart_Blend_Params, Restart_Blend_Params, Blend_Param_Map);
+  /*!\brief RESTART_BLEND_COORDS \n DESCRIPTION: Values of the RESTART_BLEND_PARAM for each blended solution. \ingroup Config */
+  addDoubleListOption("RESTART_BLEND_COORDS", nRestart_Blend_Coords, Restart_Blend_Coords);
   /*!\brief BINARY_RESTART \n DESCRIPTION: Read binary SU2 native restart files. \n Options: YES, NO \ingroup Config */
   addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, true);
   /*!\brief WRT_RESTART_OVERWRITE \n DESCRIPTION: overwrite restart files or append iteration number. \n Options: YES, NO \ingroup Config */
@@ -1406,6 +1408,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("SIDESLIP_ANGLE", AoS, 0.0);
   /*!\brief AOA  \n DESCRIPTION: Angle of attack (degrees, only for compressible flows) \ingroup Config*/
   addDoubleOption("AOA", AoA, 0.0);
+  /* DESCRIPTION: List of angles of attack (degrees) solved one after the other on the same mesh (steady single-zone primal flows). */
+  addDoubleListOption("SWEEP_AOA", nSweep_AoA, Sweep_AoA);
   /* DESCRIPTION: Activate fixed CL mode (specify a CL instead of AoA). */
   addBoolOption("FIXED_CL_MODE", Fixed_CL_Mode, false);
   /* DESCRIPTION: Evaluate the dOF_dCL or dOF_dCMy during run time. */
@@ -1736,6 +1740,14 @@ void CConfig::SetConfig_Options() {
   default_cfl_adapt[0] = 1.0; default_cfl_adapt[1] = 1.0; default_cfl_adapt[2] = 10.0; default_cfl_adapt[3] = 100.0;
   default_cfl_adapt[4] = 0.001;
   addDoubleListOption("CFL_ADAPT_PARAM", nCFL_AdaptParam, CFL_AdaptParam);
+  /* DESCRIPTION: Adapt the CFL limit and the linear solver settings to maximize the residual reduction per second. */
+  addBoolOption("CFL_ADAPT_COST", CFL_Adapt_Cost, false);
+  /* !\brief CFL_ADAPT_COST_PARAM
+   * DESCRIPTION: Parameters of the cost-aware CFL adaption (iterations per window, min and max linear solver tolerance,
+   * max linear solves between preconditioner builds). \ingroup Config*/
+  default_cfl_adapt_cost[0] = 10; default_cfl_adapt_cost[1] = 1e-6; default_cfl_adapt_cost[2] = 0.1;
+  default_cfl_adapt_cost[3] = 8;
+  addDoubleListOption("CFL_ADAPT_COST_PARAM", nCFL_AdaptCostParam, CFL_AdaptCostParam);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the adjoint problem */
   addDoubleOption("CFL_REDUCTION_ADJFLOW", CFLRedCoeff_AdjFlow, 0.8);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the level set problem */
@@ -1837,6 +1849,8 @@ void CConfig::SetConfig_Options() {
   addEnumOption("DISCADJ_LIN_SOLVER", Kind_DiscAdj_Linear_Solver, Linear_Solver_Map, FGMRES);
   /* DESCRIPTION: Preconditioner for the discrete adjoint Krylov linear solvers */
   addEnumOption("DISCADJ_LIN_PREC", Kind_DiscAdj_Linear_Prec, Linear_Solver_Prec_Map, ILU);
+  /* DESCRIPTION: Reuse the primal preconditioner in the adjoint linear solves of symmetric systems */
+  addBoolOption("DISCADJ_LIN_REUSE_PRIMAL_PREC", DiscAdj_Reuse_Primal_Prec, false);
   /* DESCRIPTION: Linear solver for the discete adjoint systems */
 
   /*!\par CONFIG_CATEGORY: Convergence\ingroup Config*/
@@ -2155,6 +2169,24 @@ void CConfig::SetConfig_Options() {
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
   /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
+  /* DESCRIPTION: Report the memory used by each subsystem after preprocessing and at the end \ingroup Config*/
+  addBoolOption("WRT_MEMORY_REPORT", Wrt_MemoryReport, false);
+  /* DESCRIPTION: Time the main phases of the solver (preprocessing, residuals, linear solver, etc.) \ingroup Config*/
+  addBoolOption("PROFILING", Profiling, false);
+  /* DESCRIPTION: Write the profiling statistics to file every this many iterations, 0 for end of run only \ingroup Config*/
+  addUnsignedLongOption("PROFILING_FREQ", Profiling_Freq, 0);
+  /* DESCRIPTION: Format of the profiling output file (CSV, JSON) \ingroup Config*/
+  addEnumOption("PROFILING_FORMAT", Profiling_Format, Profiling_Format_Map, PROFILING_FORMAT::CSV);
+  /* DESCRIPTION: Profiling output file (w/o extension) \ingroup Config*/
+  addStringOption("PROFILING_FILENAME", Profiling_FileName, string("profiling"));
+  /* DESCRIPTION: Read hardware counters (cycles, instructions, cache misses) in the profiled regions \ingroup Config*/
+  addBoolOption("PROFILING_COUNTERS", Profiling_Counters, false);
+  /* DESCRIPTION: CPU-specific hardware events (raw codes) read in addition to the generic ones \ingroup Config*/
+  addStringListOption("PROFILING_RAW_EVENTS", nProfiling_Raw_Events, Profiling_Raw_Events);
+  /* DESCRIPTION: Record the MPI communication (halo exchanges, collectives, rank-to-rank volumes) \ingroup Config*/
+  addBoolOption("PROFILING_COMMS", Profiling_Comms, false);
+  /* DESCRIPTION: Roofline analysis of the kernels, measures STREAM bandwidth and flop rate \ingroup Config*/
+  addBoolOption("PROFILING_ROOFLINE", Profiling_Roofline, false);
   /*!\brief MARKER_ANALYZE_AVERAGE
    *  \n DESCRIPTION: Output averaged flow values on specified analyze marker.
    *  Options: AREA, MASSFLUX
@@ -2603,6 +2635,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("AITKEN_DYN_MIN_INITIAL", AitkenDynMinInit, 0.5);
   /* DESCRIPTION: Kind of relaxation */
   addEnumOption("BGS_RELAXATION", Kind_BGS_RelaxMethod, AitkenForm_Map, BGS_RELAXATION::NONE);
+  /* DESCRIPTION: Number of samples (past BGS iterates) used by the IQN_ILS relaxation */
+  addUnsignedShortOption("BGS_QUASI_NEWTON_SAMPLES", nQuasiNewtonSamples_BGS, 10);
   /* DESCRIPTION: Relaxation required */
   addBoolOption("RELAXATION", Relaxation, false);
 
@@ -2640,6 +2674,12 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION:  Courant-Friedrichs-Lewy condition of the finest grid in radiation solvers */
   addDoubleOption("CFL_NUMBER_RAD", CFL_Rad, 1.0);
 
+  /* DESCRIPTION: Solve the radiation equation only every this many flow iterations, once converged below RADIATION_UPDATE_RESIDUAL */
+  addUnsignedLongOption("RADIATION_UPDATE_FREQ", Rad_Update_Freq, 1);
+
+  /* DESCRIPTION: Log10 of the radiation RMS residual below which RADIATION_UPDATE_FREQ applies */
+  addDoubleOption("RADIATION_UPDATE_RESIDUAL", Rad_Update_Residual, 0.0);
+
   /*!\par CONFIG_CATEGORY: Heat solver \ingroup Config*/
   /*--- options related to the heat solver ---*/
 
@@ -2916,6 +2956,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
+  /* DESCRIPTION: Select the edge coloring group size of the flow solvers from the measured time of their edge loops. */
+  addBoolOption("EDGE_COLORING_AUTOTUNE", edgeColorAutotune, false);
+
   /*--- options that are used for libROM ---*/
   /*!\par CONFIG_CATEGORY:libROM options \ingroup Config*/
 
@@ -2934,6 +2977,15 @@ void CConfig::SetConfig_Options() {
   /*!\brief ROM_SAVE_FREQ \n DESCRIPTION: How often to save snapshots for unsteady problems.*/
   addUnsignedShortOption("ROM_SAVE_FREQ", rom_save_freq, 1);
 
+  /*!\brief REDUCED_ORDER_MODEL \n DESCRIPTION: Type of reduced-order model used to solve the flow equations. */
+  addEnumOption("REDUCED_ORDER_MODEL", Kind_ROM, ROM_Map, ROM_KIND::NONE);
+
+  /*!\brief ROM_SNAPSHOT_FILES \n DESCRIPTION: Snapshots (SU2 binary restarts) used to build the POD basis. */
+  addStringListOption("ROM_SNAPSHOT_FILES", nROM_Snapshot_Files, ROM_Snapshot_Files);
+
+  /*!\brief ROM_SAMPLE_POINTS \n DESCRIPTION: Number of points where the residual of the ROM is sampled (hyper-reduction), 0 for all. */
+  addUnsignedLongOption("ROM_SAMPLE_POINTS", nROM_Sample_Points, 0);
+
   /* END_CONFIG_OPTIONS */
 
 }
@@ -4590,6 +4642,17 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     nCFL_AdaptParam = default_cfl_adapt.size();
   }
 
+  if (nCFL_AdaptCostParam < default_cfl_adapt_cost.size()) {
+    auto newParam = new su2double [default_cfl_adapt_cost.size()];
+    for (iCFL = 0; iCFL < default_cfl_adapt_cost.size(); ++iCFL) {
+      if (iCFL < nCFL_AdaptCostParam) newParam[iCFL] = CFL_AdaptCostParam[iCFL];
+      else newParam[iCFL] = default_cfl_adapt_cost[iCFL];
+    }
+    swap(newParam, CFL_AdaptCostParam);
+    delete [] newParam;
+    nCFL_AdaptCostParam = default_cfl_adapt_cost.size();
+  }
+
   /*--- Evaluate when the Cl should be evaluated ---*/
 
   Iter_Fixed_CM        = SU2_TYPE::Int(nInnerIter / (su2double(Update_iH)+1));
@@ -4616,6 +4679,44 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (Update_AoA_Iter_Limit == 0 && Fixed_CL_Mode) {
     SU2_MPI::Error("ERROR: Please specify non-zero UPDATE_AOA_ITER_LIMIT.", CURRENT_FUNCTION);
   }
+  if (nSweep_AoA > 0 && (Fixed_CL_Mode || Time_Domain || Multizone_Problem)) {
+    SU2_MPI::Error("SWEEP_AOA is only available for steady single-zone problems without FIXED_CL_MODE.",
+                   CURRENT_FUNCTION);
+  }
+  if (nRestart_Blend_Files > 0) {
+    if (nRestart_Blend_Params == 0 || nRestart_Blend_Coords != nRestart_Blend_Files * nRestart_Blend_Params) {
+      SU2_MPI::Error("RESTART_BLEND_COORDS must contain the value of each RESTART_BLEND_PARAM for each of the\n"
+                     "RESTART_BLEND_FILES (one row of values per file).", CURRENT_FUNCTION);
+    }
+    if (Time_Domain || ContinuousAdjoint || DiscreteAdjoint) {
+      SU2_MPI::Error("RESTART_BLEND_FILES is only available for steady direct problems.", CURRENT_FUNCTION);
+    }
+    if (!Restart) {
+      SU2_MPI::Error("RESTART_BLEND_FILES requires RESTART_SOL= YES.", CURRENT_FUNCTION);
+    }
+  }
+  if (Kind_ROM != ROM_KIND::NONE) {
+    const bool flow = (Kind_Solver == MAIN_SOLVER::EULER || Kind_Solver == MAIN_SOLVER::NAVIER_STOKES ||
+                       Kind_Solver == MAIN_SOLVER::INC_EULER || Kind_Solver == MAIN_SOLVER::INC_NAVIER_STOKES);
+    if (!flow || Kind_Species_Model != SPECIES_MODEL::NONE) {
+      SU2_MPI::Error("REDUCED_ORDER_MODEL is only available for the (incompressible) Euler and Navier-Stokes solvers.",
+                     CURRENT_FUNCTION);
+    }
+    if (Time_Domain || Multizone_Problem || Kind_TimeIntScheme_Flow != EULER_IMPLICIT || nMGLevels != 0 ||
+        nMarker_PerBound != 0) {
+      SU2_MPI::Error("REDUCED_ORDER_MODEL requires a steady single-zone problem with TIME_DISCRE_FLOW= EULER_IMPLICIT,\n"
+                     "MGLEVEL= 0, and without periodic boundaries.", CURRENT_FUNCTION);
+    }
+    if (POD_Basis_Gen != POD_KIND::STATIC) {
+      SU2_MPI::Error("REDUCED_ORDER_MODEL requires BASIS_GENERATION= STATIC_POD.", CURRENT_FUNCTION);
+    }
+    if (nROM_Snapshot_Files < 2) {
+      SU2_MPI::Error("At least two ROM_SNAPSHOT_FILES are needed to build the reduced-order model.", CURRENT_FUNCTION);
+    }
+  }
+  else if (nROM_Sample_Points > 0) {
+    SU2_MPI::Error("ROM_SAMPLE_POINTS requires a REDUCED_ORDER_MODEL.", CURRENT_FUNCTION);
+  }
   if (Iter_Fixed_CM == 0) { Iter_Fixed_CM = nInnerIter+1; Update_iH = 0; }
   if (Iter_Fixed_NetThrust == 0) { Iter_Fixed_NetThrust = nInnerIter+1; Update_BCThrust = 0; }
 
@@ -5359,6 +5460,22 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     SU2_MPI::Error(string("CFL adaption minimum CFL is larger than the maximum CFL."), CURRENT_FUNCTION);
   }
 
+  if (CFL_Adapt_Cost && (!CFL_Adapt || Comm_Level != COMM_FULL)) {
+    SU2_MPI::Error(string("CFL_ADAPT_COST requires CFL_ADAPT= YES and COMM_LEVEL= FULL."), CURRENT_FUNCTION);
+  }
+
+  if (CFL_Adapt_Cost && ((CFL_AdaptCostParam[0] < 1) || (CFL_AdaptCostParam[1] <= 0.0) ||
+                         (CFL_AdaptCostParam[1] > CFL_AdaptCostParam[2]) || (CFL_AdaptCostParam[3] < 1))) {
+    SU2_MPI::Error(string("Invalid CFL_ADAPT_COST_PARAM, the window must have at least 1 iteration, the tolerances\n") +
+                   string("must be positive and in ascending order, and the preconditioner period at least 1."),
+                   CURRENT_FUNCTION);
+  }
+
+  if (Kind_BGS_RelaxMethod == BGS_RELAXATION::IQN_ILS && nQuasiNewtonSamples_BGS < 2) {
+    SU2_MPI::Error(string("BGS_QUASI_NEWTON_SAMPLES must be at least 2 for BGS_RELAXATION= IQN_ILS."),
+                   CURRENT_FUNCTION);
+  }
+
   /*--- 0 in the config file means "disable" which can be done using a very large group. ---*/
   if (edgeColorGroupSize==0) edgeColorGroupSize = 1<<30;
 
@@ -6230,6 +6347,14 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
       if (Fixed_CL_Mode) {
         cout << "Fixed CL mode, target value: " << Target_CL << "." << endl;
       }
+      if (nSweep_AoA > 0) {
+        cout << "Sweep of " << nSweep_AoA << " angles of attack on the same mesh." << endl;
+      }
+      if (Kind_ROM == ROM_KIND::POD_LSPG) {
+        cout << "LSPG reduced-order model, POD basis of " << nROM_Snapshot_Files << " snapshots";
+        if (nROM_Sample_Points > 0) cout << ", residual sampled at " << nROM_Sample_Points << " points";
+        cout << "." << endl;
+      }
     }
 
     if (EquivArea) {
@@ -6935,6 +7060,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
               switch (Kind_Linear_Solver_Prec) {
                 case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
+                case AMG:     cout << "Using an algebraic multigrid preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
               }
@@ -6943,6 +7069,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
               switch (Kind_Linear_Solver_Prec) {
                 case ILU:     cout << "A ILU(" << Linear_Solver_ILU_n << ")"; break;
                 case LINELET: cout << "A Linelet"; break;
+                case AMG:     cout << "An AMG"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
               }
@@ -7078,6 +7205,11 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
         <<",\n                lower limit: "<< CFL_AdaptParam[2] <<", upper limit: " << CFL_AdaptParam[3]
         <<",\n                acceptable linear residual: "<< CFL_AdaptParam[4] << "." << endl;
 
+      if (CFL_Adapt && CFL_Adapt_Cost)
+        cout << "Cost-aware CFL adaptation. Window: " << CFL_AdaptCostParam[0] << " iterations, linear tolerance: ["
+             << CFL_AdaptCostParam[1] << ", " << CFL_AdaptCostParam[2] << "],\n                preconditioner built "
+             << "at least every " << CFL_AdaptCostParam[3] << " linear solves." << endl;
+
       if (nMGLevels !=0) {
         PrintingToolbox::CTablePrinter MGTable(&std::cout);
 
@@ -8172,6 +8304,18 @@ CConfig::~CConfig() {
   delete [] FreeStreamTurboNormal;
 }
 
+su2double CConfig::GetBlend_Param_Value(BLEND_PARAM param) const {
+  switch (param) {
+    case BLEND_PARAM::MACH: return Mach;
+    case BLEND_PARAM::AOA: return AoA;
+    case BLEND_PARAM::SIDESLIP: return AoS;
+    case BLEND_PARAM::REYNOLDS: return Reynolds;
+    case BLEND_PARAM::FREESTREAM_PRESSURE: return Pressure_FreeStream;
+    case BLEND_PARAM::FREESTREAM_TEMPERATURE: return Temperature_FreeStream;
+  }
+  return 0.0;
+}
+
 string CConfig::GetFilename(string filename, const string& ext, int timeIter) const {
 
   /*--- Remove any extension --- */
@@ -9620,191 +9764,6 @@ short CConfig::FindInterfaceMarker(unsigned short iInterface) const {
   return -1;
 }
 
-void CConfig::Tick(double *val_start_time) {
-
-#ifdef PROFILE
-  *val_start_time = SU2_MPI::Wtime();
-#endif
-
-}
-
-void CConfig::Tock(double val_start_time, const string& val_function_name, int val_group_id) {
-
-#ifdef PROFILE
-
-  double val_stop_time = 0.0, val_elapsed_time = 0.0;
-
-  val_stop_time = SU2_MPI::Wtime();
-
-  /*--- Compute the elapsed time for this subroutine ---*/
-  val_elapsed_time = val_stop_time - val_start_time;
-
-  /*--- Store the subroutine name and the elapsed time ---*/
-  Profile_Function_tp.push_back(val_function_name);
-  Profile_Time_tp.push_back(val_elapsed_time);
-  Profile_ID_tp.push_back(val_group_id);
-
-#endif
-
-}
-
-void CConfig::SetProfilingCSV() {
-
-#ifdef PROFILE
-
-  int rank = MASTER_NODE;
-  int size = SINGLE_NODE;
-#ifdef HAVE_MPI
-  SU2_MPI::Comm_rank(SU2_MPI::GetComm(), &rank);
-  SU2_MPI::Comm_size(SU2_MPI::GetComm(), &size);
-#endif
-
-  /*--- Each rank has the same stack trace, so the they have the same
-   function calls and ordering in the vectors. We're going to reduce
-   the timings from each rank and extract the avg, min, and max timings. ---*/
-
-  /*--- First, create a local mapping, so that we can extract the
-   min and max values for each function. ---*/
-
-  for (unsigned int i = 0; i < Profile_Function_tp.size(); i++) {
-
-    /*--- Add the function and initialize if not already stored (the ID
-     only needs to be stored the first time).---*/
-    if (Profile_Map_tp.find(Profile_Function_tp[i]) == Profile_Map_tp.end()) {
-
-      vector<int> profile; profile.push_back(i);
-      Profile_Map_tp.insert(pair<string,vector<int> >(Profile_Function_tp[i],profile));
-
-    } else {
-
-      /*--- This function has already been added, so simply increment the
-       number of calls and total time for this function. ---*/
-
-      Profile_Map_tp[Profile_Function_tp[i]].push_back(i);
-
-    }
-  }
-
-  /*--- We now have everything gathered by function name, so we can loop over
-   each function and store the min/max times. ---*/
-
-  int map_size = 0;
-  for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-    map_size++;
-  }
-
-  /*--- Allocate and initialize memory ---*/
-
-  double *l_min_red = NULL, *l_max_red = NULL, *l_tot_red = NULL, *l_avg_red = NULL;
-  int *n_calls_red = NULL;
-  double* l_min = new double[map_size];
-  double* l_max = new double[map_size];
-  double* l_tot = new double[map_size];
-  double* l_avg = new double[map_size];
-  int* n_calls  = new int[map_size];
-  for (int i = 0; i < map_size; i++)
-  {
-    l_min[i]   = 1e10;
-    l_max[i]   = 0.0;
-    l_tot[i]   = 0.0;
-    l_avg[i]   = 0.0;
-    n_calls[i] = 0;
-  }
-
-  /*--- Collect the info for each function from the current rank ---*/
-
-  int func_counter = 0;
-  for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-
-    for (unsigned int i = 0; i < (it->second).size(); i++) {
-      n_calls[func_counter]++;
-      l_tot[func_counter] += Profile_Time_tp[(it->second)[i]];
-      if (Profile_Time_tp[(it->second)[i]] < l_min[func_counter])
-        l_min[func_counter] = Profile_Time_tp[(it->second)[i]];
-      if (Profile_Time_tp[(it->second)[i]] > l_max[func_counter])
-        l_max[func_counter] = Profile_Time_tp[(it->second)[i]];
-
-    }
-    l_avg[func_counter] = l_tot[func_counter]/((double)n_calls[func_counter]);
-    func_counter++;
-  }
-
-  /*--- Now reduce the data ---*/
-
-  if (rank == MASTER_NODE) {
-    l_min_red = new double[map_size];
-    l_max_red = new double[map_size];
-    l_tot_red = new double[map_size];
-    l_avg_red = new double[map_size];
-    n_calls_red  = new int[map_size];
-  }
-
-#ifdef HAVE_MPI
-  MPI_Reduce(n_calls, n_calls_red, map_size, MPI_INT, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_tot, l_tot_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_avg, l_avg_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_min, l_min_red, map_size, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_max, l_max_red, map_size, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
-#else
-  memcpy(n_calls_red, n_calls, map_size*sizeof(int));
-  memcpy(l_tot_red,   l_tot,   map_size*sizeof(double));
-  memcpy(l_avg_red,   l_avg,   map_size*sizeof(double));
-  memcpy(l_min_red,   l_min,   map_size*sizeof(double));
-  memcpy(l_max_red,   l_max,   map_size*sizeof(double));
-#endif
-
-  /*--- The master rank will write the file ---*/
-
-  if (rank == MASTER_NODE) {
-
-    /*--- Take averages over all ranks on the master ---*/
-
-    for (int i = 0; i < map_size; i++) {
-      l_tot_red[i]   = l_tot_red[i]/(double)size;
-      l_avg_red[i]   = l_avg_red[i]/(double)size;
-      n_calls_red[i] = n_calls_red[i]/size;
-    }
-
-    /*--- Now write a CSV file with the processed results ---*/
-
-    ofstream Profile_File;
-    Profile_File.precision(15);
-    Profile_File.open("profiling.csv");
-
-    /*--- Create the CSV header ---*/
-
-    Profile_File << "\"Function_Name\", \"N_Calls\", \"Avg_Total_Time\", \"Avg_Time\", \"Min_Time\", \"Max_Time\", \"Function_ID\"" << endl;
-
-    /*--- Loop through the map and write the results to the file ---*/
-
-    func_counter = 0;
-    for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-
-      Profile_File << scientific << it->first << ", " << n_calls_red[func_counter] << ", " << l_tot_red[func_counter] << ", " << l_avg_red[func_counter] << ", " << l_min_red[func_counter] << ", " << l_max_red[func_counter] << ", " << (int)Profile_ID_tp[(it->second)[0]] << endl;
-      func_counter++;
-    }
-
-    Profile_File.close();
-
-  }
-
-  delete [] l_min;
-  delete [] l_max;
-  delete [] l_avg;
-  delete [] l_tot;
-  delete [] n_calls;
-  if (rank == MASTER_NODE) {
-    delete [] l_min_red;
-    delete [] l_max_red;
-    delete [] l_avg_red;
-    delete [] l_tot_red;
-    delete [] n_calls_red;
-  }
-
-#endif
-
-}
-
 void CConfig::GEMM_Tick(double *val_start_time) const {
 
 #ifdef PROFILE
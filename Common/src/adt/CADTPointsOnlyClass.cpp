@@ -237,3 +237,60 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
      Take the sqrt to obtain the correct value. */
   dist = sqrt(dist);
 }
+
+void CADTPointsOnlyClass::DetermineNodesInRadius_impl(vector<unsigned long>& frontLeaves,
+                                                      vector<unsigned long>& frontLeavesNew, const su2double* coor,
+                                                      su2double radius, vector<unsigned long>& pointIDs) const {
+  pointIDs.clear();
+  if (isEmpty) return;
+
+  const bool wasActive = AD::BeginPassive();
+
+  /*--- Compare distances squared to avoid the sqrt. ---*/
+  const su2double radius2 = radius * radius;
+
+  /*--- Traverse the tree starting from the root leaf, only the leaves whose
+        bounding box intersects the sphere of the search need to be visited. ---*/
+  frontLeaves.clear();
+  frontLeaves.push_back(0);
+
+  while (!frontLeaves.empty()) {
+    frontLeavesNew.clear();
+
+    for (const auto ll : frontLeaves) {
+      for (unsigned short mm = 0; mm < 2; ++mm) {
+        const unsigned long kk = leaves[ll].children[mm];
+
+        if (leaves[ll].childrenAreTerminal[mm]) {
+          /*--- Terminal leaves with a single point store it in both children, the first child may also be
+                a leaf whose index happens to be equal to the index of the point. ---*/
+          if (mm == 1 && leaves[ll].childrenAreTerminal[0] && kk == leaves[ll].children[0]) continue;
+
+          const su2double* coorTarget = coorPoints.data() + nDimADT * kk;
+          su2double distTarget = 0;
+          for (unsigned short l = 0; l < nDimADT; ++l) {
+            const su2double ds = coor[l] - coorTarget[l];
+            distTarget += ds * ds;
+          }
+          if (distTarget <= radius2) pointIDs.push_back(localPointIDs[kk]);
+        } else {
+          /*--- Minimum possible distance squared to the leaf. ---*/
+          su2double posDist = 0.0;
+          for (unsigned short l = 0; l < nDimADT; ++l) {
+            su2double ds = 0.0;
+            if (coor[l] < leaves[kk].xMin[l])
+              ds = coor[l] - leaves[kk].xMin[l];
+            else if (coor[l] > leaves[kk].xMax[l])
+              ds = coor[l] - leaves[kk].xMax[l];
+
+            posDist += ds * ds;
+          }
+          if (posDist <= radius2) frontLeavesNew.push_back(kk);
+        }
+      }
+    }
+    swap(frontLeaves, frontLeavesNew);
+  }
+
+  AD::EndPassive(wasActive);
+}
@@ -25,13 +25,19 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <array>
+#include <set>
 #include <unordered_set>
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/toolboxes/ndflattener.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
+#include "../../include/toolboxes/CCommProfiler.hpp"
+#include "../../include/toolboxes/CMemoryTracker.hpp"
 
 CGeometry::CGeometry() : size(SU2_MPI::GetSize()), rank(SU2_MPI::GetRank()) {}
 
@@ -94,6 +100,8 @@ CGeometry::~CGeometry() {
 
   /*--- Delete structures for MPI point-to-point communication. ---*/
 
+  CMemoryTracker::Account("Comm buffers", -GetCommBufferBytes());
+
   delete[] bufD_P2PRecv;
   delete[] bufD_P2PSend;
 
@@ -342,6 +350,8 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
   if (countPerPoint <= maxCountPerPoint) return;
 
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    const auto bytesBefore = GetCommBufferBytes();
+
     /*--- Store the larger packet size to the class data. ---*/
 
     maxCountPerPoint = countPerPoint;
@@ -359,10 +369,61 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
     delete[] bufS_P2PRecv;
     bufS_P2PRecv = new unsigned short[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+
+    CMemoryTracker::Account("Comm buffers", GetCommBufferBytes() - bytesBefore);
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
+long long CGeometry::GetCommBufferBytes() const {
+  constexpr long long bytesPerItem = sizeof(su2double) + sizeof(unsigned short);
+  long long bytes = 0;
+  if (maxCountPerPoint > 0) {
+    bytes += maxCountPerPoint * bytesPerItem * (nPoint_P2PSend[nP2PSend] + nPoint_P2PRecv[nP2PRecv]);
+  }
+  if (maxCountPerPeriodicPoint > 0) {
+    bytes += maxCountPerPeriodicPoint * bytesPerItem *
+             (nPoint_PeriodicSend[nPeriodicSend] + nPoint_PeriodicRecv[nPeriodicRecv]);
+  }
+  return bytes;
+}
+
+void CGeometry::ProfileP2PComms(unsigned short commType, unsigned short countPerPoint, unsigned short mpiType,
+                                bool reverse) const {
+  if (!CCommProfiler::IsEnabled()) return;
+
+  /*--- The adjoint values are not counted, the size is that of the primal type. ---*/
+  const auto bytesPerPoint =
+      countPerPoint * (mpiType == COMM_TYPE_DOUBLE ? sizeof(passivedouble) : sizeof(unsigned short));
+
+  /*--- Reversed comms send to the neighbors we normally receive from. ---*/
+  const int nSend = reverse ? nP2PRecv : nP2PSend;
+  const int* nPointSend = reverse ? nPoint_P2PRecv : nPoint_P2PSend;
+  const int* neighbors = reverse ? Neighbors_P2PRecv : Neighbors_P2PSend;
+
+  const auto id = CCommProfiler::HaloId(commType);
+  CCommProfiler::AddExchange(id, nSend);
+  for (int iSend = 0; iSend < nSend; ++iSend) {
+    const auto nPointP2P = nPointSend[iSend + 1] - nPointSend[iSend];
+    CCommProfiler::AddMessage(id, neighbors[iSend], nPointP2P * bytesPerPoint);
+  }
+}
+
+void CGeometry::ProfilePeriodicComms(unsigned short commType, unsigned short countPerPeriodicPoint,
+                                     unsigned short mpiType) const {
+  if (!CCommProfiler::IsEnabled()) return;
+
+  const auto bytesPerPoint =
+      countPerPeriodicPoint * (mpiType == COMM_TYPE_DOUBLE ? sizeof(passivedouble) : sizeof(unsigned short));
+
+  const auto id = CCommProfiler::PeriodicId(commType);
+  CCommProfiler::AddExchange(id, nPeriodicSend);
+  for (int iSend = 0; iSend < nPeriodicSend; ++iSend) {
+    const auto nPointPeriodic = nPoint_PeriodicSend[iSend + 1] - nPoint_PeriodicSend[iSend];
+    CCommProfiler::AddMessage(id, Neighbors_PeriodicSend[iSend], nPointPeriodic * bytesPerPoint);
+  }
+}
+
 void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigned short commType,
                              unsigned short countPerPoint, bool val_reverse) const {
   /*--- Launch the non-blocking recv's first. Note that we have stored
@@ -578,6 +639,8 @@ void CGeometry::GetCommCountAndType(const CConfig* config, unsigned short commTy
 void CGeometry::InitiateComms(CGeometry* geometry, const CConfig* config, unsigned short commType) const {
   if (nP2PSend == 0) return;
 
+  SU2_PROFILE_REGION("MPI comms");
+
   /*--- Local variables ---*/
 
   unsigned short iDim;
@@ -612,6 +675,7 @@ void CGeometry::InitiateComms(CGeometry* geometry, const CConfig* config, unsign
   /*--- Post all non-blocking recvs first before sends. ---*/
 
   geometry->PostP2PRecvs(geometry, config, MPI_TYPE, COUNT_PER_POINT, false);
+  ProfileP2PComms(commType, COUNT_PER_POINT, MPI_TYPE, false);
 
   for (iMessage = 0; iMessage < nP2PSend; iMessage++) {
     /*--- Get the offset in the buffer for the start of this message. ---*/
@@ -675,6 +739,8 @@ void CGeometry::InitiateComms(CGeometry* geometry, const CConfig* config, unsign
 void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, unsigned short commType) {
   if (nP2PRecv == 0) return;
 
+  SU2_PROFILE_REGION("MPI comms");
+
   /*--- Local variables ---*/
 
   unsigned short iDim, COUNT_PER_POINT = 0, MPI_TYPE = 0;
@@ -703,7 +769,8 @@ void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, unsign
     /*--- For efficiency, recv the messages dynamically based on
      the order they arrive. ---*/
 
-    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);)
+    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_PROFILE_REGION("MPI wait"); SU2_COMM_WAIT(CCommProfiler::HaloId(commType));
+                               SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);)
 
     /*--- Once we have recv'd a message, get the source rank. ---*/
 
@@ -764,7 +831,8 @@ void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, unsign
    data in the loop above at this point. ---*/
 
 #ifdef HAVE_MPI
-  SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);)
+  SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_PROFILE_REGION("MPI wait"); SU2_COMM_WAIT(CCommProfiler::HaloId(commType));
+                             SU2_MPI::Waitall(nP2PSend, req_P2PSend, MPI_STATUS_IGNORE);)
 #endif
 }
 
@@ -1101,6 +1169,8 @@ void CGeometry::AllocatePeriodicComms(unsigned short countPerPeriodicPoint) {
   if (countPerPeriodicPoint <= maxCountPerPeriodicPoint) return;
 
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    const auto bytesBefore = GetCommBufferBytes();
+
     /*--- Store the larger packet size to the class data. ---*/
 
     maxCountPerPeriodicPoint = countPerPeriodicPoint;
@@ -1123,6 +1193,8 @@ void CGeometry::AllocatePeriodicComms(unsigned short countPerPeriodicPoint) {
 
     delete[] bufS_PeriodicRecv;
     bufS_PeriodicRecv = new unsigned short[nRecv]();
+
+    CMemoryTracker::Account("Comm buffers", GetCommBufferBytes() - bytesBefore);
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
@@ -1530,35 +1602,526 @@ bool CGeometry::SegmentIntersectsTriangle(su2double point0[3], const su2double p
   return (true);
 }
 
+namespace {
+/*!
+ * \brief Segments of the intersection of a plane with the surface. The end points of each segment
+ *        are the "Index0" and "Index1" entries, each identified by the global indices of the cut edge.
+ */
+struct SectionSegments {
+  vector<su2double> Xcoord_Index0, Ycoord_Index0, Zcoord_Index0, Variable_Index0;
+  vector<su2double> Xcoord_Index1, Ycoord_Index1, Zcoord_Index1, Variable_Index1;
+  vector<unsigned long> IGlobalID_Index0, JGlobalID_Index0, IGlobalID_Index1, JGlobalID_Index1;
+
+  size_t size() const { return Xcoord_Index0.size(); }
+
+  /*--- Keep only the segments flagged in "keep", preserving their order. ---*/
+  void Filter(const vector<bool>& keep) {
+    size_t nKeep = 0;
+    for (size_t iEdge = 0; iEdge < size(); iEdge++) {
+      if (!keep[iEdge]) continue;
+      Xcoord_Index0[nKeep] = Xcoord_Index0[iEdge];
+      Ycoord_Index0[nKeep] = Ycoord_Index0[iEdge];
+      Zcoord_Index0[nKeep] = Zcoord_Index0[iEdge];
+      Variable_Index0[nKeep] = Variable_Index0[iEdge];
+      IGlobalID_Index0[nKeep] = IGlobalID_Index0[iEdge];
+      JGlobalID_Index0[nKeep] = JGlobalID_Index0[iEdge];
+      Xcoord_Index1[nKeep] = Xcoord_Index1[iEdge];
+      Ycoord_Index1[nKeep] = Ycoord_Index1[iEdge];
+      Zcoord_Index1[nKeep] = Zcoord_Index1[iEdge];
+      Variable_Index1[nKeep] = Variable_Index1[iEdge];
+      IGlobalID_Index1[nKeep] = IGlobalID_Index1[iEdge];
+      JGlobalID_Index1[nKeep] = JGlobalID_Index1[iEdge];
+      ++nKeep;
+    }
+    Resize(nKeep);
+  }
+
+  void Resize(size_t n) {
+    for (auto* vec : {&Xcoord_Index0, &Ycoord_Index0, &Zcoord_Index0, &Variable_Index0, &Xcoord_Index1,
+                      &Ycoord_Index1, &Zcoord_Index1, &Variable_Index1})
+      vec->resize(n);
+    for (auto* vec : {&IGlobalID_Index0, &JGlobalID_Index0, &IGlobalID_Index1, &JGlobalID_Index1}) vec->resize(n);
+  }
+};
+
+/*!
+ * \brief Side of the nacelle w.r.t. a section plane, only elements with a non-negative value are cut.
+ */
+su2double NacelleCrossProduct(const su2double* AveCoord, const su2double* Plane_Normal, const CConfig* config) {
+  su2double Tilt_Angle = config->GetNacelleLocation(3) * PI_NUMBER / 180;
+  su2double Toe_Angle = config->GetNacelleLocation(4) * PI_NUMBER / 180;
+
+  /*--- Translate to the origin ---*/
+
+  su2double XCoord_Trans = AveCoord[0] - config->GetNacelleLocation(0);
+  su2double YCoord_Trans = AveCoord[1] - config->GetNacelleLocation(1);
+  su2double ZCoord_Trans = AveCoord[2] - config->GetNacelleLocation(2);
+
+  /*--- Apply tilt angle ---*/
+
+  su2double XCoord_Trans_Tilt = XCoord_Trans * cos(Tilt_Angle) + ZCoord_Trans * sin(Tilt_Angle);
+  su2double YCoord_Trans_Tilt = YCoord_Trans;
+  su2double ZCoord_Trans_Tilt = ZCoord_Trans * cos(Tilt_Angle) - XCoord_Trans * sin(Tilt_Angle);
+
+  /*--- Apply toe angle ---*/
+
+  su2double YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * sin(Toe_Angle) + YCoord_Trans_Tilt * cos(Toe_Angle);
+  su2double ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+
+  /*--- Undo plane rotation, we have already rotated the nacelle ---*/
+
+  /*--- Undo tilt angle ---*/
+
+  su2double XPlane_Normal_Tilt = Plane_Normal[0] * cos(-Tilt_Angle) + Plane_Normal[2] * sin(-Tilt_Angle);
+  su2double YPlane_Normal_Tilt = Plane_Normal[1];
+  su2double ZPlane_Normal_Tilt = Plane_Normal[2] * cos(-Tilt_Angle) - Plane_Normal[0] * sin(-Tilt_Angle);
+
+  /*--- Undo toe angle ---*/
+
+  su2double YPlane_Normal_Tilt_Toe = XPlane_Normal_Tilt * sin(-Toe_Angle) + YPlane_Normal_Tilt * cos(-Toe_Angle);
+  su2double ZPlane_Normal_Tilt_Toe = ZPlane_Normal_Tilt;
+
+  return YCoord_Trans_Tilt_Toe * ZPlane_Normal_Tilt_Toe - ZCoord_Trans_Tilt_Toe * YPlane_Normal_Tilt_Toe;
+}
+
+/*!
+ * \brief Remove degenerate and repeated segments, and chain the remaining ones into an ordered airfoil,
+ *        starting from the trailing edge.
+ * \return False if the curve is incomplete (a single open end), the caller reports it.
+ */
+bool ChainSectionSegments(const su2double* Plane_Normal, const CConfig* config, SectionSegments& Segments,
+                          vector<su2double>& Xcoord_Airfoil, vector<su2double>& Ycoord_Airfoil,
+                          vector<su2double>& Zcoord_Airfoil, vector<su2double>& Variable_Airfoil) {
+  unsigned short Index = 0;
+  long Next_Edge = 0;
+  unsigned long iEdge, jEdge, Trailing_Point, Airfoil_Point, EdgeDonor;
+  su2double Trailing_Coord;
+  bool Found_Edge, FoundEdge;
+  passivedouble Dist_Value;
+  vector<unsigned long> IGlobalID_Airfoil, JGlobalID_Airfoil;
+  vector<unsigned short> Conection_Index0, Conection_Index1;
+  vector<su2double> XcoordExtra, YcoordExtra, ZcoordExtra, VariableExtra;
+  vector<unsigned long> IGlobalIDExtra, JGlobalIDExtra;
+  vector<bool> AddExtra;
+
+  auto& Xcoord_Index0 = Segments.Xcoord_Index0;
+  auto& Ycoord_Index0 = Segments.Ycoord_Index0;
+  auto& Zcoord_Index0 = Segments.Zcoord_Index0;
+  auto& Variable_Index0 = Segments.Variable_Index0;
+  auto& IGlobalID_Index0 = Segments.IGlobalID_Index0;
+  auto& JGlobalID_Index0 = Segments.JGlobalID_Index0;
+  auto& Xcoord_Index1 = Segments.Xcoord_Index1;
+  auto& Ycoord_Index1 = Segments.Ycoord_Index1;
+  auto& Zcoord_Index1 = Segments.Zcoord_Index1;
+  auto& Variable_Index1 = Segments.Variable_Index1;
+  auto& IGlobalID_Index1 = Segments.IGlobalID_Index1;
+  auto& JGlobalID_Index1 = Segments.JGlobalID_Index1;
+
+  /*--- Remove singular edges (both end points on the same mesh edge) ---*/
+
+  const auto SameEdge = [](unsigned long I0, unsigned long J0, unsigned long I1, unsigned long J1) {
+    return ((I0 == I1) && (J0 == J1)) || ((I0 == J1) && (J0 == I1));
+  };
+
+  vector<bool> keep(Segments.size());
+  for (iEdge = 0; iEdge < Segments.size(); iEdge++) {
+    keep[iEdge] = !SameEdge(IGlobalID_Index0[iEdge], JGlobalID_Index0[iEdge], IGlobalID_Index1[iEdge],
+                            JGlobalID_Index1[iEdge]);
+  }
+  Segments.Filter(keep);
+
+  /*--- Remove repeated edges (same mesh edges in any orientation), this could happend because the MPI.
+   The first occurrence is kept, segments are identified by the sorted global indices of their edges. ---*/
+
+  using EdgeKey = std::array<unsigned long, 4>;
+  std::set<EdgeKey> Unique;
+  keep.assign(Segments.size(), true);
+  for (iEdge = 0; iEdge < Segments.size(); iEdge++) {
+    std::array<unsigned long, 2> Edge0 = {{min(IGlobalID_Index0[iEdge], JGlobalID_Index0[iEdge]),
+                                           max(IGlobalID_Index0[iEdge], JGlobalID_Index0[iEdge])}};
+    std::array<unsigned long, 2> Edge1 = {{min(IGlobalID_Index1[iEdge], JGlobalID_Index1[iEdge]),
+                                           max(IGlobalID_Index1[iEdge], JGlobalID_Index1[iEdge])}};
+    if (Edge1 < Edge0) swap(Edge0, Edge1);
+    keep[iEdge] = Unique.insert(EdgeKey{{Edge0[0], Edge0[1], Edge1[0], Edge1[1]}}).second;
+  }
+  Segments.Filter(keep);
+
+  bool Complete = true;
+
+  if (Xcoord_Index0.empty()) return Complete;
+
+  if (Xcoord_Index0.size() != 1) {
+    /*--- Rotate from the Y-Z plane to the X-Z plane to reuse the rest of subroutines  ---*/
+
+    if (config->GetGeo_Description() == FUSELAGE) {
+      su2double Angle = -0.5 * PI_NUMBER;
+      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+        su2double XCoord = Xcoord_Index0[iEdge] * cos(Angle) - Ycoord_Index0[iEdge] * sin(Angle);
+        su2double YCoord = Ycoord_Index0[iEdge] * cos(Angle) + Xcoord_Index0[iEdge] * sin(Angle);
+        su2double ZCoord = Zcoord_Index0[iEdge];
+        Xcoord_Index0[iEdge] = XCoord;
+        Ycoord_Index0[iEdge] = YCoord;
+        Zcoord_Index0[iEdge] = ZCoord;
+        XCoord = Xcoord_Index1[iEdge] * cos(Angle) - Ycoord_Index1[iEdge] * sin(Angle);
+        YCoord = Ycoord_Index1[iEdge] * cos(Angle) + Xcoord_Index1[iEdge] * sin(Angle);
+        ZCoord = Zcoord_Index1[iEdge];
+        Xcoord_Index1[iEdge] = XCoord;
+        Ycoord_Index1[iEdge] = YCoord;
+        Zcoord_Index1[iEdge] = ZCoord;
+      }
+    }
+
+    /*--- Rotate nacelle secction to a X-Z plane to reuse the rest of subroutines  ---*/
+
+    if (config->GetGeo_Description() == NACELLE) {
+      su2double Tilt_Angle = config->GetNacelleLocation(3) * PI_NUMBER / 180;
+      su2double Toe_Angle = config->GetNacelleLocation(4) * PI_NUMBER / 180;
+      su2double Theta_deg = atan2(Plane_Normal[1], -Plane_Normal[2]) / PI_NUMBER * 180 + 180;
+      su2double Roll_Angle = 0.5 * PI_NUMBER - Theta_deg * PI_NUMBER / 180;
+
+      su2double XCoord_Trans, YCoord_Trans, ZCoord_Trans, XCoord_Trans_Tilt, YCoord_Trans_Tilt, ZCoord_Trans_Tilt,
+          XCoord_Trans_Tilt_Toe, YCoord_Trans_Tilt_Toe, ZCoord_Trans_Tilt_Toe, XCoord, YCoord, ZCoord;
+
+      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+        /*--- First point of the edge ---*/
+
+        /*--- Translate to the origin ---*/
+
+        XCoord_Trans = Xcoord_Index0[iEdge] - config->GetNacelleLocation(0);
+        YCoord_Trans = Ycoord_Index0[iEdge] - config->GetNacelleLocation(1);
+        ZCoord_Trans = Zcoord_Index0[iEdge] - config->GetNacelleLocation(2);
+
+        /*--- Apply tilt angle ---*/
+
+        XCoord_Trans_Tilt = XCoord_Trans * cos(Tilt_Angle) + ZCoord_Trans * sin(Tilt_Angle);
+        YCoord_Trans_Tilt = YCoord_Trans;
+        ZCoord_Trans_Tilt = ZCoord_Trans * cos(Tilt_Angle) - XCoord_Trans * sin(Tilt_Angle);
+
+        /*--- Apply toe angle ---*/
+
+        XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * cos(Toe_Angle) - YCoord_Trans_Tilt * sin(Toe_Angle);
+        YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * sin(Toe_Angle) + YCoord_Trans_Tilt * cos(Toe_Angle);
+        ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+
+        /*--- Rotate to X-Z plane (roll) ---*/
+
+        XCoord = XCoord_Trans_Tilt_Toe;
+        YCoord = YCoord_Trans_Tilt_Toe * cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe * sin(Roll_Angle);
+        ZCoord = YCoord_Trans_Tilt_Toe * sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe * cos(Roll_Angle);
+
+        /*--- Update coordinates ---*/
+
+        Xcoord_Index0[iEdge] = XCoord;
+        Ycoord_Index0[iEdge] = YCoord;
+        Zcoord_Index0[iEdge] = ZCoord;
+
+        /*--- Second point of the edge ---*/
+
+        /*--- Translate to the origin ---*/
+
+        XCoord_Trans = Xcoord_Index1[iEdge] - config->GetNacelleLocation(0);
+        YCoord_Trans = Ycoord_Index1[iEdge] - config->GetNacelleLocation(1);
+        ZCoord_Trans = Zcoord_Index1[iEdge] - config->GetNacelleLocation(2);
+
+        /*--- Apply tilt angle ---*/
+
+        XCoord_Trans_Tilt = XCoord_Trans * cos(Tilt_Angle) + ZCoord_Trans * sin(Tilt_Angle);
+        YCoord_Trans_Tilt = YCoord_Trans;
+        ZCoord_Trans_Tilt = ZCoord_Trans * cos(Tilt_Angle) - XCoord_Trans * sin(Tilt_Angle);
+
+        /*--- Apply toe angle ---*/
+
+        XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * cos(Toe_Angle) - YCoord_Trans_Tilt * sin(Toe_Angle);
+        YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * sin(Toe_Angle) + YCoord_Trans_Tilt * cos(Toe_Angle);
+        ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+
+        /*--- Rotate to X-Z plane (roll) ---*/
+
+        XCoord = XCoord_Trans_Tilt_Toe;
+        YCoord = YCoord_Trans_Tilt_Toe * cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe * sin(Roll_Angle);
+        ZCoord = YCoord_Trans_Tilt_Toe * sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe * cos(Roll_Angle);
+
+        /*--- Update coordinates ---*/
+
+        Xcoord_Index1[iEdge] = XCoord;
+        Ycoord_Index1[iEdge] = YCoord;
+        Zcoord_Index1[iEdge] = ZCoord;
+      }
+    }
+
+    /*--- Identify the extreme of the curve and close it ---*/
+
+    Conection_Index0.assign(Xcoord_Index0.size(), 0);
+    Conection_Index1.assign(Xcoord_Index0.size(), 0);
+
+    for (iEdge = 0; iEdge < Xcoord_Index0.size() - 1; iEdge++) {
+      for (jEdge = iEdge + 1; jEdge < Xcoord_Index0.size(); jEdge++) {
+        if (((IGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]) &&
+             (JGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge])) ||
+            ((IGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge]) &&
+             (JGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]))) {
+          Conection_Index0[iEdge]++;
+          Conection_Index0[jEdge]++;
+        }
+
+        if (((IGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]) &&
+             (JGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge])) ||
+            ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge]) &&
+             (JGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]))) {
+          Conection_Index0[iEdge]++;
+          Conection_Index1[jEdge]++;
+        }
+
+        if (((IGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge]) &&
+             (JGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge])) ||
+            ((IGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge]) &&
+             (JGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge]))) {
+          Conection_Index1[iEdge]++;
+          Conection_Index0[jEdge]++;
+        }
+
+        if (((IGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge]) &&
+             (JGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge])) ||
+            ((IGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge]) &&
+             (JGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge]))) {
+          Conection_Index1[iEdge]++;
+          Conection_Index1[jEdge]++;
+        }
+      }
+    }
+
+    /*--- Connect extremes of the curves ---*/
+
+    /*--- First: Identify the extremes of the curve in the extra vector  ---*/
+
+    for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+      if (Conection_Index0[iEdge] == 0) {
+        XcoordExtra.push_back(Xcoord_Index0[iEdge]);
+        YcoordExtra.push_back(Ycoord_Index0[iEdge]);
+        ZcoordExtra.push_back(Zcoord_Index0[iEdge]);
+        VariableExtra.push_back(Variable_Index0[iEdge]);
+        IGlobalIDExtra.push_back(IGlobalID_Index0[iEdge]);
+        JGlobalIDExtra.push_back(JGlobalID_Index0[iEdge]);
+        AddExtra.push_back(true);
+      }
+      if (Conection_Index1[iEdge] == 0) {
+        XcoordExtra.push_back(Xcoord_Index1[iEdge]);
+        YcoordExtra.push_back(Ycoord_Index1[iEdge]);
+        ZcoordExtra.push_back(Zcoord_Index1[iEdge]);
+        VariableExtra.push_back(Variable_Index1[iEdge]);
+        IGlobalIDExtra.push_back(IGlobalID_Index1[iEdge]);
+        JGlobalIDExtra.push_back(JGlobalID_Index1[iEdge]);
+        AddExtra.push_back(true);
+      }
+    }
+
+    /*--- Second, if it is an open curve then find the closest point to an extreme to close it  ---*/
+
+    if (XcoordExtra.size() > 1) {
+      for (iEdge = 0; iEdge < XcoordExtra.size() - 1; iEdge++) {
+        su2double MinDist = 1E6;
+        FoundEdge = false;
+        EdgeDonor = 0;
+        for (jEdge = iEdge + 1; jEdge < XcoordExtra.size(); jEdge++) {
+          Dist_Value =
+              sqrt(pow(SU2_TYPE::GetValue(XcoordExtra[iEdge]) - SU2_TYPE::GetValue(XcoordExtra[jEdge]), 2.0));
+          if ((Dist_Value < MinDist) && (AddExtra[iEdge]) && (AddExtra[jEdge])) {
+            EdgeDonor = jEdge;
+            FoundEdge = true;
+          }
+        }
+
+        if (FoundEdge) {
+          /*--- Add first point of the new edge ---*/
+
+          Xcoord_Index0.push_back(XcoordExtra[iEdge]);
+          Ycoord_Index0.push_back(YcoordExtra[iEdge]);
+          Zcoord_Index0.push_back(ZcoordExtra[iEdge]);
+          Variable_Index0.push_back(VariableExtra[iEdge]);
+          IGlobalID_Index0.push_back(IGlobalIDExtra[iEdge]);
+          JGlobalID_Index0.push_back(JGlobalIDExtra[iEdge]);
+          AddExtra[iEdge] = false;
+
+          /*--- Add second (closest)  point of the new edge ---*/
+
+          Xcoord_Index1.push_back(XcoordExtra[EdgeDonor]);
+          Ycoord_Index1.push_back(YcoordExtra[EdgeDonor]);
+          Zcoord_Index1.push_back(ZcoordExtra[EdgeDonor]);
+          Variable_Index1.push_back(VariableExtra[EdgeDonor]);
+          IGlobalID_Index1.push_back(IGlobalIDExtra[EdgeDonor]);
+          JGlobalID_Index1.push_back(JGlobalIDExtra[EdgeDonor]);
+          AddExtra[EdgeDonor] = false;
+        }
+      }
+
+    }
+
+    else if (XcoordExtra.size() == 1) {
+      Complete = false;
+    }
+
+    /*--- Find and add the trailing edge to to the list
+     and the contect the first point to the trailing edge ---*/
+
+    Trailing_Point = 0;
+    Trailing_Coord = Xcoord_Index0[0];
+    for (iEdge = 1; iEdge < Xcoord_Index0.size(); iEdge++) {
+      if (Xcoord_Index0[iEdge] > Trailing_Coord) {
+        Trailing_Point = iEdge;
+        Trailing_Coord = Xcoord_Index0[iEdge];
+      }
+    }
+
+    Xcoord_Airfoil.push_back(Xcoord_Index0[Trailing_Point]);
+    Ycoord_Airfoil.push_back(Ycoord_Index0[Trailing_Point]);
+    Zcoord_Airfoil.push_back(Zcoord_Index0[Trailing_Point]);
+    Variable_Airfoil.push_back(Variable_Index0[Trailing_Point]);
+    IGlobalID_Airfoil.push_back(IGlobalID_Index0[Trailing_Point]);
+    JGlobalID_Airfoil.push_back(JGlobalID_Index0[Trailing_Point]);
+
+    Xcoord_Airfoil.push_back(Xcoord_Index1[Trailing_Point]);
+    Ycoord_Airfoil.push_back(Ycoord_Index1[Trailing_Point]);
+    Zcoord_Airfoil.push_back(Zcoord_Index1[Trailing_Point]);
+    Variable_Airfoil.push_back(Variable_Index1[Trailing_Point]);
+    IGlobalID_Airfoil.push_back(IGlobalID_Index1[Trailing_Point]);
+    JGlobalID_Airfoil.push_back(JGlobalID_Index1[Trailing_Point]);
+
+    Xcoord_Index0.erase(Xcoord_Index0.begin() + Trailing_Point);
+    Ycoord_Index0.erase(Ycoord_Index0.begin() + Trailing_Point);
+    Zcoord_Index0.erase(Zcoord_Index0.begin() + Trailing_Point);
+    Variable_Index0.erase(Variable_Index0.begin() + Trailing_Point);
+    IGlobalID_Index0.erase(IGlobalID_Index0.begin() + Trailing_Point);
+    JGlobalID_Index0.erase(JGlobalID_Index0.begin() + Trailing_Point);
+
+    Xcoord_Index1.erase(Xcoord_Index1.begin() + Trailing_Point);
+    Ycoord_Index1.erase(Ycoord_Index1.begin() + Trailing_Point);
+    Zcoord_Index1.erase(Zcoord_Index1.begin() + Trailing_Point);
+    Variable_Index1.erase(Variable_Index1.begin() + Trailing_Point);
+    IGlobalID_Index1.erase(IGlobalID_Index1.begin() + Trailing_Point);
+    JGlobalID_Index1.erase(JGlobalID_Index1.begin() + Trailing_Point);
+
+    /*--- Algorithm for adding the rest of the points ---*/
+
+    do {
+      /*--- Last added point in the list ---*/
+
+      Airfoil_Point = Xcoord_Airfoil.size() - 1;
+
+      /*--- Find the closest point  ---*/
+
+      Found_Edge = false;
+
+      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
+        if (((IGlobalID_Index0[iEdge] == IGlobalID_Airfoil[Airfoil_Point]) &&
+             (JGlobalID_Index0[iEdge] == JGlobalID_Airfoil[Airfoil_Point])) ||
+            ((IGlobalID_Index0[iEdge] == JGlobalID_Airfoil[Airfoil_Point]) &&
+             (JGlobalID_Index0[iEdge] == IGlobalID_Airfoil[Airfoil_Point]))) {
+          Next_Edge = iEdge;
+          Found_Edge = true;
+          Index = 0;
+          break;
+        }
+
+        if (((IGlobalID_Index1[iEdge] == IGlobalID_Airfoil[Airfoil_Point]) &&
+             (JGlobalID_Index1[iEdge] == JGlobalID_Airfoil[Airfoil_Point])) ||
+            ((IGlobalID_Index1[iEdge] == JGlobalID_Airfoil[Airfoil_Point]) &&
+             (JGlobalID_Index1[iEdge] == IGlobalID_Airfoil[Airfoil_Point]))) {
+          Next_Edge = iEdge;
+          Found_Edge = true;
+          Index = 1;
+          break;
+        }
+      }
+
+      /*--- Add and remove the next point to the list and the next point in the edge ---*/
+
+      if (Found_Edge) {
+        if (Index == 0) {
+          Xcoord_Airfoil.push_back(Xcoord_Index1[Next_Edge]);
+          Ycoord_Airfoil.push_back(Ycoord_Index1[Next_Edge]);
+          Zcoord_Airfoil.push_back(Zcoord_Index1[Next_Edge]);
+          Variable_Airfoil.push_back(Variable_Index1[Next_Edge]);
+          IGlobalID_Airfoil.push_back(IGlobalID_Index1[Next_Edge]);
+          JGlobalID_Airfoil.push_back(JGlobalID_Index1[Next_Edge]);
+        }
+
+        if (Index == 1) {
+          Xcoord_Airfoil.push_back(Xcoord_Index0[Next_Edge]);
+          Ycoord_Airfoil.push_back(Ycoord_Index0[Next_Edge]);
+          Zcoord_Airfoil.push_back(Zcoord_Index0[Next_Edge]);
+          Variable_Airfoil.push_back(Variable_Index0[Next_Edge]);
+          IGlobalID_Airfoil.push_back(IGlobalID_Index0[Next_Edge]);
+          JGlobalID_Airfoil.push_back(JGlobalID_Index0[Next_Edge]);
+        }
+
+        Xcoord_Index0.erase(Xcoord_Index0.begin() + Next_Edge);
+        Ycoord_Index0.erase(Ycoord_Index0.begin() + Next_Edge);
+        Zcoord_Index0.erase(Zcoord_Index0.begin() + Next_Edge);
+        Variable_Index0.erase(Variable_Index0.begin() + Next_Edge);
+        IGlobalID_Index0.erase(IGlobalID_Index0.begin() + Next_Edge);
+        JGlobalID_Index0.erase(JGlobalID_Index0.begin() + Next_Edge);
+
+        Xcoord_Index1.erase(Xcoord_Index1.begin() + Next_Edge);
+        Ycoord_Index1.erase(Ycoord_Index1.begin() + Next_Edge);
+        Zcoord_Index1.erase(Zcoord_Index1.begin() + Next_Edge);
+        Variable_Index1.erase(Variable_Index1.begin() + Next_Edge);
+        IGlobalID_Index1.erase(IGlobalID_Index1.begin() + Next_Edge);
+        JGlobalID_Index1.erase(JGlobalID_Index1.begin() + Next_Edge);
+
+      } else {
+        break;
+      }
+
+    } while (!Xcoord_Index0.empty());
+
+    /*--- Clean the vector before using them again for storing the upper or the lower side ---*/
+
+    Xcoord_Index0.clear();
+    Ycoord_Index0.clear();
+    Zcoord_Index0.clear();
+    Variable_Index0.clear();
+    IGlobalID_Index0.clear();
+    JGlobalID_Index0.clear();
+    Xcoord_Index1.clear();
+    Ycoord_Index1.clear();
+    Zcoord_Index1.clear();
+    Variable_Index1.clear();
+    IGlobalID_Index1.clear();
+    JGlobalID_Index1.clear();
+  }
+  return Complete;
+}
+}  // namespace
+
 void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Normal, su2double MinXCoord,
                                        su2double MaxXCoord, su2double MinYCoord, su2double MaxYCoord,
                                        su2double MinZCoord, su2double MaxZCoord, const su2double* FlowVariable,
                                        vector<su2double>& Xcoord_Airfoil, vector<su2double>& Ycoord_Airfoil,
                                        vector<su2double>& Zcoord_Airfoil, vector<su2double>& Variable_Airfoil,
                                        bool original_surface, CConfig* config) {
-  const bool wasActive = AD::BeginPassive();
+  /*--- The deformed section is differentiated (SU2_GEO gradients), the original one is not. ---*/
+  const bool wasActive = original_surface && AD::BeginPassive();
 
-  unsigned short iMarker, iNode, jNode, iDim, Index = 0;
+  unsigned short iMarker, iNode, jNode, iDim;
   bool intersect;
-  long Next_Edge = 0;
-  unsigned long iPoint, jPoint, iElem, Trailing_Point, Airfoil_Point, iVertex, iEdge, PointIndex, jEdge;
+  unsigned long iPoint, jPoint, iElem, iVertex, iEdge, PointIndex;
   su2double Segment_P0[3] = {0.0, 0.0, 0.0}, Segment_P1[3] = {0.0, 0.0, 0.0}, Variable_P0 = 0.0, Variable_P1 = 0.0,
-            Intersection[3] = {0.0, 0.0, 0.0}, Trailing_Coord, *VarCoord = nullptr, Variable_Interp,
-            v1[3] = {0.0, 0.0, 0.0}, v3[3] = {0.0, 0.0, 0.0}, CrossProduct = 1.0;
-  bool Found_Edge;
-  passivedouble Dist_Value;
-  vector<su2double> Xcoord_Index0, Ycoord_Index0, Zcoord_Index0, Variable_Index0, Xcoord_Index1, Ycoord_Index1,
-      Zcoord_Index1, Variable_Index1;
-  vector<unsigned long> IGlobalID_Index0, JGlobalID_Index0, IGlobalID_Index1, JGlobalID_Index1, IGlobalID_Airfoil,
-      JGlobalID_Airfoil;
-  vector<unsigned short> Conection_Index0, Conection_Index1;
-  vector<unsigned long> Duplicate;
+            Intersection[3] = {0.0, 0.0, 0.0}, *VarCoord = nullptr, Variable_Interp, CrossProduct = 1.0;
   su2double** Coord_Variation = nullptr;
-  vector<su2double> XcoordExtra, YcoordExtra, ZcoordExtra, VariableExtra;
-  vector<unsigned long> IGlobalIDExtra, JGlobalIDExtra;
-  vector<bool> AddExtra;
-  unsigned long EdgeDonor;
-  bool FoundEdge;
+
+  SectionSegments Segments;
+  auto& Xcoord_Index0 = Segments.Xcoord_Index0;
+  auto& Ycoord_Index0 = Segments.Ycoord_Index0;
+  auto& Zcoord_Index0 = Segments.Zcoord_Index0;
+  auto& Variable_Index0 = Segments.Variable_Index0;
+  auto& IGlobalID_Index0 = Segments.IGlobalID_Index0;
+  auto& JGlobalID_Index0 = Segments.JGlobalID_Index0;
+  auto& Xcoord_Index1 = Segments.Xcoord_Index1;
+  auto& Ycoord_Index1 = Segments.Ycoord_Index1;
+  auto& Zcoord_Index1 = Segments.Zcoord_Index1;
+  auto& Variable_Index1 = Segments.Variable_Index1;
+  auto& IGlobalID_Index1 = Segments.IGlobalID_Index1;
+  auto& JGlobalID_Index1 = Segments.JGlobalID_Index1;
 
 #ifdef HAVE_MPI
   unsigned long nLocalEdge, MaxLocalEdge, *Buffer_Send_nEdge, *Buffer_Receive_nEdge, nBuffer_Coord, nBuffer_Variable,
@@ -1573,8 +2136,6 @@ void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Nor
   Ycoord_Airfoil.clear();
   Zcoord_Airfoil.clear();
   Variable_Airfoil.clear();
-  IGlobalID_Airfoil.clear();
-  JGlobalID_Airfoil.clear();
 
   /*--- Set the right plane in 2D (note the change in Y-Z plane) ---*/
 
@@ -1635,44 +2196,8 @@ void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Nor
         CrossProduct = 1.0;
 
         if (config->GetGeo_Description() == NACELLE) {
-          su2double Tilt_Angle = config->GetNacelleLocation(3) * PI_NUMBER / 180;
-          su2double Toe_Angle = config->GetNacelleLocation(4) * PI_NUMBER / 180;
-
-          /*--- Translate to the origin ---*/
-
-          su2double XCoord_Trans = AveXCoord - config->GetNacelleLocation(0);
-          su2double YCoord_Trans = AveYCoord - config->GetNacelleLocation(1);
-          su2double ZCoord_Trans = AveZCoord - config->GetNacelleLocation(2);
-
-          /*--- Apply tilt angle ---*/
-
-          su2double XCoord_Trans_Tilt = XCoord_Trans * cos(Tilt_Angle) + ZCoord_Trans * sin(Tilt_Angle);
-          su2double YCoord_Trans_Tilt = YCoord_Trans;
-          su2double ZCoord_Trans_Tilt = ZCoord_Trans * cos(Tilt_Angle) - XCoord_Trans * sin(Tilt_Angle);
-
-          /*--- Apply toe angle ---*/
-
-          su2double YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * sin(Toe_Angle) + YCoord_Trans_Tilt * cos(Toe_Angle);
-          su2double ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
-
-          /*--- Undo plane rotation, we have already rotated the nacelle ---*/
-
-          /*--- Undo tilt angle ---*/
-
-          su2double XPlane_Normal_Tilt = Plane_Normal[0] * cos(-Tilt_Angle) + Plane_Normal[2] * sin(-Tilt_Angle);
-          su2double YPlane_Normal_Tilt = Plane_Normal[1];
-          su2double ZPlane_Normal_Tilt = Plane_Normal[2] * cos(-Tilt_Angle) - Plane_Normal[0] * sin(-Tilt_Angle);
-
-          /*--- Undo toe angle ---*/
-
-          su2double YPlane_Normal_Tilt_Toe =
-              XPlane_Normal_Tilt * sin(-Toe_Angle) + YPlane_Normal_Tilt * cos(-Toe_Angle);
-          su2double ZPlane_Normal_Tilt_Toe = ZPlane_Normal_Tilt;
-
-          v1[1] = YCoord_Trans_Tilt_Toe - 0.0;
-          v1[2] = ZCoord_Trans_Tilt_Toe - 0.0;
-          v3[0] = v1[1] * ZPlane_Normal_Tilt_Toe - v1[2] * YPlane_Normal_Tilt_Toe;
-          CrossProduct = v3[0] * 1.0;
+          const su2double AveCoord[] = {AveXCoord, AveYCoord, AveZCoord};
+          CrossProduct = NacelleCrossProduct(AveCoord, Plane_Normal, config);
         }
 
         for (unsigned short iFace = 0; iFace < bound[iMarker][iElem]->GetnFaces(); iFace++) {
@@ -1867,449 +2392,389 @@ void CGeometry::ComputeAirfoil_Section(su2double* Plane_P0, su2double* Plane_Nor
 #endif
 
   if ((rank == MASTER_NODE) && (!Xcoord_Index0.empty())) {
-    /*--- Remove singular edges ---*/
-
-    bool Remove;
+    if (!ChainSectionSegments(Plane_Normal, config, Segments, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                              Variable_Airfoil)) {
+      cout << "There cutting system has failed, there is an incomplete curve (not used)." << endl;
+    }
+  }
 
-    do {
-      Remove = false;
-      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-        if (((IGlobalID_Index0[iEdge] == IGlobalID_Index1[iEdge]) &&
-             (JGlobalID_Index0[iEdge] == JGlobalID_Index1[iEdge])) ||
-            ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[iEdge]) &&
-             (JGlobalID_Index0[iEdge] == IGlobalID_Index1[iEdge]))) {
-          Xcoord_Index0.erase(Xcoord_Index0.begin() + iEdge);
-          Ycoord_Index0.erase(Ycoord_Index0.begin() + iEdge);
-          Zcoord_Index0.erase(Zcoord_Index0.begin() + iEdge);
-          Variable_Index0.erase(Variable_Index0.begin() + iEdge);
-          IGlobalID_Index0.erase(IGlobalID_Index0.begin() + iEdge);
-          JGlobalID_Index0.erase(JGlobalID_Index0.begin() + iEdge);
-
-          Xcoord_Index1.erase(Xcoord_Index1.begin() + iEdge);
-          Ycoord_Index1.erase(Ycoord_Index1.begin() + iEdge);
-          Zcoord_Index1.erase(Zcoord_Index1.begin() + iEdge);
-          Variable_Index1.erase(Variable_Index1.begin() + iEdge);
-          IGlobalID_Index1.erase(IGlobalID_Index1.begin() + iEdge);
-          JGlobalID_Index1.erase(JGlobalID_Index1.begin() + iEdge);
-
-          Remove = true;
-          break;
-        }
-        if (Remove) break;
-      }
-    } while (Remove);
+  AD::EndPassive(wasActive);
+}
 
-    /*--- Remove repeated edges computing distance, this could happend because the MPI ---*/
+void CGeometry::ComputeAirfoil_Sections(unsigned short nPlane, su2double* const* Plane_P0,
+                                        su2double* const* Plane_Normal, vector<su2double>* Xcoord_Airfoil,
+                                        vector<su2double>* Ycoord_Airfoil, vector<su2double>* Zcoord_Airfoil,
+                                        vector<su2double>* Variable_Airfoil, bool original_surface, CConfig* config) {
+  /*--- In 2D the section is the whole surface, there is nothing to batch. ---*/
 
-    do {
-      Remove = false;
-      for (iEdge = 0; iEdge < Xcoord_Index0.size() - 1; iEdge++) {
-        for (jEdge = iEdge + 1; jEdge < Xcoord_Index0.size(); jEdge++) {
-          /*--- Edges with the same orientation ---*/
-
-          if ((((IGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]) &&
-                (JGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge])) ||
-               ((IGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge]) &&
-                (JGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]))) &&
-              (((IGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge]) &&
-                (JGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge])) ||
-               ((IGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge]) &&
-                (JGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge])))) {
-            Xcoord_Index0.erase(Xcoord_Index0.begin() + jEdge);
-            Ycoord_Index0.erase(Ycoord_Index0.begin() + jEdge);
-            Zcoord_Index0.erase(Zcoord_Index0.begin() + jEdge);
-            Variable_Index0.erase(Variable_Index0.begin() + jEdge);
-            IGlobalID_Index0.erase(IGlobalID_Index0.begin() + jEdge);
-            JGlobalID_Index0.erase(JGlobalID_Index0.begin() + jEdge);
-
-            Xcoord_Index1.erase(Xcoord_Index1.begin() + jEdge);
-            Ycoord_Index1.erase(Ycoord_Index1.begin() + jEdge);
-            Zcoord_Index1.erase(Zcoord_Index1.begin() + jEdge);
-            Variable_Index1.erase(Variable_Index1.begin() + jEdge);
-            IGlobalID_Index1.erase(IGlobalID_Index1.begin() + jEdge);
-            JGlobalID_Index1.erase(JGlobalID_Index1.begin() + jEdge);
-
-            Remove = true;
-            break;
-          }
+  if (nDim == 2) {
+    for (auto iPlane = 0u; iPlane < nPlane; iPlane++) {
+      ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, nullptr,
+                             Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
+                             Variable_Airfoil[iPlane], original_surface, config);
+    }
+    return;
+  }
 
-          /*--- Edges with oposite orientation ---*/
-
-          if ((((IGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]) &&
-                (JGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge])) ||
-               ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge]) &&
-                (JGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]))) &&
-              (((IGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge]) &&
-                (JGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge])) ||
-               ((IGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge]) &&
-                (JGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge])))) {
-            Xcoord_Index0.erase(Xcoord_Index0.begin() + jEdge);
-            Ycoord_Index0.erase(Ycoord_Index0.begin() + jEdge);
-            Zcoord_Index0.erase(Zcoord_Index0.begin() + jEdge);
-            Variable_Index0.erase(Variable_Index0.begin() + jEdge);
-            IGlobalID_Index0.erase(IGlobalID_Index0.begin() + jEdge);
-            JGlobalID_Index0.erase(JGlobalID_Index0.begin() + jEdge);
-
-            Xcoord_Index1.erase(Xcoord_Index1.begin() + jEdge);
-            Ycoord_Index1.erase(Ycoord_Index1.begin() + jEdge);
-            Zcoord_Index1.erase(Zcoord_Index1.begin() + jEdge);
-            Variable_Index1.erase(Variable_Index1.begin() + jEdge);
-            IGlobalID_Index1.erase(IGlobalID_Index1.begin() + jEdge);
-            JGlobalID_Index1.erase(JGlobalID_Index1.begin() + jEdge);
-
-            Remove = true;
-            break;
-          }
-          if (Remove) break;
-        }
-        if (Remove) break;
-      }
+  /*--- The deformed sections are differentiated (SU2_GEO gradients), the original ones are not. ---*/
+  const bool wasActive = original_surface && AD::BeginPassive();
 
-    } while (Remove);
-
-    if (Xcoord_Index0.size() != 1) {
-      /*--- Rotate from the Y-Z plane to the X-Z plane to reuse the rest of subroutines  ---*/
-
-      if (config->GetGeo_Description() == FUSELAGE) {
-        su2double Angle = -0.5 * PI_NUMBER;
-        for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-          su2double XCoord = Xcoord_Index0[iEdge] * cos(Angle) - Ycoord_Index0[iEdge] * sin(Angle);
-          su2double YCoord = Ycoord_Index0[iEdge] * cos(Angle) + Xcoord_Index0[iEdge] * sin(Angle);
-          su2double ZCoord = Zcoord_Index0[iEdge];
-          Xcoord_Index0[iEdge] = XCoord;
-          Ycoord_Index0[iEdge] = YCoord;
-          Zcoord_Index0[iEdge] = ZCoord;
-          XCoord = Xcoord_Index1[iEdge] * cos(Angle) - Ycoord_Index1[iEdge] * sin(Angle);
-          YCoord = Ycoord_Index1[iEdge] * cos(Angle) + Xcoord_Index1[iEdge] * sin(Angle);
-          ZCoord = Zcoord_Index1[iEdge];
-          Xcoord_Index1[iEdge] = XCoord;
-          Ycoord_Index1[iEdge] = YCoord;
-          Zcoord_Index1[iEdge] = ZCoord;
-        }
-      }
+  /*--- Same perturbation of the planes as in SegmentIntersectsPlane. ---*/
+  const passivedouble epsilon = 1E-6;
 
-      /*--- Rotate nacelle secction to a X-Z plane to reuse the rest of subroutines  ---*/
+  for (auto iPlane = 0u; iPlane < nPlane; iPlane++) {
+    Xcoord_Airfoil[iPlane].clear();
+    Ycoord_Airfoil[iPlane].clear();
+    Zcoord_Airfoil[iPlane].clear();
+    Variable_Airfoil[iPlane].clear();
+  }
 
-      if (config->GetGeo_Description() == NACELLE) {
-        su2double Tilt_Angle = config->GetNacelleLocation(3) * PI_NUMBER / 180;
-        su2double Toe_Angle = config->GetNacelleLocation(4) * PI_NUMBER / 180;
-        su2double Theta_deg = atan2(Plane_Normal[1], -Plane_Normal[2]) / PI_NUMBER * 180 + 180;
-        su2double Roll_Angle = 0.5 * PI_NUMBER - Theta_deg * PI_NUMBER / 180;
+  /*--- Coordinates of the points that are cut (with the vertex coordinate variations if
+   the surface is deformed), and list of the elements that are cut. ---*/
 
-        su2double XCoord_Trans, YCoord_Trans, ZCoord_Trans, XCoord_Trans_Tilt, YCoord_Trans_Tilt, ZCoord_Trans_Tilt,
-            XCoord_Trans_Tilt_Toe, YCoord_Trans_Tilt_Toe, ZCoord_Trans_Tilt_Toe, XCoord, YCoord, ZCoord;
+  su2activematrix SurfaceCoord(nPoint, nDim);
+  vector<pair<unsigned short, unsigned long> > CutElem;
 
-        for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-          /*--- First point of the edge ---*/
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    if (config->GetMarker_All_GeoEval(iMarker) != YES) continue;
 
-          /*--- Translate to the origin ---*/
+    for (auto iVertex = 0ul; iVertex < nVertex[iMarker]; iVertex++) {
+      const auto iPoint = vertex[iMarker][iVertex]->GetNode();
+      const su2double* VarCoord = vertex[iMarker][iVertex]->GetVarCoord();
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        SurfaceCoord(iPoint, iDim) = nodes->GetCoord(iPoint, iDim);
+        if (!original_surface) SurfaceCoord(iPoint, iDim) += VarCoord[iDim];
+      }
+    }
+    for (auto iElem = 0ul; iElem < nElem_Bound[iMarker]; iElem++) CutElem.emplace_back(iMarker, iElem);
+  }
+  const auto nCutElem = CutElem.size();
 
-          XCoord_Trans = Xcoord_Index0[iEdge] - config->GetNacelleLocation(0);
-          YCoord_Trans = Ycoord_Index0[iEdge] - config->GetNacelleLocation(1);
-          ZCoord_Trans = Zcoord_Index0[iEdge] - config->GetNacelleLocation(2);
+  /*--- Average coordinates of the elements (original surface) used to select the elements. ---*/
 
-          /*--- Apply tilt angle ---*/
+  su2activematrix AveCoord(nCutElem, 3);
+  vector<bool> InsideBounds(nCutElem);
 
-          XCoord_Trans_Tilt = XCoord_Trans * cos(Tilt_Angle) + ZCoord_Trans * sin(Tilt_Angle);
-          YCoord_Trans_Tilt = YCoord_Trans;
-          ZCoord_Trans_Tilt = ZCoord_Trans * cos(Tilt_Angle) - XCoord_Trans * sin(Tilt_Angle);
+  for (auto iCut = 0ul; iCut < nCutElem; iCut++) {
+    const auto* elem = bound[CutElem[iCut].first][CutElem[iCut].second];
+    for (auto iDim = 0u; iDim < 3; iDim++) AveCoord(iCut, iDim) = 0.0;
+    for (auto iNode = 0u; iNode < elem->GetnNodes(); iNode++) {
+      const auto iPoint = elem->GetNode(iNode);
+      for (auto iDim = 0u; iDim < nDim; iDim++) AveCoord(iCut, iDim) += nodes->GetCoord(iPoint, iDim);
+    }
+    for (auto iDim = 0u; iDim < 3; iDim++) AveCoord(iCut, iDim) /= su2double(elem->GetnNodes());
 
-          /*--- Apply toe angle ---*/
+    InsideBounds[iCut] = (fabs(AveCoord(iCut, 0)) < 1E6) && (fabs(AveCoord(iCut, 1)) < 1E6) &&
+                         (fabs(AveCoord(iCut, 2)) < 1E6);
+  }
 
-          XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * cos(Toe_Angle) - YCoord_Trans_Tilt * sin(Toe_Angle);
-          YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * sin(Toe_Angle) + YCoord_Trans_Tilt * cos(Toe_Angle);
-          ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+  /*--- Group the planes by normal, and for each group bin the elements by their extent along the normal,
+   so that each plane only visits the elements of one bin instead of the entire surface. ---*/
 
-          /*--- Rotate to X-Z plane (roll) ---*/
+  struct ElementBins {
+    passivedouble Normal[3], Min, Max, Width, Tol;
+    unsigned long nBin;
+    vector<passivedouble> ElemMin, ElemMax;
+    vector<unsigned long> Start, Elem;
 
-          XCoord = XCoord_Trans_Tilt_Toe;
-          YCoord = YCoord_Trans_Tilt_Toe * cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe * sin(Roll_Angle);
-          ZCoord = YCoord_Trans_Tilt_Toe * sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe * cos(Roll_Angle);
+    unsigned long Bin(passivedouble val) const {
+      const auto b = static_cast<long>(floor((val - Min) / Width));
+      return static_cast<unsigned long>(max(0l, min(b, static_cast<long>(nBin) - 1)));
+    }
+  };
+  vector<ElementBins> Bins;
+  vector<unsigned short> PlaneGroup(nPlane);
+
+  for (auto iPlane = 0u; iPlane < nPlane; iPlane++) {
+    passivedouble Normal[3];
+    for (auto iDim = 0u; iDim < 3; iDim++) Normal[iDim] = SU2_TYPE::GetValue(Plane_Normal[iPlane][iDim]) + epsilon;
+
+    unsigned short iGroup = 0;
+    for (; iGroup < Bins.size(); iGroup++) {
+      const auto& n = Bins[iGroup].Normal;
+      if ((n[0] == Normal[0]) && (n[1] == Normal[1]) && (n[2] == Normal[2])) break;
+    }
+    PlaneGroup[iPlane] = iGroup;
+    if (iGroup < Bins.size()) continue;
+
+    Bins.emplace_back();
+    auto& bins = Bins.back();
+    for (auto iDim = 0u; iDim < 3; iDim++) bins.Normal[iDim] = Normal[iDim];
+
+    bins.ElemMin.resize(nCutElem);
+    bins.ElemMax.resize(nCutElem);
+    bins.Min = numeric_limits<passivedouble>::max();
+    bins.Max = numeric_limits<passivedouble>::lowest();
+
+    for (auto iCut = 0ul; iCut < nCutElem; iCut++) {
+      const auto* elem = bound[CutElem[iCut].first][CutElem[iCut].second];
+      passivedouble ElemMin = numeric_limits<passivedouble>::max(), ElemMax = numeric_limits<passivedouble>::lowest();
+      for (auto iNode = 0u; iNode < elem->GetnNodes(); iNode++) {
+        const auto iPoint = elem->GetNode(iNode);
+        passivedouble Proj = 0.0;
+        for (auto iDim = 0u; iDim < nDim; iDim++) Proj += Normal[iDim] * SU2_TYPE::GetValue(SurfaceCoord(iPoint, iDim));
+        ElemMin = min(ElemMin, Proj);
+        ElemMax = max(ElemMax, Proj);
+      }
+      bins.ElemMin[iCut] = ElemMin;
+      bins.ElemMax[iCut] = ElemMax;
+      bins.Min = min(bins.Min, ElemMin);
+      bins.Max = max(bins.Max, ElemMax);
+    }
 
-          /*--- Update coordinates ---*/
+    /*--- The tolerance only adds candidates, the exact test is SegmentIntersectsPlane. ---*/
 
-          Xcoord_Index0[iEdge] = XCoord;
-          Ycoord_Index0[iEdge] = YCoord;
-          Zcoord_Index0[iEdge] = ZCoord;
+    bins.Tol = 1E-8 * max(fabs(bins.Min), fabs(bins.Max)) + 1E-12;
+    bins.nBin = max<unsigned long>(1, nCutElem / 16);
+    bins.Width = (bins.Max - bins.Min) / bins.nBin;
+    if (!(bins.Width > 0.0)) {
+      bins.nBin = 1;
+      bins.Width = 1.0;
+    }
 
-          /*--- Second point of the edge ---*/
+    /*--- Compressed storage of the elements of each bin, in ascending element order. ---*/
 
-          /*--- Translate to the origin ---*/
+    bins.Start.assign(bins.nBin + 1, 0);
+    for (auto iCut = 0ul; iCut < nCutElem; iCut++) {
+      for (auto iBin = bins.Bin(bins.ElemMin[iCut] - bins.Tol); iBin <= bins.Bin(bins.ElemMax[iCut] + bins.Tol); iBin++)
+        bins.Start[iBin + 1]++;
+    }
+    for (auto iBin = 0ul; iBin < bins.nBin; iBin++) bins.Start[iBin + 1] += bins.Start[iBin];
 
-          XCoord_Trans = Xcoord_Index1[iEdge] - config->GetNacelleLocation(0);
-          YCoord_Trans = Ycoord_Index1[iEdge] - config->GetNacelleLocation(1);
-          ZCoord_Trans = Zcoord_Index1[iEdge] - config->GetNacelleLocation(2);
+    bins.Elem.resize(bins.Start[bins.nBin]);
+    vector<unsigned long> Fill(bins.Start.begin(), bins.Start.end() - 1);
+    for (auto iCut = 0ul; iCut < nCutElem; iCut++) {
+      for (auto iBin = bins.Bin(bins.ElemMin[iCut] - bins.Tol); iBin <= bins.Bin(bins.ElemMax[iCut] + bins.Tol); iBin++)
+        bins.Elem[Fill[iBin]++] = iCut;
+    }
+  }
 
-          /*--- Apply tilt angle ---*/
+  /*--- Cut all the planes, in parallel. The segments of each plane are stored in element order. ---*/
 
-          XCoord_Trans_Tilt = XCoord_Trans * cos(Tilt_Angle) + ZCoord_Trans * sin(Tilt_Angle);
-          YCoord_Trans_Tilt = YCoord_Trans;
-          ZCoord_Trans_Tilt = ZCoord_Trans * cos(Tilt_Angle) - XCoord_Trans * sin(Tilt_Angle);
+  vector<SectionSegments> Local(nPlane);
 
-          /*--- Apply toe angle ---*/
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_DYN(1)
+    for (auto iPlane = 0u; iPlane < nPlane; iPlane++) {
+      const auto& bins = Bins[PlaneGroup[iPlane]];
+      auto& Segments = Local[iPlane];
 
-          XCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * cos(Toe_Angle) - YCoord_Trans_Tilt * sin(Toe_Angle);
-          YCoord_Trans_Tilt_Toe = XCoord_Trans_Tilt * sin(Toe_Angle) + YCoord_Trans_Tilt * cos(Toe_Angle);
-          ZCoord_Trans_Tilt_Toe = ZCoord_Trans_Tilt;
+      passivedouble Offset = 0.0;
+      for (auto iDim = 0u; iDim < 3; iDim++)
+        Offset += bins.Normal[iDim] * (SU2_TYPE::GetValue(Plane_P0[iPlane][iDim]) + epsilon);
 
-          /*--- Rotate to X-Z plane (roll) ---*/
+      if ((Offset < bins.Min - bins.Tol) || (Offset > bins.Max + bins.Tol)) continue;
 
-          XCoord = XCoord_Trans_Tilt_Toe;
-          YCoord = YCoord_Trans_Tilt_Toe * cos(Roll_Angle) - ZCoord_Trans_Tilt_Toe * sin(Roll_Angle);
-          ZCoord = YCoord_Trans_Tilt_Toe * sin(Roll_Angle) + ZCoord_Trans_Tilt_Toe * cos(Roll_Angle);
+      const auto iBin = bins.Bin(Offset);
 
-          /*--- Update coordinates ---*/
+      for (auto iList = bins.Start[iBin]; iList < bins.Start[iBin + 1]; iList++) {
+        const auto iCut = bins.Elem[iList];
+        if ((Offset < bins.ElemMin[iCut] - bins.Tol) || (Offset > bins.ElemMax[iCut] + bins.Tol)) continue;
+        if (!InsideBounds[iCut]) continue;
 
-          Xcoord_Index1[iEdge] = XCoord;
-          Ycoord_Index1[iEdge] = YCoord;
-          Zcoord_Index1[iEdge] = ZCoord;
+        if (config->GetGeo_Description() == NACELLE) {
+          if (NacelleCrossProduct(AveCoord[iCut], Plane_Normal[iPlane], config) < 0.0) continue;
         }
-      }
 
-      /*--- Identify the extreme of the curve and close it ---*/
+        const auto* elem = bound[CutElem[iCut].first][CutElem[iCut].second];
+        unsigned short PointIndex = 0;
 
-      Conection_Index0.reserve(Xcoord_Index0.size() + 1);
-      Conection_Index1.reserve(Xcoord_Index0.size() + 1);
-
-      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-        Conection_Index0[iEdge] = 0;
-        Conection_Index1[iEdge] = 0;
-      }
+        for (unsigned short iFace = 0; iFace < elem->GetnFaces(); iFace++) {
+          const auto iPoint = elem->GetNode(elem->GetFaces(iFace, 0));
+          const auto jPoint = elem->GetNode(elem->GetFaces(iFace, 1));
 
-      for (iEdge = 0; iEdge < Xcoord_Index0.size() - 1; iEdge++) {
-        for (jEdge = iEdge + 1; jEdge < Xcoord_Index0.size(); jEdge++) {
-          if (((IGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]) &&
-               (JGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge])) ||
-              ((IGlobalID_Index0[iEdge] == JGlobalID_Index0[jEdge]) &&
-               (JGlobalID_Index0[iEdge] == IGlobalID_Index0[jEdge]))) {
-            Conection_Index0[iEdge]++;
-            Conection_Index0[jEdge]++;
+          su2double Segment_P0[3] = {0.0}, Segment_P1[3] = {0.0}, Intersection[3] = {0.0}, Variable_Interp = 0.0;
+          for (auto iDim = 0u; iDim < nDim; iDim++) {
+            Segment_P0[iDim] = SurfaceCoord(iPoint, iDim);
+            Segment_P1[iDim] = SurfaceCoord(jPoint, iDim);
           }
 
-          if (((IGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]) &&
-               (JGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge])) ||
-              ((IGlobalID_Index0[iEdge] == JGlobalID_Index1[jEdge]) &&
-               (JGlobalID_Index0[iEdge] == IGlobalID_Index1[jEdge]))) {
-            Conection_Index0[iEdge]++;
-            Conection_Index1[jEdge]++;
+          if (!SegmentIntersectsPlane(Segment_P0, Segment_P1, 0.0, 0.0, Plane_P0[iPlane], Plane_Normal[iPlane],
+                                      Intersection, Variable_Interp))
+            continue;
+
+          if (PointIndex == 0) {
+            Segments.Xcoord_Index0.push_back(Intersection[0]);
+            Segments.Ycoord_Index0.push_back(Intersection[1]);
+            Segments.Zcoord_Index0.push_back(Intersection[2]);
+            Segments.Variable_Index0.push_back(Variable_Interp);
+            Segments.IGlobalID_Index0.push_back(nodes->GetGlobalIndex(iPoint));
+            Segments.JGlobalID_Index0.push_back(nodes->GetGlobalIndex(jPoint));
           }
-
-          if (((IGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge]) &&
-               (JGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge])) ||
-              ((IGlobalID_Index1[iEdge] == JGlobalID_Index0[jEdge]) &&
-               (JGlobalID_Index1[iEdge] == IGlobalID_Index0[jEdge]))) {
-            Conection_Index1[iEdge]++;
-            Conection_Index0[jEdge]++;
-          }
-
-          if (((IGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge]) &&
-               (JGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge])) ||
-              ((IGlobalID_Index1[iEdge] == JGlobalID_Index1[jEdge]) &&
-               (JGlobalID_Index1[iEdge] == IGlobalID_Index1[jEdge]))) {
-            Conection_Index1[iEdge]++;
-            Conection_Index1[jEdge]++;
+          if (PointIndex == 1) {
+            Segments.Xcoord_Index1.push_back(Intersection[0]);
+            Segments.Ycoord_Index1.push_back(Intersection[1]);
+            Segments.Zcoord_Index1.push_back(Intersection[2]);
+            Segments.Variable_Index1.push_back(Variable_Interp);
+            Segments.IGlobalID_Index1.push_back(nodes->GetGlobalIndex(iPoint));
+            Segments.JGlobalID_Index1.push_back(nodes->GetGlobalIndex(jPoint));
           }
+          PointIndex++;
         }
       }
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
 
-      /*--- Connect extremes of the curves ---*/
-
-      /*--- First: Identify the extremes of the curve in the extra vector  ---*/
+  /*--- Each plane is chained by one rank (iPlane % size), send the segments of each plane to that rank.
+   The segments are received in rank order, the same order as when gathering on the master. ---*/
 
-      for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-        if (Conection_Index0[iEdge] == 0) {
-          XcoordExtra.push_back(Xcoord_Index0[iEdge]);
-          YcoordExtra.push_back(Ycoord_Index0[iEdge]);
-          ZcoordExtra.push_back(Zcoord_Index0[iEdge]);
-          VariableExtra.push_back(Variable_Index0[iEdge]);
-          IGlobalIDExtra.push_back(IGlobalID_Index0[iEdge]);
-          JGlobalIDExtra.push_back(JGlobalID_Index0[iEdge]);
-          AddExtra.push_back(true);
-        }
-        if (Conection_Index1[iEdge] == 0) {
-          XcoordExtra.push_back(Xcoord_Index1[iEdge]);
-          YcoordExtra.push_back(Ycoord_Index1[iEdge]);
-          ZcoordExtra.push_back(Zcoord_Index1[iEdge]);
-          VariableExtra.push_back(Variable_Index1[iEdge]);
-          IGlobalIDExtra.push_back(IGlobalID_Index1[iEdge]);
-          JGlobalIDExtra.push_back(JGlobalID_Index1[iEdge]);
-          AddExtra.push_back(true);
-        }
-      }
+  vector<unsigned long> nLocalSeg(nPlane), nSeg(nPlane * size);
+  for (auto iPlane = 0u; iPlane < nPlane; iPlane++) nLocalSeg[iPlane] = Local[iPlane].Xcoord_Index1.size();
 
-      /*--- Second, if it is an open curve then find the closest point to an extreme to close it  ---*/
-
-      if (XcoordExtra.size() > 1) {
-        for (iEdge = 0; iEdge < XcoordExtra.size() - 1; iEdge++) {
-          su2double MinDist = 1E6;
-          FoundEdge = false;
-          EdgeDonor = 0;
-          for (jEdge = iEdge + 1; jEdge < XcoordExtra.size(); jEdge++) {
-            Dist_Value =
-                sqrt(pow(SU2_TYPE::GetValue(XcoordExtra[iEdge]) - SU2_TYPE::GetValue(XcoordExtra[jEdge]), 2.0));
-            if ((Dist_Value < MinDist) && (AddExtra[iEdge]) && (AddExtra[jEdge])) {
-              EdgeDonor = jEdge;
-              FoundEdge = true;
-            }
-          }
+  SU2_MPI::Allgather(nLocalSeg.data(), nPlane, MPI_UNSIGNED_LONG, nSeg.data(), nPlane, MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
 
-          if (FoundEdge) {
-            /*--- Add first point of the new edge ---*/
-
-            Xcoord_Index0.push_back(XcoordExtra[iEdge]);
-            Ycoord_Index0.push_back(YcoordExtra[iEdge]);
-            Zcoord_Index0.push_back(ZcoordExtra[iEdge]);
-            Variable_Index0.push_back(VariableExtra[iEdge]);
-            IGlobalID_Index0.push_back(IGlobalIDExtra[iEdge]);
-            JGlobalID_Index0.push_back(JGlobalIDExtra[iEdge]);
-            AddExtra[iEdge] = false;
-
-            /*--- Add second (closest)  point of the new edge ---*/
-
-            Xcoord_Index1.push_back(XcoordExtra[EdgeDonor]);
-            Ycoord_Index1.push_back(YcoordExtra[EdgeDonor]);
-            Zcoord_Index1.push_back(ZcoordExtra[EdgeDonor]);
-            Variable_Index1.push_back(VariableExtra[EdgeDonor]);
-            IGlobalID_Index1.push_back(IGlobalIDExtra[EdgeDonor]);
-            JGlobalID_Index1.push_back(JGlobalIDExtra[EdgeDonor]);
-            AddExtra[EdgeDonor] = false;
-          }
-        }
+  vector<int> SendCount(size, 0), SendDispl(size + 1, 0), RecvCount(size, 0), RecvDispl(size + 1, 0);
+  for (auto iPlane = 0u; iPlane < nPlane; iPlane++) {
+    SendCount[iPlane % size] += nLocalSeg[iPlane];
+    if (int(iPlane % size) == rank) {
+      for (int iRank = 0; iRank < size; iRank++) RecvCount[iRank] += nSeg[iRank * nPlane + iPlane];
+    }
+  }
+  for (int iRank = 0; iRank < size; iRank++) {
+    SendDispl[iRank + 1] = SendDispl[iRank] + SendCount[iRank];
+    RecvDispl[iRank + 1] = RecvDispl[iRank] + RecvCount[iRank];
+  }
 
+  constexpr int nCoordSeg = 8, nIDSeg = 4;
+  vector<su2double> SendCoord(nCoordSeg * SendDispl[size]), RecvCoord(nCoordSeg * RecvDispl[size]);
+  vector<unsigned long> SendID(nIDSeg * SendDispl[size]), RecvID(nIDSeg * RecvDispl[size]);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    auto iSeg = SendDispl[iRank];
+    for (auto iPlane = iRank; iPlane < nPlane; iPlane += size) {
+      const auto& Segments = Local[iPlane];
+      for (auto iEdge = 0ul; iEdge < nLocalSeg[iPlane]; iEdge++, iSeg++) {
+        su2double* Coord = &SendCoord[nCoordSeg * iSeg];
+        Coord[0] = Segments.Xcoord_Index0[iEdge];
+        Coord[1] = Segments.Ycoord_Index0[iEdge];
+        Coord[2] = Segments.Zcoord_Index0[iEdge];
+        Coord[3] = Segments.Variable_Index0[iEdge];
+        Coord[4] = Segments.Xcoord_Index1[iEdge];
+        Coord[5] = Segments.Ycoord_Index1[iEdge];
+        Coord[6] = Segments.Zcoord_Index1[iEdge];
+        Coord[7] = Segments.Variable_Index1[iEdge];
+        unsigned long* ID = &SendID[nIDSeg * iSeg];
+        ID[0] = Segments.IGlobalID_Index0[iEdge];
+        ID[1] = Segments.JGlobalID_Index0[iEdge];
+        ID[2] = Segments.IGlobalID_Index1[iEdge];
+        ID[3] = Segments.JGlobalID_Index1[iEdge];
       }
-
-      else if (XcoordExtra.size() == 1) {
-        cout << "There cutting system has failed, there is an incomplete curve (not used)." << endl;
+    }
+  }
+  Local.clear();
+
+  auto Scale = [](const vector<int>& vec, int factor) {
+    vector<int> scaled(vec);
+    for (auto& val : scaled) val *= factor;
+    return scaled;
+  };
+
+  SU2_MPI::Alltoallv(SendCoord.data(), Scale(SendCount, nCoordSeg).data(), Scale(SendDispl, nCoordSeg).data(),
+                     MPI_DOUBLE, RecvCoord.data(), Scale(RecvCount, nCoordSeg).data(),
+                     Scale(RecvDispl, nCoordSeg).data(), MPI_DOUBLE, SU2_MPI::GetComm());
+  SU2_MPI::Alltoallv(SendID.data(), Scale(SendCount, nIDSeg).data(), Scale(SendDispl, nIDSeg).data(),
+                     MPI_UNSIGNED_LONG, RecvID.data(), Scale(RecvCount, nIDSeg).data(), Scale(RecvDispl, nIDSeg).data(),
+                     MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  /*--- Assemble the segments of the planes owned by this rank. ---*/
+
+  vector<unsigned short> MyPlanes;
+  for (auto iPlane = rank; iPlane < nPlane; iPlane += size) MyPlanes.push_back(iPlane);
+  const auto nMyPlane = MyPlanes.size();
+
+  vector<SectionSegments> Owned(nMyPlane);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    auto iSeg = RecvDispl[iRank];
+    for (auto iMyPlane = 0ul; iMyPlane < nMyPlane; iMyPlane++) {
+      auto& Segments = Owned[iMyPlane];
+      for (auto iEdge = 0ul; iEdge < nSeg[iRank * nPlane + MyPlanes[iMyPlane]]; iEdge++, iSeg++) {
+        const su2double* Coord = &RecvCoord[nCoordSeg * iSeg];
+        Segments.Xcoord_Index0.push_back(Coord[0]);
+        Segments.Ycoord_Index0.push_back(Coord[1]);
+        Segments.Zcoord_Index0.push_back(Coord[2]);
+        Segments.Variable_Index0.push_back(Coord[3]);
+        Segments.Xcoord_Index1.push_back(Coord[4]);
+        Segments.Ycoord_Index1.push_back(Coord[5]);
+        Segments.Zcoord_Index1.push_back(Coord[6]);
+        Segments.Variable_Index1.push_back(Coord[7]);
+        const unsigned long* ID = &RecvID[nIDSeg * iSeg];
+        Segments.IGlobalID_Index0.push_back(ID[0]);
+        Segments.JGlobalID_Index0.push_back(ID[1]);
+        Segments.IGlobalID_Index1.push_back(ID[2]);
+        Segments.JGlobalID_Index1.push_back(ID[3]);
       }
+    }
+  }
 
-      /*--- Find and add the trailing edge to to the list
-       and the contect the first point to the trailing edge ---*/
+  /*--- Chain the segments of the owned planes into airfoils, in parallel. The incomplete curves are
+   counted and reported once by the master. ---*/
 
-      Trailing_Point = 0;
-      Trailing_Coord = Xcoord_Index0[0];
-      for (iEdge = 1; iEdge < Xcoord_Index0.size(); iEdge++) {
-        if (Xcoord_Index0[iEdge] > Trailing_Coord) {
-          Trailing_Point = iEdge;
-          Trailing_Coord = Xcoord_Index0[iEdge];
-        }
-      }
+  vector<vector<su2double> > MyXcoord(nMyPlane), MyYcoord(nMyPlane), MyZcoord(nMyPlane), MyVariable(nMyPlane);
+  vector<char> Incomplete(nMyPlane, false);
 
-      Xcoord_Airfoil.push_back(Xcoord_Index0[Trailing_Point]);
-      Ycoord_Airfoil.push_back(Ycoord_Index0[Trailing_Point]);
-      Zcoord_Airfoil.push_back(Zcoord_Index0[Trailing_Point]);
-      Variable_Airfoil.push_back(Variable_Index0[Trailing_Point]);
-      IGlobalID_Airfoil.push_back(IGlobalID_Index0[Trailing_Point]);
-      JGlobalID_Airfoil.push_back(JGlobalID_Index0[Trailing_Point]);
-
-      Xcoord_Airfoil.push_back(Xcoord_Index1[Trailing_Point]);
-      Ycoord_Airfoil.push_back(Ycoord_Index1[Trailing_Point]);
-      Zcoord_Airfoil.push_back(Zcoord_Index1[Trailing_Point]);
-      Variable_Airfoil.push_back(Variable_Index1[Trailing_Point]);
-      IGlobalID_Airfoil.push_back(IGlobalID_Index1[Trailing_Point]);
-      JGlobalID_Airfoil.push_back(JGlobalID_Index1[Trailing_Point]);
-
-      Xcoord_Index0.erase(Xcoord_Index0.begin() + Trailing_Point);
-      Ycoord_Index0.erase(Ycoord_Index0.begin() + Trailing_Point);
-      Zcoord_Index0.erase(Zcoord_Index0.begin() + Trailing_Point);
-      Variable_Index0.erase(Variable_Index0.begin() + Trailing_Point);
-      IGlobalID_Index0.erase(IGlobalID_Index0.begin() + Trailing_Point);
-      JGlobalID_Index0.erase(JGlobalID_Index0.begin() + Trailing_Point);
-
-      Xcoord_Index1.erase(Xcoord_Index1.begin() + Trailing_Point);
-      Ycoord_Index1.erase(Ycoord_Index1.begin() + Trailing_Point);
-      Zcoord_Index1.erase(Zcoord_Index1.begin() + Trailing_Point);
-      Variable_Index1.erase(Variable_Index1.begin() + Trailing_Point);
-      IGlobalID_Index1.erase(IGlobalID_Index1.begin() + Trailing_Point);
-      JGlobalID_Index1.erase(JGlobalID_Index1.begin() + Trailing_Point);
-
-      /*--- Algorithm for adding the rest of the points ---*/
-
-      do {
-        /*--- Last added point in the list ---*/
-
-        Airfoil_Point = Xcoord_Airfoil.size() - 1;
-
-        /*--- Find the closest point  ---*/
-
-        Found_Edge = false;
-
-        for (iEdge = 0; iEdge < Xcoord_Index0.size(); iEdge++) {
-          if (((IGlobalID_Index0[iEdge] == IGlobalID_Airfoil[Airfoil_Point]) &&
-               (JGlobalID_Index0[iEdge] == JGlobalID_Airfoil[Airfoil_Point])) ||
-              ((IGlobalID_Index0[iEdge] == JGlobalID_Airfoil[Airfoil_Point]) &&
-               (JGlobalID_Index0[iEdge] == IGlobalID_Airfoil[Airfoil_Point]))) {
-            Next_Edge = iEdge;
-            Found_Edge = true;
-            Index = 0;
-            break;
-          }
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_DYN(1)
+    for (auto iMyPlane = 0ul; iMyPlane < nMyPlane; iMyPlane++) {
+      if (Owned[iMyPlane].size() == 0) continue;
+      Incomplete[iMyPlane] = !ChainSectionSegments(Plane_Normal[MyPlanes[iMyPlane]], config, Owned[iMyPlane],
+                                                   MyXcoord[iMyPlane], MyYcoord[iMyPlane], MyZcoord[iMyPlane],
+                                                   MyVariable[iMyPlane]);
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
 
-          if (((IGlobalID_Index1[iEdge] == IGlobalID_Airfoil[Airfoil_Point]) &&
-               (JGlobalID_Index1[iEdge] == JGlobalID_Airfoil[Airfoil_Point])) ||
-              ((IGlobalID_Index1[iEdge] == JGlobalID_Airfoil[Airfoil_Point]) &&
-               (JGlobalID_Index1[iEdge] == IGlobalID_Airfoil[Airfoil_Point]))) {
-            Next_Edge = iEdge;
-            Found_Edge = true;
-            Index = 1;
-            break;
-          }
-        }
+  /*--- Gather the airfoils on the master node, the last entry of the counts is the number of incomplete curves. ---*/
 
-        /*--- Add and remove the next point to the list and the next point in the edge ---*/
+  vector<unsigned long> nMyAirfoilPoint(nPlane + 1, 0), nAirfoilPoint(nPlane + 1, 0);
+  for (auto iMyPlane = 0ul; iMyPlane < nMyPlane; iMyPlane++) {
+    nMyAirfoilPoint[MyPlanes[iMyPlane]] = MyXcoord[iMyPlane].size();
+    nMyAirfoilPoint[nPlane] += Incomplete[iMyPlane];
+  }
 
-        if (Found_Edge) {
-          if (Index == 0) {
-            Xcoord_Airfoil.push_back(Xcoord_Index1[Next_Edge]);
-            Ycoord_Airfoil.push_back(Ycoord_Index1[Next_Edge]);
-            Zcoord_Airfoil.push_back(Zcoord_Index1[Next_Edge]);
-            Variable_Airfoil.push_back(Variable_Index1[Next_Edge]);
-            IGlobalID_Airfoil.push_back(IGlobalID_Index1[Next_Edge]);
-            JGlobalID_Airfoil.push_back(JGlobalID_Index1[Next_Edge]);
-          }
+  SU2_MPI::Reduce(nMyAirfoilPoint.data(), nAirfoilPoint.data(), nPlane + 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE,
+                  SU2_MPI::GetComm());
 
-          if (Index == 1) {
-            Xcoord_Airfoil.push_back(Xcoord_Index0[Next_Edge]);
-            Ycoord_Airfoil.push_back(Ycoord_Index0[Next_Edge]);
-            Zcoord_Airfoil.push_back(Zcoord_Index0[Next_Edge]);
-            Variable_Airfoil.push_back(Variable_Index0[Next_Edge]);
-            IGlobalID_Airfoil.push_back(IGlobalID_Index0[Next_Edge]);
-            JGlobalID_Airfoil.push_back(JGlobalID_Index0[Next_Edge]);
-          }
+  if ((rank == MASTER_NODE) && (nAirfoilPoint[nPlane] > 0)) {
+    cout << "The cutting system has failed, there are " << nAirfoilPoint[nPlane]
+         << " incomplete curves (not used)." << endl;
+  }
 
-          Xcoord_Index0.erase(Xcoord_Index0.begin() + Next_Edge);
-          Ycoord_Index0.erase(Ycoord_Index0.begin() + Next_Edge);
-          Zcoord_Index0.erase(Zcoord_Index0.begin() + Next_Edge);
-          Variable_Index0.erase(Variable_Index0.begin() + Next_Edge);
-          IGlobalID_Index0.erase(IGlobalID_Index0.begin() + Next_Edge);
-          JGlobalID_Index0.erase(JGlobalID_Index0.begin() + Next_Edge);
-
-          Xcoord_Index1.erase(Xcoord_Index1.begin() + Next_Edge);
-          Ycoord_Index1.erase(Ycoord_Index1.begin() + Next_Edge);
-          Zcoord_Index1.erase(Zcoord_Index1.begin() + Next_Edge);
-          Variable_Index1.erase(Variable_Index1.begin() + Next_Edge);
-          IGlobalID_Index1.erase(IGlobalID_Index1.begin() + Next_Edge);
-          JGlobalID_Index1.erase(JGlobalID_Index1.begin() + Next_Edge);
-
-        } else {
-          break;
-        }
+  vector<su2double> SendAirfoil;
+  for (auto iMyPlane = 0ul; iMyPlane < nMyPlane; iMyPlane++) {
+    for (const auto* vec : {&MyXcoord[iMyPlane], &MyYcoord[iMyPlane], &MyZcoord[iMyPlane], &MyVariable[iMyPlane]})
+      SendAirfoil.insert(SendAirfoil.end(), vec->begin(), vec->end());
+  }
 
-      } while (!Xcoord_Index0.empty());
+  /*--- The counts are only known (and needed) on the master. ---*/
 
-      /*--- Clean the vector before using them again for storing the upper or the lower side ---*/
+  vector<int> AirfoilCount(size, 0), AirfoilDispl(size + 1, 0);
+  vector<su2double> RecvAirfoil;
 
-      Xcoord_Index0.clear();
-      Ycoord_Index0.clear();
-      Zcoord_Index0.clear();
-      Variable_Index0.clear();
-      IGlobalID_Index0.clear();
-      JGlobalID_Index0.clear();
-      Xcoord_Index1.clear();
-      Ycoord_Index1.clear();
-      Zcoord_Index1.clear();
-      Variable_Index1.clear();
-      IGlobalID_Index1.clear();
-      JGlobalID_Index1.clear();
+  if (rank == MASTER_NODE) {
+    for (auto iPlane = 0u; iPlane < nPlane; iPlane++) AirfoilCount[iPlane % size] += 4 * nAirfoilPoint[iPlane];
+    for (int iRank = 0; iRank < size; iRank++) AirfoilDispl[iRank + 1] = AirfoilDispl[iRank] + AirfoilCount[iRank];
+    RecvAirfoil.resize(AirfoilDispl[size]);
+  }
+
+  SU2_MPI::Gatherv(SendAirfoil.data(), SendAirfoil.size(), MPI_DOUBLE, RecvAirfoil.data(), AirfoilCount.data(),
+                   AirfoilDispl.data(), MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (rank == MASTER_NODE) {
+    for (int iRank = 0; iRank < size; iRank++) {
+      auto Pos = RecvAirfoil.begin() + AirfoilDispl[iRank];
+      for (auto iPlane = iRank; iPlane < nPlane; iPlane += size) {
+        const auto n = nAirfoilPoint[iPlane];
+        for (auto* vec : {&Xcoord_Airfoil[iPlane], &Ycoord_Airfoil[iPlane], &Zcoord_Airfoil[iPlane],
+                          &Variable_Airfoil[iPlane]}) {
+          vec->assign(Pos, Pos + n);
+          Pos += n;
+        }
+      }
     }
   }
 
@@ -2957,7 +3422,7 @@ void CGeometry::ComputeSurf_Curvature(CConfig* config) {
 
 void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
                                         const vector<pair<ENUM_FILTER_KERNEL, su2double>>& kernels,
-                                        const unsigned short search_limit, su2double* values) const {
+                                        su2double* values) const {
   /*--- Apply a filter to "input_values". The filter is an averaging process over the neighbourhood
   of each element, which is a circle in 2D and a sphere in 3D of radius "filter_radius".
   The filter is characterized by its kernel, i.e. how the weights are computed. Multiple kernels
@@ -2967,365 +3432,262 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double>& filter_radius,
   /*--- Check if we need to do any work. ---*/
   if (kernels.empty()) return;
 
-  /*--- FIRST: Gather the adjacency matrix, element centroids, volumes, and values on every
-  processor, this is required because the filter reaches far into adjacent partitions. ---*/
-
-  /*--- Adjacency matrix ---*/
-  vector<unsigned long> neighbour_start;
-  long* neighbour_idx = nullptr;
-  GetGlobalElementAdjacencyMatrix(neighbour_start, neighbour_idx);
-
-  /*--- Element centroids and volumes. ---*/
-  auto *cg_elem = new su2double[Global_nElemDomain * nDim], *vol_elem = new su2double[Global_nElemDomain];
-#ifdef HAVE_MPI
-  /*--- Number of subdomain each point is part of. ---*/
-  vector<char> halo_detect(Global_nElemDomain);
-#endif
-
-  /*--- Inputs of a filter stage, like with CG and volumes, each processor needs to see everything. ---*/
-  auto* work_values = new su2double[Global_nElemDomain];
-
-  /*--- When gathering the neighborhood of each element we use a vector of booleans to indicate
-  whether an element is already added to the list of neighbors (one vector per thread). ---*/
-  vector<vector<bool>> is_neighbor(omp_get_max_threads());
-
-  /*--- Begin OpenMP parallel section, count total number of searches for which
-  the recursion limit is reached and the full neighborhood is not considered. ---*/
-  unsigned long limited_searches = 0;
-
-  SU2_OMP_PARALLEL_(reduction(+ : limited_searches)) {
-    /*--- Initialize ---*/
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
-      for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem + iDim] = 0.0;
-      vol_elem[iElem] = 0.0;
-    }
-    END_SU2_OMP_FOR
-
-    /*--- Populate ---*/
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < nElem; ++iElem) {
-      auto iElem_global = elem[iElem]->GetGlobalIndex();
-      for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem_global + iDim] = elem[iElem]->GetCG(iDim);
-      vol_elem[iElem_global] = elem[iElem]->GetVolume();
-    }
-    END_SU2_OMP_FOR
+  /*--- FIRST: Build (or reuse) the sparse filter operators, these only depend on the mesh. ---*/
+  const auto& filter = GetElementFilterInfo(filter_radius, kernels);
 
-#ifdef HAVE_MPI
-    /*--- Account for the duplication introduced by the halo elements and the
-    reduction using MPI_SUM, which is required to maintain differentiabillity. ---*/
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) halo_detect[iElem] = 0;
-    END_SU2_OMP_FOR
-
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < nElem; ++iElem) halo_detect[elem[iElem]->GetGlobalIndex()] = 1;
-    END_SU2_OMP_FOR
+  /*--- Values of the local and halo-extended elements, inputs of each filter stage. ---*/
+  vector<su2double> work_values(filter.nElemExt);
+  vector<su2double> send_buf(filter.sendElem.size()), recv_buf(filter.recvElem.size());
 
-    /*--- Share with all processors ---*/
-    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-      auto* dbl_buffer = new su2double[Global_nElemDomain * nDim];
-      SU2_MPI::Allreduce(cg_elem, dbl_buffer, Global_nElemDomain * nDim, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      swap(dbl_buffer, cg_elem);
-      delete[] dbl_buffer;
+  for (unsigned long iKernel = 0; iKernel < kernels.size(); ++iKernel) {
+    const auto kernel_type = kernels[iKernel].first;
+    const su2double kernel_param = kernels[iKernel].second;
+    const auto& pattern = filter.pattern[iKernel];
+    const auto& weights = filter.weights[iKernel];
 
-      dbl_buffer = new su2double[Global_nElemDomain];
-      SU2_MPI::Allreduce(vol_elem, dbl_buffer, Global_nElemDomain, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      swap(dbl_buffer, vol_elem);
-      delete[] dbl_buffer;
-
-      vector<char> char_buffer(Global_nElemDomain);
-      MPI_Allreduce(halo_detect.data(), char_buffer.data(), Global_nElemDomain, MPI_CHAR, MPI_SUM, SU2_MPI::GetComm());
-      halo_detect.swap(char_buffer);
-    }
-    END_SU2_OMP_SAFE_GLOBAL_ACCESS
-
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
-      su2double numRepeat = halo_detect[iElem];
-      for (unsigned short iDim = 0; iDim < nDim; ++iDim) cg_elem[nDim * iElem + iDim] /= numRepeat;
-      vol_elem[iElem] /= numRepeat;
-    }
-    END_SU2_OMP_FOR
-#endif
-
-    /*--- SECOND: Each processor performs the average for its elements. For each
-    element we look for neighbours of neighbours of... until the distance to the
-    closest newly found one is greater than the filter radius.  ---*/
-
-    is_neighbor[omp_get_thread_num()].resize(Global_nElemDomain, false);
-
-    for (unsigned long iKernel = 0; iKernel < kernels.size(); ++iKernel) {
-      auto kernel_type = kernels[iKernel].first;
-      su2double kernel_param = kernels[iKernel].second;
-      su2double kernel_radius = filter_radius[iKernel];
-
-      /*--- Synchronize work values ---*/
-      /*--- Initialize ---*/
+    /*--- SECOND: Synchronize the values of the elements needed by the neighbours of each rank. ---*/
+    SU2_OMP_PARALLEL {
       SU2_OMP_FOR_STAT(256)
-      for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) work_values[iElem] = 0.0;
+      for (auto iElem = 0ul; iElem < nElem; ++iElem) work_values[iElem] = values[iElem];
       END_SU2_OMP_FOR
 
-      /*--- Populate ---*/
       SU2_OMP_FOR_STAT(256)
-      for (auto iElem = 0ul; iElem < nElem; ++iElem) work_values[elem[iElem]->GetGlobalIndex()] = values[iElem];
+      for (auto iSend = 0ul; iSend < filter.sendElem.size(); ++iSend) send_buf[iSend] = values[filter.sendElem[iSend]];
       END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
 
-#ifdef HAVE_MPI
-      /*--- Share with all processors ---*/
-      BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-        auto* buffer = new su2double[Global_nElemDomain];
-        SU2_MPI::Allreduce(work_values, buffer, Global_nElemDomain, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-        swap(buffer, work_values);
-        delete[] buffer;
-      }
-      END_SU2_OMP_SAFE_GLOBAL_ACCESS
+    SU2_MPI::Alltoallv(send_buf.data(), filter.sendCounts.data(), filter.sendDispls.data(), MPI_DOUBLE,
+                       recv_buf.data(), filter.recvCounts.data(), filter.recvDispls.data(), MPI_DOUBLE,
+                       SU2_MPI::GetComm());
 
-      /*--- Account for duplication ---*/
-      SU2_OMP_FOR_STAT(256)
-      for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
-        su2double numRepeat = halo_detect[iElem];
-        work_values[iElem] /= numRepeat;
-      }
-      END_SU2_OMP_FOR
-#endif
+    /*--- Copies of the same element received from different ranks have the same value. ---*/
+    for (auto iRecv = 0ul; iRecv < filter.recvElem.size(); ++iRecv) work_values[filter.recvElem[iRecv]] = recv_buf[iRecv];
 
-      /*--- Filter ---*/
-      SU2_OMP_FOR_DYN(128)
-      for (auto iElem = 0ul; iElem < nElem; ++iElem) {
-        int thread = omp_get_thread_num();
+    /*--- THIRD: Each rank applies the filter to its elements (sparse matrix-vector product). ---*/
+    SU2_OMP_PARALLEL_(for schedule(dynamic,128))
+    for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+      su2double numerator = 0.0;
+      auto k = pattern.outerPtr()[iElem];
+
+      switch (kernel_type) {
+        /*--- distance-based kernels (weighted averages), the weights are normalized. ---*/
+        case ENUM_FILTER_KERNEL::CONSTANT_WEIGHT:
+        case ENUM_FILTER_KERNEL::CONICAL_WEIGHT:
+        case ENUM_FILTER_KERNEL::GAUSSIAN_WEIGHT:
+          for (auto idx : pattern.getInnerIter(iElem)) numerator += weights[k++] * work_values[idx];
+          values[iElem] = numerator;
+          break;
 
-        /*--- Center of the search ---*/
-        auto iElem_global = elem[iElem]->GetGlobalIndex();
+        /*--- morphology kernels (image processing), the weights are 1/#neighbours. ---*/
+        case ENUM_FILTER_KERNEL::DILATE_MORPH:
+          for (auto idx : pattern.getInnerIter(iElem)) numerator += weights[k++] * exp(kernel_param * work_values[idx]);
+          values[iElem] = log(numerator) / kernel_param;
+          break;
 
-        /*--- Find the neighbours of iElem ---*/
-        vector<long> neighbours;
-        limited_searches +=
-            !GetRadialNeighbourhood(iElem_global, SU2_TYPE::GetValue(kernel_radius), search_limit, neighbour_start,
-                                    neighbour_idx, cg_elem, neighbours, is_neighbor[thread]);
-        /*--- Apply the kernel ---*/
-        su2double weight = 0.0, numerator = 0.0, denominator = 0.0;
+        case ENUM_FILTER_KERNEL::ERODE_MORPH:
+          for (auto idx : pattern.getInnerIter(iElem))
+            numerator += weights[k++] * exp(kernel_param * (1.0 - work_values[idx]));
+          values[iElem] = 1.0 - log(numerator) / kernel_param;
+          break;
 
-        switch (kernel_type) {
-          /*--- distance-based kernels (weighted averages) ---*/
-          case ENUM_FILTER_KERNEL::CONSTANT_WEIGHT:
-          case ENUM_FILTER_KERNEL::CONICAL_WEIGHT:
-          case ENUM_FILTER_KERNEL::GAUSSIAN_WEIGHT:
+        default:
+          SU2_MPI::Error("Unknown type of filter kernel", CURRENT_FUNCTION);
+      }
+    }
+    END_SU2_OMP_PARALLEL
+  }
+}
 
-            for (auto idx : neighbours) {
-              su2double distance = 0.0;
-              for (unsigned short iDim = 0; iDim < nDim; ++iDim)
-                distance += pow(cg_elem[nDim * iElem_global + iDim] - cg_elem[nDim * idx + iDim], 2);
-              distance = sqrt(distance);
+const CGeometry::CElementFilterInfo& CGeometry::GetElementFilterInfo(
+    const vector<su2double>& filter_radius, const vector<pair<ENUM_FILTER_KERNEL, su2double>>& kernels) const {
+  /*--- Check if the operators can be reused (the mesh is not expected to change between calls). ---*/
+  auto& filter = elementFilterInfo;
 
-              switch (kernel_type) {
-                case ENUM_FILTER_KERNEL::CONSTANT_WEIGHT:
-                  weight = 1.0;
-                  break;
-                case ENUM_FILTER_KERNEL::CONICAL_WEIGHT:
-                  weight = kernel_radius - distance;
-                  break;
-                case ENUM_FILTER_KERNEL::GAUSSIAN_WEIGHT:
-                  weight = exp(-0.5 * pow(distance / kernel_param, 2));
-                  break;
-                default:
-                  break;
-              }
-              weight *= vol_elem[idx];
-              numerator += weight * work_values[idx];
-              denominator += weight;
-            }
-            values[iElem] = numerator / denominator;
-            break;
+  bool reuse = (filter.kernels.size() == kernels.size());
+  for (auto iKernel = 0ul; reuse && iKernel < kernels.size(); ++iKernel) {
+    reuse = (filter.kernels[iKernel].first == kernels[iKernel].first) &&
+            (filter.kernels[iKernel].second == SU2_TYPE::GetValue(kernels[iKernel].second)) &&
+            (filter.radius[iKernel] == SU2_TYPE::GetValue(filter_radius[iKernel]));
+  }
+  if (reuse) return filter;
 
-          /*--- morphology kernels (image processing) ---*/
-          case ENUM_FILTER_KERNEL::DILATE_MORPH:
-          case ENUM_FILTER_KERNEL::ERODE_MORPH:
+  filter = CElementFilterInfo();
+  for (auto iKernel = 0ul; iKernel < kernels.size(); ++iKernel) {
+    filter.kernels.emplace_back(kernels[iKernel].first, SU2_TYPE::GetValue(kernels[iKernel].second));
+    filter.radius.push_back(SU2_TYPE::GetValue(filter_radius[iKernel]));
+  }
+  const auto max_radius = *max_element(filter.radius.begin(), filter.radius.end());
 
-            for (auto idx : neighbours) {
-              switch (kernel_type) {
-                case ENUM_FILTER_KERNEL::DILATE_MORPH:
-                  numerator += exp(kernel_param * work_values[idx]);
-                  break;
-                case ENUM_FILTER_KERNEL::ERODE_MORPH:
-                  numerator += exp(kernel_param * (1.0 - work_values[idx]));
-                  break;
-                default:
-                  break;
-              }
-              denominator += 1.0;
-            }
-            values[iElem] = log(numerator / denominator) / kernel_param;
-            if (kernel_type == ENUM_FILTER_KERNEL::ERODE_MORPH) values[iElem] = 1.0 - values[iElem];
-            break;
+  /*--- The geometric part of the filter is not differentiated. ---*/
+  const bool wasActive = AD::BeginPassive();
+  using PassiveMPI = SelectMPIWrapper<passivedouble>::W;
 
-          default:
-            SU2_MPI::Error("Unknown type of filter kernel", CURRENT_FUNCTION);
-        }
+  /*--- Bounding box of the local elements, extended by the filter radius. ---*/
+  vector<passivedouble> bbox(2 * nDim);
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+    bbox[iDim] = numeric_limits<passivedouble>::max();
+    bbox[nDim + iDim] = numeric_limits<passivedouble>::lowest();
+  }
+  for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      const auto x = SU2_TYPE::GetValue(elem[iElem]->GetCG(iDim));
+      bbox[iDim] = min(bbox[iDim], x - max_radius);
+      bbox[nDim + iDim] = max(bbox[nDim + iDim], x + max_radius);
+    }
+  }
+  vector<passivedouble> allBBox(2 * nDim * size);
+  PassiveMPI::Allgather(bbox.data(), 2 * nDim, MPI_DOUBLE, allBBox.data(), 2 * nDim, MPI_DOUBLE, SU2_MPI::GetComm());
+
+  /*--- Send the local elements to the ranks whose extended box contains their centroid. ---*/
+  vector<vector<unsigned long>> sendLists(size);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (iRank == rank) continue;
+    const auto* box = &allBBox[2 * nDim * iRank];
+    for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+      bool inside = true;
+      for (unsigned short iDim = 0; iDim < nDim && inside; ++iDim) {
+        const auto x = SU2_TYPE::GetValue(elem[iElem]->GetCG(iDim));
+        inside = (x >= box[iDim]) && (x <= box[nDim + iDim]);
       }
-      END_SU2_OMP_FOR
+      if (inside) sendLists[iRank].push_back(iElem);
     }
   }
-  END_SU2_OMP_PARALLEL
-
-  limited_searches /= kernels.size();
 
-  unsigned long tmp = limited_searches;
-  SU2_MPI::Reduce(&tmp, &limited_searches, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+  filter.sendCounts.resize(size);
+  filter.sendDispls.resize(size);
+  filter.recvCounts.resize(size);
+  filter.recvDispls.resize(size);
 
-  if (rank == MASTER_NODE && limited_searches > 0)
-    cout << "Warning: The filter radius was limited for " << limited_searches << " elements ("
-         << limited_searches / (0.01 * Global_nElemDomain) << "%).\n";
-
-  delete[] neighbour_idx;
-  delete[] cg_elem;
-  delete[] vol_elem;
-  delete[] work_values;
-}
+  for (int iRank = 0; iRank < size; ++iRank) {
+    filter.sendCounts[iRank] = sendLists[iRank].size();
+    filter.sendDispls[iRank] = iRank ? filter.sendDispls[iRank - 1] + filter.sendCounts[iRank - 1] : 0;
+    filter.sendElem.insert(filter.sendElem.end(), sendLists[iRank].begin(), sendLists[iRank].end());
+  }
+  SU2_MPI::Alltoall(filter.sendCounts.data(), 1, MPI_INT, filter.recvCounts.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  for (int iRank = 1; iRank < size; ++iRank)
+    filter.recvDispls[iRank] = filter.recvDispls[iRank - 1] + filter.recvCounts[iRank - 1];
+  const auto nRecv = filter.recvDispls.back() + filter.recvCounts.back();
+
+  /*--- Exchange global indices, centroids, and volumes, of the elements. ---*/
+  const auto nSend = filter.sendElem.size();
+  vector<unsigned long> sendIdx(nSend), recvIdx(nRecv);
+  vector<passivedouble> sendCG(nSend * nDim), recvCG(nRecv * nDim), sendVol(nSend), recvVol(nRecv);
+
+  for (auto iSend = 0ul; iSend < nSend; ++iSend) {
+    const auto iElem = filter.sendElem[iSend];
+    sendIdx[iSend] = elem[iElem]->GetGlobalIndex();
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      sendCG[iSend * nDim + iDim] = SU2_TYPE::GetValue(elem[iElem]->GetCG(iDim));
+    sendVol[iSend] = SU2_TYPE::GetValue(elem[iElem]->GetVolume());
+  }
 
-void CGeometry::GetGlobalElementAdjacencyMatrix(vector<unsigned long>& neighbour_start, long*& neighbour_idx) const {
-  if (neighbour_idx != nullptr)
-    SU2_MPI::Error("neighbour_idx is expected to be NULL, stopping to avoid a potential memory leak", CURRENT_FUNCTION);
+  SU2_MPI::Alltoallv(sendIdx.data(), filter.sendCounts.data(), filter.sendDispls.data(), MPI_UNSIGNED_LONG,
+                     recvIdx.data(), filter.recvCounts.data(), filter.recvDispls.data(), MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+  PassiveMPI::Alltoallv(sendVol.data(), filter.sendCounts.data(), filter.sendDispls.data(), MPI_DOUBLE,
+                        recvVol.data(), filter.recvCounts.data(), filter.recvDispls.data(), MPI_DOUBLE,
+                        SU2_MPI::GetComm());
+  {
+    auto counts = filter.sendCounts, displs = filter.sendDispls, rcounts = filter.recvCounts,
+         rdispls = filter.recvDispls;
+    for (int iRank = 0; iRank < size; ++iRank) {
+      counts[iRank] *= nDim;
+      displs[iRank] *= nDim;
+      rcounts[iRank] *= nDim;
+      rdispls[iRank] *= nDim;
+    }
+    PassiveMPI::Alltoallv(sendCG.data(), counts.data(), displs.data(), MPI_DOUBLE, recvCG.data(), rcounts.data(),
+                          rdispls.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+  }
 
-  /*--- Determine how much space we need for the adjacency matrix by counting the
-  neighbours of each element, i.e. its number of faces---*/
-  auto* nFaces_elem = new unsigned short[Global_nElemDomain];
+  /*--- Halo-extended element set, local elements first, then the received ones without duplicates
+  (elements in the overlap of the partitions are present on multiple ranks). ---*/
+  unordered_map<unsigned long, unsigned long> globalToExt;
+  vector<passivedouble> cgExt(nElem * nDim), volExt(nElem);
 
-  SU2_OMP_PARALLEL {
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) nFaces_elem[iElem] = 0;
-    END_SU2_OMP_FOR
+  for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+    globalToExt.emplace(elem[iElem]->GetGlobalIndex(), iElem);
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) cgExt[iElem * nDim + iDim] = SU2_TYPE::GetValue(elem[iElem]->GetCG(iDim));
+    volExt[iElem] = SU2_TYPE::GetValue(elem[iElem]->GetVolume());
+  }
 
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < nElem; ++iElem) {
-      auto iElem_global = elem[iElem]->GetGlobalIndex();
-      nFaces_elem[iElem_global] = elem[iElem]->GetnFaces();
+  filter.recvElem.resize(nRecv);
+  for (int iRecv = 0; iRecv < nRecv; ++iRecv) {
+    const auto res = globalToExt.emplace(recvIdx[iRecv], volExt.size());
+    filter.recvElem[iRecv] = res.first->second;
+    if (res.second) {
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) cgExt.push_back(recvCG[iRecv * nDim + iDim]);
+      volExt.push_back(recvVol[iRecv]);
     }
-    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_PARALLEL
-#ifdef HAVE_MPI
-  /*--- Share with all processors ---*/
-  {
-    auto* buffer = new unsigned short[Global_nElemDomain];
-    MPI_Allreduce(nFaces_elem, buffer, Global_nElemDomain, MPI_UNSIGNED_SHORT, MPI_MAX, SU2_MPI::GetComm());
-    /*--- swap pointers and delete old data to keep the same variable name after reduction ---*/
-    swap(buffer, nFaces_elem);
-    delete[] buffer;
-  }
-#endif
+  filter.nElemExt = volExt.size();
 
-  /*--- Vector with the addresses of the start of the neighbours of a given element.
-  This is generated by a cumulative sum of the neighbour count. ---*/
-  neighbour_start.resize(Global_nElemDomain + 1);
+  /*--- THEN: Local radius search with an ADT over the extended centroids, and computation of the weights. ---*/
+  vector<unsigned long> extIdx(filter.nElemExt);
+  iota(extIdx.begin(), extIdx.end(), 0ul);
+  vector<su2double> cgADT(cgExt.begin(), cgExt.end());
+  CADTPointsOnlyClass tree(nDim, filter.nElemExt, cgADT.data(), extIdx.data(), false);
 
-  neighbour_start[0] = 0;
-  for (auto iElem = 0ul; iElem < Global_nElemDomain; ++iElem) {
-    neighbour_start[iElem + 1] = neighbour_start[iElem] + nFaces_elem[iElem];
-  }
-  delete[] nFaces_elem;
+  for (auto iKernel = 0ul; iKernel < kernels.size(); ++iKernel) {
+    const auto kernel_type = filter.kernels[iKernel].first;
+    const auto kernel_param = filter.kernels[iKernel].second;
+    const auto kernel_radius = filter.radius[iKernel];
 
-  /*--- Allocate ---*/
-  unsigned long matrix_size = neighbour_start[Global_nElemDomain];
-  neighbour_idx = new long[matrix_size];
+    vector<vector<unsigned long>> neighbours(nElem);
 
-  SU2_OMP_PARALLEL {
-    /*--- Initialize ---*/
-    SU2_OMP_FOR_STAT(256)
-    for (auto iElem = 0ul; iElem < matrix_size; ++iElem) neighbour_idx[iElem] = -1;
-    END_SU2_OMP_FOR
-
-    /*--- Populate ---*/
-    SU2_OMP_FOR_STAT(128)
+    SU2_OMP_PARALLEL_(for schedule(dynamic,128))
     for (auto iElem = 0ul; iElem < nElem; ++iElem) {
-      auto iElem_global = elem[iElem]->GetGlobalIndex();
-      auto start_pos = neighbour_start[iElem_global];
+      tree.DetermineNodesInRadius(&cgADT[iElem * nDim], kernel_radius, neighbours[iElem]);
+      sort(neighbours[iElem].begin(), neighbours[iElem].end());
+    }
+    END_SU2_OMP_PARALLEL
 
-      for (unsigned short iFace = 0; iFace < elem[iElem]->GetnFaces(); ++iFace) {
-        long neighbour = elem[iElem]->GetNeighbor_Elements(iFace);
+    filter.pattern.emplace_back(neighbours);
+    neighbours.clear();
 
-        if (neighbour >= 0) {
-          neighbour_idx[start_pos + iFace] = elem[neighbour]->GetGlobalIndex();
-        }
-      }
-    }
-    END_SU2_OMP_FOR
-  }
-  END_SU2_OMP_PARALLEL
-#ifdef HAVE_MPI
-  /*--- Share with all processors ---*/
-  {
-    long* buffer = new long[matrix_size];
-    MPI_Allreduce(neighbour_idx, buffer, matrix_size, MPI_LONG, MPI_MAX, SU2_MPI::GetComm());
-    swap(buffer, neighbour_idx);
-    delete[] buffer;
-  }
-#endif
-}
+    const auto& pattern = filter.pattern.back();
+    filter.weights.emplace_back(pattern.getNumNonZeros());
+    auto& weights = filter.weights.back();
 
-bool CGeometry::GetRadialNeighbourhood(const unsigned long iElem_global, const passivedouble radius,
-                                       size_t search_limit, const vector<unsigned long>& neighbour_start,
-                                       const long* neighbour_idx, const su2double* cg_elem, vector<long>& neighbours,
-                                       vector<bool>& is_neighbor) const {
-  /*--- Validate inputs if we are debugging. ---*/
-  assert(neighbour_start.size() == Global_nElemDomain + 1 && neighbour_idx != nullptr && cg_elem != nullptr &&
-         is_neighbor.size() == Global_nElemDomain && "invalid inputs");
-
-  /*--- 0 search_limit means "unlimited" (it will probably
-   stop once it gathers the entire domain, probably). ---*/
-  if (!search_limit) search_limit = numeric_limits<size_t>::max();
-
-  /*--- Center of the search ---*/
-  neighbours.clear();
-  neighbours.push_back(iElem_global);
-  is_neighbor[iElem_global] = true;
-
-  passivedouble X0[3] = {0.0, 0.0, 0.0};
-  for (unsigned short iDim = 0; iDim < nDim; ++iDim) X0[iDim] = SU2_TYPE::GetValue(cg_elem[nDim * iElem_global + iDim]);
-
-  /*--- Loop stops when "neighbours" stops changing size, or degree reaches limit. ---*/
-  bool finished = false;
-  for (size_t degree = 0, start = 0; degree < search_limit && !finished; ++degree) {
-    /*--- For each element of the last degree added consider its immediate
-     neighbours, that are not already neighbours, as candidates. ---*/
-    vector<long> candidates;
-
-    for (auto it = neighbours.begin() + start; it != neighbours.end(); ++it) {
-      /*--- scan row of the adjacency matrix of element *it ---*/
-      for (auto i = neighbour_start[*it]; i < neighbour_start[(*it) + 1]; ++i) {
-        auto idx = neighbour_idx[i];
-        if (idx >= 0)
-          if (!is_neighbor[idx]) {
-            candidates.push_back(idx);
-            /*--- mark as neighbour for now to avoid duplicate candidates. ---*/
-            is_neighbor[idx] = true;
-          }
-      }
-    }
-    /*--- update start position to fetch next degree candidates. ---*/
-    start = neighbours.size();
+    SU2_OMP_PARALLEL_(for schedule(dynamic,128))
+    for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+      passivedouble denominator = 0.0;
+      const auto begin = pattern.outerPtr()[iElem];
+      auto k = begin;
 
-    /*--- Add candidates within "radius" of X0, if none qualifies we are "finished". ---*/
-    finished = true;
-    for (auto idx : candidates) {
-      /*--- passivedouble as we only need to compare "distance". ---*/
-      passivedouble distance = 0.0;
-      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
-        distance += pow(X0[iDim] - SU2_TYPE::GetValue(cg_elem[nDim * idx + iDim]), 2);
+      for (auto idx : pattern.getInnerIter(iElem)) {
+        passivedouble distance = 0.0;
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          distance += pow(cgExt[nDim * iElem + iDim] - cgExt[nDim * idx + iDim], 2);
+        distance = sqrt(distance);
 
-      if (distance < pow(radius, 2)) {
-        neighbours.push_back(idx);
-        finished = false;
+        passivedouble weight = 1.0;
+        switch (kernel_type) {
+          case ENUM_FILTER_KERNEL::CONSTANT_WEIGHT:
+            weight = volExt[idx];
+            break;
+          case ENUM_FILTER_KERNEL::CONICAL_WEIGHT:
+            weight = (kernel_radius - distance) * volExt[idx];
+            break;
+          case ENUM_FILTER_KERNEL::GAUSSIAN_WEIGHT:
+            weight = exp(-0.5 * pow(distance / kernel_param, 2)) * volExt[idx];
+            break;
+          default:
+            break;
+        }
+        weights[k++] = weight;
+        denominator += weight;
       }
-      /*--- not a neighbour in the end. ---*/
-      else
-        is_neighbor[idx] = false;
+      for (k = begin; k < pattern.outerPtr()[iElem + 1]; ++k) weights[k] /= denominator;
     }
+    END_SU2_OMP_PARALLEL
   }
-  /*--- Restore the state of the working vector for next call. ---*/
-  for (auto idx : neighbours) is_neighbor[idx] = false;
 
-  return finished;
+  AD::EndPassive(wasActive);
+
+  return filter;
 }
 
 void CGeometry::SetElemVolume() {
@@ -3585,6 +3947,7 @@ const CCompressedSparsePatternUL& CGeometry::GetSparsePattern(ConnectivityType t
     pattern = fvm ? &finiteVolumeCSRFillN : &finiteElementCSRFillN;
 
   if (pattern->empty()) {
+    SU2_MEMORY_SCOPE("Sparse patterns");
     *pattern = buildCSRPattern(*this, type, fillLvl);
     pattern->buildDiagPtr();
   }
@@ -3594,6 +3957,7 @@ const CCompressedSparsePatternUL& CGeometry::GetSparsePattern(ConnectivityType t
 
 const CEdgeToNonZeroMapUL& CGeometry::GetEdgeToSparsePatternMap() {
   if (edgeToCSRMap.empty()) {
+    SU2_MEMORY_SCOPE("Sparse patterns");
     if (finiteVolumeCSRFill0.empty()) {
       finiteVolumeCSRFill0 = buildCSRPattern(*this, ConnectivityType::FiniteVolume, 0ul);
     }
@@ -3605,6 +3969,7 @@ const CEdgeToNonZeroMapUL& CGeometry::GetEdgeToSparsePatternMap() {
 const su2vector<unsigned long>& CGeometry::GetTransposeSparsePatternMap(ConnectivityType type) {
   /*--- Yes the const cast is weird but it is still better than repeating code. ---*/
   auto& pattern = const_cast<CCompressedSparsePatternUL&>(GetSparsePattern(type));
+  SU2_MEMORY_SCOPE("Sparse patterns");
   pattern.buildTransposePtr();
   return pattern.transposePtr();
 }
@@ -3622,22 +3987,7 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
       return edgeColoring;
     }
 
-    /*--- Create a temporary sparse pattern from the edges. ---*/
-    su2vector<unsigned long> outerPtr(nEdge + 1);
-    su2vector<unsigned long> innerIdx(nEdge * 2);
-
-    for (unsigned long iEdge = 0; iEdge < nEdge; ++iEdge) {
-      outerPtr(iEdge) = 2 * iEdge;
-      innerIdx(iEdge * 2 + 0) = edges->GetNode(iEdge, 0);
-      innerIdx(iEdge * 2 + 1) = edges->GetNode(iEdge, 1);
-    }
-    outerPtr(nEdge) = 2 * nEdge;
-
-    CCompressedSparsePatternUL pattern(move(outerPtr), move(innerIdx));
-
-    /*--- Color the edges. ---*/
-    constexpr bool balanceColors = true;
-    edgeColoring = colorSparsePattern(pattern, edgeColorGroupSize, balanceColors);
+    edgeColoring = ColorEdges(edgeColorGroupSize);
 
     /*--- If the coloring fails use the natural coloring. This is a
      *    "soft" failure as this "bad" coloring should be detected
@@ -3651,6 +4001,25 @@ const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(su2double* efficien
   return edgeColoring;
 }
 
+CCompressedSparsePatternUL CGeometry::ColorEdges(unsigned long groupSize) const {
+  /*--- Create a temporary sparse pattern from the edges. ---*/
+  su2vector<unsigned long> outerPtr(nEdge + 1);
+  su2vector<unsigned long> innerIdx(nEdge * 2);
+
+  for (unsigned long iEdge = 0; iEdge < nEdge; ++iEdge) {
+    outerPtr(iEdge) = 2 * iEdge;
+    innerIdx(iEdge * 2 + 0) = edges->GetNode(iEdge, 0);
+    innerIdx(iEdge * 2 + 1) = edges->GetNode(iEdge, 1);
+  }
+  outerPtr(nEdge) = 2 * nEdge;
+
+  CCompressedSparsePatternUL pattern(move(outerPtr), move(innerIdx));
+
+  /*--- Color the edges. ---*/
+  constexpr bool balanceColors = true;
+  return colorSparsePattern(pattern, groupSize, balanceColors);
+}
+
 void CGeometry::SetNaturalEdgeColoring() {
   if (nEdge == 0) return;
   edgeColoring = createNaturalColoring(nEdge);
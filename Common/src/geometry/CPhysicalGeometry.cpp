@@ -9638,11 +9638,8 @@ void CPhysicalGeometry::Compute_Wing(CConfig* config, bool original_surface, su2
 
   /*--- Create the section slices through the geometry ---*/
 
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, nullptr,
-                           Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
-  }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                          Variable_Airfoil, original_surface, config);
 
   /*--- Compute airfoil characteristic only in the master node ---*/
 
@@ -9947,11 +9944,8 @@ void CPhysicalGeometry::Compute_Fuselage(CConfig* config, bool original_surface,
 
   /*--- Create the section slices through the geometry ---*/
 
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, nullptr,
-                           Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
-  }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                          Variable_Airfoil, original_surface, config);
 
   /*--- Compute the area at each section ---*/
 
@@ -10269,11 +10263,8 @@ void CPhysicalGeometry::Compute_Nacelle(CConfig* config, bool original_surface,
 
   /*--- Create the section slices through the geometry ---*/
 
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, nullptr,
-                           Xcoord_Airfoil[iPlane], Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                           Variable_Airfoil[iPlane], original_surface, config);
-  }
+  ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil,
+                          Variable_Airfoil, original_surface, config);
 
   /*--- Compute airfoil characteristic only in the master node ---*/
 
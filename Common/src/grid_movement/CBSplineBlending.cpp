@@ -145,3 +145,98 @@ su2double CBSplineBlending::GetDerivative(short val_i, su2double val_t, short va
   }
   return 0.0;
 }
+
+void CBSplineBlending::GetAllBasis(su2double val_t, su2double* val_N, su2double* val_dN, su2double* val_d2N) const {
+  /*--- Evaluation is based on the algorithms A2.1 and A2.3 from "The NURBS Book (Les Piegl and Wayne Tiller)",
+   * only the Order basis functions of the knot span that contains t are non-zero. ---*/
+
+  const int p = Degree;
+
+  for (int i = 0; i < nControl; ++i) val_N[i] = val_dN[i] = val_d2N[i] = 0.0;
+
+  /*--- Find the knot span. ---*/
+
+  int span = p;
+  if (val_t >= U[nControl]) {
+    span = nControl - 1;
+  } else if (val_t > U[p]) {
+    int low = p, high = nControl;
+    span = (low + high) / 2;
+    while (val_t < U[span] || val_t >= U[span + 1]) {
+      if (val_t < U[span])
+        high = span;
+      else
+        low = span;
+      span = (low + high) / 2;
+    }
+  }
+
+  /*--- Triangular table of basis functions (upper part) and knot differences (lower part), plus the knot
+   * distances and the coefficients of the derivatives. Usual orders use the stack. ---*/
+
+  const int n = Order;
+  su2double stackWork[MAXORDER_STACK * (MAXORDER_STACK + 4)];
+  vector<su2double> heapWork;
+  su2double* work = stackWork;
+  if (n > MAXORDER_STACK) {
+    heapWork.resize(n * (n + 4));
+    work = heapWork.data();
+  }
+  auto ndu = [work, n](int i, int j) -> su2double& { return work[i * n + j]; };
+  su2double* left = work + n * n;
+  su2double* right = left + n;
+  su2double* a[] = {right + n, right + 2 * n};
+
+  ndu(0, 0) = 1.0;
+  for (int j = 1; j <= p; ++j) {
+    left[j] = val_t - U[span + 1 - j];
+    right[j] = U[span + j] - val_t;
+    su2double saved = 0.0;
+    for (int r = 0; r < j; ++r) {
+      ndu(j, r) = right[r + 1] + left[j - r];
+      const su2double temp = ndu(r, j - 1) / ndu(j, r);
+      ndu(r, j) = saved + right[r + 1] * temp;
+      saved = left[j - r] * temp;
+    }
+    ndu(j, j) = saved;
+  }
+
+  for (int j = 0; j <= p; ++j) val_N[span - p + j] = ndu(j, p);
+
+  /*--- First and second derivatives. ---*/
+
+  su2double* ders[] = {val_dN, val_d2N};
+
+  for (int r = 0; r <= p; ++r) {
+    int s1 = 0, s2 = 1;
+    a[0][0] = 1.0;
+
+    for (int k = 1; k <= 2 && k <= p; ++k) {
+      su2double d = 0.0;
+      const int rk = r - k, pk = p - k;
+      if (r >= k) {
+        a[s2][0] = a[s1][0] / ndu(pk + 1, rk);
+        d = a[s2][0] * ndu(rk, pk);
+      }
+      const int j1 = (rk >= -1) ? 1 : -rk;
+      const int j2 = (r - 1 <= pk) ? k - 1 : p - r;
+      for (int j = j1; j <= j2; ++j) {
+        a[s2][j] = (a[s1][j] - a[s1][j - 1]) / ndu(pk + 1, rk + j);
+        d += a[s2][j] * ndu(rk + j, pk);
+      }
+      if (r <= pk) {
+        a[s2][k] = -a[s1][k - 1] / ndu(pk + 1, r);
+        d += a[s2][k] * ndu(r, pk);
+      }
+      ders[k - 1][span - p + r] = d;
+      std::swap(s1, s2);
+    }
+  }
+
+  /*--- Multiply by the correct factors. ---*/
+
+  for (int j = 0; j <= p; ++j) {
+    val_dN[span - p + j] *= p;
+    val_d2N[span - p + j] *= p * (p - 1);
+  }
+}
@@ -120,3 +120,36 @@ su2double CBezierBlending::Binomial(unsigned short n, unsigned short m) {
 
   return result;
 }
+
+void CBezierBlending::GetAllBasis(su2double val_t, su2double* val_N, su2double* val_dN, su2double* val_d2N) const {
+  const int n = Degree;
+
+  /*--- Bernstein polynomials of increasing degree by the de Casteljau recurrence,
+   * B_{i,k}(t) = (1-t) B_{i,k-1}(t) + t B_{i-1,k-1}(t), computed in place. ---*/
+
+  int degree = 0;
+  auto Elevate = [&]() {
+    ++degree;
+    for (int i = degree; i > 0; --i) val_N[i] = (1.0 - val_t) * val_N[i] + val_t * val_N[i - 1];
+    val_N[0] *= (1.0 - val_t);
+  };
+  auto Basis = [&](int i) { return (i >= 0 && i <= degree) ? val_N[i] : su2double(0.0); };
+
+  val_N[0] = 1.0;
+  for (int i = 1; i <= n; ++i) val_N[i] = 0.0;
+
+  while (degree < n - 2) Elevate();
+
+  /*--- The derivatives are differences of the polynomials of lower degree,
+   * B''_{i,n} = n(n-1) (B_{i-2,n-2} - 2 B_{i-1,n-2} + B_{i,n-2}) and B'_{i,n} = n (B_{i-1,n-1} - B_{i,n-1}). ---*/
+
+  for (int i = 0; i <= n; ++i) {
+    val_d2N[i] = (n < 2) ? su2double(0.0) : n * (n - 1) * (Basis(i - 2) - 2.0 * Basis(i - 1) + Basis(i));
+  }
+  if (n >= 2) Elevate();
+
+  for (int i = 0; i <= n; ++i) {
+    val_dN[i] = (n < 1) ? su2double(0.0) : n * (Basis(i - 1) - Basis(i));
+  }
+  if (n >= 1) Elevate();
+}
@@ -30,6 +30,8 @@
 #include "../../include/grid_movement/CBSplineBlending.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
+#include <random>
+
 CFreeFormDefBox::CFreeFormDefBox() : CGridMovement() {}
 
 CFreeFormDefBox::CFreeFormDefBox(const unsigned short Degree[], unsigned short BSplineOrder[],
@@ -811,21 +813,131 @@ su2double* CFreeFormDefBox::GetParametricCoord_Analytical(const su2double* cart_
 }
 
 su2double* CFreeFormDefBox::EvalCartesianCoord(su2double* ParamCoord) const {
-  unsigned short iDim, iDegree, jDegree, kDegree;
+  EvalCartesianCoord(ParamCoord, cart_coord);
+  return cart_coord;
+}
 
-  for (iDim = 0; iDim < nDim; iDim++) cart_coord[iDim] = 0.0;
+void CFreeFormDefBox::EvalCartesianCoord(const su2double* uvw, su2double* xyz, su2double (*dxyz)[3],
+                                         su2double (*d2xyz)[3][3]) const {
+  const unsigned short nBasis[] = {lOrder, mOrder, nOrder};
+  const unsigned short maxBasis = max(lOrder, max(mOrder, nOrder));
+  const bool derivatives = (dxyz != nullptr) || (d2xyz != nullptr);
+
+  /*--- Values and derivatives of the basis functions in each direction, small boxes use the stack. ---*/
+
+  constexpr unsigned short MAXBASIS_STACK = 16;
+  su2double stackBasis[9 * MAXBASIS_STACK];
+  vector<su2double> heapBasis;
+  su2double* basis = stackBasis;
+  if (maxBasis > MAXBASIS_STACK) {
+    heapBasis.resize(9 * maxBasis);
+    basis = heapBasis.data();
+  }
+  auto B = [&](int dir, int der) { return &basis[(3 * dir + der) * maxBasis]; };
 
-  for (iDegree = 0; iDegree <= lDegree; iDegree++)
-    for (jDegree = 0; jDegree <= mDegree; jDegree++)
-      for (kDegree = 0; kDegree <= nDegree; kDegree++)
-        for (iDim = 0; iDim < nDim; iDim++) {
-          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim] *
-                              BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0]) *
-                              BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1]) *
-                              BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+  for (int dir = 0; dir < 3; dir++) BlendingFunction[dir]->GetAllBasis(uvw[dir], B(dir, 0), B(dir, 1), B(dir, 2));
+
+  /*--- Sum factorization, Sk[p] = sum_k P_ijk d^p N_k(w), then Tjk[p][q] = sum_j Sk[q] d^p N_j(v),
+   * and finally the sums over i. Only the combinations needed for up to second derivatives are formed. ---*/
+
+  su2double X[3] = {0.0}, dX[3][3] = {{0.0}}, d2X[3][3][3] = {{{0.0}}};
+
+  for (auto i = 0u; i < nBasis[0]; i++) {
+    const su2double Nu[] = {B(0, 0)[i], B(0, 1)[i], B(0, 2)[i]};
+    if (Nu[0] == 0.0 && Nu[1] == 0.0 && Nu[2] == 0.0) continue;
+
+    su2double T[3][3][3] = {{{0.0}}};
+
+    for (auto j = 0u; j < nBasis[1]; j++) {
+      const su2double Nv[] = {B(1, 0)[j], B(1, 1)[j], B(1, 2)[j]};
+      if (Nv[0] == 0.0 && Nv[1] == 0.0 && Nv[2] == 0.0) continue;
+
+      su2double S[3][3] = {{0.0}};
+
+      for (auto k = 0u; k < nBasis[2]; k++) {
+        const su2double* Nw[] = {&B(2, 0)[k], &B(2, 1)[k], &B(2, 2)[k]};
+        const su2double* P = Coord_Control_Points[i][j][k];
+        for (auto iDim = 0u; iDim < nDim; iDim++) {
+          S[0][iDim] += P[iDim] * *Nw[0];
+          if (derivatives) {
+            S[1][iDim] += P[iDim] * *Nw[1];
+            S[2][iDim] += P[iDim] * *Nw[2];
+          }
         }
+      }
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        T[0][0][iDim] += S[0][iDim] * Nv[0];
+        if (derivatives) {
+          T[0][1][iDim] += S[1][iDim] * Nv[0];
+          T[0][2][iDim] += S[2][iDim] * Nv[0];
+          T[1][0][iDim] += S[0][iDim] * Nv[1];
+          T[1][1][iDim] += S[1][iDim] * Nv[1];
+          T[2][0][iDim] += S[0][iDim] * Nv[2];
+        }
+      }
+    }
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      X[iDim] += Nu[0] * T[0][0][iDim];
+      if (derivatives) {
+        dX[0][iDim] += Nu[1] * T[0][0][iDim];
+        dX[1][iDim] += Nu[0] * T[1][0][iDim];
+        dX[2][iDim] += Nu[0] * T[0][1][iDim];
+        d2X[0][0][iDim] += Nu[2] * T[0][0][iDim];
+        d2X[1][1][iDim] += Nu[0] * T[2][0][iDim];
+        d2X[2][2][iDim] += Nu[0] * T[0][2][iDim];
+        d2X[0][1][iDim] += Nu[1] * T[1][0][iDim];
+        d2X[0][2][iDim] += Nu[1] * T[0][1][iDim];
+        d2X[1][2][iDim] += Nu[0] * T[1][1][iDim];
+      }
+    }
+  }
 
-  return cart_coord;
+  for (auto iDim = 0u; iDim < nDim; iDim++) {
+    xyz[iDim] = X[iDim];
+    for (auto a = 0u; a < 3; a++) {
+      if (dxyz) dxyz[a][iDim] = dX[a][iDim];
+      if (d2xyz) {
+        for (auto b = a; b < 3; b++) d2xyz[a][b][iDim] = d2xyz[b][a][iDim] = d2X[a][b][iDim];
+      }
+    }
+  }
+}
+
+void CFreeFormDefBox::AddControlPointSensitivity(const su2double* uvw, const su2double* val,
+                                                 su2double* cpSens) const {
+  const unsigned short nBasis[] = {lOrder, mOrder, nOrder};
+  const unsigned short maxBasis = max(lOrder, max(mOrder, nOrder));
+
+  /*--- Values of the basis functions in each direction (and scratch space for the derivatives). ---*/
+
+  constexpr unsigned short MAXBASIS_STACK = 16;
+  su2double stackBasis[5 * MAXBASIS_STACK];
+  vector<su2double> heapBasis;
+  su2double* basis = stackBasis;
+  if (maxBasis > MAXBASIS_STACK) {
+    heapBasis.resize(5 * maxBasis);
+    basis = heapBasis.data();
+  }
+  const su2double* N[] = {basis, basis + maxBasis, basis + 2 * maxBasis};
+  su2double* dN = basis + 3 * maxBasis;
+  su2double* d2N = basis + 4 * maxBasis;
+
+  for (int dir = 0; dir < 3; dir++) BlendingFunction[dir]->GetAllBasis(uvw[dir], basis + dir * maxBasis, dN, d2N);
+
+  /*--- Transpose of EvalCartesianCoord, which is linear in the control points. ---*/
+
+  for (auto i = 0u; i < nBasis[0]; i++) {
+    if (N[0][i] == 0.0) continue;
+    for (auto j = 0u; j < nBasis[1]; j++) {
+      const su2double Nuv = N[0][i] * N[1][j];
+      if (Nuv == 0.0) continue;
+      for (auto k = 0u; k < nBasis[2]; k++) {
+        const su2double Nuvw = Nuv * N[2][k];
+        su2double* sens = &cpSens[((i * nBasis[1] + j) * nBasis[2] + k) * 3];
+        for (auto iDim = 0u; iDim < nDim; iDim++) sens[iDim] += Nuvw * val[iDim];
+      }
+    }
+  }
 }
 
 su2double* CFreeFormDefBox::GetFFDGradient(su2double* val_coord, su2double* xyz) {
@@ -888,24 +1000,29 @@ void CFreeFormDefBox::GetFFDHessian(su2double* uvw, su2double* xyz, su2double**
 
 su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, su2double* xyz,
                                                          const su2double* ParamCoordGuess, CConfig* config) {
-  su2double *IndepTerm, SOR_Factor = 1.0, MinNormError, NormError, Determinant, AdjHessian[3][3],
-                        Temp[3] = {0.0, 0.0, 0.0};
+  GetParametricCoord_Iterative(iPoint, xyz, ParamCoordGuess, ParamCoord, config);
+  return ParamCoord;
+}
+
+bool CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, const su2double* xyz,
+                                                   const su2double* ParamCoordGuess, su2double* uvw,
+                                                   const CConfig* config) const {
+  su2double SOR_Factor = 1.0, MinNormError, NormError, Determinant, AdjHessian[3][3], IndepTerm[3] = {0.0},
+            Temp[3] = {0.0, 0.0, 0.0};
   unsigned short iDim, jDim, RandonCounter;
   unsigned long iter;
 
-  su2double tol = config->GetFFD_Tol() * 1E-3;
-  unsigned short it_max = config->GetnFFD_Iter();
-  unsigned short Random_Trials = 500;
+  const su2double tol = config->GetFFD_Tol() * 1E-3;
+  const unsigned short it_max = config->GetnFFD_Iter();
+  const unsigned short Random_Trials = 500;
+  const bool bspline = (config->GetFFD_Blending() == BSPLINE_UNIFORM);
 
-  /*--- Allocate the Hessian ---*/
+  /*--- The random restarts use a generator local to each point, the result does not depend on the threads. ---*/
 
-  Hessian = new su2double*[nDim];
-  IndepTerm = new su2double[nDim];
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Hessian[iDim] = new su2double[nDim];
-    ParamCoord[iDim] = ParamCoordGuess[iDim];
-    IndepTerm[iDim] = 0.0;
-  }
+  std::minstd_rand generator(iPoint + 1);
+  std::uniform_real_distribution<passivedouble> distribution(0.0, 1.0);
+
+  for (iDim = 0; iDim < nDim; iDim++) uvw[iDim] = ParamCoordGuess[iDim];
 
   RandonCounter = 0;
   MinNormError = 1E6;
@@ -913,15 +1030,22 @@ su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
   /*--- External iteration ---*/
 
   for (iter = 0; iter < (unsigned long)it_max * Random_Trials; iter++) {
-    /*--- The independent term of the solution of our system is -Gradient(sol_old) ---*/
+    /*--- Gradient and Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2, from one evaluation of the box. ---*/
 
-    Gradient = GetFFDGradient(ParamCoord, xyz);
+    su2double X[3] = {0.0}, dX[3][3] = {{0.0}}, d2X[3][3][3] = {{{0.0}}}, Hessian[3][3] = {{0.0}};
 
-    for (iDim = 0; iDim < nDim; iDim++) IndepTerm[iDim] = -Gradient[iDim];
+    EvalCartesianCoord(uvw, X, dX, d2X);
 
-    /*--- Hessian = The Matrix of our system, getHessian(sol_old,xyz,...) ---*/
+    for (iDim = 0; iDim < nDim; iDim++) IndepTerm[iDim] = 0.0;
 
-    GetFFDHessian(ParamCoord, xyz, Hessian);
+    for (unsigned short kDim = 0; kDim < nDim; kDim++) {
+      const su2double Residual = 2.0 * (X[kDim] - xyz[kDim]);
+      for (iDim = 0; iDim < nDim; iDim++) {
+        IndepTerm[iDim] -= Residual * dX[iDim][kDim];
+        for (jDim = 0; jDim < nDim; jDim++)
+          Hessian[iDim][jDim] += 2.0 * dX[iDim][kDim] * dX[jDim][kDim] + Residual * d2X[iDim][jDim][kDim];
+      }
+    }
 
     /*--- Adjoint to Hessian ---*/
 
@@ -957,7 +1081,7 @@ su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
     /*--- Update with Successive over-relaxation ---*/
 
     for (iDim = 0; iDim < nDim; iDim++) {
-      ParamCoord[iDim] = (1.0 - SOR_Factor) * ParamCoord[iDim] + SOR_Factor * (ParamCoord[iDim] + IndepTerm[iDim]);
+      uvw[iDim] = (1.0 - SOR_Factor) * uvw[iDim] + SOR_Factor * (uvw[iDim] + IndepTerm[iDim]);
     }
 
     /*--- If the gradient is small, we have converged ---*/
@@ -977,42 +1101,39 @@ su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
     if (((iter % it_max) == 0) && (iter != 0)) {
       RandonCounter++;
       if (RandonCounter == Random_Trials) {
+        SU2_OMP_CRITICAL
         cout << endl
              << "Unknown point: " << iPoint << " (" << xyz[0] << ", " << xyz[1] << ", " << xyz[2]
              << "). Min Error: " << MinNormError << ". Iter: " << iter << "." << endl;
+        END_SU2_OMP_CRITICAL
       } else {
         SOR_Factor = 0.1;
-        for (iDim = 0; iDim < nDim; iDim++) ParamCoord[iDim] = su2double(rand()) / su2double(RAND_MAX);
+        for (iDim = 0; iDim < nDim; iDim++) uvw[iDim] = distribution(generator);
       }
     }
 
     /* --- Splines are not defined outside of [0,1]. So if the parametric coords are outside of
      *  [0,1] the step was too big and we have to use a smaller relaxation factor. ---*/
 
-    if ((config->GetFFD_Blending() == BSPLINE_UNIFORM) &&
-        (((ParamCoord[0] < 0.0) || (ParamCoord[0] > 1.0)) || ((ParamCoord[1] < 0.0) || (ParamCoord[1] > 1.0)) ||
-         ((ParamCoord[2] < 0.0) || (ParamCoord[2] > 1.0)))) {
+    if (bspline && (((uvw[0] < 0.0) || (uvw[0] > 1.0)) || ((uvw[1] < 0.0) || (uvw[1] > 1.0)) ||
+                    ((uvw[2] < 0.0) || (uvw[2] > 1.0)))) {
       for (iDim = 0; iDim < nDim; iDim++) {
-        ParamCoord[iDim] = ParamCoordGuess[iDim];
+        uvw[iDim] = ParamCoordGuess[iDim];
       }
       SOR_Factor = 0.9 * SOR_Factor;
     }
   }
 
-  for (iDim = 0; iDim < nDim; iDim++) delete[] Hessian[iDim];
-  delete[] Hessian;
-  delete[] IndepTerm;
-
   /*--- The code has hit the max number of iterations ---*/
 
   if (iter == (unsigned long)it_max * Random_Trials) {
+    SU2_OMP_CRITICAL
     cout << "Unknown point: (" << xyz[0] << ", " << xyz[1] << ", " << xyz[2]
          << "). Increase the value of FFD_ITERATIONS." << endl;
+    END_SU2_OMP_CRITICAL
+    return false;
   }
-
-  /*--- Real Solution is now ParamCoord; Return it ---*/
-
-  return ParamCoord;
+  return true;
 }
 
 bool CFreeFormDefBox::CheckPointInsideFFD(const su2double* coord) const {
@@ -757,7 +757,6 @@ void CSurfaceMovement::SetParametricCoord(CGeometry* geometry, CConfig* config,
   unsigned long TotalVertex = 0;
   unsigned long VisitedVertex = 0;
   unsigned long MappedVertex = 0;
-  su2double ParamCoordGuess[3] = {0.5, 0.5, 0.5};
 
   /*--- Check that the box is defined correctly for the preliminary point containment check,
    * by checking that the midpoint of the box is considered to be inside it. ---*/
@@ -788,14 +787,46 @@ void CSurfaceMovement::SetParametricCoord(CGeometry* geometry, CConfig* config,
                    CURRENT_FUNCTION);
   }
 
+  /*--- The point inversion does not depend on the design variables, there is nothing to record. ---*/
+
+  const bool wasActive = AD::BeginPassive();
+
+  /*--- Gather the vertices of the design markers, the point inversions are then done in parallel. ---*/
+
+  vector<pair<unsigned short, unsigned long> > Vertices;
   for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_DV(iMarker) == YES) {
       TotalVertex += geometry->nVertex[iMarker];
+      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) Vertices.emplace_back(iMarker, iVertex);
+    }
+  }
+  const auto nVertices = Vertices.size();
+
+  su2activematrix CartCoords(nVertices, 3), ParamCoords(nVertices, 3);
+  su2activevector Diffs(nVertices);
+  vector<char> Inside(nVertices, false);
+
+  /*--- The vertices are processed in blocks of fixed size, neighbors on the surface have similar parametric
+   * coordinates, therefore the last value found in the block is a good initial guess for the next vertex.
+   * The guess is reset at the start of each block so that the results do not depend on the number of threads. ---*/
+
+  constexpr unsigned long blockSize = 64;
+  const auto nBlocks = roundUpDiv(nVertices, blockSize);
+
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_DYN(1)
+    for (auto iBlock = 0ul; iBlock < nBlocks; iBlock++) {
+      su2double ParamCoordGuess[3] = {0.5, 0.5, 0.5};
+      const auto blockEnd = min<unsigned long>((iBlock + 1) * blockSize, nVertices);
+
+      for (auto iVert = iBlock * blockSize; iVert < blockEnd; iVert++) {
+        const auto iMarker = Vertices[iVert].first;
+        const auto iVertex = Vertices[iVert].second;
 
-      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
         /*--- Get the cartesian coordinates ---*/
 
-        su2double CartCoord[3] = {};
+        su2double* CartCoord = CartCoords[iVert];
+        for (auto iDim = 0u; iDim < 3; iDim++) CartCoord[iDim] = 0.0;
         for (auto iDim = 0u; iDim < nDim; iDim++) CartCoord[iDim] = geometry->vertex[iMarker][iVertex]->GetCoord(iDim);
 
         /*--- Transform the cartesian into polar ---*/
@@ -821,65 +852,86 @@ void CSurfaceMovement::SetParametricCoord(CGeometry* geometry, CConfig* config,
           }
         }
 
+        /*--- If the point is inside the FFD, compute the value of the parametric coordinate. ---*/
+
+        Inside[iVert] = FFDBox->CheckPointInsideFFD(CartCoord);
+        if (!Inside[iVert]) continue;
+
         const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        su2double* ParamCoord = ParamCoords[iVert];
 
-        /*--- If the point is inside the FFD, compute the value of the parametric coordinate. ---*/
+        FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, ParamCoord, config);
 
-        if (FFDBox->CheckPointInsideFFD(CartCoord)) {
-          /*--- Find the parametric coordinate ---*/
+        /*--- Compute the cartesian coordinates using the parametric coordinates
+         to check that everything is correct, and the max difference w.r.t. the original value. ---*/
 
-          ++VisitedVertex;
-          auto* ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+        su2double CartCoordNew[3] = {0.0};
+        FFDBox->EvalCartesianCoord(ParamCoord, CartCoordNew);
+        Diffs[iVert] = GeometryToolbox::Distance(nDim, CartCoordNew, CartCoord);
 
-          /*--- Compute the cartesian coordinates using the parametric coordinates
-           to check that everything is correct ---*/
+        /*--- Only mapped points are used as the next initial guess. ---*/
 
-          const auto* CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+        bool mapped = true;
+        for (auto iDim = 0u; iDim < 3; iDim++)
+          mapped &= (ParamCoord[iDim] >= -config->GetFFD_Tol()) && (ParamCoord[iDim] <= 1.0 + config->GetFFD_Tol());
+        if (mapped) {
+          for (auto iDim = 0u; iDim < 3; iDim++) ParamCoordGuess[iDim] = ParamCoord[iDim];
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
 
-          /*--- Compute max difference between original value and the recomputed value ---*/
+  /*--- Store the mapped points in the box, in the original order of the markers and vertices. ---*/
 
-          const su2double Diff = GeometryToolbox::Distance(nDim, CartCoordNew, CartCoord);
-          my_MaxDiff = max(my_MaxDiff, Diff);
+  for (auto iVert = 0ul; iVert < nVertices; iVert++) {
+    if (!Inside[iVert]) continue;
 
-          /*--- If the parametric coordinates are in (-tol, 1+tol) the point belongs to the FFDBox ---*/
+    const auto iMarker = Vertices[iVert].first;
+    const auto iVertex = Vertices[iVert].second;
+    const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    su2double* CartCoord = CartCoords[iVert];
+    su2double* ParamCoord = ParamCoords[iVert];
+    const su2double Diff = Diffs[iVert];
 
-          if (((ParamCoord[0] >= -config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[1] >= -config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[2] >= -config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
-            /*--- Rectification of the initial tolerance (we have detected situations
-             where 0.0 and 1.0 do not work properly. ---*/
+    ++VisitedVertex;
+    my_MaxDiff = max(my_MaxDiff, Diff);
 
-            const su2double lower_limit = config->GetFFD_Tol();
-            const su2double upper_limit = 1.0 - config->GetFFD_Tol();
+    /*--- If the parametric coordinates are in (-tol, 1+tol) the point belongs to the FFDBox ---*/
 
-            ParamCoord[0] = fmin(fmax(lower_limit, ParamCoord[0]), upper_limit);
-            ParamCoord[1] = fmin(fmax(lower_limit, ParamCoord[1]), upper_limit);
-            ParamCoord[2] = fmin(fmax(lower_limit, ParamCoord[2]), upper_limit);
+    if (((ParamCoord[0] >= -config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[1] >= -config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[2] >= -config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
+      /*--- Rectification of the initial tolerance (we have detected situations
+       where 0.0 and 1.0 do not work properly. ---*/
 
-            /*--- Set the value of the parametric coordinate ---*/
+      const su2double lower_limit = config->GetFFD_Tol();
+      const su2double upper_limit = 1.0 - config->GetFFD_Tol();
 
-            ++MappedVertex;
-            FFDBox->Set_MarkerIndex(iMarker);
-            FFDBox->Set_VertexIndex(iVertex);
-            FFDBox->Set_PointIndex(iPoint);
-            FFDBox->Set_ParametricCoord(ParamCoord);
-            FFDBox->Set_CartesianCoord(CartCoord);
+      ParamCoord[0] = fmin(fmax(lower_limit, ParamCoord[0]), upper_limit);
+      ParamCoord[1] = fmin(fmax(lower_limit, ParamCoord[1]), upper_limit);
+      ParamCoord[2] = fmin(fmax(lower_limit, ParamCoord[2]), upper_limit);
 
-            ParamCoordGuess[0] = ParamCoord[0];
-            ParamCoordGuess[1] = ParamCoord[1];
-            ParamCoordGuess[2] = ParamCoord[2];
-          }
+      /*--- Set the value of the parametric coordinate ---*/
 
-          if (Diff >= config->GetFFD_Tol()) {
-            cout << "Please check this point: Local (" << ParamCoord[0] << " " << ParamCoord[1] << " " << ParamCoord[2]
-                 << ") <-> Global (" << CartCoord[0] << " " << CartCoord[1] << " " << CartCoord[2] << ") <-> Error "
-                 << Diff << " vs " << config->GetFFD_Tol() << "." << endl;
-          }
-        }
-      }
+      ++MappedVertex;
+      FFDBox->Set_MarkerIndex(iMarker);
+      FFDBox->Set_VertexIndex(iVertex);
+      FFDBox->Set_PointIndex(iPoint);
+      FFDBox->Set_ParametricCoord(ParamCoord);
+      FFDBox->Set_CartesianCoord(CartCoord);
+    }
+
+    if (Diff >= config->GetFFD_Tol()) {
+      cout << "Please check this point: Local (" << ParamCoord[0] << " " << ParamCoord[1] << " " << ParamCoord[2]
+           << ") <-> Global (" << CartCoord[0] << " " << CartCoord[1] << " " << CartCoord[2] << ") <-> Error "
+           << Diff << " vs " << config->GetFFD_Tol() << "." << endl;
     }
   }
 
+  AD::EndPassive(wasActive);
+
   su2double MaxDiff = 0.0;
   SU2_MPI::Reduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
 
@@ -1474,44 +1526,44 @@ void CSurfaceMovement::CheckFFDIntersections(CGeometry* geometry, CConfig* confi
 
 void CSurfaceMovement::UpdateParametricCoord(CGeometry* geometry, CConfig* config, CFreeFormDefBox* FFDBox,
                                              unsigned short iFFDBox) {
-  unsigned short iMarker, iDim;
-  unsigned long iVertex, iPoint, iSurfacePoints;
-  su2double CartCoord[3] = {0.0, 0.0, 0.0}, *CartCoordNew, *CartCoordOld;
-  su2double *ParamCoord, *var_coord, ParamCoordGuess[3] = {0.0, 0.0, 0.0};
-  su2double MaxDiff, my_MaxDiff = 0.0, Diff;
+  su2double MaxDiff, my_MaxDiff = 0.0;
+  const auto nSurfacePoint = FFDBox->GetnSurfacePoint();
 
-  /*--- Recompute the parametric coordinates ---*/
+  /*--- Recompute the parametric coordinates, the surface points are independent. ---*/
 
-  for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
-    /*--- Get the marker of the surface point ---*/
+  SU2_OMP_PARALLEL {
+    su2double thread_MaxDiff = 0.0;
 
-    iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+    SU2_OMP_FOR_DYN(256)
+    for (auto iSurfacePoints = 0ul; iSurfacePoints < nSurfacePoint; iSurfacePoints++) {
+      /*--- Get the marker of the surface point ---*/
+
+      const auto iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+
+      if (config->GetMarker_All_DV(iMarker) != YES) continue;
 
-    if (config->GetMarker_All_DV(iMarker) == YES) {
       /*--- Get the vertex of the surface point ---*/
 
-      iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
-      iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
+      const auto iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
+      const auto iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
 
       /*--- Get the parametric and cartesians coordinates of the
        surface point (they don't mach) ---*/
 
-      ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
+      su2double ParamCoordGuess[3] = {0.0}, ParamCoord[3] = {0.0}, CartCoord[3] = {0.0}, CartCoordNew[3] = {0.0};
+      FFDBox->Get_ParametricCoord(iSurfacePoints, ParamCoordGuess);
 
       /*--- Compute and set the cartesian coord using the variation computed
        with the previous deformation ---*/
 
-      var_coord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-      CartCoordOld = geometry->nodes->GetCoord(iPoint);
-      for (iDim = 0; iDim < 3; iDim++) CartCoord[iDim] = CartCoordOld[iDim] + var_coord[iDim];
+      const auto* var_coord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+      const auto* CartCoordOld = geometry->nodes->GetCoord(iPoint);
+      for (auto iDim = 0u; iDim < geometry->GetnDim(); iDim++) CartCoord[iDim] = CartCoordOld[iDim] + var_coord[iDim];
       FFDBox->Set_CartesianCoord(CartCoord, iSurfacePoints);
 
       /*--- Find the parametric coordinate using as ParamCoordGuess the previous value ---*/
 
-      ParamCoordGuess[0] = ParamCoord[0];
-      ParamCoordGuess[1] = ParamCoord[1];
-      ParamCoordGuess[2] = ParamCoord[2];
-      ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+      FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, ParamCoord, config);
 
       /*--- Set the new value of the parametric coordinates ---*/
 
@@ -1520,17 +1572,23 @@ void CSurfaceMovement::UpdateParametricCoord(CGeometry* geometry, CConfig* confi
       /*--- Compute the cartesian coordinates using the parametric coordinates
        to check that everything is correct ---*/
 
-      CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+      FFDBox->EvalCartesianCoord(ParamCoord, CartCoordNew);
 
       /*--- Compute max difference between original value and the recomputed value ---*/
 
-      Diff = 0.0;
-      for (iDim = 0; iDim < geometry->GetnDim(); iDim++)
+      su2double Diff = 0.0;
+      for (auto iDim = 0u; iDim < geometry->GetnDim(); iDim++)
         Diff += (CartCoordNew[iDim] - CartCoord[iDim]) * (CartCoordNew[iDim] - CartCoord[iDim]);
       Diff = sqrt(Diff);
-      my_MaxDiff = max(my_MaxDiff, Diff);
+      thread_MaxDiff = max(thread_MaxDiff, Diff);
     }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_CRITICAL
+    my_MaxDiff = max(my_MaxDiff, thread_MaxDiff);
+    END_SU2_OMP_CRITICAL
   }
+  END_SU2_OMP_PARALLEL
 
 #ifdef HAVE_MPI
   SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
@@ -1590,52 +1648,57 @@ void CSurfaceMovement::ApplyDesignVariables(CGeometry* geometry, CConfig* config
 
 su2double CSurfaceMovement::SetCartesianCoord(CGeometry* geometry, CConfig* config, CFreeFormDefBox* FFDBox,
                                               unsigned short iFFDBox, bool ResetDef) {
-  su2double *CartCoordNew, Diff, my_MaxDiff = 0.0, MaxDiff, *ParamCoord, VarCoord[3] = {0.0, 0.0, 0.0},
-                                 CartCoordOld[3] = {0.0, 0.0, 0.0};
-  unsigned short iMarker, iDim;
-  unsigned long iVertex, iPoint, iSurfacePoints;
+  su2double my_MaxDiff = 0.0, MaxDiff;
+  const su2double Zeros[3] = {0.0, 0.0, 0.0};
 
-  bool cylindrical = (config->GetFFD_CoordSystem() == CYLINDRICAL);
-  bool spherical = (config->GetFFD_CoordSystem() == SPHERICAL);
-  bool polar = (config->GetFFD_CoordSystem() == POLAR);
-  unsigned short nDim = geometry->GetnDim();
+  const bool cylindrical = (config->GetFFD_CoordSystem() == CYLINDRICAL);
+  const bool spherical = (config->GetFFD_CoordSystem() == SPHERICAL);
+  const bool polar = (config->GetFFD_CoordSystem() == POLAR);
+  const unsigned short nDim = geometry->GetnDim();
+  const auto nSurfacePoint = FFDBox->GetnSurfacePoint();
 
   /*--- Set to zero all the porints in VarCoord, this is important when we are dealing with different boxes
     because a loop over GetnSurfacePoint is no sufficient ---*/
 
   if (ResetDef) {
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        geometry->vertex[iMarker][iVertex]->SetVarCoord(Zeros);
       }
     }
   }
 
-  /*--- Recompute the cartesians coordinates ---*/
+  /*--- Recompute the cartesians coordinates, each surface point of the box is a different vertex. ---*/
 
-  for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
-    /*--- Get the marker of the surface point ---*/
+  SU2_OMP_PARALLEL {
+    su2double thread_MaxDiff = 0.0;
 
-    iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+    SU2_OMP_FOR_DYN(256)
+    for (auto iSurfacePoints = 0ul; iSurfacePoints < nSurfacePoint; iSurfacePoints++) {
+      /*--- Get the marker of the surface point ---*/
+
+      const auto iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+
+      if (config->GetMarker_All_DV(iMarker) != YES) continue;
 
-    if (config->GetMarker_All_DV(iMarker) == YES) {
       /*--- Get the vertex of the surface point ---*/
 
-      iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
-      iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
+      const auto iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
+      const auto iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
 
       /*--- Set to zero the variation of the coordinates ---*/
 
-      geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+      geometry->vertex[iMarker][iVertex]->SetVarCoord(Zeros);
 
       /*--- Get the parametric coordinate of the surface point ---*/
 
-      ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
+      su2double ParamCoord[3] = {0.0}, CartCoordNew[3] = {0.0}, VarCoord[3] = {0.0};
+      FFDBox->Get_ParametricCoord(iSurfacePoints, ParamCoord);
 
       /*--- Compute the new cartesian coordinate, and set the value in
        the FFDBox structure ---*/
 
-      CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+      FFDBox->EvalCartesianCoord(ParamCoord, CartCoordNew);
 
       /*--- If polar coordinates, compute the cartesians from the polar value ---*/
 
@@ -1670,30 +1733,30 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry* geometry, CConfig* conf
 
       FFDBox->Set_CartesianCoord(CartCoordNew, iSurfacePoints);
 
-      /*--- Get the original cartesian coordinates of the surface point ---*/
-
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CartCoordOld[iDim] = geometry->nodes->GetCoord(iPoint, iDim);
-      }
-
-      /*--- Set the value of the variation of the coordinates ---*/
+      /*--- Set the value of the variation of the coordinates, w.r.t. the original cartesian coordinates ---*/
 
-      Diff = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        VarCoord[iDim] = CartCoordNew[iDim] - CartCoordOld[iDim];
+      su2double Diff = 0.0;
+      for (auto iDim = 0u; iDim < nDim; iDim++) {
+        VarCoord[iDim] = CartCoordNew[iDim] - geometry->nodes->GetCoord(iPoint, iDim);
         if ((fabs(VarCoord[iDim]) <= EPS) && (config->GetDirectDiff() != D_DESIGN) && (!config->GetAD_Mode()))
           VarCoord[iDim] = 0.0;
         Diff += (VarCoord[iDim] * VarCoord[iDim]);
       }
       Diff = sqrt(Diff);
 
-      my_MaxDiff = max(my_MaxDiff, Diff);
+      thread_MaxDiff = max(thread_MaxDiff, Diff);
 
       /*--- Set the variation of the coordinates ---*/
 
       geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
     }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_CRITICAL
+    my_MaxDiff = max(my_MaxDiff, thread_MaxDiff);
+    END_SU2_OMP_CRITICAL
   }
+  END_SU2_OMP_PARALLEL
 
   SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
 
@@ -29,8 +29,12 @@
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
+#include "../../include/toolboxes/CCommProfiler.hpp"
+#include "../../include/toolboxes/CMemoryTracker.hpp"
 
 #include <cmath>
+#include <limits>
 
 template <class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::GetSize()) {
@@ -156,13 +160,19 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     ptr = MemoryAllocation::aligned_alloc<ScalarType, true>(64, num * sizeof(ScalarType));
   };
 
-  allocAndInit(matrix, nnz * nVar * nEqn);
+  {
+    SU2_MEMORY_SCOPE("Jacobians");
+    allocAndInit(matrix, nnz * nVar * nEqn);
+  }
 
   /*--- Preconditioners. ---*/
 
-  if (ilu_needed) allocAndInit(ILU_matrix, nnz_ilu * nVar * nEqn);
+  {
+    SU2_MEMORY_SCOPE("Preconditioners");
+    if (ilu_needed) allocAndInit(ILU_matrix, nnz_ilu * nVar * nEqn);
 
-  if (diag_needed) allocAndInit(invM, nPointDomain * nVar * nEqn);
+    if (diag_needed) allocAndInit(invM, nPointDomain * nVar * nEqn);
+  }
 
   /*--- Thread parallel initialization. ---*/
 
@@ -229,6 +239,8 @@ void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry* geometry, cons
                                unsigned short commType) {
   if (geometry->nP2PSend == 0) return;
 
+  SU2_PROFILE_REGION("MPI comms");
+
   /*--- Local variables ---*/
 
   const unsigned short COUNT_PER_POINT = x.GetNVar();
@@ -262,6 +274,7 @@ void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry* geometry, cons
   /*--- Post all non-blocking recvs first before sends. ---*/
 
   geometry->PostP2PRecvs(geometry, config, MPI_TYPE, COUNT_PER_POINT, reverse);
+  geometry->ProfileP2PComms(commType, COUNT_PER_POINT, MPI_TYPE, reverse);
 
   for (auto iMessage = 0; iMessage < geometry->nP2PSend; iMessage++) {
     switch (commType) {
@@ -344,6 +357,8 @@ template <class T>
 void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CConfig* config, unsigned short commType) {
   if (geometry->nP2PRecv == 0) return;
 
+  SU2_PROFILE_REGION("MPI comms");
+
   /*--- Local variables ---*/
 
   const unsigned short COUNT_PER_POINT = x.GetNVar();
@@ -359,7 +374,8 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
     /*--- For efficiency, recv the messages dynamically based on
      the order they arrive. ---*/
 
-    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);)
+    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_PROFILE_REGION("MPI wait"); SU2_COMM_WAIT(CCommProfiler::HaloId(commType));
+                               SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);)
 
     /*--- Once we have recv'd a message, get the source rank. ---*/
 
@@ -449,7 +465,8 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
    data in the loop above at this point. ---*/
 
 #ifdef HAVE_MPI
-  SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);)
+  SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_PROFILE_REGION("MPI wait"); SU2_COMM_WAIT(CCommProfiler::HaloId(commType));
+                             SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);)
 #endif
 }
 
@@ -463,6 +480,22 @@ void CSysMatrix<ScalarType>::SetValZero() {
   SU2_OMP_BARRIER
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::GetValues(vector<ScalarType>& values) const {
+  values.assign(matrix, matrix + nnz * nVar * nEqn);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SetValues(const vector<ScalarType>& values) {
+  const auto size = nnz * nVar * nEqn;
+  if (values.size() != size) SU2_MPI::Error("Values do not match the sparse pattern.", CURRENT_FUNCTION);
+
+  const auto chunk = roundUpDiv(size, omp_get_num_threads());
+  const auto begin = chunk * omp_get_thread_num();
+  if (begin < size) memcpy(&matrix[begin], &values[begin], min(chunk, size - begin) * sizeof(ScalarType));
+  SU2_OMP_BARRIER
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::SetValDiagonalZero() {
   SU2_OMP_FOR_STAT(omp_heavy_size)
@@ -565,9 +598,12 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
 template <class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                                  CGeometry* geometry, const CConfig* config) const {
+  /*--- Number of right-hand sides stored in the vectors. ---*/
+  const auto nRhs = vec.GetNVar() / nEqn;
+
   /*--- Some checks for consistency between CSysMatrix and the CSysVector<ScalarType>s ---*/
 #ifndef NDEBUG
-  if ((nEqn != vec.GetNVar()) || (nVar != prod.GetNVar())) {
+  if ((nEqn * nRhs != vec.GetNVar()) || (nVar * nRhs != prod.GetNVar())) {
     SU2_MPI::Error("nVar values incompatible.", CURRENT_FUNCTION);
   }
   if (nPoint != prod.GetNBlk()) {
@@ -581,11 +617,38 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    RowProduct(vec, row_i, &prod[row_i * nVar]);
+  {
+    SU2_PROFILE_REGION("SpMV");
+
+    /*--- Memory traffic (blocks, column indices, and vectors) and operations of the local product. ---*/
+    const auto nnzDomain = row_ptr[nPointDomain];
+    CProfiler::AddWork(nnzDomain * (nVar * nEqn * sizeof(ScalarType) + sizeof(unsigned long)) +
+                           nRhs * (nPointDomain * nVar + nPoint * nEqn) * sizeof(ScalarType),
+                       2.0 * nnzDomain * nVar * nEqn * nRhs);
+
+    if (nRhs == 1) {
+      SU2_OMP_FOR_DYN(omp_heavy_size)
+      for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+        RowProduct(vec, row_i, &prod[row_i * nVar]);
+      }
+      END_SU2_OMP_FOR
+    } else {
+      /*--- Multiple right-hand sides, each block is loaded once and applied to all of them. ---*/
+      SU2_OMP_FOR_DYN(omp_heavy_size)
+      for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+        auto* prod_i = &prod[row_i * nVar * nRhs];
+        for (auto iVar = 0ul; iVar < nVar * nRhs; iVar++) prod_i[iVar] = 0.0;
+
+        for (auto index = row_ptr[row_i]; index < row_ptr[row_i + 1]; index++) {
+          const auto* block = &matrix[index * nVar * nEqn];
+          const auto* vec_j = &vec[col_ind[index] * nEqn * nRhs];
+          for (auto iRhs = 0ul; iRhs < nRhs; iRhs++)
+            MatrixVectorProductAdd(block, &vec_j[iRhs * nEqn], &prod_i[iRhs * nVar]);
+        }
+      }
+      END_SU2_OMP_FOR
+    }
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization. ---*/
 
@@ -593,6 +656,29 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::MatrixVectorProductRows(const CSysVector<ScalarType>& vec,
+                                                     const vector<unsigned long>& rows,
+                                                     CSysVector<ScalarType>& prod) const {
+  const auto nRhs = vec.GetNVar() / nEqn;
+
+  SU2_OMP_BARRIER
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (auto k = 0ul; k < rows.size(); k++) {
+    const auto row_i = rows[k];
+    auto* prod_i = &prod[row_i * nVar * nRhs];
+    for (auto iVar = 0ul; iVar < nVar * nRhs; iVar++) prod_i[iVar] = 0.0;
+
+    for (auto index = row_ptr[row_i]; index < row_ptr[row_i + 1]; index++) {
+      const auto* block = &matrix[index * nVar * nEqn];
+      const auto* vec_j = &vec[col_ind[index] * nEqn * nRhs];
+      for (auto iRhs = 0ul; iRhs < nRhs; iRhs++)
+        MatrixVectorProductAdd(block, &vec_j[iRhs * nEqn], &prod_i[iRhs * nVar]);
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner() {
   /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks. ---*/
@@ -607,10 +693,13 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
                                                          CSysVector<ScalarType>& prod, CGeometry* geometry,
                                                          const CConfig* config) const {
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
+  const auto nRhs = vec.GetNVar() / nVar;
   SU2_OMP_BARRIER
   SU2_OMP_FOR_DYN(omp_heavy_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
+    for (auto iRhs = 0ul; iRhs < nRhs; iRhs++)
+      MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[(iPoint * nRhs + iRhs) * nVar],
+                          &prod[(iPoint * nRhs + iRhs) * nVar]);
   END_SU2_OMP_FOR
 
   /*--- MPI Parallelization ---*/
@@ -721,6 +810,15 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
+  SU2_PROFILE_REGION("ILU apply");
+
+  /*--- Memory traffic (blocks, column indices, vectors) and operations of the forward and backward
+   *    substitutions, the inverse of the diagonal blocks replaces the diagonal blocks of the factors. ---*/
+  const auto nnzDomain = row_ptr_ilu[nPointDomain];
+  CProfiler::AddWork(nnzDomain * (nVar * nVar * sizeof(ScalarType) + sizeof(unsigned long)) +
+                         nPointDomain * (3 * nVar * sizeof(ScalarType) + 2 * sizeof(unsigned long)),
+                     2.0 * nnzDomain * nVar * nVar);
+
   /*--- OpenMP Parallelization ---*/
   SU2_OMP_FOR_STAT(1)
   for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
@@ -970,6 +1068,351 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner() {
+  if (nVar != nEqn) SU2_MPI::Error("The AMG preconditioner requires square blocks.", CURRENT_FUNCTION);
+
+  const auto blkSz = nVar * nVar;
+  const auto NONE = std::numeric_limits<unsigned long>::max();
+
+  /*--- Strength of connection threshold, and norm used to compare blocks. ---*/
+  const ScalarType theta = 0.08;
+  auto blockNorm = [blkSz](const ScalarType* block) {
+    ScalarType norm = 0.0;
+    for (auto k = 0ul; k < blkSz; ++k) norm += fabs(block[k]);
+    return norm;
+  };
+
+  /*--- The aggregation and Galerkin products are sequential, the smoother setup is threaded. ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    AMGLevels.clear();
+    AMGLevels.reserve(AMG_MAX_LEVELS);
+    AMGCoarseInv.clear();
+
+    /*--- The finest level is a view of the matrix, the halo columns are ignored. ---*/
+    AMGLevels.emplace_back();
+    AMGLevels[0].nPoint = nPointDomain;
+    AMGLevels[0].rowPtr = row_ptr;
+    AMGLevels[0].colInd = col_ind;
+    AMGLevels[0].values = matrix;
+
+    while (AMGLevels.size() < AMG_MAX_LEVELS && AMGLevels.back().nPoint > AMG_COARSE_SIZE) {
+      auto& fine = AMGLevels.back();
+      const auto n = fine.nPoint;
+
+      vector<ScalarType> diagNorm(n, 0.0);
+      for (auto i = 0ul; i < n; ++i)
+        for (auto k = fine.rowPtr[i]; k < fine.rowPtr[i + 1]; ++k)
+          if (fine.colInd[k] == i) diagNorm[i] = blockNorm(&fine.values[k * blkSz]);
+
+      auto strong = [&](unsigned long i, unsigned long k) {
+        const auto j = fine.colInd[k];
+        if (j == i || j >= n) return false;
+        const ScalarType aij = blockNorm(&fine.values[k * blkSz]);
+        return aij * aij >= theta * theta * diagNorm[i] * diagNorm[j];
+      };
+
+      /*--- Aggregation, first pass: points whose strong neighbors are all free form an aggregate with them. ---*/
+      auto& agg = fine.aggregate;
+      agg.assign(n, NONE);
+      unsigned long nAgg = 0;
+
+      for (auto i = 0ul; i < n; ++i) {
+        if (agg[i] != NONE) continue;
+        bool free = true;
+        for (auto k = fine.rowPtr[i]; k < fine.rowPtr[i + 1] && free; ++k)
+          if (strong(i, k)) free = (agg[fine.colInd[k]] == NONE);
+        if (!free) continue;
+        agg[i] = nAgg;
+        for (auto k = fine.rowPtr[i]; k < fine.rowPtr[i + 1]; ++k)
+          if (strong(i, k)) agg[fine.colInd[k]] = nAgg;
+        ++nAgg;
+      }
+
+      /*--- Second pass: join the left-over points to a strongly connected aggregate of the first pass. ---*/
+      const auto firstPass = agg;
+      for (auto i = 0ul; i < n; ++i) {
+        if (agg[i] != NONE) continue;
+        for (auto k = fine.rowPtr[i]; k < fine.rowPtr[i + 1]; ++k) {
+          if (strong(i, k) && firstPass[fine.colInd[k]] != NONE) {
+            agg[i] = firstPass[fine.colInd[k]];
+            break;
+          }
+        }
+      }
+
+      /*--- Third pass: what remains (weakly connected points) forms new aggregates. ---*/
+      for (auto i = 0ul; i < n; ++i) {
+        if (agg[i] != NONE) continue;
+        agg[i] = nAgg;
+        for (auto k = fine.rowPtr[i]; k < fine.rowPtr[i + 1]; ++k)
+          if (strong(i, k) && agg[fine.colInd[k]] == NONE) agg[fine.colInd[k]] = nAgg;
+        ++nAgg;
+      }
+
+      /*--- Stop if the coarsening stagnates. ---*/
+      if (4 * nAgg > 3 * n) {
+        agg.clear();
+        break;
+      }
+
+      /*--- Rows of the fine level in each aggregate. ---*/
+      fine.agg_ptr.assign(nAgg + 1, 0);
+      for (auto i = 0ul; i < n; ++i) ++fine.agg_ptr[agg[i] + 1];
+      for (auto I = 0ul; I < nAgg; ++I) fine.agg_ptr[I + 1] += fine.agg_ptr[I];
+      fine.agg_idx.resize(n);
+      {
+        auto pos = fine.agg_ptr;
+        for (auto i = 0ul; i < n; ++i) fine.agg_idx[pos[agg[i]]++] = i;
+      }
+
+      /*--- Galerkin product with the piecewise constant prolongation, the coarse
+       *    blocks are the sums of the fine blocks connecting two aggregates. ---*/
+      AMGLevel coarse;
+      coarse.nPoint = nAgg;
+      coarse.row_ptr.reserve(nAgg + 1);
+      coarse.row_ptr.push_back(0);
+      vector<unsigned long> position(nAgg, NONE);
+
+      for (auto I = 0ul; I < nAgg; ++I) {
+        const auto rowStart = coarse.col_ind.size();
+        for (auto m = fine.agg_ptr[I]; m < fine.agg_ptr[I + 1]; ++m) {
+          const auto i = fine.agg_idx[m];
+          for (auto k = fine.rowPtr[i]; k < fine.rowPtr[i + 1]; ++k) {
+            if (fine.colInd[k] >= n) continue;
+            const auto J = agg[fine.colInd[k]];
+            if (position[J] == NONE || position[J] < rowStart) {
+              position[J] = coarse.col_ind.size();
+              coarse.col_ind.push_back(J);
+              coarse.val.resize(coarse.val.size() + blkSz, 0.0);
+            }
+            auto* block = &coarse.val[position[J] * blkSz];
+            for (auto iVar = 0ul; iVar < blkSz; ++iVar) block[iVar] += fine.values[k * blkSz + iVar];
+          }
+        }
+        coarse.row_ptr.push_back(coarse.col_ind.size());
+      }
+
+      AMGLevels.push_back(std::move(coarse));
+      auto& last = AMGLevels.back();
+      last.rowPtr = last.row_ptr.data();
+      last.colInd = last.col_ind.data();
+      last.values = last.val.data();
+    }
+
+    for (auto& level : AMGLevels) level.invDiag.resize(level.nPoint * blkSz);
+
+    /*--- Dense inverse of the coarsest level if it is small enough. ---*/
+    const auto& coarsest = AMGLevels.back();
+    const auto N = coarsest.nPoint * nVar;
+
+    if (N <= AMG_MAX_DENSE) {
+      vector<ScalarType> A(N * N, 0.0);
+      AMGCoarseInv.assign(N * N, 0.0);
+
+      for (auto i = 0ul; i < coarsest.nPoint; ++i) {
+        for (auto k = coarsest.rowPtr[i]; k < coarsest.rowPtr[i + 1]; ++k) {
+          const auto j = coarsest.colInd[k];
+          if (j >= coarsest.nPoint) continue;
+          for (auto iVar = 0ul; iVar < nVar; ++iVar)
+            for (auto jVar = 0ul; jVar < nVar; ++jVar)
+              A[(i * nVar + iVar) * N + j * nVar + jVar] = coarsest.values[k * blkSz + iVar * nVar + jVar];
+        }
+      }
+      for (auto i = 0ul; i < N; ++i) AMGCoarseInv[i * N + i] = 1.0;
+
+      /*--- Gauss-Jordan elimination with partial pivoting. ---*/
+      for (auto c = 0ul; c < N; ++c) {
+        auto p = c;
+        for (auto r = c + 1; r < N; ++r)
+          if (fabs(A[r * N + c]) > fabs(A[p * N + c])) p = r;
+
+        if (A[p * N + c] == 0.0) {
+          /*--- Singular, the coarsest level will be smoothed instead. ---*/
+          AMGCoarseInv.clear();
+          break;
+        }
+        if (p != c) {
+          for (auto k = 0ul; k < N; ++k) {
+            std::swap(A[p * N + k], A[c * N + k]);
+            std::swap(AMGCoarseInv[p * N + k], AMGCoarseInv[c * N + k]);
+          }
+        }
+        const ScalarType scale = 1.0 / A[c * N + c];
+        for (auto k = 0ul; k < N; ++k) {
+          A[c * N + k] *= scale;
+          AMGCoarseInv[c * N + k] *= scale;
+        }
+        for (auto r = 0ul; r < N; ++r) {
+          const ScalarType f = A[r * N + c];
+          if (r == c || f == 0.0) continue;
+          for (auto k = 0ul; k < N; ++k) {
+            A[r * N + k] -= f * A[c * N + k];
+            AMGCoarseInv[r * N + k] -= f * AMGCoarseInv[c * N + k];
+          }
+        }
+      }
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- l1-Jacobi smoother, the absolute row sums of the off-diagonal blocks are added to the diagonal,
+   *    this bounds the spectral radius of D^-1 A by 1 for symmetric positive definite matrices. The
+   *    smoother is then convergent for any weight below 2, the unweighted one is over-damped. ---*/
+  const ScalarType omega = 1.5;
+
+  for (auto& level : AMGLevels) {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto i = 0ul; i < level.nPoint; ++i) {
+      ScalarType diag[MAXNVAR * MAXNVAR] = {0.0};
+
+      for (auto k = level.rowPtr[i]; k < level.rowPtr[i + 1]; ++k) {
+        const auto j = level.colInd[k];
+        const auto* block = &level.values[k * blkSz];
+        if (j == i) {
+          for (auto iVar = 0ul; iVar < blkSz; ++iVar) diag[iVar] += block[iVar];
+        } else if (j < level.nPoint) {
+          for (auto iVar = 0ul; iVar < nVar; ++iVar)
+            for (auto jVar = 0ul; jVar < nVar; ++jVar) diag[iVar * (nVar + 1)] += fabs(block[iVar * nVar + jVar]);
+        }
+      }
+      MatrixInverse(diag, &level.invDiag[i * blkSz]);
+      for (auto iVar = 0ul; iVar < blkSz; ++iVar) level.invDiag[i * blkSz + iVar] *= omega;
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      CGeometry* geometry, const CConfig* config) const {
+  const auto blkSz = nVar * nVar;
+  const auto nRhs = vec.GetNVar() / nVar;
+  const auto rowSz = nVar * nRhs;
+  const auto nLevel = AMGLevels.size();
+
+  /*--- Coherent view of vectors, and working vectors sized for the number of right-hand sides. ---*/
+  SU2_OMP_BARRIER
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    for (auto iLevel = 0ul; iLevel < nLevel; ++iLevel) {
+      const auto& level = AMGLevels[iLevel];
+      level.res.resize(level.nPoint * rowSz);
+      if (iLevel == 0) continue;
+      level.sol.resize(level.nPoint * rowSz);
+      level.rhs.resize(level.nPoint * rowSz);
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- The finest level works directly on the input and output vectors. ---*/
+  auto sol = [&](unsigned long iLevel) { return iLevel ? AMGLevels[iLevel].sol.data() : &prod[0]; };
+  auto rhs = [&](unsigned long iLevel) { return iLevel ? AMGLevels[iLevel].rhs.data() : &vec[0]; };
+
+  /*--- r = b - A x ---*/
+  auto residual = [&](unsigned long iLevel) {
+    const auto& level = AMGLevels[iLevel];
+    const ScalarType* x = sol(iLevel);
+    const ScalarType* b = rhs(iLevel);
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto i = 0ul; i < level.nPoint; ++i) {
+      auto* r_i = &level.res[i * rowSz];
+      for (auto iVar = 0ul; iVar < rowSz; ++iVar) r_i[iVar] = b[i * rowSz + iVar];
+
+      for (auto k = level.rowPtr[i]; k < level.rowPtr[i + 1]; ++k) {
+        const auto j = level.colInd[k];
+        if (j >= level.nPoint) continue;
+        for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs)
+          MatrixVectorProductSub(&level.values[k * blkSz], &x[j * rowSz + iRhs * nVar], &r_i[iRhs * nVar]);
+      }
+    }
+    END_SU2_OMP_FOR
+  };
+
+  /*--- x = D^-1 b (from a zero initial guess), or x += D^-1 (b - A x). ---*/
+  auto smooth = [&](unsigned long iLevel, bool zeroGuess) {
+    const auto& level = AMGLevels[iLevel];
+    ScalarType* x = sol(iLevel);
+    if (!zeroGuess) residual(iLevel);
+    const ScalarType* r = zeroGuess ? rhs(iLevel) : level.res.data();
+
+    SU2_OMP_FOR_STAT(omp_heavy_size)
+    for (auto i = 0ul; i < level.nPoint; ++i) {
+      for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+        const auto offset = i * rowSz + iRhs * nVar;
+        if (zeroGuess)
+          MatrixVectorProduct(&level.invDiag[i * blkSz], &r[offset], &x[offset]);
+        else
+          MatrixVectorProductAdd(&level.invDiag[i * blkSz], &r[offset], &x[offset]);
+      }
+    }
+    END_SU2_OMP_FOR
+  };
+
+  /*--- Restriction of the residual, sum over the rows of each aggregate. ---*/
+  auto restrictResidual = [&](unsigned long iLevel) {
+    const auto& level = AMGLevels[iLevel];
+    ScalarType* b = AMGLevels[iLevel + 1].rhs.data();
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto I = 0ul; I < AMGLevels[iLevel + 1].nPoint; ++I) {
+      for (auto iVar = 0ul; iVar < rowSz; ++iVar) b[I * rowSz + iVar] = 0.0;
+      for (auto m = level.agg_ptr[I]; m < level.agg_ptr[I + 1]; ++m)
+        for (auto iVar = 0ul; iVar < rowSz; ++iVar) b[I * rowSz + iVar] += level.res[level.agg_idx[m] * rowSz + iVar];
+    }
+    END_SU2_OMP_FOR
+  };
+
+  /*--- Prolongation of the coarse correction. ---*/
+  auto prolongCorrection = [&](unsigned long iLevel) {
+    const auto& level = AMGLevels[iLevel];
+    ScalarType* x = sol(iLevel);
+    const ScalarType* xc = AMGLevels[iLevel + 1].sol.data();
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto i = 0ul; i < level.nPoint; ++i)
+      for (auto iVar = 0ul; iVar < rowSz; ++iVar) x[i * rowSz + iVar] += xc[level.aggregate[i] * rowSz + iVar];
+    END_SU2_OMP_FOR
+  };
+
+  /*--- Downward leg of the V-cycle. ---*/
+  for (auto iLevel = 0ul; iLevel + 1 < nLevel; ++iLevel) {
+    smooth(iLevel, true);
+    residual(iLevel);
+    restrictResidual(iLevel);
+  }
+
+  /*--- Coarsest level, direct solve if possible, otherwise smooth. ---*/
+  const auto iCoarse = nLevel - 1;
+  if (!AMGCoarseInv.empty()) {
+    const auto N = AMGLevels[iCoarse].nPoint * nVar;
+    ScalarType* x = sol(iCoarse);
+    const ScalarType* b = rhs(iCoarse);
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto iRow = 0ul; iRow < N; ++iRow) {
+      const auto i = iRow / nVar, iVar = iRow % nVar;
+      for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+        ScalarType sum = 0.0;
+        for (auto jCol = 0ul; jCol < N; ++jCol)
+          sum += AMGCoarseInv[iRow * N + jCol] * b[(jCol / nVar) * rowSz + iRhs * nVar + jCol % nVar];
+        x[i * rowSz + iRhs * nVar + iVar] = sum;
+      }
+    }
+    END_SU2_OMP_FOR
+  } else {
+    smooth(iCoarse, true);
+    for (int iSweep = 0; iSweep < 4; ++iSweep) smooth(iCoarse, false);
+  }
+
+  /*--- Upward leg, prolongate the corrections and post-smooth. ---*/
+  for (auto iLevel = nLevel - 1; iLevel > 0; --iLevel) {
+    prolongCorrection(iLevel - 1);
+    smooth(iLevel - 1, false);
+  }
+
+  /*--- MPI Parallelization ---*/
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType>& sol, const CSysVector<ScalarType>& f,
                                              CSysVector<ScalarType>& res) const {
@@ -992,6 +1435,8 @@ void CSysMatrix<ScalarType>::EnforceSolutionAtNode(const unsigned long node_i, c
    *    symmetric the entire column may not be eliminated, the result (matrix and vector) is still correct.
    *    The vector is updated with the product of column i by the known (enforced) solution at node i. ---*/
 
+  const auto nRhs = b.GetNVar() / nVar;
+
   for (auto index = row_ptr[node_i]; index < row_ptr[node_i + 1]; ++index) {
     auto node_j = col_ind[index];
 
@@ -1008,14 +1453,17 @@ void CSysMatrix<ScalarType>::EnforceSolutionAtNode(const unsigned long node_i, c
       bji = bij;
     }
 
-    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
-      for (auto jVar = 0ul; jVar < nVar; ++jVar) {
-        /*--- Column product. ---*/
-        b[node_j * nVar + iVar] -= bji[iVar * nVar + jVar] * x_i[jVar];
-        /*--- Delete blocks. ---*/
-        bij[iVar * nVar + jVar] = bji[iVar * nVar + jVar] = 0.0;
+    /*--- Column product, for each right-hand side of b. ---*/
+    for (auto iRhs = 0ul; iRhs < nRhs; ++iRhs) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+          b[(node_j * nRhs + iRhs) * nVar + iVar] -= bji[iVar * nVar + jVar] * x_i[iRhs * nVar + jVar];
+        }
       }
     }
+
+    /*--- Delete blocks. ---*/
+    for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) bij[iVar] = bji[iVar] = 0.0;
   }
 
   /*--- Set the diagonal block to the identity. ---*/
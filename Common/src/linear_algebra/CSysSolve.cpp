@@ -33,6 +33,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
 
 #include <limits>
 
@@ -908,8 +909,8 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
     default: {
       KindSolver = config->GetKind_Linear_Solver();
       KindPrecond = config->GetKind_Linear_Solver_Prec();
-      MaxIter = config->GetLinear_Solver_Iter();
-      SolverTol = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
+      MaxIter = (iterOverride > 0) ? iterOverride : config->GetLinear_Solver_Iter();
+      SolverTol = (tolOverride > 0) ? tolOverride : SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
       ScreenOutput = false;
       break;
     }
@@ -942,6 +943,8 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
 
   /*--- Declaration of the external function ---*/
   auto externalFunction = [&]() {
+    SU2_PROFILE_REGION("Linear solver");
+
     /*--- Create matrix-vector product, preconditioner, and solve the linear system ---*/
 
     HandleTemporariesIn(LinSysRes, LinSysSol);
@@ -952,9 +955,12 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
 
     auto precond = CPreconditioner<ScalarType>::Create(kindPrec, Jacobian, geometry, config);
 
-    /*--- Build preconditioner. ---*/
+    /*--- Build preconditioner, unless the one built for the same matrix can be reused. ---*/
 
-    precond->Build();
+    if (!reusePrecond) {
+      SU2_PROFILE_REGION("Preconditioner");
+      precond->Build();
+    }
 
     /*--- Solve system. ---*/
 
@@ -983,7 +989,7 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         break;
       case PASTIX_LDLT:
       case PASTIX_LU:
-        Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
+        if (!reusePrecond) Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
         Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
         IterLinSol = 1;
         residual = 1e-20;
@@ -1003,10 +1009,15 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
     delete precond;
 
     if (TapeActive) {
-      /*--- To keep the behavior of SU2_DOT, but not strictly required since jacobian is symmetric(?). ---*/
+      /*--- To keep the behavior of SU2_DOT, but not strictly required since jacobian is symmetric(?).
+       * Symmetric systems (e.g. linear elasticity) reuse the primal preconditioner, unless the adjoint uses
+       * a different type of preconditioner, in which case it is built for the (untransposed) matrix. ---*/
       const bool RequiresTranspose =
+          !symmetricSystem &&
           ((lin_sol_mode != LINEAR_SOLVER_MODE::MESH_DEFORM) || (config->GetKind_SU2() == SU2_COMPONENT::SU2_DOT));
 
+      const auto PrimalPrecond = KindPrecond;
+
       if (lin_sol_mode == LINEAR_SOLVER_MODE::MESH_DEFORM)
         KindPrecond = config->GetKind_Deform_Linear_Solver_Prec();
       else if (lin_sol_mode == LINEAR_SOLVER_MODE::GRADIENT_MODE)
@@ -1018,13 +1029,18 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
 
       if (RequiresTranspose) Jacobian.TransposeInPlace();
 
+      const bool RequiresBuild = RequiresTranspose || (symmetricSystem && KindPrecond != PrimalPrecond);
+
       switch (KindPrecond) {
         case ILU:
-          if (RequiresTranspose) Jacobian.BuildILUPreconditioner();
+          if (RequiresBuild) Jacobian.BuildILUPreconditioner();
+          break;
+        case AMG:
+          if (RequiresBuild) Jacobian.BuildAMGPreconditioner();
           break;
         case JACOBI:
         case LINELET:
-          if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
+          if (RequiresBuild) Jacobian.BuildJacobiPreconditioner();
           break;
         case LU_SGS:
           /*--- Nothing to build. ---*/
@@ -1106,7 +1122,7 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
 
   /*--- If there was no call to solve first the preconditioner needs to be built here. ---*/
   if (directCall) {
-    Jacobian.TransposeInPlace();
+    if (!symmetricSystem) Jacobian.TransposeInPlace();
     precond->Build();
   }
 
@@ -0,0 +1,334 @@
+/*!
+ * \file CCommProfiler.cpp
+ * \brief Implementation of the communication profiler (see hpp).
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CCommProfiler.hpp"
+#include "../../include/option_structure.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+bool CCommProfiler::enabled = false;
+
+namespace {
+using MPIWrapper = SelectMPIWrapper<passivedouble>::W;
+
+static_assert(CCommProfiler::N_HALO == SOLUTION_TIME_N1 + 1, "Update the halo exchange names.");
+static_assert(CCommProfiler::N_PERIODIC == PERIODIC_IMPLICIT + 1, "Update the periodic exchange names.");
+
+/*--- Names of the exchanges, MPI_QUANTITIES followed by PERIODIC_QUANTITIES. ---*/
+const char* const EXCHANGE_NAMES[CCommProfiler::N_EXCHANGES] = {
+    "SOLUTION", "SOLUTION_OLD", "SOLUTION_GRADIENT", "SOLUTION_GRAD_REC", "SOLUTION_LIMITER", "SOLUTION_GEOMETRY",
+    "PRIMITIVE_GRADIENT", "PRIMITIVE_GRAD_REC", "PRIMITIVE_LIMITER", "UNDIVIDED_LAPLACIAN", "MAX_EIGENVALUE",
+    "SENSOR", "AUXVAR_GRADIENT", "COORDINATES", "COORDINATES_OLD", "MAX_LENGTH", "GRID_VELOCITY", "SOLUTION_EDDY",
+    "SOLUTION_MATRIX", "SOLUTION_MATRIXTRANS", "NEIGHBORS", "SOLUTION_FEA", "MESH_DISPLACEMENTS", "SOLUTION_TIME_N",
+    "SOLUTION_TIME_N1", "PERIODIC_NONE", "PERIODIC_VOLUME", "PERIODIC_NEIGHBORS", "PERIODIC_RESIDUAL",
+    "PERIODIC_LAPLACIAN", "PERIODIC_MAX_EIG", "PERIODIC_SENSOR", "PERIODIC_SOL_GG", "PERIODIC_PRIM_GG",
+    "PERIODIC_SOL_LS", "PERIODIC_PRIM_LS", "PERIODIC_SOL_ULS", "PERIODIC_PRIM_ULS", "PERIODIC_SOL_GG_R",
+    "PERIODIC_PRIM_GG_R", "PERIODIC_SOL_LS_R", "PERIODIC_PRIM_LS_R", "PERIODIC_SOL_ULS_R", "PERIODIC_PRIM_ULS_R",
+    "PERIODIC_LIM_SOL_1", "PERIODIC_LIM_SOL_2", "PERIODIC_LIM_PRIM_1", "PERIODIC_LIM_PRIM_2", "PERIODIC_IMPLICIT"};
+
+const char* const COLLECTIVE_NAMES[CCommProfiler::N_COLLECTIVES] = {
+    "Allreduce", "Reduce", "Bcast", "Gather", "Gatherv", "Scatter", "Allgather", "Allgatherv", "Alltoall",
+    "Alltoallv", "Barrier"};
+
+/*--- Accumulated values of an exchange type, in the calling rank. ---*/
+struct Exchange {
+  double calls = 0, messages = 0, neighbors = 0, bytes = 0, wait = 0;
+};
+
+/*--- Accumulated values of a kind of collective at a call site (profiler region), in the calling rank. ---*/
+struct Collective {
+  double calls = 0, bytes = 0, time = 0;
+};
+
+Exchange exchanges[CCommProfiler::N_EXCHANGES];
+std::map<std::pair<int, int>, Collective> collectives;
+std::vector<double> bytesTo;
+
+inline bool Recording() { return CCommProfiler::IsEnabled() && omp_get_thread_num() == 0; }
+
+std::string ToString(double value, int precision, bool fixed = false) {
+  std::ostringstream str;
+  if (fixed) str << std::fixed;
+  str << std::setprecision(precision) << value;
+  return str.str();
+}
+}  // namespace
+
+void CCommProfiler::Initialize(bool enable) {
+  enabled = enable;
+  for (auto& exchange : exchanges) exchange = Exchange();
+  collectives.clear();
+  bytesTo.assign(SU2_MPI::GetSize(), 0.0);
+}
+
+void CCommProfiler::AddExchange(int id, int nNeighbors) {
+  if (!Recording() || id < 0 || id >= N_EXCHANGES) return;
+  exchanges[id].calls += 1;
+  exchanges[id].neighbors = std::max<double>(exchanges[id].neighbors, nNeighbors);
+}
+
+void CCommProfiler::AddMessage(int id, int dest, double bytes) {
+  if (!Recording() || id < 0 || id >= N_EXCHANGES) return;
+  exchanges[id].messages += 1;
+  exchanges[id].bytes += bytes;
+  if (dest >= 0 && dest < static_cast<int>(bytesTo.size())) bytesTo[dest] += bytes;
+}
+
+void CCommProfiler::AddWait(int id, double time) {
+  if (!Recording() || id < 0 || id >= N_EXCHANGES) return;
+  exchanges[id].wait += time;
+}
+
+void CCommProfiler::AddCollective(int kind, double bytes, double time) {
+  if (!Recording()) return;
+  auto& collective = collectives[std::make_pair(CProfiler::GetCurrentRegion(), kind)];
+  collective.calls += 1;
+  collective.bytes += bytes;
+  collective.time += time;
+}
+
+void CCommProfiler::Reduce(std::vector<ExchangeStats>& exchangeStats, std::vector<CollectiveStats>& collectiveStats,
+                           std::vector<Volume>& volumes) {
+  /*--- The communication of the reduction is not recorded. ---*/
+  const bool wasEnabled = enabled;
+  enabled = false;
+
+  const int size = SU2_MPI::GetSize();
+  const auto comm = SU2_MPI::GetComm();
+
+  /*--- Exchanges, fixed set of types. ---*/
+
+  constexpr int nFields = 5;
+  std::vector<passivedouble> local(N_EXCHANGES * nFields), sum(local.size()), max(local.size());
+  for (int id = 0; id < N_EXCHANGES; ++id) {
+    local[id * nFields + 0] = exchanges[id].calls;
+    local[id * nFields + 1] = exchanges[id].messages;
+    local[id * nFields + 2] = exchanges[id].neighbors;
+    local[id * nFields + 3] = exchanges[id].bytes;
+    local[id * nFields + 4] = exchanges[id].wait;
+  }
+  MPIWrapper::Allreduce(local.data(), sum.data(), local.size(), MPI_DOUBLE, MPI_SUM, comm);
+  MPIWrapper::Allreduce(local.data(), max.data(), local.size(), MPI_DOUBLE, MPI_MAX, comm);
+
+  exchangeStats.clear();
+  for (int id = 0; id < N_EXCHANGES; ++id) {
+    const auto* s = &sum[id * nFields];
+    const auto* m = &max[id * nFields];
+    if (s[0] == 0) continue;
+    ExchangeStats stats;
+    stats.name = EXCHANGE_NAMES[id];
+    stats.calls = static_cast<unsigned long>(s[0] / size + 0.5);
+    stats.messages = s[1] / s[0];
+    stats.maxNeighbors = m[2];
+    stats.sumBytes = s[3];
+    stats.maxBytes = m[3];
+    stats.avgWait = s[4] / size;
+    stats.maxWait = m[4];
+    exchangeStats.push_back(stats);
+  }
+
+  /*--- Collectives, the call sites of each rank may be different. ---*/
+
+  std::vector<std::string> localKeys;
+  for (const auto& collective : collectives) {
+    const auto& key = collective.first;
+    localKeys.push_back(CProfiler::GetRegionPath(key.first) + '\t' + COLLECTIVE_NAMES[key.second]);
+  }
+  const auto keys = CProfiler::UnionOverRanks(localKeys);
+  std::map<std::string, size_t> index;
+  for (auto i = 0ul; i < keys.size(); ++i) index.emplace(keys[i], i);
+
+  const auto nKeys = keys.size();
+  std::vector<passivedouble> localColl(3 * nKeys, 0.0), sumColl(3 * nKeys), maxColl(3 * nKeys);
+  auto iLocal = 0ul;
+  for (const auto& collective : collectives) {
+    const auto i = index.at(localKeys[iLocal++]);
+    localColl[3 * i + 0] = collective.second.calls;
+    localColl[3 * i + 1] = collective.second.bytes;
+    localColl[3 * i + 2] = collective.second.time;
+  }
+  MPIWrapper::Allreduce(localColl.data(), sumColl.data(), localColl.size(), MPI_DOUBLE, MPI_SUM, comm);
+  MPIWrapper::Allreduce(localColl.data(), maxColl.data(), localColl.size(), MPI_DOUBLE, MPI_MAX, comm);
+
+  collectiveStats.clear();
+  for (auto i = 0ul; i < nKeys; ++i) {
+    CollectiveStats stats;
+    const auto tab = keys[i].find('\t');
+    stats.site = keys[i].substr(0, tab);
+    if (stats.site.empty()) stats.site = "(none)";
+    stats.kind = keys[i].substr(tab + 1);
+    stats.calls = static_cast<unsigned long>(sumColl[3 * i] / size + 0.5);
+    stats.bytes = sumColl[3 * i + 1] / std::max<passivedouble>(sumColl[3 * i], 1.0);
+    stats.avgTime = sumColl[3 * i + 2] / size;
+    stats.maxTime = maxColl[3 * i + 2];
+    collectiveStats.push_back(stats);
+  }
+  std::stable_sort(collectiveStats.begin(), collectiveStats.end(),
+                   [](const CollectiveStats& a, const CollectiveStats& b) { return a.maxTime > b.maxTime; });
+
+  /*--- Rank-to-rank volumes, only the non-zero entries (destination, bytes) of each rank are sent to the
+   *    master rank, one rank at a time, each rank only communicates with a few neighbors. ---*/
+
+  std::vector<passivedouble> entries;
+  for (auto dest = 0ul; dest < bytesTo.size(); ++dest) {
+    if (bytesTo[dest] == 0) continue;
+    entries.push_back(dest);
+    entries.push_back(bytesTo[dest]);
+  }
+  int nEntries = entries.size();
+  std::vector<int> allEntries(SU2_MPI::GetRank() == MASTER_NODE ? size : 0);
+  MPIWrapper::Gather(&nEntries, 1, MPI_INT, allEntries.data(), 1, MPI_INT, MASTER_NODE, comm);
+
+  volumes.clear();
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    std::vector<passivedouble> received;
+    for (int iRank = 0; iRank < size; ++iRank) {
+      if (iRank != MASTER_NODE) {
+        received.resize(allEntries[iRank]);
+        MPIWrapper::Status status;
+        if (!received.empty()) {
+          MPIWrapper::Recv(received.data(), received.size(), MPI_DOUBLE, iRank, 0, comm, &status);
+        }
+      }
+      const auto& rankEntries = (iRank == MASTER_NODE) ? entries : received;
+      for (auto i = 0ul; i + 1 < rankEntries.size(); i += 2) {
+        Volume volume;
+        volume.rank = iRank;
+        volume.dest = static_cast<int>(rankEntries[i]);
+        volume.bytes = rankEntries[i + 1];
+        volumes.push_back(volume);
+      }
+    }
+  } else if (nEntries > 0) {
+    MPIWrapper::Send(entries.data(), nEntries, MPI_DOUBLE, MASTER_NODE, 0, comm);
+  }
+
+  enabled = wasEnabled;
+}
+
+void CCommProfiler::Print() {
+  std::vector<ExchangeStats> exchangeStats;
+  std::vector<CollectiveStats> collectiveStats;
+  std::vector<Volume> volumes;
+  Reduce(exchangeStats, collectiveStats, volumes);
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  const int size = SU2_MPI::GetSize();
+  auto toMB = [](double bytes) { return ToString(bytes / (1024.0 * 1024.0), 3, true); };
+
+  std::cout << "\n------------------------ Communication Profiling -------------------------" << std::endl;
+  std::cout << "Point-to-point exchanges, calls and messages per call are averages over ranks." << std::endl;
+
+  PrintingToolbox::CTablePrinter table(&std::cout);
+  table.AddColumn("Quantity", 22);
+  table.AddColumn("Calls", 8);
+  table.AddColumn("Msg/call", 8);
+  table.AddColumn("Neighbors", 9);
+  table.AddColumn("Sent (sum) [MB]", 15);
+  table.AddColumn("Sent (max) [MB]", 15);
+  table.AddColumn("Wait (avg) [s]", 14);
+  table.AddColumn("Wait (max) [s]", 14);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.PrintHeader();
+  for (const auto& stats : exchangeStats) {
+    table << stats.name << stats.calls << ToString(stats.messages, 3) << stats.maxNeighbors << toMB(stats.sumBytes)
+          << toMB(stats.maxBytes) << ToString(stats.avgWait, 4) << ToString(stats.maxWait, 4);
+  }
+  table.PrintFooter();
+
+  std::cout << "\nCollectives by call site (innermost profiling region), sorted by max time over ranks." << std::endl;
+
+  PrintingToolbox::CTablePrinter coll(&std::cout);
+  coll.AddColumn("Call site", 40);
+  coll.AddColumn("Kind", 10);
+  coll.AddColumn("Calls", 9);
+  coll.AddColumn("Bytes/call", 10);
+  coll.AddColumn("Avg [s]", 10);
+  coll.AddColumn("Max [s]", 10);
+  coll.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  coll.PrintHeader();
+  for (const auto& stats : collectiveStats) {
+    /*--- Long paths are shortened from the left to keep the innermost regions. ---*/
+    auto site = stats.site;
+    if (site.size() > 38) site = "..." + site.substr(site.size() - 35);
+    coll << site << stats.kind << stats.calls << ToString(stats.bytes, 4) << ToString(stats.avgTime, 4)
+         << ToString(stats.maxTime, 4);
+  }
+  coll.PrintFooter();
+
+  if (size > 16) {
+    std::cout << "The rank-to-rank volumes are written to file (more than 16 ranks)." << std::endl;
+    return;
+  }
+  std::vector<double> matrix(size * size, 0.0);
+  for (const auto& volume : volumes) matrix[volume.rank * size + volume.dest] = volume.bytes;
+
+  std::cout << "\nBytes sent in point-to-point exchanges [MB], from rank (row) to rank (column)." << std::endl;
+  PrintingToolbox::CTablePrinter rankTable(&std::cout);
+  rankTable.AddColumn("Rank", 5);
+  for (int j = 0; j < size; ++j) rankTable.AddColumn(std::to_string(j), 9);
+  rankTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+  rankTable.PrintHeader();
+  for (int i = 0; i < size; ++i) {
+    rankTable << i;
+    for (int j = 0; j < size; ++j) rankTable << toMB(matrix[i * size + j]);
+  }
+  rankTable.PrintFooter();
+}
+
+void CCommProfiler::Write(const std::string& fileName) {
+  std::vector<ExchangeStats> exchangeStats;
+  std::vector<CollectiveStats> collectiveStats;
+  std::vector<Volume> volumes;
+  Reduce(exchangeStats, collectiveStats, volumes);
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  std::ofstream file(fileName + "_comms.csv");
+  file.precision(8);
+  file << "\"Kind\",\"Name\",\"Site\",\"Calls\",\"Messages_Per_Call\",\"Max_Neighbors\",\"Sum_Bytes\",\"Max_Bytes\","
+          "\"Bytes_Per_Call\",\"Avg_Time\",\"Max_Time\"\n";
+  for (const auto& stats : exchangeStats) {
+    file << "\"Exchange\",\"" << stats.name << "\",\"\"," << stats.calls << "," << stats.messages << ","
+         << stats.maxNeighbors << "," << stats.sumBytes << "," << stats.maxBytes << ",," << stats.avgWait << ","
+         << stats.maxWait << "\n";
+  }
+  for (const auto& stats : collectiveStats) {
+    file << "\"Collective\",\"" << stats.kind << "\",\"" << stats.site << "\"," << stats.calls << ",,,,,"
+         << stats.bytes << "," << stats.avgTime << "," << stats.maxTime << "\n";
+  }
+  file.close();
+
+  file.open(fileName + "_comm_matrix.csv");
+  file << "\"Rank\",\"Dest\",\"Bytes\"\n";
+  for (const auto& volume : volumes) file << volume.rank << "," << volume.dest << "," << volume.bytes << "\n";
+}
@@ -0,0 +1,108 @@
+/*!
+ * \file CHardwareCounters.cpp
+ * \brief Implementation of the hardware counters (see hpp).
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CHardwareCounters.hpp"
+
+#include <sstream>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#define HAVE_PERF_EVENT
+#endif
+
+namespace {
+/*--- Generic events, in the order in which they are opened. ---*/
+const char* const GENERIC_NAMES[] = {"Cycles", "Instructions", "Cache_References", "Cache_Misses"};
+constexpr int N_GENERIC = 4;
+}  // namespace
+
+std::vector<std::string> CHardwareCounters::EventNames(const std::vector<unsigned long>& rawEvents) {
+  std::vector<std::string> names(GENERIC_NAMES, GENERIC_NAMES + N_GENERIC);
+  for (const auto code : rawEvents) {
+    std::ostringstream name;
+    name << "Raw_0x" << std::hex << code;
+    names.push_back(name.str());
+  }
+  if (names.size() > MAX_EVENTS) names.resize(MAX_EVENTS);
+  return names;
+}
+
+std::string CHardwareCounters::Open(const std::vector<unsigned long>& rawEvents) {
+  Close();
+#ifdef HAVE_PERF_EVENT
+  const uint64_t genericConfigs[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                     PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES};
+
+  const int nEvents = EventNames(rawEvents).size();
+  for (int i = 0; i < nEvents; ++i) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = (i < N_GENERIC) ? PERF_TYPE_HARDWARE : PERF_TYPE_RAW;
+    attr.config = (i < N_GENERIC) ? genericConfigs[i] : rawEvents[i - N_GENERIC];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    /*--- Calling thread (pid 0), any CPU, no group. ---*/
+    const int fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    if (fd < 0) {
+      const std::string reason = std::string("perf_event_open failed for ") + EventNames(rawEvents)[i] + " (" +
+                                 strerror(errno) + ")";
+      Close();
+      return reason;
+    }
+    fds.push_back(fd);
+  }
+  return "";
+#else
+  return "hardware counters are only supported on Linux";
+#endif
+}
+
+void CHardwareCounters::Close() {
+#ifdef HAVE_PERF_EVENT
+  for (const int fd : fds) close(fd);
+#endif
+  fds.clear();
+}
+
+void CHardwareCounters::Read(Reading& reading) const {
+#ifdef HAVE_PERF_EVENT
+  for (int i = 0; i < GetnEvents(); ++i) {
+    uint64_t data[3] = {0, 0, 0};
+    if (read(fds[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))) continue;
+    reading.value[i] = data[0];
+    reading.enabled[i] = data[1];
+    reading.running[i] = data[2];
+  }
+#endif
+}
@@ -0,0 +1,215 @@
+/*!
+ * \file CMemoryTracker.cpp
+ * \brief Implementation of the memory tracker (see hpp).
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CMemoryTracker.hpp"
+#include "../../include/option_structure.hpp"
+#include "../../include/basic_types/ad_structure.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/parallelization/omp_structure.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+const char* CMemoryTracker::names[MAX_OWNERS] = {"Other"};
+std::atomic<int> CMemoryTracker::nOwners{1};
+std::atomic<int> CMemoryTracker::sharedOwner{0};
+thread_local int CMemoryTracker::threadOwner = -1;
+std::atomic<long long> CMemoryTracker::current[MAX_OWNERS + 1] = {};
+std::atomic<long long> CMemoryTracker::peak[MAX_OWNERS + 1] = {};
+
+namespace {
+using MPIWrapper = SelectMPIWrapper<passivedouble>::W;
+
+/*--- Peak resident set size of the process in bytes, 0 if not available. ---*/
+double PeakResidentSize() {
+#if defined(_WIN32)
+  return 0.0;
+#else
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+#if defined(__APPLE__)
+  return usage.ru_maxrss;
+#else
+  return usage.ru_maxrss * 1024.0;
+#endif
+#endif
+}
+}  // namespace
+
+int CMemoryTracker::GetOwner(const char* name) {
+  auto find = [name](int n) {
+    for (int i = 0; i < n; ++i) {
+      if (names[i] == name || strcmp(names[i], name) == 0) return i;
+    }
+    return -1;
+  };
+
+  /*--- Names are only appended, and published by the release store of nOwners, the lookup can be lock-free. ---*/
+  int owner = find(nOwners.load(std::memory_order_acquire));
+  if (owner >= 0) return owner;
+
+  SU2_OMP_CRITICAL
+  {
+    const int n = nOwners.load(std::memory_order_relaxed);
+    owner = find(n);
+    if (owner < 0) {
+      owner = 0;
+      if (n < MAX_OWNERS) {
+        names[n] = name;
+        nOwners.store(n + 1, std::memory_order_release);
+        owner = n;
+      }
+    }
+  }
+  END_SU2_OMP_CRITICAL
+  return owner;
+}
+
+int CMemoryTracker::SetCurrentOwner(int owner) {
+  if (omp_in_parallel()) {
+    const int previous = threadOwner;
+    threadOwner = owner;
+    return previous;
+  }
+  return sharedOwner.exchange(owner, std::memory_order_relaxed);
+}
+
+std::vector<CMemoryTracker::OwnerStats> CMemoryTracker::Reduce(OwnerStats& total) {
+  /*--- Union of the owners of all ranks, each rank may have registered them in a different order. ---*/
+
+  const int size = SU2_MPI::GetSize();
+  const int n = nOwners.load();
+  std::string localBuffer;
+  for (int i = 0; i < n; ++i) localBuffer += std::string(names[i]) + '\n';
+
+  int localLength = localBuffer.size();
+  std::vector<int> lengths(size), displs(size, 0);
+  MPIWrapper::Allgather(&localLength, 1, MPI_INT, lengths.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int i = 1; i < size; ++i) displs[i] = displs[i - 1] + lengths[i - 1];
+
+  std::vector<char> buffer(displs[size - 1] + lengths[size - 1] + 1, '\0');
+  MPIWrapper::Allgatherv(localBuffer.data(), localLength, MPI_CHAR, buffer.data(), lengths.data(), displs.data(),
+                         MPI_CHAR, SU2_MPI::GetComm());
+
+  std::vector<std::string> allNames;
+  std::map<std::string, size_t> index;
+  std::istringstream allBuffer(std::string(buffer.data(), buffer.size() - 1));
+  for (std::string name; std::getline(allBuffer, name);) {
+    if (index.emplace(name, allNames.size()).second) allNames.push_back(name);
+  }
+
+  /*--- Reduce current and peak memory, the last entry is the total. ---*/
+
+  const auto nAll = allNames.size();
+  std::vector<passivedouble> localCurrent(nAll + 1, 0.0), localPeak(nAll + 1, 0.0);
+  for (int i = 0; i < n; ++i) {
+    const auto iAll = index.at(names[i]);
+    localCurrent[iAll] = current[i].load();
+    localPeak[iAll] = peak[i].load();
+  }
+  localCurrent[nAll] = current[MAX_OWNERS].load();
+  localPeak[nAll] = peak[MAX_OWNERS].load();
+
+  std::vector<passivedouble> sumCurrent(nAll + 1), maxCurrent(nAll + 1), sumPeak(nAll + 1), maxPeak(nAll + 1);
+  const auto comm = SU2_MPI::GetComm();
+  MPIWrapper::Allreduce(localCurrent.data(), sumCurrent.data(), nAll + 1, MPI_DOUBLE, MPI_SUM, comm);
+  MPIWrapper::Allreduce(localCurrent.data(), maxCurrent.data(), nAll + 1, MPI_DOUBLE, MPI_MAX, comm);
+  MPIWrapper::Allreduce(localPeak.data(), sumPeak.data(), nAll + 1, MPI_DOUBLE, MPI_SUM, comm);
+  MPIWrapper::Allreduce(localPeak.data(), maxPeak.data(), nAll + 1, MPI_DOUBLE, MPI_MAX, comm);
+
+  auto makeStats = [&](size_t i, const std::string& name) {
+    OwnerStats stats;
+    stats.name = name;
+    stats.sumCurrent = sumCurrent[i];
+    stats.maxCurrent = maxCurrent[i];
+    stats.sumPeak = sumPeak[i];
+    stats.maxPeak = maxPeak[i];
+    return stats;
+  };
+  total = makeStats(nAll, "Total");
+
+  std::vector<OwnerStats> owners;
+  for (auto i = 0ul; i < nAll; ++i) {
+    if (maxPeak[i] > 0) owners.push_back(makeStats(i, allNames[i]));
+  }
+  std::stable_sort(owners.begin(), owners.end(),
+                   [](const OwnerStats& a, const OwnerStats& b) { return a.maxPeak > b.maxPeak; });
+  return owners;
+}
+
+void CMemoryTracker::Print(const std::string& title) {
+  /*--- The tape is not allocated via MemoryAllocation, its current size is measured. ---*/
+  if (AD::GetTapeMemory() > 0) Set("AD tape", AD::GetTapeMemory());
+
+  OwnerStats total;
+  const auto owners = Reduce(total);
+
+  passivedouble localRSS = PeakResidentSize(), maxRSS = 0.0, sumRSS = 0.0;
+  MPIWrapper::Allreduce(&localRSS, &maxRSS, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  MPIWrapper::Allreduce(&localRSS, &sumRSS, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  std::cout << "\n---------------------------- Memory Report -----------------------------" << std::endl;
+  std::cout << "Memory " << title << " [MB]. Peak values are high-water marks of each owner, max/sum over ranks."
+            << std::endl;
+
+  auto toMB = [](double bytes) {
+    std::ostringstream value;
+    value << std::fixed << std::setprecision(1) << bytes / (1024.0 * 1024.0);
+    return value.str();
+  };
+
+  PrintingToolbox::CTablePrinter table(&std::cout);
+  table.AddColumn("Owner", 24);
+  table.AddColumn("Current (max)", 14);
+  table.AddColumn("Current (sum)", 14);
+  table.AddColumn("Peak (max)", 14);
+  table.AddColumn("Peak (sum)", 14);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.PrintHeader();
+  for (const auto& owner : owners) {
+    table << owner.name << toMB(owner.maxCurrent) << toMB(owner.sumCurrent) << toMB(owner.maxPeak)
+          << toMB(owner.sumPeak);
+  }
+  table.PrintFooter();
+  table << total.name << toMB(total.maxCurrent) << toMB(total.sumCurrent) << toMB(total.maxPeak)
+        << toMB(total.sumPeak);
+  table.PrintFooter();
+
+  if (maxRSS > 0) {
+    std::cout << "Peak resident memory of the process: " << toMB(maxRSS) << " MB (max over ranks), " << toMB(sumRSS)
+              << " MB (sum over ranks)." << std::endl;
+  }
+}
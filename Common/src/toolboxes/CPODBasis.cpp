@@ -0,0 +1,178 @@
+/*!
+ * \file CPODBasis.cpp
+ * \brief Implementation of the POD basis class (see hpp).
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CPODBasis.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+/*!
+ * \brief Eigen-decomposition of a small symmetric matrix with the cyclic Jacobi method.
+ * \param[in,out] A - The matrix, on exit its diagonal holds the eigenvalues.
+ * \param[out] V - The eigenvectors (columns).
+ */
+void SymmetricEigenJacobi(su2passivematrix& A, su2passivematrix& V) {
+  const auto n = A.rows();
+  V.resize(n, n) = 0.0;
+  for (auto i = 0ul; i < n; ++i) V(i, i) = 1.0;
+
+  for (int sweep = 0; sweep < 100; ++sweep) {
+    passivedouble offDiag = 0.0, diag = 0.0;
+    for (auto i = 0ul; i < n; ++i) {
+      diag += pow(A(i, i), 2);
+      for (auto j = i + 1; j < n; ++j) offDiag += pow(A(i, j), 2);
+    }
+    if (offDiag <= 1e-30 * diag) break;
+
+    for (auto p = 0ul; p < n; ++p) {
+      for (auto q = p + 1; q < n; ++q) {
+        if (fabs(A(p, q)) < 1e-300) continue;
+
+        /*--- Rotation that annihilates A(p,q). ---*/
+        const passivedouble theta = 0.5 * (A(q, q) - A(p, p)) / A(p, q);
+        const passivedouble t = copysign(1.0, theta) / (fabs(theta) + sqrt(theta * theta + 1.0));
+        const passivedouble c = 1.0 / sqrt(t * t + 1.0), s = t * c;
+
+        for (auto k = 0ul; k < n; ++k) {
+          const passivedouble akp = A(k, p), akq = A(k, q);
+          A(k, p) = c * akp - s * akq;
+          A(k, q) = s * akp + c * akq;
+        }
+        for (auto k = 0ul; k < n; ++k) {
+          const passivedouble apk = A(p, k), aqk = A(q, k);
+          A(p, k) = c * apk - s * aqk;
+          A(q, k) = s * apk + c * aqk;
+        }
+        for (auto k = 0ul; k < n; ++k) {
+          const passivedouble vkp = V(k, p), vkq = V(k, q);
+          V(k, p) = c * vkp - s * vkq;
+          V(k, q) = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+void CPODBasis::Build(const std::vector<su2passivematrix>& snapshots, unsigned long maxModes, passivedouble tolerance) {
+  const auto nSnap = snapshots.size();
+  if (nSnap < 2) SU2_MPI::Error("At least two snapshots are needed to build a POD basis.", CURRENT_FUNCTION);
+
+  const auto nPoint = snapshots[0].rows();
+  const auto nVar = snapshots[0].cols();
+  for (const auto& snap : snapshots) {
+    if (snap.rows() != nPoint || snap.cols() != nVar)
+      SU2_MPI::Error("The snapshots do not have the same size.", CURRENT_FUNCTION);
+  }
+
+  /*--- Reference state (mean of the snapshots). ---*/
+
+  reference.resize(nPoint, nVar) = 0.0;
+  for (const auto& snap : snapshots) {
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) reference(iPoint, iVar) += snap(iPoint, iVar) / nSnap;
+  }
+
+  /*--- Inner product weights, the inverse of the mean square of each variable of the reference. ---*/
+
+  su2passivevector localSq(nVar + 1);
+  localSq = 0.0;
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) localSq[iVar] += pow(reference(iPoint, iVar), 2);
+  localSq[nVar] = nPoint;
+
+  su2passivevector globalSq(nVar + 1);
+  SelectMPIWrapper<passivedouble>::W::Allreduce(localSq.data(), globalSq.data(), nVar + 1, MPI_DOUBLE, MPI_SUM,
+                                                SU2_MPI::GetComm());
+
+  weights.resize(nVar);
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+    const passivedouble meanSq = globalSq[iVar] / std::max<passivedouble>(globalSq[nVar], 1);
+    weights[iVar] = 1.0 / std::max<passivedouble>(meanSq, 1e-16);
+  }
+
+  /*--- Correlation matrix of the fluctuations, C_ij = <s_i - s_ref, s_j - s_ref>. ---*/
+
+  su2passivematrix localCorr(nSnap, nSnap), corr(nSnap, nSnap);
+  localCorr = 0.0;
+  for (auto i = 0ul; i < nSnap; ++i) {
+    for (auto j = 0ul; j <= i; ++j) {
+      passivedouble sum = 0.0;
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+          sum += weights[iVar] * (snapshots[i](iPoint, iVar) - reference(iPoint, iVar)) *
+                 (snapshots[j](iPoint, iVar) - reference(iPoint, iVar));
+        }
+      }
+      localCorr(i, j) = localCorr(j, i) = sum;
+    }
+  }
+  SelectMPIWrapper<passivedouble>::W::Allreduce(localCorr.data(), corr.data(), nSnap * nSnap, MPI_DOUBLE, MPI_SUM,
+                                                SU2_MPI::GetComm());
+
+  /*--- Eigen-decomposition, sorted by decreasing energy. ---*/
+
+  su2passivematrix eigVec;
+  SymmetricEigenJacobi(corr, eigVec);
+
+  std::vector<unsigned long> order(nSnap);
+  std::iota(order.begin(), order.end(), 0ul);
+  std::sort(order.begin(), order.end(),
+            [&corr](unsigned long a, unsigned long b) { return corr(a, a) > corr(b, b); });
+
+  passivedouble totalEnergy = 0.0;
+  for (auto i = 0ul; i < nSnap; ++i) totalEnergy += std::max<passivedouble>(corr(i, i), 0.0);
+
+  /*--- The modes are combinations of the fluctuations, phi_k = sum_i v_ik (s_i - s_ref) / sqrt(lambda_k). ---*/
+
+  std::vector<unsigned long> retained;
+  for (auto i : order) {
+    if (retained.size() == maxModes || corr(i, i) <= tolerance * corr(order[0], order[0])) break;
+    retained.push_back(i);
+  }
+
+  modes.clear();
+  eigenvalues.resize(retained.size());
+  energyFraction = 0.0;
+
+  for (auto iMode = 0ul; iMode < retained.size(); ++iMode) {
+    const auto k = retained[iMode];
+    eigenvalues[iMode] = corr(k, k);
+    energyFraction += corr(k, k) / std::max(totalEnergy, 1e-300);
+
+    const passivedouble scale = 1.0 / sqrt(corr(k, k));
+    modes.emplace_back(nPoint, nVar);
+    auto& mode = modes.back();
+    mode = 0.0;
+    for (auto i = 0ul; i < nSnap; ++i) {
+      const passivedouble coeff = eigVec(i, k) * scale;
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          mode(iPoint, iVar) += coeff * (snapshots[i](iPoint, iVar) - reference(iPoint, iVar));
+    }
+  }
+}
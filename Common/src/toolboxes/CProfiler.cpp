@@ -0,0 +1,623 @@
+/*!
+ * \file CProfiler.cpp
+ * \brief Implementation of the runtime profiler (see hpp).
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CProfiler.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+bool CProfiler::enabled = false;
+std::vector<CProfiler::ThreadData> CProfiler::threads;
+std::vector<const char*> CProfiler::forkPath;
+CProfiler::Clock::time_point CProfiler::startTime = CProfiler::Clock::now();
+bool CProfiler::useCounters = false;
+bool CProfiler::countersWarned = false;
+std::vector<unsigned long> CProfiler::rawEvents;
+double CProfiler::streamBandwidth = 0.0;
+double CProfiler::peakFlops = 0.0;
+
+namespace {
+/*--- CSV files written in this run, the first write truncates the file. ---*/
+std::set<std::string> csvFilesWritten;
+
+using MPIWrapper = SelectMPIWrapper<passivedouble>::W;
+
+/*--- Result of the compute benchmark, prevents the compiler from removing it. ---*/
+volatile double benchmarkSink = 0.0;
+
+/*--- Size in bytes of the last level cache of the first CPU, and number of CPUs that share it, from sysfs
+ *    (Linux), the size is 0 if it is not available. ---*/
+std::pair<unsigned long, int> LastLevelCache() {
+  unsigned long size = 0;
+  int level = 0, nShared = 1;
+  for (int index = 0; index < 16; ++index) {
+    const std::string dir = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+    std::ifstream levelFile(dir + "level"), sizeFile(dir + "size"), sharedFile(dir + "shared_cpu_list");
+    int thisLevel = 0;
+    unsigned long thisSize = 0;
+    std::string unit, cpus;
+    if (!(levelFile >> thisLevel) || !(sizeFile >> thisSize) || thisLevel < level) continue;
+    sizeFile >> unit;
+    if (unit == "K") thisSize <<= 10;
+    if (unit == "M") thisSize <<= 20;
+    if (unit == "G") thisSize <<= 30;
+    level = thisLevel;
+    size = thisSize;
+
+    /*--- List of ranges, e.g. "0-15,32-47". ---*/
+    nShared = 0;
+    std::getline(sharedFile, cpus);
+    std::istringstream ranges(cpus);
+    for (std::string range; std::getline(ranges, range, ',');) {
+      const auto dash = range.find('-');
+      try {
+        nShared += (dash == std::string::npos) ? 1 : std::stoi(range.substr(dash + 1)) - std::stoi(range) + 1;
+      } catch (const std::exception&) {
+      }
+    }
+    nShared = std::max(nShared, 1);
+  }
+  return std::make_pair(size, nShared);
+}
+
+/*--- Roofline table of the regions that declared work, given the limits of the machine (sum over ranks). ---*/
+void PrintRoofline(const std::vector<CProfiler::RegionStats>& stats, double bandwidth, double flops) {
+  const double ridge = flops / bandwidth;
+
+  std::cout << "\nRoofline, regions with declared work (estimates). Machine: STREAM triad " << std::setprecision(4)
+            << bandwidth * 1e-9 << " GB/s, attainable " << flops * 1e-9 << " GFLOP/s, ridge point " << ridge
+            << " flop/B." << std::endl;
+  std::cout << "Rates use the average time over ranks excluding nested MPI comms, and are totals over ranks."
+            << std::endl;
+
+  PrintingToolbox::CTablePrinter table(&std::cout);
+  table.AddColumn("Region", 32);
+  table.AddColumn("AI [flop/B]", 11);
+  table.AddColumn("GB/s", 9);
+  table.AddColumn("STREAM [%]", 10);
+  table.AddColumn("GFLOP/s", 9);
+  table.AddColumn("Peak [%]", 8);
+  table.AddColumn("Bound", 8);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.PrintHeader();
+
+  for (const auto& region : stats) {
+    if (region.bytes <= 0 && region.flops <= 0) continue;
+
+    /*--- The halo exchanges done by some kernels (e.g. gradients) are not part of the kernel. ---*/
+    double time = region.avgTime;
+    for (const auto& other : stats)
+      if (other.path == region.path + "/MPI comms") time -= other.avgTime;
+    if (time <= 0) continue;
+
+    const double intensity = region.flops / std::max(region.bytes, 1.0);
+    const double rateBytes = region.bytes / time, rateFlops = region.flops / time;
+
+    const auto name = std::string(2 * region.depth, ' ') + region.path.substr(region.path.rfind('/') + 1);
+    std::ostringstream ai, gbs, pctBw, gflops, pctPeak;
+    ai << std::setprecision(3) << intensity;
+    gbs << std::setprecision(4) << rateBytes * 1e-9;
+    pctBw << std::fixed << std::setprecision(1) << 100 * rateBytes / bandwidth;
+    gflops << std::setprecision(4) << rateFlops * 1e-9;
+    pctPeak << std::fixed << std::setprecision(1) << 100 * rateFlops / flops;
+    table << name << ai.str() << gbs.str() << pctBw.str() << gflops.str() << pctPeak.str()
+          << (intensity < ridge ? "memory" : "compute");
+  }
+  table.PrintFooter();
+}
+}  // namespace
+
+void CProfiler::Initialize(bool enable, bool counters, const std::vector<std::string>& raw) {
+  enabled = enable;
+  for (auto& data : threads) data.counters.Close();
+  threads.clear();
+  threads.resize(omp_get_max_threads());
+  for (auto& data : threads) data.tree.resize(1);
+  forkPath.clear();
+
+  useCounters = enable && counters;
+  countersWarned = false;
+  rawEvents.clear();
+  for (const auto& code : raw) {
+    try {
+      rawEvents.push_back(std::stoul(code, nullptr, 0));
+    } catch (const std::exception&) {
+      SU2_MPI::Error("Invalid raw hardware event \"" + code + "\".", CURRENT_FUNCTION);
+    }
+  }
+  const auto maxRaw = CHardwareCounters::MAX_EVENTS - CHardwareCounters::EventNames({}).size();
+  if (rawEvents.size() > maxRaw) {
+    SU2_MPI::Error("At most " + std::to_string(maxRaw) + " raw hardware events can be requested.", CURRENT_FUNCTION);
+  }
+  startTime = Clock::now();
+}
+
+int CProfiler::FindChild(std::vector<Region>& tree, int parent, const char* name) {
+  for (const int child : tree[parent].children) {
+    const char* other = tree[child].name;
+    if (other == name || strcmp(other, name) == 0) return child;
+  }
+  const int child = tree.size();
+  tree.emplace_back();
+  tree.back().name = name;
+  tree.back().parent = parent;
+  tree[parent].children.push_back(child);
+  return child;
+}
+
+int CProfiler::Enter(const char* name) {
+  const int thread = omp_get_thread_num();
+  if (thread >= static_cast<int>(threads.size())) return -1;
+  auto& data = threads[thread];
+
+  /*--- The worker threads place their outermost regions under the regions of the master thread. ---*/
+  if (thread != 0 && data.depth == 0) {
+    data.current = 0;
+    for (const char* parent : forkPath) data.current = FindChild(data.tree, data.current, parent);
+  }
+  const int region = FindChild(data.tree, data.current, name);
+  data.current = region;
+  ++data.depth;
+
+  if (thread == 0 && !omp_in_parallel()) forkPath.push_back(name);
+
+  /*--- The counters are opened lazily by each thread, since they can only be read by the thread that opened them. ---*/
+  if (useCounters) {
+    if (data.countersState == 0) {
+      /*--- Failures are reported once, by Reduce, after combining all the threads and ranks. ---*/
+      data.countersError = data.counters.Open(rawEvents);
+      data.countersState = data.countersError.empty() ? 1 : -1;
+    }
+    if (data.countersState == 1) {
+      data.readings.emplace_back();
+      data.counters.Read(data.readings.back());
+    }
+  }
+  return region;
+}
+
+void CProfiler::Leave(int region, double elapsed) {
+  const int thread = omp_get_thread_num();
+  auto& data = threads[thread];
+  if (region >= static_cast<int>(data.tree.size()) || data.depth == 0) return;
+
+  auto& node = data.tree[region];
+  node.time += elapsed;
+  ++node.calls;
+
+  if (data.countersState == 1 && !data.readings.empty()) {
+    CHardwareCounters::Reading end;
+    data.counters.Read(end);
+    data.counters.AddDelta(data.readings.back(), end, node.counts);
+    data.readings.pop_back();
+  }
+  data.current = node.parent;
+  --data.depth;
+
+  if (thread == 0 && !omp_in_parallel() && !forkPath.empty()) forkPath.pop_back();
+}
+
+std::string CProfiler::GetRegionPath(int region) {
+  if (threads.empty() || region <= 0 || region >= static_cast<int>(threads[0].tree.size())) return "";
+  const auto& tree = threads[0].tree;
+  std::string path = tree[region].name;
+  for (int parent = tree[region].parent; parent > 0; parent = tree[parent].parent)
+    path = std::string(tree[parent].name) + "/" + path;
+  return path;
+}
+
+std::vector<std::string> CProfiler::UnionOverRanks(const std::vector<std::string>& names) {
+  const int size = SU2_MPI::GetSize();
+  std::string localBuffer;
+  for (const auto& name : names) localBuffer += name + '\n';
+
+  int localLength = localBuffer.size();
+  std::vector<int> lengths(size), displs(size, 0);
+  MPIWrapper::Allgather(&localLength, 1, MPI_INT, lengths.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int i = 1; i < size; ++i) displs[i] = displs[i - 1] + lengths[i - 1];
+
+  std::vector<char> buffer(displs[size - 1] + lengths[size - 1] + 1, '\0');
+  MPIWrapper::Allgatherv(localBuffer.data(), localLength, MPI_CHAR, buffer.data(), lengths.data(), displs.data(),
+                         MPI_CHAR, SU2_MPI::GetComm());
+
+  std::vector<std::string> allNames;
+  std::set<std::string> seen;
+  std::istringstream allBuffer(std::string(buffer.data(), buffer.size() - 1));
+  for (std::string name; std::getline(allBuffer, name);) {
+    if (seen.insert(name).second) allNames.push_back(name);
+  }
+  return allNames;
+}
+
+CProfiler::RegionTotals CProfiler::GetTotals(const char* name) {
+  RegionTotals totals;
+  if (threads.empty()) return totals;
+  const auto& tree = threads[0].tree;
+
+  /*--- Depth-first traversal, the children of matching regions are not visited. ---*/
+  std::vector<int> stack(tree[0].children.begin(), tree[0].children.end());
+  while (!stack.empty()) {
+    const auto& node = tree[stack.back()];
+    stack.pop_back();
+    if (strcmp(node.name, name) == 0) {
+      totals.time += node.time;
+      totals.bytes += node.bytes;
+      totals.flops += node.flops;
+      totals.calls += node.calls;
+    } else {
+      stack.insert(stack.end(), node.children.begin(), node.children.end());
+    }
+  }
+  return totals;
+}
+
+std::vector<CProfiler::RegionStats> CProfiler::Reduce(double& totalTime) {
+  /*--- Flatten the trees of the threads, for each region keep the slowest thread, and the total time and
+   *    number of threads that entered it to measure the load imbalance. ---*/
+
+  std::vector<std::string> localPaths;
+  std::map<std::string, size_t> localIndex;
+  std::vector<passivedouble> localTime, localCalls, localCounts, threadTime, threadCount, localBytes, localFlops;
+  const int nCounts = CHardwareCounters::EventNames(rawEvents).size();
+
+  for (const auto& data : threads) {
+    std::vector<std::pair<int, std::string>> stack;
+    for (auto it = data.tree[0].children.rbegin(); it != data.tree[0].children.rend(); ++it)
+      stack.emplace_back(*it, data.tree[*it].name);
+
+    while (!stack.empty()) {
+      const auto region = stack.back().first;
+      const auto path = stack.back().second;
+      stack.pop_back();
+
+      const auto& node = data.tree[region];
+      auto it = localIndex.find(path);
+      if (it == localIndex.end()) {
+        it = localIndex.emplace(path, localPaths.size()).first;
+        localPaths.push_back(path);
+        localTime.push_back(0.0);
+        localCalls.push_back(0.0);
+        threadTime.push_back(0.0);
+        threadCount.push_back(0.0);
+        localBytes.push_back(0.0);
+        localFlops.push_back(0.0);
+        localCounts.resize(localCounts.size() + nCounts, 0.0);
+      }
+      localTime[it->second] = std::max<passivedouble>(localTime[it->second], node.time);
+      localCalls[it->second] = std::max<passivedouble>(localCalls[it->second], node.calls);
+      if (node.calls > 0) {
+        threadTime[it->second] += node.time;
+        threadCount[it->second] += 1;
+      }
+      localBytes[it->second] += node.bytes;
+      localFlops[it->second] += node.flops;
+      for (int iCount = 0; iCount < nCounts; ++iCount)
+        localCounts[it->second * nCounts + iCount] += node.counts[iCount];
+
+      for (auto child = node.children.rbegin(); child != node.children.rend(); ++child)
+        stack.emplace_back(*child, path + "/" + data.tree[*child].name);
+    }
+  }
+
+  /*--- Union of the regions of all ranks, each rank may have entered different regions. ---*/
+
+  const int size = SU2_MPI::GetSize();
+  const auto paths = UnionOverRanks(localPaths);
+  std::map<std::string, size_t> index;
+  for (auto i = 0ul; i < paths.size(); ++i) index.emplace(paths[i], i);
+
+  /*--- Depth-first order, siblings in order of first appearance. The key of a region is the
+   *    list of indices of itself and its parents, which are always present in the list. ---*/
+
+  std::vector<std::vector<size_t>> keys(paths.size());
+  for (auto i = 0ul; i < paths.size(); ++i) {
+    for (auto pos = paths[i].find('/'); pos != std::string::npos; pos = paths[i].find('/', pos + 1))
+      keys[i].push_back(index.at(paths[i].substr(0, pos)));
+    keys[i].push_back(i);
+  }
+  std::vector<size_t> order(paths.size());
+  for (auto i = 0ul; i < order.size(); ++i) order[i] = i;
+  std::sort(order.begin(), order.end(), [&keys](size_t a, size_t b) { return keys[a] < keys[b]; });
+
+  /*--- Reduce the times over the ranks. ---*/
+
+  const auto nRegion = paths.size();
+  std::vector<passivedouble> time(nRegion, 0.0), calls(nRegion, 0.0), counts(nRegion * nCounts, 0.0);
+  std::vector<passivedouble> imbalance(nRegion, 0.0), maxImbalance(nRegion, 0.0);
+  std::vector<passivedouble> work(2 * nRegion, 0.0), sumWork(2 * nRegion, 0.0);
+  for (auto i = 0ul; i < localPaths.size(); ++i) {
+    const auto iRegion = index.at(localPaths[i]);
+    time[iRegion] = localTime[i];
+    calls[iRegion] = localCalls[i];
+    work[2 * iRegion] = localBytes[i];
+    work[2 * iRegion + 1] = localFlops[i];
+    /*--- Slowest over average thread, only regions entered by the worker threads can be imbalanced. ---*/
+    if (threadCount[i] > 1 && threadTime[i] > 0) {
+      imbalance[iRegion] = localTime[i] * threadCount[i] / threadTime[i] - 1;
+    }
+    for (int iCount = 0; iCount < nCounts; ++iCount)
+      counts[iRegion * nCounts + iCount] = localCounts[i * nCounts + iCount];
+  }
+  std::vector<passivedouble> minTime(nRegion), maxTime(nRegion), sumTime(nRegion), sumCalls(nRegion);
+  MPIWrapper::Allreduce(time.data(), minTime.data(), nRegion, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+  MPIWrapper::Allreduce(time.data(), maxTime.data(), nRegion, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  MPIWrapper::Allreduce(time.data(), sumTime.data(), nRegion, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  MPIWrapper::Allreduce(calls.data(), sumCalls.data(), nRegion, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  MPIWrapper::Allreduce(imbalance.data(), maxImbalance.data(), nRegion, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  MPIWrapper::Allreduce(work.data(), sumWork.data(), 2 * nRegion, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  /*--- The counts are only meaningful if all threads of all ranks could open the counters. ---*/
+  int localAvailable = useCounters, available = 0;
+  for (const auto& data : threads) localAvailable &= (data.countersState != -1);
+  MPIWrapper::Allreduce(&localAvailable, &available, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  if (useCounters && !available && !countersWarned) {
+    countersWarned = true;
+    std::string reason;
+    for (const auto& data : threads) {
+      if (reason.empty()) reason = data.countersError;
+    }
+    if (SU2_MPI::GetRank() == MASTER_NODE) {
+      std::cout << "WARNING: Hardware counters are not available on all threads and ranks"
+                << (reason.empty() ? std::string() : ", " + reason) << "." << std::endl;
+    }
+  }
+
+  std::vector<passivedouble> sumCounts(counts.size(), 0.0);
+  if (available) {
+    MPIWrapper::Allreduce(counts.data(), sumCounts.data(), counts.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  }
+
+  passivedouble localTotal = std::chrono::duration<double>(Clock::now() - startTime).count();
+  passivedouble total = 0.0;
+  MPIWrapper::Allreduce(&localTotal, &total, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  totalTime = total;
+
+  std::vector<RegionStats> stats(nRegion);
+  for (auto i = 0ul; i < nRegion; ++i) {
+    const auto iRegion = order[i];
+    stats[i].path = paths[iRegion];
+    stats[i].depth = keys[iRegion].size() - 1;
+    stats[i].calls = static_cast<unsigned long>(sumCalls[iRegion] / size + 0.5);
+    stats[i].minTime = minTime[iRegion];
+    stats[i].avgTime = sumTime[iRegion] / size;
+    stats[i].maxTime = maxTime[iRegion];
+    stats[i].imbalance = maxImbalance[iRegion];
+    stats[i].bytes = sumWork[2 * iRegion];
+    stats[i].flops = sumWork[2 * iRegion + 1];
+    if (available) {
+      stats[i].counts.assign(sumCounts.begin() + iRegion * nCounts, sumCounts.begin() + (iRegion + 1) * nCounts);
+    }
+  }
+  return stats;
+}
+
+void CProfiler::MeasureMachine() {
+  const int nThread = omp_get_max_threads();
+
+  /*--- STREAM triad, the best of several repetitions is kept. The arrays are initialized by the threads that
+   *    use them (first touch) and the ranks are synchronized to measure the bandwidth available to each when the
+   *    node is fully loaded. As in the STREAM rules, each array is at least 4 times the last level cache, which
+   *    is shared by the ranks running on the CPUs that share it (assuming one CPU per thread), and not smaller
+   *    than 32 MB. ---*/
+
+  const auto llc = LastLevelCache();
+  const double llcPerRank = static_cast<double>(llc.first) * std::min(1.0, static_cast<double>(nThread) / llc.second);
+  const unsigned long N = std::max(1ul << 22, static_cast<unsigned long>(4 * llcPerRank / sizeof(double)));
+  constexpr int nRep = 10;
+  std::unique_ptr<double[]> a(new double[N]), b(new double[N]), c(new double[N]);
+  const double scalar = 3.0;
+  double bestTriad = 1e300;
+
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_STAT(N / nThread + 1)
+    for (auto i = 0ul; i < N; ++i) {
+      a[i] = 1.0;
+      b[i] = 2.0;
+      c[i] = 0.0;
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  for (int iRep = 0; iRep < nRep; ++iRep) {
+    SU2_MPI::Barrier(SU2_MPI::GetComm());
+    const double start = Time();
+    SU2_OMP_PARALLEL {
+      SU2_OMP_FOR_STAT(N / nThread + 1)
+      for (auto i = 0ul; i < N; ++i) c[i] = a[i] + scalar * b[i];
+      END_SU2_OMP_FOR
+    }
+    END_SU2_OMP_PARALLEL
+    bestTriad = std::min(bestTriad, Time() - start);
+  }
+  benchmarkSink = c[N / 2];
+
+  /*--- Multiply-add on independent elements of a small array (in L1 cache) of each thread, which the
+   *    compiler can vectorize, with enough independent chains to hide the latency of the operations. ---*/
+
+  constexpr int M = 64;
+  constexpr unsigned long nLoop = 1ul << 18;
+  double bestCompute = 1e300;
+
+  for (int iRep = 0; iRep < nRep / 2; ++iRep) {
+    SU2_MPI::Barrier(SU2_MPI::GetComm());
+    const double start = Time();
+    SU2_OMP_PARALLEL {
+      double x[M];
+      for (int j = 0; j < M; ++j) x[j] = j;
+      for (auto iLoop = 0ul; iLoop < nLoop; ++iLoop)
+        for (int j = 0; j < M; ++j) x[j] = x[j] * 0.999999 + 1e-6;
+      double sum = 0.0;
+      for (int j = 0; j < M; ++j) sum += x[j];
+      SU2_OMP_MASTER
+      benchmarkSink = sum;
+      END_SU2_OMP_MASTER
+    }
+    END_SU2_OMP_PARALLEL
+    bestCompute = std::min(bestCompute, Time() - start);
+  }
+
+  passivedouble local[] = {3.0 * N * sizeof(double) / bestTriad, 2.0 * M * nLoop * nThread / bestCompute};
+  passivedouble total[2] = {0.0, 0.0};
+  MPIWrapper::Allreduce(local, total, 2, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  streamBandwidth = total[0];
+  peakFlops = total[1];
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    std::cout << "Machine limits for the roofline analysis (sum over ranks): STREAM triad " << std::setprecision(4)
+              << streamBandwidth * 1e-9 << " GB/s (arrays of " << N * sizeof(double) / (1 << 20) << " MB), attainable "
+              << peakFlops * 1e-9 << " GFLOP/s." << std::endl;
+  }
+}
+
+void CProfiler::Print() {
+  double totalTime = 0.0;
+  const auto stats = Reduce(totalTime);
+  if (SU2_MPI::GetRank() != MASTER_NODE || stats.empty()) return;
+
+  std::cout << "\n------------------------------ Profiling -------------------------------" << std::endl;
+  std::cout << "Times are the slowest thread of each rank, min/avg/max over ranks." << std::endl;
+  std::cout << "Imbalance is the slowest over the average thread minus one, max over ranks." << std::endl;
+
+  PrintingToolbox::CTablePrinter table(&std::cout);
+  table.AddColumn("Region", 32);
+  table.AddColumn("Calls", 9);
+  table.AddColumn("Min [s]", 10);
+  table.AddColumn("Avg [s]", 10);
+  table.AddColumn("Max [s]", 10);
+  table.AddColumn("Total [%]", 9);
+  table.AddColumn("Imb [%]", 7);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.PrintHeader();
+
+  for (const auto& region : stats) {
+    const auto name = std::string(2 * region.depth, ' ') + region.path.substr(region.path.rfind('/') + 1);
+    std::ostringstream minTime, avgTime, maxTime, percent, imbalance;
+    minTime << std::setprecision(4) << region.minTime;
+    avgTime << std::setprecision(4) << region.avgTime;
+    maxTime << std::setprecision(4) << region.maxTime;
+    percent << std::fixed << std::setprecision(1) << 100 * region.avgTime / std::max(totalTime, 1e-300);
+    imbalance << std::fixed << std::setprecision(1) << 100 * region.imbalance;
+    table << name << region.calls << minTime.str() << avgTime.str() << maxTime.str() << percent.str()
+          << imbalance.str();
+  }
+  table.PrintFooter();
+  std::cout << "Total wall time: " << totalTime << " s." << std::endl;
+
+  if (streamBandwidth > 0 && peakFlops > 0) PrintRoofline(stats, streamBandwidth, peakFlops);
+
+  if (stats[0].counts.empty()) return;
+
+  /*--- Hardware counters, the derived metrics use the generic events (always the first 4). ---*/
+
+  const auto names = GetCounterNames();
+  std::cout << "\nHardware counters, sum over threads and ranks." << std::endl;
+
+  PrintingToolbox::CTablePrinter counters(&std::cout);
+  counters.AddColumn("Region", 32);
+  counters.AddColumn("IPC", 7);
+  counters.AddColumn("LLC Miss [%]", 12);
+  for (auto iCount = 0ul; iCount < names.size(); ++iCount) counters.AddColumn(names[iCount], 16);
+  counters.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  counters.PrintHeader();
+
+  for (const auto& region : stats) {
+    const auto name = std::string(2 * region.depth, ' ') + region.path.substr(region.path.rfind('/') + 1);
+    std::ostringstream ipc, miss;
+    ipc << std::fixed << std::setprecision(2) << region.counts[1] / std::max(region.counts[0], 1.0);
+    miss << std::fixed << std::setprecision(1) << 100 * region.counts[3] / std::max(region.counts[2], 1.0);
+    counters << name << ipc.str() << miss.str();
+    for (const auto count : region.counts) {
+      std::ostringstream value;
+      value << std::setprecision(4) << count;
+      counters << value.str();
+    }
+  }
+  counters.PrintFooter();
+}
+
+void CProfiler::Write(const std::string& fileName, PROFILING_FORMAT format, const std::string& label) {
+  double totalTime = 0.0;
+  const auto stats = Reduce(totalTime);
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  std::ofstream file;
+  file.precision(8);
+
+  if (format == PROFILING_FORMAT::CSV) {
+    const auto name = fileName + ".csv";
+    const bool first = csvFilesWritten.insert(name).second;
+    file.open(name, first ? std::ios::out : std::ios::app);
+    /*--- The counter columns are present whenever counters are requested, empty if they are not available. ---*/
+    const auto names = useCounters ? GetCounterNames() : std::vector<std::string>();
+    if (first) {
+      file << "\"Label\",\"Region\",\"Depth\",\"Calls\",\"Min_Time\",\"Avg_Time\",\"Max_Time\",\"Total_Time\","
+           << "\"Thread_Imbalance\"";
+      for (const auto& counter : names) file << ",\"" << counter << "\"";
+      file << "\n";
+    }
+    for (const auto& region : stats) {
+      file << "\"" << label << "\",\"" << region.path << "\"," << region.depth << "," << region.calls << ","
+           << region.minTime << "," << region.avgTime << "," << region.maxTime << "," << totalTime << ","
+           << region.imbalance;
+      for (auto iCount = 0ul; iCount < names.size(); ++iCount) {
+        file << ",";
+        if (!region.counts.empty()) file << region.counts[iCount];
+      }
+      file << "\n";
+    }
+  } else {
+    file.open(fileName + ".json");
+    file << "{\n  \"label\": \"" << label << "\",\n  \"total_time\": " << totalTime << ",\n  \"regions\": [";
+    const auto names = GetCounterNames();
+    for (auto i = 0ul; i < stats.size(); ++i) {
+      const auto& region = stats[i];
+      file << (i ? ",\n" : "\n") << "    {\"path\": \"" << region.path << "\", \"depth\": " << region.depth
+           << ", \"calls\": " << region.calls << ", \"min_time\": " << region.minTime
+           << ", \"avg_time\": " << region.avgTime << ", \"max_time\": " << region.maxTime
+           << ", \"thread_imbalance\": " << region.imbalance;
+      if (!region.counts.empty()) {
+        file << ", \"counters\": {";
+        for (auto iCount = 0ul; iCount < names.size(); ++iCount)
+          file << (iCount ? ", \"" : "\"") << names[iCount] << "\": " << region.counts[iCount];
+        file << "}";
+      }
+      file << "}";
+    }
+    file << "\n  ]\n}\n";
+  }
+}
@@ -126,4 +126,21 @@ public:
    * \brief Postprocess the adjoint iteration for ZONE_0.
    */
   void Postprocess(void) override;
+
+  /*!
+   * \brief Solve the primal problem in-process, without recording, starting from the solution currently in memory.
+   * \note This allows one instance of the driver to be used for a complete design loop (e.g. through the
+   *       Python wrapper): impose new boundary displacements, deform the mesh and solve the primal problem
+   *       (RunPrimal), then record and solve the adjoint (Preprocess, Run) and compute the sensitivities
+   *       w.r.t. the boundary displacements (Postprocess). The solutions of the previous design are the
+   *       initial conditions of both problems.
+   * \param[in] nIter - Maximum number of primal iterations.
+   * \return True if the primal problem converged (CONV_RESIDUAL_MINVAL) before reaching nIter.
+   */
+  bool RunPrimal(unsigned long nIter);
+
+  /*!
+   * \brief Get the value of the objective function of the last recording.
+   */
+  inline passivedouble GetObjectiveFunction() const { return SU2_TYPE::GetValue(ObjFunc); }
 };
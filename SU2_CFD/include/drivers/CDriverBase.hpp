@@ -425,6 +425,14 @@ class CDriverBase {
    */
   void CommunicateMeshDisplacements(void);
 
+  /*!
+   * \brief Deform the volume mesh to follow the boundary displacements currently imposed (e.g. with
+   *        SetMarkerCustomDisplacement), without writing any files.
+   * \note Drivers that support this keep the deformation operator between calls, only the boundary
+   *       conditions change from one design iteration to the next.
+   */
+  virtual void DeformMesh() { SU2_MPI::Error("Mesh deformation is not supported by this driver.", CURRENT_FUNCTION); }
+
   /*!
    * \brief Get all the active solver names with their associated indices (which can be used to access their data).
    */
@@ -527,6 +535,18 @@ class CDriverBase {
     return CPyWrapperMatrixView(sensitivity, "Sensitivity", true);
   }
 
+  /*!
+   * \brief Get a read-only view of the residual of a solver on all mesh nodes (nodes x variables).
+   * \note This is the right-hand side of the last linear system (implicit solvers) or the residual of the last
+   *       stage (explicit solvers), the column indices are the same as in Solution().
+   */
+  inline CPyWrapperMatrixView Residual(unsigned short iSolver) {
+    auto* solver = GetSolverAndCheckMarker(iSolver);
+    auto& res = solver->LinSysRes;
+    return CPyWrapperMatrixView(res.GetLocSize() ? &res[0] : nullptr, res.GetNBlk(), res.GetNVar(),
+                                "Residual of " + solver->GetSolverName(), true);
+  }
+
   /*!
    * \brief Set the temperature of a vertex on a specified marker (MARKER_PYTHON_CUSTOM).
    * \note This can be the input of a heat or flow solver in a CHT setting.
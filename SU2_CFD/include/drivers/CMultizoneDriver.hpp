@@ -67,6 +67,13 @@ protected:
    */
   void Corrector(unsigned short val_iZone);
 
+  /*!
+   * \brief Discard the history of the interface quasi-Newton (IQN_ILS) acceleration and enable or disable it.
+   * \note It is enabled for the coupling iterations of each time step, and disabled for the transfers of Update.
+   * \param[in] active - Whether the transfers are accelerated.
+   */
+  void ResetQuasiNewtonAcceleration(bool active);
+
   /*!
    * \brief Run a Block Gauss-Seidel iteration in all physical zones.
    */
@@ -47,6 +47,12 @@ protected:
      */
   virtual bool GetTimeConvergence() const;
 
+  /*!
+   * \brief Solve the steady problem for each angle of attack of SWEEP_AOA, reusing the geometry, the preprocessing
+   *        and the solvers. Each condition starts from the converged solution of the nearest angle solved so far.
+   */
+  void RunSweep_AoA();
+
 public:
 
   /*!
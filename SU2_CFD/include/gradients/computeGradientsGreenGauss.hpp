@@ -28,6 +28,8 @@
  */
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
+#include "../../../Common/include/toolboxes/graph_toolbox.hpp"
 
 namespace detail {
 
@@ -50,6 +52,7 @@ namespace detail {
  * \param[in] varBegin - Index of first variable for which to compute the gradient.
  * \param[in] varEnd - Index of last variable for which to compute the gradient.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[in] pointList - Optional, sorted list of the (non-halo) points where the gradient is needed.
  */
 template<size_t nDim, class FieldType, class GradientType>
 void computeGradientsGreenGauss(CSolver* solver,
@@ -60,21 +63,23 @@ void computeGradientsGreenGauss(CSolver* solver,
                                 const FieldType& field,
                                 size_t varBegin,
                                 size_t varEnd,
-                                GradientType& gradient)
+                                GradientType& gradient,
+                                const std::vector<unsigned long>* pointList)
 {
-  const size_t nPointDomain = geometry.GetnPointDomain();
+  const IndexSubset<> points(pointList, geometry.GetnPointDomain());
 
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
-  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+  const auto chunkSize = computeStaticChunkSize(points.size, omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
   /*--- For each (non-halo) volume integrate over its faces (edges). ---*/
 
   SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  for (size_t k = 0; k < points.size; ++k)
   {
+    const size_t iPoint = points[k];
     auto nodes = geometry.nodes;
 
     /*--- Cannot preaccumulate if hybrid parallel due to shared reading. ---*/
@@ -148,9 +153,9 @@ void computeGradientsGreenGauss(CSolver* solver,
         size_t iPoint = geometry.vertex[iMarker][iVertex]->GetNode();
         auto nodes = geometry.nodes;
 
-        /*--- Halo points do not need to be considered. ---*/
+        /*--- Halo points (and points not in the list) do not need to be considered. ---*/
 
-        if (!nodes->GetDomain(iPoint)) continue;
+        if (!nodes->GetDomain(iPoint) || !points.contains(iPoint)) continue;
 
         su2double volume = nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint);
 
@@ -201,15 +206,30 @@ void computeGradientsGreenGauss(CSolver* solver,
                                 const FieldType& field,
                                 size_t varBegin,
                                 size_t varEnd,
-                                GradientType& gradient) {
+                                GradientType& gradient,
+                                const std::vector<unsigned long>* pointList = nullptr) {
+  SU2_PROFILE_REGION("Gradients");
+
+  /*--- Work model, each point reads its volume and values and writes the gradient, each neighbor
+   *    (about two per edge) reads the values of the neighbor, the normal, and the edge/point indices. ---*/
+  if (CProfiler::IsEnabled()) {
+    const double nVar = varEnd - varBegin, nDim = geometry.GetnDim();
+    const double nPoint = pointList ? pointList->size() : geometry.GetnPointDomain();
+    const double nNeigh = 2.0 * geometry.GetnEdge() * nPoint / std::max<unsigned long>(geometry.GetnPointDomain(), 1);
+    const double real = sizeof(su2double), index = sizeof(unsigned long);
+    CProfiler::AddWork(nPoint * (2 * real + nVar * (1 + nDim) * real + index) +
+                           nNeigh * (2 * index + (nDim + nVar) * real),
+                       nPoint * 2 + nNeigh * (1 + nVar * (2 + 2 * nDim)));
+  }
+
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry,
-                                          config, field, varBegin, varEnd, gradient);
+                                          config, field, varBegin, varEnd, gradient, pointList);
     break;
   case 3:
     detail::computeGradientsGreenGauss<3>(solver, kindMpiComm, kindPeriodicComm, geometry,
-                                          config, field, varBegin, varEnd, gradient);
+                                          config, field, varBegin, varEnd, gradient, pointList);
     break;
   default:
     SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
@@ -28,6 +28,8 @@
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
+#include "../../../Common/include/toolboxes/graph_toolbox.hpp"
 
 namespace detail {
 
@@ -177,6 +179,7 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
  * \param[in] varEnd - Index of last variable for which to compute the gradient.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
  * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \param[in] pointList - Optional, sorted list of the (non-halo) points where the gradient is needed.
  */
 template<size_t nDim, class FieldType, class GradientType, class RMatrixType>
 void computeGradientsLeastSquares(CSolver* solver,
@@ -189,24 +192,26 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varBegin,
                                   size_t varEnd,
                                   GradientType& gradient,
-                                  RMatrixType& Rmatrix)
+                                  RMatrixType& Rmatrix,
+                                  const std::vector<unsigned long>* pointList)
 {
   const bool periodic = (solver != nullptr) && (config.GetnMarker_Periodic() > 0);
 
-  const size_t nPointDomain = geometry.GetnPointDomain();
+  const IndexSubset<> points(pointList, geometry.GetnPointDomain());
 
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
-  size_t chunkSize = computeStaticChunkSize(nPointDomain,
+  size_t chunkSize = computeStaticChunkSize(points.size,
                      omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
   /*--- First loop over non-halo points of the grid. ---*/
 
   SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  for (size_t k = 0; k < points.size; ++k)
   {
+    const size_t iPoint = points[k];
     auto nodes = geometry.nodes;
     const auto coord_i = nodes->GetCoord(iPoint);
 
@@ -307,8 +312,8 @@ void computeGradientsLeastSquares(CSolver* solver,
     /*--- Second loop over points of the grid to compute final gradient. ---*/
 
     SU2_OMP_FOR_DYN(chunkSize)
-    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
-      solveLeastSquares<nDim, true>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+    for (size_t k = 0; k < points.size; ++k)
+      solveLeastSquares<nDim, true>(points[k], varBegin, varEnd, Rmatrix, gradient);
     END_SU2_OMP_FOR
   }
 
@@ -340,15 +345,31 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varBegin,
                                   size_t varEnd,
                                   GradientType& gradient,
-                                  RMatrixType& Rmatrix) {
+                                  RMatrixType& Rmatrix,
+                                  const std::vector<unsigned long>* pointList = nullptr) {
+  SU2_PROFILE_REGION("Gradients");
+
+  /*--- Work model, each neighbor (about two per edge) reads its coordinates and values and updates the
+   *    R matrix and right-hand sides, each point factorizes R and multiplies the right-hand sides. ---*/
+  if (CProfiler::IsEnabled()) {
+    const double nVar = varEnd - varBegin, nDim = geometry.GetnDim();
+    const double nPoint = pointList ? pointList->size() : geometry.GetnPointDomain();
+    const double nNeigh = 2.0 * geometry.GetnEdge() * nPoint / std::max<unsigned long>(geometry.GetnPointDomain(), 1);
+    const double real = sizeof(su2double), index = sizeof(unsigned long);
+    CProfiler::AddWork(nPoint * ((nDim + nVar + nVar * nDim + nDim * nDim) * real + index) +
+                           nNeigh * (index + (nDim + nVar) * real),
+                       nNeigh * (nDim + weighted * (2 * nDim + 1) + nDim * (nDim + 1) + nVar * (1 + 2 * nDim)) +
+                           nPoint * (2 * nVar * nDim * nDim + 30));
+  }
+
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, gradient, Rmatrix);
+                                            weighted, field, varBegin, varEnd, gradient, Rmatrix, pointList);
     break;
   case 3:
     detail::computeGradientsLeastSquares<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
-                                            weighted, field, varBegin, varEnd, gradient, Rmatrix);
+                                            weighted, field, varBegin, varEnd, gradient, Rmatrix, pointList);
     break;
   default:
     SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
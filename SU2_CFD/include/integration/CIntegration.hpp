@@ -34,6 +34,7 @@
 #include "../solvers/CSolver.hpp"
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 using namespace std;
 
@@ -49,6 +50,17 @@ protected:
   int rank,      /*!< \brief MPI Rank. */
   size;          /*!< \brief MPI Size. */
 
+  /*!
+   * \brief Preprocessing of a solver (primitives, gradients, limiters, etc.) as a region of the profiler.
+   * \param[in] solver - Solver to preprocess, the other arguments are those of CSolver::Preprocessing.
+   */
+  static inline void SolverPreprocessing(CSolver *solver, CGeometry *geometry, CSolver **solver_container,
+                                         CConfig *config, unsigned short iMesh, unsigned short iRKStep,
+                                         unsigned short RunTime_EqSystem, bool Output) {
+    SU2_PROFILE_REGION("Preprocessing");
+    solver->Preprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, Output);
+  }
+
   /*!
    * \brief Do the space integration of the numerical system.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
 
 #include <cmath>
 #include <string>
@@ -36,6 +37,7 @@
 #include <sstream>
 #include <algorithm>
 #include <iostream>
+#include <map>
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -71,6 +73,13 @@ protected:
   unsigned short nSpanMaxAllZones = 0;
 
   unsigned short nVar = 0;
+
+  /*--- Interface quasi-Newton (IQN-ILS) acceleration of the donor data, one per interface marker and donor
+   * solver, since e.g. flow, turbulence, and species data are transferred through the same interface. ---*/
+  unsigned short nQuasiNewtonSamples = 0;
+  bool quasiNewtonActive = false;
+  map<pair<unsigned short, const CSolver*>, CQuasiNewtonInvLeastSquares<passivedouble> > InterfaceCorrector;
+
   static constexpr size_t MAXNDIM = 3;  /*!< \brief Max number of space dimensions, used in some static arrays. */
 
 public:
@@ -106,7 +115,35 @@ public:
                      CGeometry *donor_geometry, CGeometry *target_geometry,
                      const CConfig *donor_config, const CConfig *target_config);
 
+  /*!
+   * \brief Enable the interface quasi-Newton (IQN-ILS) acceleration of the data sent by the donor zone.
+   * \note The fixed point is defined by the donor values on the interface, each call to BroadcastData
+   *       is considered one evaluation of the fixed point (i.e. one block Gauss-Seidel iteration).
+   * \param[in] nSamples - Number of past iterates used to approximate the inverse Jacobian.
+   */
+  void SetQuasiNewtonAcceleration(unsigned short nSamples);
+
+  /*!
+   * \brief Discard the quasi-Newton history (e.g. at the start of a time step).
+   */
+  void ResetQuasiNewtonAcceleration();
+
+  /*!
+   * \brief Apply the quasi-Newton acceleration in BroadcastData or not, it should only be active during the
+   *        coupling iterations, transfers of converged data (e.g. before writing restarts) are not accelerated.
+   * \param[in] active - Whether to accelerate.
+   */
+  inline void SetQuasiNewtonActive(bool active) { quasiNewtonActive = active; }
+
 protected:
+  /*!
+   * \brief Apply the quasi-Newton correction to the donor values of an interface marker.
+   * \param[in] iMarkerInt - Index of the interface marker.
+   * \param[in] donor_solution - Solver from which the values are transferred, identifies the transfer.
+   * \param[in,out] donorVar - Donor values on this rank, replaced by the accelerated values.
+   */
+  void AccelerateDonorData(unsigned short iMarkerInt, const CSolver* donor_solution, su2activematrix& donorVar);
+
   /*!
    * \brief A virtual member.
    */
@@ -25,8 +25,10 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "../../../Common/include/toolboxes/graph_toolbox.hpp"
 #include "CLimiterDetails.hpp"
 #include "computeLimiters_impl.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 /*!
  * \brief A wrapper funtion that calls specialized implementations depending
@@ -49,18 +51,21 @@ void computeLimiters(LIMITER LimiterKind,
                      const GradientType& gradient,
                      FieldType& fieldMin,
                      FieldType& fieldMax,
-                     FieldType& limiter)
+                     FieldType& limiter,
+                     const std::vector<unsigned long>* pointList = nullptr)
 {
+  SU2_PROFILE_REGION("Limiters");
+
   if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
     SU2_MPI::Error("Too many dimensions to compute limiters.", CURRENT_FUNCTION);
 
 #define INSTANTIATE(KIND)\
 if (geometry.GetnDim() == 2) {\
   computeLimiters_impl<2,KIND>(solver, kindMpiComm, kindPeriodicComm1, kindPeriodicComm2, geometry,\
-                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter);\
+                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter, pointList);\
 } else {\
   computeLimiters_impl<3,KIND>(solver, kindMpiComm, kindPeriodicComm1, kindPeriodicComm2, geometry,\
-                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter);\
+                               config, varBegin, varEnd, field, gradient, fieldMin, fieldMax, limiter, pointList);\
 }
   switch (LimiterKind) {
     case LIMITER::NONE:
@@ -54,6 +54,7 @@
  * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
  * \param[out] fieldMax - As above but maximum values.
  * \param[out] limiter - Reconstruction limiter for the field.
+ * \param[in] pointList - Optional, sorted list of the (non-halo) points where the limiter is needed.
  *
  * Template parameters:
  * \param nDim - Number of dimensions.
@@ -74,15 +75,16 @@ void computeLimiters_impl(CSolver* solver,
                           const GradientType& gradient,
                           FieldType& fieldMin,
                           FieldType& fieldMax,
-                          FieldType& limiter)
+                          FieldType& limiter,
+                          const std::vector<unsigned long>* pointList)
 {
   constexpr size_t MAXNVAR = 32;
 
   if (varEnd > MAXNVAR)
     SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
 
-  const size_t nPointDomain = geometry.GetnPointDomain();
   const size_t nPoint = geometry.GetnPoint();
+  const IndexSubset<> points(pointList, geometry.GetnPointDomain());
 
   /*--- If we do not have periodicity we can use a
    *    more efficient access pattern to memory. ---*/
@@ -94,7 +96,7 @@ void computeLimiters_impl(CSolver* solver,
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
-  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+  const auto chunkSize = computeStaticChunkSize(points.size, omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
   /*--- If limiters are frozen do not record the computation ---*/
@@ -128,8 +130,9 @@ void computeLimiters_impl(CSolver* solver,
   /*--- Compute limiter for each point. ---*/
 
   SU2_OMP_FOR_DYN(chunkSize)
-  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  for (size_t k = 0; k < points.size; ++k)
   {
+    const size_t iPoint = points[k];
     auto nodes = geometry.nodes;
     const auto coord_i = nodes->GetCoord(iPoint);
 
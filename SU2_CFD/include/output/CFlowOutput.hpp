@@ -37,6 +37,7 @@ struct CPrimitiveIndices;
 class CFlowOutput : public CFVMOutput{
 protected:
   unsigned long lastInnerIter;
+  unsigned long nSnapshot = 0;   /*!< \brief Number of snapshots written (SAVE_LIBROM). */
 
   /*!
    * \brief Constructor of the class
@@ -110,6 +111,16 @@ protected:
    */
   void LoadHistoryDataScalar(const CConfig* config, const CSolver* const* solver);
 
+  /*!
+   * \brief Add the history fields of the cost-aware CFL adaption (FVMComp, FVMInc, FVMNEMO).
+   */
+  void AddHistoryOutputFieldsCostControl(const CConfig* config);
+
+  /*!
+   * \brief Set the history fields of the cost-aware CFL adaption.
+   */
+  void LoadHistoryDataCostControl(const CConfig* config, const CSolver* flow_solver);
+
   /*!
    * \brief Add scalar (turbulence/species) volume solution fields for a point (FVMComp, FVMInc, FVMNEMO).
    * \note The order of fields in restart files is fixed. Therefore the split-up.
@@ -314,6 +325,14 @@ protected:
    */
   void WriteAdditionalFiles(CConfig *config, CGeometry *geometry, CSolver **solver_container) override;
 
+  /*!
+   * \brief Write the final solution as a snapshot for reduced-order models (SU2 binary restart format).
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - The container holding all solution data.
+   */
+  void WriteSnapshotFiles(CConfig *config, CGeometry *geometry, CSolver **solver_container) override;
+
   /*!
    * \brief Determines if the the volume output should be written.
    * \param[in] config - Definition of the particular problem.
@@ -93,6 +93,9 @@ protected:
 
   bool cauchyTimeConverged; /*! \brief: Flag indicating that solver is already converged. Needed for writing restart files. */
 
+  vector<passivedouble> perfTotals; /*!< \brief Cumulative profiler totals at the previous history evaluation. */
+  unsigned long lastProfilingIter = std::numeric_limits<unsigned long>::max(); /*!< \brief Last profiled iteration. */
+
   /** \brief Enum to identify the screen output format. */
   enum class ScreenOutputFormat {
     INTEGER,         /*!< \brief Integer format. Example: 34 */
@@ -825,6 +828,14 @@ protected:
    */
   void LoadCommonHistoryData(const CConfig *config);
 
+  /*!
+   * \brief Load the performance history fields (PERF_TIME and PERF_RATE groups) from the runtime profiler.
+   * \note The values are the increments since the previous evaluation, times are the maximum over ranks
+   * and rates the minimum, such that slow ranks can be detected.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void LoadPerformanceHistoryData(const CConfig *config);
+
   /*!
    * \brief Allocates the data sorters if necessary.
    * \param[in] config - Definition of the particular problem.
@@ -960,6 +971,21 @@ protected:
    */
   inline virtual void WriteAdditionalFiles(CConfig *config, CGeometry* geometry, CSolver** solver_container){}
 
+  /*!
+   * \brief Write snapshots of the final solution (e.g. for reduced-order models), called once per solve.
+   * \param[in] config - Definition of the particular problem per zone.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - The container holding all solution data.
+   */
+  inline virtual void WriteSnapshotFiles(CConfig *config, CGeometry* geometry, CSolver** solver_container){}
+
+  /*!
+   * \brief Write the statistics of the runtime profiler to file every PROFILING_FREQ iterations.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Iter - Current (time, outer, or inner) iteration.
+   */
+  void WriteProfilingFile(const CConfig *config, unsigned long Iter);
+
   /*!
    * \brief Write any additional output defined for the current solver.
    * \param[in] config - Definition of the particular problem per zone.
@@ -105,6 +105,7 @@ protected:
   passivedouble *connSend;             //!< Send buffer holding the data that will be send to other processors
   passivedouble *dataBuffer;           //!< Buffer holding the sorted, partitioned data as passivedouble types
   unsigned long *idSend;               //!< Send buffer holding global indices that will be send to other processors
+  long long bufferBytes = 0;           //!< Size of the buffers above, accounted in the memory report
   int nSends,                          //!< Number of sends
   nRecvs;                              //!< Number of receives
 
@@ -39,6 +39,10 @@
 class CDiscAdjFEASolver final : public CSolver {
 private:
   static constexpr size_t MAXNVAR = 9;  /*!< \brief Max number of variables, for static arrays. */
+  static constexpr size_t OMP_MAX_SIZE = 1024; /*!< \brief Max chunk size for light point loops. */
+
+  unsigned long omp_chunk_size = 0; /*!< \brief Chunk size used in light point loops. */
+
   unsigned short KindDirect_Solver = 0;
   CSolver *direct_solver = nullptr;
 
@@ -328,4 +332,9 @@ public:
                    int val_iter,
                    bool val_update_geo) override;
 
+  /*!
+   * \brief The registration and extraction routines are hybrid-parallel.
+   */
+  inline bool GetHasHybridParallel() const override { return true; }
+
 };
@@ -28,6 +28,10 @@
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CLoopTuner.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
+#include "../../../Common/include/toolboxes/CPODBasis.hpp"
+#include "../../../Common/include/toolboxes/CSymmetricMatrix.hpp"
 #include "CSolver.hpp"
 
 class CNumericsSIMD;
@@ -198,6 +202,13 @@ class CFVMFlowSolverBase : public CSolver {
 #ifdef HAVE_OMP
   vector<GridColor<> > EdgeColoring; /*!< \brief Edge colors. */
   bool ReducerStrategy = false;      /*!< \brief If the reducer strategy is in use. */
+
+  /*--- Coloring with a group size tuned for this solver (EDGE_COLORING_AUTOTUNE), used instead of the
+   *    coloring of the geometry (which other solvers share) when the tuned group size is different. ---*/
+  CCompressedSparsePatternUL TunedEdgeColoring; /*!< \brief Coloring with the group size being tried or tuned. */
+  const CCompressedSparsePatternUL* GeometryEdgeColoring = nullptr; /*!< \brief Coloring of the geometry. */
+  CLoopTuner EdgeColoringTuner;                 /*!< \brief Tuner of the edge coloring group size. */
+  passivedouble EdgeLoopStartTime = 0.0;        /*!< \brief Start time of the edge loop being timed. */
 #else
   array<DummyGridColor<>, 1> EdgeColoring;
   /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
@@ -214,6 +225,26 @@ class CFVMFlowSolverBase : public CSolver {
 
   CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for edge flux computation. */
 
+  /*--- Reduced-order model (REDUCED_ORDER_MODEL), the solution is u = u_ref + Phi q. ---*/
+
+  CPODBasis ROMBasis;                     /*!< \brief POD basis (u_ref and Phi). */
+  CSysVector<su2mixedfloat> ROMModes;     /*!< \brief Modes with halos, nVar x nModes per point, to apply the Jacobian. */
+  CSysVector<su2mixedfloat> ROMTestBasis; /*!< \brief Test basis of the LSPG projection, (V/dt + J) Phi. */
+  vector<passivedouble> ROMCoords;        /*!< \brief Reduced coordinates (q) of the solution. */
+  su2passivematrix ROMNormalEqs;          /*!< \brief Normal equations of the least-squares problem and its rhs. */
+  passivedouble ROMRelaxation = 1.0;      /*!< \brief Relaxation of the reduced update. */
+
+  /*--- Hyper-reduction (ROM_SAMPLE_POINTS), the residual is only evaluated at sample points, which requires the
+   *    gradients (and limiters) on the sample points and their neighbors, and the solution on the next layer. ---*/
+  bool ROMHyperReduction = false;           /*!< \brief If the loops are restricted to the sample points. */
+  vector<unsigned long> ROMSamplePoints;    /*!< \brief Sample points (non-halo). */
+  vector<unsigned long> ROMGradientPoints;  /*!< \brief Sample points, their neighbors, and wall points (non-halo). */
+  vector<unsigned long> ROMStatePoints;     /*!< \brief Points where the solution is needed (non-halo and halo). */
+  unsigned long ROMStateDomainPoints = 0;   /*!< \brief Number of non-halo points in ROMStatePoints (first ones). */
+  passivedouble ROMResidualScale = 1.0;     /*!< \brief Scale of the RMS residual, number of points / samples. */
+  CCompressedSparsePatternUL ROMEdges;      /*!< \brief Edges of the sample points, by color. */
+  vector<GridColor<> > ROMEdgeColoring;     /*!< \brief Colors of ROMEdges for the edge loops. */
+
   /*!
    * \brief The highest level in the variable hierarchy the DERIVED solver can safely use.
    */
@@ -257,6 +288,25 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void HybridParallelInitialization(const CConfig& config, CGeometry& geometry);
 
+  /*!
+   * \brief Set the colors of the edge loops from an edge coloring.
+   * \param[in] coloring - Edge coloring, the solver keeps pointers to its indices.
+   * \param[in] groupSize - Group size of the coloring.
+   */
+  void SetEdgeColoring(const CCompressedSparsePatternUL& coloring, unsigned long groupSize);
+
+  /*!
+   * \brief Start timing a loop over the edge colors if the group size is being tuned (all threads call this).
+   */
+  void EdgeLoopTuningStart();
+
+  /*!
+   * \brief Stop timing a loop over the edge colors, and switch to the next group size being tried or to
+   *        the fastest one (all threads call this, the threads are synchronized only while tuning).
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void EdgeLoopTuningStop(const CGeometry& geometry);
+
   /*!
    * \brief Move solution to previous time levels (for restarts).
    */
@@ -347,6 +397,70 @@ class CFVMFlowSolverBase : public CSolver {
    */
   virtual void ComputeUnderRelaxationFactor(const CConfig* config);
 
+  /*!
+   * \brief Read the snapshots (ROM_SNAPSHOT_FILES), build the POD basis, and project the current solution onto it.
+   * \note Not thread safe, must be called by the master thread.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InitializeReducedOrderModel(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Least-squares Petrov-Galerkin (LSPG) iteration, replaces the linear solve of the implicit iteration.
+   * \note The linearized residual of the pseudo-time iteration (the Jacobian including V/dt, and the residual)
+   * is minimized over the span of the POD modes, i.e. (W^T W) dq = -W^T R with W = (V/dt + J) Phi, which
+   * costs one multiplication of the Jacobian by all the modes and the solution of an nModes x nModes system.
+   * The update is relaxed uniformly (instead of point-wise) to keep the solution in the span of the basis.
+   * With hyper-reduction, only the rows of W and R of the sample points are used.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ReducedOrder_Iteration(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Select the sample points of the hyper-reduction (ROM_SAMPLE_POINTS) and build the point and edge sets
+   *        of the restricted loops. The points with the largest leverage (weighted sum of squares of the modes)
+   *        are selected with a global threshold, so that the selection does not depend on the partitioning.
+   * \note All threads must call this (after InitializeReducedOrderModel), the sets are communicated.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InitializeHyperReduction(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Sample points of the hyper-reduction, where the residual is needed, nullptr for all (non-halo) points.
+   */
+  inline const vector<unsigned long>* GetSamplePoints() const {
+    return ROMHyperReduction ? &ROMSamplePoints : nullptr;
+  }
+
+  /*!
+   * \brief Points where the gradients and limiters are needed, nullptr for all (non-halo) points.
+   */
+  inline const vector<unsigned long>* GetGradientPoints() const {
+    return ROMHyperReduction ? &ROMGradientPoints : nullptr;
+  }
+
+  /*!
+   * \brief Points where the primitive variables are needed, nullptr for all points.
+   */
+  inline const vector<unsigned long>* GetStatePoints() const {
+    return ROMHyperReduction ? &ROMStatePoints : nullptr;
+  }
+
+  /*!
+   * \brief Call an edge loop for each color, of all the edges or only of the edges of the sample points.
+   * \param[in] edgeLoop - Generic function object called with each color (GridColor-like).
+   */
+  template <class EdgeLoop>
+  FORCEINLINE void ForEachEdgeColor(const EdgeLoop& edgeLoop) const {
+    if (ROMHyperReduction) {
+      for (const auto& color : ROMEdgeColoring) edgeLoop(color);
+    } else {
+      for (const auto& color : EdgeColoring) edgeLoop(color);
+    }
+  }
+
   /*!
    * \brief General implementation to load a flow solution from a restart file.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -396,7 +510,7 @@ class CFVMFlowSolverBase : public CSolver {
 
     /*--- Loop domain points. ---*/
 
-    SU2_OMP_FOR_DYN(omp_chunk_size)
+    SU2_OMP_FOR_DYN_PROFILED("Point loops", omp_chunk_size)
     for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
 
       /*--- Set maximum eigenvalues to zero. ---*/
@@ -445,7 +559,7 @@ class CFVMFlowSolverBase : public CSolver {
       }
 
     }
-    END_SU2_OMP_FOR
+    END_SU2_OMP_FOR_PROFILED
 
     /*--- Loop boundary edges ---*/
 
@@ -912,11 +1026,15 @@ class CFVMFlowSolverBase : public CSolver {
     su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
     unsigned long idxMax[MAXNVAR] = {0};
 
+    /*--- All points, or the sample points of the hyper-reduced ROM. ---*/
+    const IndexSubset<> points(GetSamplePoints(), nPointDomain);
+
     /*--- Add pseudotime term to Jacobian. ---*/
 
     if (implicit) {
       SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
-      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (unsigned long k = 0; k < points.size; k++) {
+        const auto iPoint = points[k];
 
         /*--- Modify matrix diagonal to improve diagonal dominance. ---*/
 
@@ -941,7 +1059,8 @@ class CFVMFlowSolverBase : public CSolver {
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
     SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
-    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned long k = 0; k < points.size; k++) {
+      const auto iPoint = points[k];
 
       /*--- Multigrid contribution to residual. ---*/
 
@@ -965,6 +1084,11 @@ class CFVMFlowSolverBase : public CSolver {
     }
     END_SU2_OMP_FOR
 
+    /*--- The RMS of the sampled residual estimates the RMS over all points. ---*/
+    if (ROMHyperReduction) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) resRMS[iVar] *= ROMResidualScale;
+    }
+
     /*--- "Add" residuals from all threads to global residual variables. ---*/
     ResidualReductions_FromAllThreads(geometry, config, resRMS, resMax, idxMax);
 
@@ -1069,6 +1193,15 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) final;
 
+  /*!
+   * \brief Reconstruct the ROM solution on all points and update the primitives (and gradients if viscous),
+   *        the hyper-reduced iterations only update them near the sample points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ReconstructFullSolution(CGeometry *geometry, CSolver **solver_container, CConfig *config) final;
+
   /*!
    * \brief Set the total residual adding the term that comes from the Dual Time Strategy.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -280,6 +280,55 @@ void CFVMFlowSolverBase<V, R>::CommunicateInitialState(CGeometry* geometry, cons
   Avg_CFL_Local = CFL;
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetEdgeColoring(const CCompressedSparsePatternUL& coloring, unsigned long groupSize) {
+#ifdef HAVE_OMP
+  const auto nColor = coloring.getOuterSize();
+  EdgeColoring.clear();
+  EdgeColoring.reserve(nColor);
+
+  for (auto iColor = 0ul; iColor < nColor; ++iColor)
+    EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+#endif
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::EdgeLoopTuningStart() {
+#ifdef HAVE_OMP
+  if (!EdgeColoringTuner.IsTuning()) return;
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  EdgeLoopStartTime = omp_get_wtime();
+  END_SU2_OMP_MASTER
+#endif
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::EdgeLoopTuningStop(const CGeometry& geometry) {
+#ifdef HAVE_OMP
+  if (!EdgeColoringTuner.IsTuning()) return;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    if (EdgeColoringTuner.Record(omp_get_wtime() - EdgeLoopStartTime)) {
+      /*--- The colorings are computed again rather than keeping one for each candidate, to save memory. ---*/
+      const auto groupSize = EdgeColoringTuner.GetValue();
+      if (groupSize == geometry.GetEdgeColorGroupSize()) {
+        TunedEdgeColoring = CCompressedSparsePatternUL();
+        SetEdgeColoring(*GeometryEdgeColoring, groupSize);
+      } else {
+        TunedEdgeColoring = geometry.ColorEdges(groupSize);
+        SetEdgeColoring(TunedEdgeColoring, groupSize);
+      }
+    }
+    if (!EdgeColoringTuner.IsTuning() && (MGLevel == MESH_0) && (rank == MASTER_NODE)) {
+      cout << SolverName << ": edge coloring group size tuned to " << EdgeColoringTuner.GetValue()
+           << " (EDGE_COLORING_GROUP_SIZE= " << geometry.GetEdgeColorGroupSize() << ")." << endl;
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+#endif
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& config, CGeometry& geometry) {
 #ifdef HAVE_OMP
@@ -299,12 +348,26 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
   if (!coloring.empty()) {
     /*--- If the reducer strategy is used we are not constrained by group
      *    size as we have no other edge loops in the Euler/NS solvers. ---*/
-    auto groupSize = ReducerStrategy ? 1ul : geometry.GetEdgeColorGroupSize();
-    auto nColor = coloring.getOuterSize();
-    EdgeColoring.reserve(nColor);
+    SetEdgeColoring(coloring, ReducerStrategy ? 1ul : geometry.GetEdgeColorGroupSize());
+  }
 
-    for (auto iColor = 0ul; iColor < nColor; ++iColor)
-      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+  /*--- Candidate group sizes to tune the edge loops, the default first, then smaller and larger multiples
+   *    of the largest SIMD length whose coloring efficiency is acceptable (to not trigger the fallback). ---*/
+  if (config.GetEdgeColoringAutotune() && !config.GetDiscrete_Adjoint() && !ReducerStrategy &&
+      (omp_get_max_threads() > 1) && !coloring.empty()) {
+    const auto defaultSize = geometry.GetEdgeColorGroupSize();
+    vector<unsigned long> candidates = {defaultSize};
+    for (const auto size : {defaultSize / 4, defaultSize / 2, defaultSize * 2}) {
+      const auto groupSize = max(nextMultiple(size, 8ul), 8ul);
+      if (find(candidates.begin(), candidates.end(), groupSize) != candidates.end()) continue;
+      const auto candidate = geometry.ColorEdges(groupSize);
+      if (!candidate.empty() &&
+          coloringEfficiency(candidate, omp_get_max_threads(), groupSize) >= COLORING_EFF_THRESH) {
+        candidates.push_back(groupSize);
+      }
+    }
+    GeometryEdgeColoring = &coloring;
+    EdgeColoringTuner.Initialize(candidates, 2, 3);
   }
 
   /*--- If the reducer strategy is not being forced (by EDGE_COLORING_GROUP_SIZE=0) print some messages. ---*/
@@ -354,7 +417,8 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_GG(CGeometry* geometry, con
   const auto comm = reconstruction? PRIMITIVE_GRAD_REC : PRIMITIVE_GRADIENT;
   const auto commPer = reconstruction? PERIODIC_PRIM_GG_R : PERIODIC_PRIM_GG;
 
-  computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, primitives, 0, nPrimVarGrad, gradient);
+  computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, primitives, 0, nPrimVarGrad, gradient,
+                             GetGradientPoints());
 }
 
 template <class V, ENUM_REGIME R>
@@ -379,7 +443,7 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_LS(CGeometry* geometry, con
   const auto comm = reconstruction? PRIMITIVE_GRAD_REC : PRIMITIVE_GRADIENT;
 
   computeGradientsLeastSquares(this, comm, commPer, *geometry, *config, weighted,
-                               primitives, 0, nPrimVarGrad, gradient, rmatrix);
+                               primitives, 0, nPrimVarGrad, gradient, rmatrix, GetGradientPoints());
 }
 
 template <class V, ENUM_REGIME R>
@@ -392,7 +456,7 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const C
   auto& limiter = nodes->GetLimiter_Primitive();
 
   computeLimiters(kindLimiter, this, PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2, *geometry, *config, 0,
-                  nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
+                  nPrimVarGrad, primitives, gradient, primMin, primMax, limiter, GetGradientPoints());
 }
 
 template <class V, ENUM_REGIME R>
@@ -528,7 +592,7 @@ void CFVMFlowSolverBase<V, R>::ComputeUnderRelaxationFactor(const CConfig* confi
 
   const su2double allowableRatio = 0.2;
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
+  SU2_OMP_FOR_STAT_PROFILED("Point loops", omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
     su2double localUnderRelaxation = 1.0;
 
@@ -555,7 +619,7 @@ void CFVMFlowSolverBase<V, R>::ComputeUnderRelaxationFactor(const CConfig* confi
 
     nodes->SetUnderRelaxation(iPoint, localUnderRelaxation);
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 }
 
 template <class V, ENUM_REGIME R>
@@ -563,6 +627,11 @@ void CFVMFlowSolverBase<V, R>::ImplicitEuler_Iteration(CGeometry *geometry, CSol
 
   PrepareImplicitIteration(geometry, nullptr, config);
 
+  if (config->GetKind_ROM() != ROM_KIND::NONE) {
+    ReducedOrder_Iteration(geometry, config);
+    return;
+  }
+
   /*--- Solve or smooth the linear system. ---*/
 
   SU2_OMP_FOR_(schedule(static,OMP_MIN_SIZE) SU2_NOWAIT)
@@ -583,6 +652,405 @@ void CFVMFlowSolverBase<V, R>::ImplicitEuler_Iteration(CGeometry *geometry, CSol
   CompleteImplicitIteration(geometry, nullptr, config);
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::InitializeReducedOrderModel(CGeometry *geometry, const CConfig *config) {
+
+  /*--- Read the snapshots, restart files of the same mesh (coordinates followed by the solution variables). ---*/
+
+  vector<su2passivematrix> snapshots;
+
+  for (auto iFile = 0u; iFile < config->GetnROM_Snapshot_Files(); iFile++) {
+    auto fileName = config->GetROM_Snapshot_File(iFile);
+    fileName = fileName.substr(0, fileName.find_last_of('.'));
+
+    Read_SU2_Restart_Binary(geometry, config, fileName);
+
+    snapshots.emplace_back(nPointDomain, nVar);
+    auto& snapshot = snapshots.back();
+
+    unsigned long counter = 0;
+    for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++) {
+      const auto iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+      if (iPoint_Local > -1) {
+        const auto* data = &Restart_Data[counter * Restart_Vars[1] + nDim];
+        for (auto iVar = 0u; iVar < nVar; iVar++) snapshot(iPoint_Local, iVar) = data[iVar];
+        counter++;
+      }
+    }
+
+    delete [] Restart_Vars;
+    Restart_Vars = nullptr;
+    delete [] Restart_Data;
+    Restart_Data = nullptr;
+
+    if (counter != nPointDomain) {
+      SU2_MPI::Error("The snapshot " + fileName + " does not match with the mesh file.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- POD basis. ---*/
+
+  ROMBasis.Build(snapshots, config->GetMax_BasisDim());
+  snapshots.clear();
+
+  const auto nModes = ROMBasis.GetnModes();
+  if (nModes == 0) {
+    SU2_MPI::Error("The POD basis is empty, the snapshots are identical.", CURRENT_FUNCTION);
+  }
+  if (rank == MASTER_NODE) {
+    cout << "POD basis of " << nModes << " modes, capturing " << 100 * ROMBasis.GetEnergyFraction()
+         << "% of the energy of the snapshots." << endl;
+  }
+
+  /*--- Copy of the modes in the layout used for products with the Jacobian (halos are set by the caller). ---*/
+
+  ROMModes.Initialize(nPoint, nPointDomain, nVar * nModes, 0.0);
+  ROMTestBasis.Initialize(nPoint, nPointDomain, nVar * nModes, 0.0);
+
+  for (auto iMode = 0ul; iMode < nModes; iMode++) {
+    const auto& mode = ROMBasis.GetMode(iMode);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      for (auto iVar = 0u; iVar < nVar; iVar++) ROMModes(iPoint, iMode * nVar + iVar) = mode(iPoint, iVar);
+  }
+
+  ROMNormalEqs.resize(nModes, nModes + 1);
+
+  /*--- Reduced coordinates of the initial solution. ---*/
+
+  ROMCoords.resize(nModes);
+  auto solution = [this](unsigned long iPoint, unsigned long iVar) {
+    return SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar));
+  };
+  ROMBasis.Project(solution, ROMCoords.data());
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::InitializeHyperReduction(CGeometry *geometry, const CConfig *config) {
+
+  const auto nSample = config->GetnROM_Sample_Points();
+  if ((nSample == 0) || (nSample >= geometry->GetGlobal_nPointDomain())) return;
+
+  /*--- LinSysSol is not used by the LSPG iteration, its first variable marks the points of the sets, the
+   *    marks of halo points are added to their owners to have the same sets on all ranks. ---*/
+
+  auto markNeighbors = [&](const vector<unsigned long>& points) {
+    for (auto iPoint : points) {
+      LinSysSol(iPoint, 0) = 1.0;
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint)) LinSysSol(jPoint, 0) = 1.0;
+    }
+  };
+
+  LinSysSol.SetValZero();
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+
+    /*--- Leverage of each point, its contribution to the norm of the modes over the domain (the residuals are
+     *    integrals over the control volumes, the points of small volumes would see only small residuals). ---*/
+
+    vector<passivedouble> leverage(nPointDomain, 0.0);
+    for (auto iMode = 0ul; iMode < ROMBasis.GetnModes(); iMode++) {
+      const auto& mode = ROMBasis.GetMode(iMode);
+      for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+        for (auto iVar = 0u; iVar < nVar; iVar++) leverage[iPoint] += ROMBasis.GetWeight(iVar) * pow(mode(iPoint, iVar), 2);
+    }
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      leverage[iPoint] *= SU2_TYPE::GetValue(geometry->nodes->GetVolume(iPoint));
+
+    /*--- Global threshold of the leverage (bisection) for the requested number of sample points. ---*/
+
+    auto countSamples = [&](passivedouble threshold) {
+      unsigned long count = 0, total = 0;
+      for (auto value : leverage) count += (value >= threshold);
+      SU2_MPI::Allreduce(&count, &total, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+      return total;
+    };
+
+    passivedouble maxLeverage = 0.0, lower = 0.0, upper = 0.0;
+    for (auto value : leverage) maxLeverage = max(maxLeverage, value);
+    SelectMPIWrapper<passivedouble>::W::Allreduce(&maxLeverage, &upper, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    upper = 2 * upper + EPS;
+
+    for (int iter = 0; iter < 64; iter++) {
+      const auto threshold = 0.5 * (lower + upper);
+      if (countSamples(threshold) >= nSample) lower = threshold;
+      else upper = threshold;
+    }
+    const auto nSampleGlobal = countSamples(lower);
+
+    if (nSampleGlobal * nVar < ROMBasis.GetnModes()) {
+      SU2_MPI::Error("Too few ROM_SAMPLE_POINTS for the number of modes.", CURRENT_FUNCTION);
+    }
+    ROMResidualScale = passivedouble(geometry->GetGlobal_nPointDomain()) / nSampleGlobal;
+
+    ROMSamplePoints.clear();
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      if (leverage[iPoint] >= lower) ROMSamplePoints.push_back(iPoint);
+
+    /*--- The gradients are needed on the sample points and their neighbors, and on the walls for the forces. ---*/
+
+    markNeighbors(ROMSamplePoints);
+    for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+      if (!config->GetSolid_Wall(iMarker)) continue;
+      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++)
+        LinSysSol(geometry->vertex[iMarker][iVertex]->GetNode(), 0) = 1.0;
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  CSysMatrixComms::Initiate(LinSysSol, geometry, config, SOLUTION_MATRIXTRANS);
+  CSysMatrixComms::Complete(LinSysSol, geometry, config, SOLUTION_MATRIXTRANS);
+
+  /*--- The solution (and primitives) are needed on the neighbors of those points. ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    ROMGradientPoints.clear();
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      if (LinSysSol(iPoint, 0) > 0.0) ROMGradientPoints.push_back(iPoint);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  LinSysSol.SetValZero();
+  SU2_OMP_SAFE_GLOBAL_ACCESS(markNeighbors(ROMGradientPoints);)
+
+  CSysMatrixComms::Initiate(LinSysSol, geometry, config, SOLUTION_MATRIXTRANS);
+  CSysMatrixComms::Complete(LinSysSol, geometry, config, SOLUTION_MATRIXTRANS);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    /*--- Non-halo points first, the halos are communicated. ---*/
+    ROMStatePoints.clear();
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      if (LinSysSol(iPoint, 0) > 0.0) ROMStatePoints.push_back(iPoint);
+    ROMStateDomainPoints = lower_bound(ROMStatePoints.begin(), ROMStatePoints.end(), nPointDomain) -
+                           ROMStatePoints.begin();
+
+    /*--- Edges of the sample points, and their coloring. The vectorized edge loops load the nodes of
+     *    contiguous edges, therefore whole SIMD groups of edges are taken (this only adds a few edges). ---*/
+
+    const unsigned long simdLen = simd::preferredLen<su2double>();
+    vector<unsigned long> edges;
+    for (auto iPoint : ROMSamplePoints) {
+      for (unsigned long iEdge : geometry->nodes->GetEdges(iPoint)) {
+        const auto first = iEdge - iEdge % simdLen;
+        for (auto jEdge = first; jEdge < min(first + simdLen, geometry->GetnEdge()); jEdge++) edges.push_back(jEdge);
+      }
+    }
+    sort(edges.begin(), edges.end());
+    edges.erase(unique(edges.begin(), edges.end()), edges.end());
+
+    su2vector<unsigned long> outerPtr(edges.size() + 1);
+    su2vector<unsigned long> innerIdx(edges.size() * 2);
+    for (auto k = 0ul; k < edges.size(); k++) {
+      outerPtr(k) = 2 * k;
+      innerIdx(2 * k) = geometry->edges->GetNode(edges[k], 0);
+      innerIdx(2 * k + 1) = geometry->edges->GetNode(edges[k], 1);
+    }
+    outerPtr(edges.size()) = 2 * edges.size();
+
+    /*--- Same strategy as the full edge coloring, with the reducer a single color is enough. The groups
+     *    (of local edges) must be multiples of the SIMD length to keep the SIMD groups whole. ---*/
+    const bool colored = !ReducerStrategy && (omp_get_max_threads() > 1);
+    auto groupSize = ReducerStrategy ? 1ul : nextMultiple(geometry->GetEdgeColorGroupSize(), simdLen);
+    if (colored) {
+      ROMEdges = colorSparsePattern(CCompressedSparsePatternUL(move(outerPtr), move(innerIdx)), groupSize);
+    }
+    if (ROMEdges.empty()) {
+      ROMEdges = createNaturalColoring(edges.size());
+      if (colored) groupSize = max<unsigned long>(edges.size(), 1);
+    }
+
+    /*--- From the local numbering of the edges of the samples to the edges of the mesh. ---*/
+    for (auto iColor = 0ul; iColor < ROMEdges.getOuterSize(); iColor++)
+      for (auto k = 0ul; k < ROMEdges.getNumNonZeros(iColor); k++)
+        ROMEdges.getInnerIdx(iColor, k) = edges[ROMEdges.getInnerIdx(iColor, k)];
+
+    ROMEdgeColoring.clear();
+    ROMEdgeColoring.reserve(ROMEdges.getOuterSize());
+    for (auto iColor = 0ul; iColor < ROMEdges.getOuterSize(); iColor++)
+      ROMEdgeColoring.emplace_back(ROMEdges.innerIdx(iColor), ROMEdges.getNumNonZeros(iColor), groupSize);
+
+    ROMHyperReduction = true;
+
+    unsigned long nLocal[] = {ROMSamplePoints.size(), ROMGradientPoints.size(), ROMStateDomainPoints};
+    unsigned long nGlobal[] = {0, 0, 0};
+    SU2_MPI::Reduce(nLocal, nGlobal, 3, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
+    if (rank == MASTER_NODE) {
+      cout << "Hyper-reduction, residual sampled at " << nGlobal[0] << " points, gradients on " << nGlobal[1]
+           << " and solution on " << nGlobal[2] << " of " << geometry->GetGlobal_nPointDomain() << " points." << endl;
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  LinSysSol.SetValZero();
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::ReducedOrder_Iteration(CGeometry *geometry, CConfig *config) {
+
+  /*--- Build the model the first time (all threads must take part in the communication of the modes). ---*/
+
+  if (ROMCoords.empty()) {
+    SU2_OMP_SAFE_GLOBAL_ACCESS(InitializeReducedOrderModel(geometry, config);)
+    CSysMatrixComms::Initiate(ROMModes, geometry, config);
+    CSysMatrixComms::Complete(ROMModes, geometry, config);
+    InitializeHyperReduction(geometry, config);
+  }
+  const auto nModes = ROMBasis.GetnModes();
+
+  /*--- Test basis, all the modes are multiplied in one pass over the matrix. The pseudo-time
+   *    term (V/dt) was added to the Jacobian by PrepareImplicitIteration. With hyper-reduction
+   *    only the rows of the sample points are needed. ---*/
+
+  if (ROMHyperReduction) {
+    Jacobian.MatrixVectorProductRows(ROMModes, ROMSamplePoints, ROMTestBasis);
+  } else {
+    Jacobian.MatrixVectorProduct(ROMModes, ROMTestBasis, geometry, config);
+  }
+  const IndexSubset<> samples(GetSamplePoints(), nPointDomain);
+
+  /*--- Normal equations of the least-squares problem, LinSysRes holds -R. ---*/
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(ROMNormalEqs = 0.0;)
+
+  su2passivematrix localEqs(nModes, nModes + 1);
+  localEqs = 0.0;
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long k = 0; k < samples.size; k++) {
+    const auto iPoint = samples[k];
+    for (auto iMode = 0ul; iMode < nModes; iMode++) {
+      const auto* w_i = &ROMTestBasis(iPoint, iMode * nVar);
+      for (auto jMode = 0ul; jMode <= iMode; jMode++) {
+        const auto* w_j = &ROMTestBasis(iPoint, jMode * nVar);
+        for (auto iVar = 0u; iVar < nVar; iVar++) localEqs(iMode, jMode) += w_i[iVar] * w_j[iVar];
+      }
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        localEqs(iMode, nModes) += w_i[iVar] * SU2_TYPE::GetValue(LinSysRes(iPoint, iVar));
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_CRITICAL {
+    for (auto i = 0ul; i < localEqs.size(); i++) ROMNormalEqs.data()[i] += localEqs.data()[i];
+  }
+  END_SU2_OMP_CRITICAL
+
+  /*--- Solve the reduced system. ---*/
+
+  vector<passivedouble> deltaCoords(nModes, 0.0);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    su2passivematrix globalEqs(nModes, nModes + 1);
+    SelectMPIWrapper<passivedouble>::W::Allreduce(ROMNormalEqs.data(), globalEqs.data(), globalEqs.size(),
+                                                  MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    ROMNormalEqs = globalEqs;
+
+    CSymmetricMatrix lhs(nModes);
+    for (auto iMode = 0ul; iMode < nModes; iMode++)
+      for (auto jMode = 0ul; jMode <= iMode; jMode++) lhs(iMode, jMode) = ROMNormalEqs(iMode, jMode);
+    lhs.Invert(true);
+
+    /*--- The solution is kept in ROMNormalEqs (last column) to share it with the other threads. ---*/
+    vector<passivedouble> rhs(nModes), sol(nModes);
+    for (auto iMode = 0ul; iMode < nModes; iMode++) rhs[iMode] = ROMNormalEqs(iMode, nModes);
+    lhs.MatVecMult(rhs.begin(), sol.begin());
+    for (auto iMode = 0ul; iMode < nModes; iMode++) ROMNormalEqs(iMode, nModes) = sol[iMode];
+
+    ROMRelaxation = 1.0;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  for (auto iMode = 0ul; iMode < nModes; iMode++) deltaCoords[iMode] = ROMNormalEqs(iMode, nModes);
+
+  /*--- Uniform relaxation, limit the relative change of the variables that are strictly positive, density and
+   *    energy for compressible flow, temperature for incompressible flow (the pressure is a gauge pressure). ---*/
+
+  const passivedouble allowableRatio = 0.2;
+  passivedouble relaxation = 1.0;
+
+  const auto firstVar = (R == ENUM_REGIME::COMPRESSIBLE) ? 0u : nVar - 1u;
+
+  /*--- With hyper-reduction the solution is only updated where it is needed to compute the residual. ---*/
+  const IndexSubset<> points(GetStatePoints(), nPoint);
+  const auto nPointUpdate = ROMHyperReduction ? ROMStateDomainPoints : nPointDomain;
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long k = 0; k < nPointUpdate; k++) {
+    const auto iPoint = points[k];
+    for (auto iVar : {firstVar, nVar - 1u}) {
+      passivedouble delta = 0.0;
+      for (auto iMode = 0ul; iMode < nModes; iMode++)
+        delta += deltaCoords[iMode] * ROMBasis.GetMode(iMode)(iPoint, iVar);
+      const passivedouble ratio = fabs(delta) / (fabs(SU2_TYPE::GetValue(nodes->GetSolution(iPoint, iVar))) + EPS);
+      if (ratio > allowableRatio) relaxation = min(relaxation, allowableRatio / ratio);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_CRITICAL {
+    ROMRelaxation = min(ROMRelaxation, relaxation);
+  }
+  END_SU2_OMP_CRITICAL
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    relaxation = ROMRelaxation;
+    SelectMPIWrapper<passivedouble>::W::Allreduce(&relaxation, &ROMRelaxation, 1, MPI_DOUBLE, MPI_MIN,
+                                                  SU2_MPI::GetComm());
+    if (ROMRelaxation < 1e-10) ROMRelaxation = 0.0;
+
+    for (auto iMode = 0ul; iMode < nModes; iMode++) ROMCoords[iMode] += ROMRelaxation * deltaCoords[iMode];
+
+    SetIterLinSolver(0);
+    SetResLinSolver(0.0);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Reconstruct the solution, the relaxation factors are stored for the CFL adaptation. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long k = 0; k < nPointUpdate; k++) {
+    const auto iPoint = points[k];
+    su2double solution[MAXNVAR];
+    ROMBasis.Reconstruct(iPoint, ROMCoords.data(), solution);
+    nodes->SetSolution(iPoint, solution);
+    nodes->SetUnderRelaxation(iPoint, ROMRelaxation);
+  }
+  END_SU2_OMP_FOR
+
+  InitiateComms(geometry, config, SOLUTION);
+  CompleteComms(geometry, config, SOLUTION);
+
+  /*--- For verification cases, compute the global error metrics. ---*/
+  ComputeVerificationError(geometry, config);
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::ReconstructFullSolution(CGeometry *geometry, CSolver **solver_container,
+                                                       CConfig *config) {
+  if (!ROMHyperReduction) return;
+
+  /*--- This is called outside of parallel regions (by the output). ---*/
+  ROMHyperReduction = false;
+
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      su2double solution[MAXNVAR];
+      ROMBasis.Reconstruct(iPoint, ROMCoords.data(), solution);
+      nodes->SetSolution(iPoint, solution);
+    }
+    END_SU2_OMP_FOR
+
+    InitiateComms(geometry, config, SOLUTION);
+    CompleteComms(geometry, config, SOLUTION);
+
+    /*--- Primitive variables, gradients, and limiters on the full mesh. ---*/
+    Preprocessing(geometry, solver_container, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, true);
+  }
+  END_SU2_OMP_PARALLEL
+
+  ROMHyperReduction = true;
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::ComputeVorticityAndStrainMag(const CConfig& config, const CGeometry *geometry, unsigned short iMesh) {
 
@@ -592,7 +1060,7 @@ void CFVMFlowSolverBase<V, R>::ComputeVorticityAndStrainMag(const CConfig& confi
 
   su2double strainMax = 0.0, omegaMax = 0.0;
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
+  SU2_OMP_FOR_STAT_PROFILED("Point loops", omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
 
     const auto VelocityGradient = nodes->GetVelocityGradient(iPoint);
@@ -646,7 +1114,7 @@ void CFVMFlowSolverBase<V, R>::ComputeVorticityAndStrainMag(const CConfig& confi
 
     AD::EndPreacc();
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
   if ((iMesh == MESH_0) && (config.GetComm_Level() == COMM_FULL)) {
     SU2_OMP_CRITICAL {
@@ -786,13 +1254,9 @@ void CFVMFlowSolverBase<V, R>::LoadRestart_impl(CGeometry **geometry, CSolver **
 
     unsigned short skipVars = nDim;
 
-    /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
+    /*--- Read the restart data from either an ASCII or binary SU2 file, or blend several files. ---*/
 
-    if (config->GetRead_Binary_Restart()) {
-      Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename);
-    } else {
-      Read_SU2_Restart_ASCII(geometry[MESH_0], config, restart_filename);
-    }
+    Read_SU2_Restart(geometry[MESH_0], config, restart_filename);
 
     bool steady_restart = config->GetSteadyRestart();
     if (update_geo && dynamic_grid) {
@@ -1081,7 +1545,7 @@ void CFVMFlowSolverBase<V, R>::BC_Sym_Plane(CGeometry* geometry, CSolver** solve
 
   /*--- Loop over all the vertices on this boundary marker. ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_DYN_PROFILED("Boundary loops", OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     if (!preprocessed || geometry->bound_is_straight[val_marker] != true) {
       /*----------------------------------------------------------------------------------------------*/
@@ -1301,7 +1765,7 @@ void CFVMFlowSolverBase<V, R>::BC_Sym_Plane(CGeometry* geometry, CSolver** solve
       }  // if viscous
     }    // if GetDomain
   }      // for iVertex
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
 }
 
@@ -1560,6 +2024,26 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
     InstantiateEdgeNumerics(solvers, config);
   }
 
+  SU2_PROFILE_REGION("Edge loop");
+
+  /*--- Estimate of the memory traffic of the loop, each edge reads the geometry and the variables of its
+   *    points, and updates their residuals and (if implicit) the four Jacobian blocks coupling them.
+   *    The operations are a model of an upwind (Roe-type) scheme: reconstruction of both states, flux and
+   *    dissipation (a few dense nVar x nVar products), flux Jacobians, and the update of the residuals
+   *    and Jacobian blocks. Use the hardware counters for exact counts of a specific scheme. ---*/
+  if (CProfiler::IsEnabled()) {
+    const bool muscl = config->GetMUSCL_Flow() && (MGLevel == MESH_0);
+    const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto pointBytes = sizeof(su2double) * (nPrimVar + muscl * nPrimVarGrad * (nDim + 1) + 2 * nVar) +
+                            sizeof(unsigned long);
+    const auto edgeBytes = 3 * nDim * sizeof(su2double) + 2 * pointBytes +
+                           implicit * 8 * nVar * nVar * sizeof(su2mixedfloat);
+    const auto edgeFlops = muscl * 4 * nPrimVarGrad * (nDim + 1) + 6 * nVar * nVar + 8 * nVar * nDim +
+                           implicit * (4 * nVar * nVar * (nDim + 1) + 4 * nVar * nVar);
+    const double nEdge = ROMHyperReduction ? ROMEdges.getNumNonZeros() : geometry->GetnEdge();
+    CProfiler::AddWork(nEdge * edgeBytes, nEdge * edgeFlops);
+  }
+
   /*--- Non-physical counter. ---*/
   unsigned long counterLocal = 0;
   SU2_OMP_MASTER
@@ -1572,10 +2056,12 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
   if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
   else AD::StartNoSharedReading();
 
+  EdgeLoopTuningStart();
+
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring) {
+  ForEachEdgeColor([&](const auto& color) {
     /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    SU2_OMP_FOR_DYN_PROFILED("Edge colors", nextMultiple(OMP_MIN_SIZE, color.groupSize))
     for(auto k = 0ul; k < color.size; k += Double::Size) {
       Int iEdge;
       Double mask;
@@ -1595,8 +2081,10 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
           counterLocal += (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
       }
     }
-    END_SU2_OMP_FOR
-  }
+    END_SU2_OMP_FOR_PROFILED
+  });
+
+  EdgeLoopTuningStop(*geometry);
 
   FinalizeResidualComputation(geometry, pausePreacc, counterLocal, config);
 }
@@ -1604,7 +2092,7 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::SumEdgeFluxes(const CGeometry* geometry) {
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
+  SU2_OMP_FOR_STAT_PROFILED("Point loops", omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
 
     LinSysRes.SetBlock_Zero(iPoint);
@@ -1616,7 +2104,7 @@ void CFVMFlowSolverBase<V, R>::SumEdgeFluxes(const CGeometry* geometry) {
         LinSysRes.SubtractBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
     }
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 }
 
 template <class V, ENUM_REGIME FlowRegime>
@@ -53,7 +53,10 @@ public:
 #endif
 
  private:
-  unsigned int curDim;                       /*!< \brief If we separate dimensions this tells us in what dimension we currently are. */
+  unsigned int curDim = 0;                   /*!< \brief If we separate dimensions this tells us in what dimension we currently are. */
+  bool batchedDims = false;                  /*!< \brief Separated dimensions are smoothed together as multiple right-hand sides. */
+
+  su2passivematrix assembledCoord;           /*!< \brief Coordinates of the mesh for which the stiffness matrix was assembled. */
 
   CSysVector<su2double> activeCoord;         /*!< \brief Auxiliar vector to keep the indeces of geometry->vertex->Coord */
 
@@ -113,6 +116,15 @@ public:
 
  private:
 
+  /*!
+   * \brief Check if the assembled stiffness matrix (and its preconditioner) can be reused.
+   * \note The operator only depends on the mesh, for a given configuration, therefore it
+   *       is kept across design iterations until the coordinates change.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \return True if the mesh did not change since the last assembly.
+   */
+  bool OperatorIsCurrent(const CGeometry* geometry);
+
   /*!
    * \brief Assemble the stiffness matrix
    */
@@ -44,6 +44,13 @@ protected:
 
   bool stiffness_set;          /*!< \brief Element-based stiffness is set. */
 
+#ifndef CODI_FORWARD_TYPE
+  typedef su2mixedfloat su2matvecscalar;
+#else
+  typedef su2double su2matvecscalar;
+#endif
+  vector<su2matvecscalar> StiffMatrix; /*!< \brief Assembled stiffness matrix, before imposing boundary conditions. */
+
   unsigned long ElemCounter;   /*!< \brief Error (negative volume) counter. */
 
   /*!
@@ -71,6 +78,16 @@ protected:
    */
   void SetWallDistance(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Set the stiffness matrix into the Jacobian. The matrix only depends on the reference
+   *        coordinates and on the element stiffness, it is assembled on the first call and
+   *        restored from StiffMatrix on the following deformations (time steps, design iterations).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Numerics used in the solution.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetStiffMatrix(CGeometry *geometry, CNumerics **numerics, const CConfig *config);
+
   /*!
    * \brief Update the value of the coordinates after the grid movement.
    * \param[in] geometry - Geometrical definition of the problem.
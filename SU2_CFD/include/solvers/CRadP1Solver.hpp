@@ -31,6 +31,10 @@
 
 class CRadP1Solver final: public CRadSolver {
 private:
+  static constexpr size_t MAXNVAR = 1;  /*!< \brief Max number of variables, for static arrays. */
+
+  bool reuseJacobian = false;  /*!< \brief The Jacobian only depends on the geometry and can be reused. */
+  bool updateJacobian = true;  /*!< \brief The Jacobian needs to be (re)assembled in the current iteration. */
 
 protected:
 
@@ -38,6 +38,31 @@ protected:
 
   CRadVariable* nodes = nullptr;  /*!< \brief The highest level in the variable hierarchy this solver can safely use. */
 
+  enum : size_t { OMP_MAX_SIZE = 512 }; /*!< \brief Max chunk size for light point loops. */
+  enum : size_t { OMP_MIN_SIZE = 32 };  /*!< \brief Min chunk size for edge loops (max is color group size). */
+
+  unsigned long omp_chunk_size = 0; /*!< \brief Chunk size used in light point loops. */
+
+  /*--- Shallow copy of grid coloring for OpenMP parallelization. ---*/
+
+#ifdef HAVE_OMP
+  vector<GridColor<> > EdgeColoring; /*!< \brief Edge colors. */
+  bool ReducerStrategy = false;      /*!< \brief If the reducer strategy is in use. */
+#else
+  array<DummyGridColor<>, 1> EdgeColoring;
+  /*--- Never use the reducer strategy if compiling for MPI-only. ---*/
+  static constexpr bool ReducerStrategy = false;
+#endif
+
+  /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
+  CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
+
+  /*!
+   * \brief Sum the edge fluxes for each cell to populate the residual vector (reducer strategy).
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SumEdgeFluxes(const CGeometry* geometry);
+
   /*!
    * \brief Return nodes to allow CSolver::base_nodes to be set.
    */
@@ -80,4 +105,9 @@ public:
   void LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *config,
                    int val_iter, bool val_update_geo) override;
 
+  /*!
+   * \brief The radiation solvers support OpenMP+MPI.
+   */
+  inline bool GetHasHybridParallel() const override { return true; }
+
 };
@@ -25,6 +25,7 @@
  */
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CScalarSolver.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
@@ -158,7 +159,7 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
   /*--- Loop over edge colors. ---*/
   for (auto color : EdgeColoring) {
     /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    SU2_OMP_FOR_DYN_PROFILED("Edge colors", nextMultiple(OMP_MIN_SIZE, color.groupSize))
     for (auto k = 0ul; k < color.size; ++k) {
       auto iEdge = color.indices[k];
 
@@ -298,7 +299,7 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
       Viscous_Residual(iEdge, geometry, solver_container,
                        numerics_container[VISC_TERM + omp_get_thread_num() * MAX_TERMS], config);
     }
-    END_SU2_OMP_FOR
+    END_SU2_OMP_FOR_PROFILED
   }  // end color loop
 
   /*--- Restore preaccumulation and adjoint evaluation state. ---*/
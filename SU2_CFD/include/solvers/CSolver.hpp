@@ -55,6 +55,7 @@
 #include "../../../Common/include/linear_algebra/blas_structure.hpp"
 #include "../../../Common/include/graph_coloring_structure.hpp"
 #include "../../../Common/include/toolboxes/MMS/CVerificationSolution.hpp"
+#include "../../../Common/include/toolboxes/CCFLCostController.hpp"
 #include "../variables/CVariable.hpp"
 
 #ifdef HAVE_LIBROM
@@ -77,6 +78,11 @@ protected:
   vector<su2double> NonLinRes_Series; /*!< \brief Vector holding the nonlinear residual indicator series. */
   su2double Old_Func,  /*!< \brief Old value of the nonlinear residual indicator. */
   New_Func;            /*!< \brief Current value of the nonlinear residual indicator. */
+  CCFLCostController CostControl;    /*!< \brief Cost-aware control of the CFL limit and linear solver settings. */
+  bool CostControlReady = false;     /*!< \brief Whether CostControl was initialized. */
+  bool CostControlRestart = false;   /*!< \brief Restart the window at the next adaptation (e.g. new time step). */
+  passivedouble CostWindowFunc = 0;  /*!< \brief Nonlinear residual indicator at the start of the window. */
+  passivedouble CostWindowTime = 0;  /*!< \brief Time at the start of the window. */
   unsigned short nVar,           /*!< \brief Number of variables of the problem. */
   nPrimVar,                      /*!< \brief Number of primitive variables of the problem. */
   nPrimVarGrad,                  /*!< \brief Number of primitive variables of the problem in the gradient computation. */
@@ -180,6 +186,42 @@ private:
    */
   void InterpolateRestartData(const CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Blended restart (RESTART_BLEND_FILES), formed once and shared by the solvers of a zone.
+   */
+  struct CBlendedRestart {
+    const CConfig* config = nullptr;     /*!< \brief Zone for which the blend was formed. */
+    const CGeometry* geometry = nullptr; /*!< \brief Mesh for which the blend was formed. */
+    vector<int> vars;                    /*!< \brief Restart_Vars of the blend. */
+    vector<string> fields;               /*!< \brief Fields of the blend. */
+    vector<passivedouble> data;          /*!< \brief Restart_Data of the blend. */
+  };
+  static CBlendedRestart BlendedRestart;
+
+  /*!
+   * \brief Set Restart_Data to the blend of the converged solutions of RESTART_BLEND_FILES, forming it if needed.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BlendRestartData(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Form the blend by inverse distance weighting, in parameter space (RESTART_BLEND_PARAM),
+   *        of the nearest converged solutions of RESTART_BLEND_FILES.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ReadBlendedRestart(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Measure the convergence rate per second and update the CFL limit and linear solver settings (master
+   *        thread only, called by AdaptCFLNumber once the nonlinear residual indicator is computed).
+   * \param[in] solverTurb - Turbulence solver, it uses the same linear solver settings as this solver.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] restart - The CFL was reset, the measurement of the current window is discarded.
+   */
+  void AdaptCostControl(CSolver *solverTurb, const CConfig *config, bool restart);
+
   /*--- Private to prevent use by derived solvers, each solver MUST have its own "nodes" member of the
    most derived type possible, e.g. CEulerSolver has nodes of CEulerVariable* and not CVariable*.
    This variable is to avoid two virtual functions calls per call i.e. CSolver::GetNodes() returns
@@ -1418,6 +1460,11 @@ public:
    */
   void ResetCFLAdapt();
 
+  /*!
+   * \brief Get the cost-aware controller of the CFL limit and linear solver settings (CFL_ADAPT_COST).
+   */
+  inline const CCFLCostController& GetCostController() const { return CostControl; }
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3393,6 +3440,22 @@ public:
                                const CConfig *config,
                                string val_filename);
 
+  /*!
+   * \brief Read the restart of a primal solution, either directly (ASCII or binary as per READ_BINARY_RESTART),
+   *        or by blending the converged solutions of RESTART_BLEND_FILES that are nearest to the current problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - String name of the restart file (not used when blending).
+   */
+  void Read_SU2_Restart(CGeometry *geometry,
+                        const CConfig *config,
+                        const string& val_filename);
+
+  /*!
+   * \brief Release the blended restart (RESTART_BLEND_FILES) once all the solvers have read it.
+   */
+  static void ClearBlendedRestart();
+
   /*!
    * \brief Read the metadata from a native SU2 restart file (ASCII or binary).
    * \param[in] geometry - Geometrical definition of the problem.
@@ -4291,6 +4354,15 @@ public:
    */
   void SavelibROM(CGeometry *geometry, CConfig *config, bool converged);
 
+  /*!
+   * \brief Update the solution (and the variables derived from it) on all points, for solvers that only update
+   *        some of them during the iterations (hyper-reduced ROM), called before the volume output is loaded.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void ReconstructFullSolution(CGeometry *geometry, CSolver **solver_container, CConfig *config) { }
+
   /*!
    * \brief Interpolate variables to a coarser grid level.
    * \note Halo values are not communicated in this function.
@@ -245,6 +245,65 @@ void CDiscAdjSinglezoneDriver::Postprocess() {
 
 }
 
+bool CDiscAdjSinglezoneDriver::RunPrimal(unsigned long nIter) {
+
+  if (config->GetTime_Domain()) {
+    SU2_MPI::Error("The in-process primal solution is only available for steady problems.", CURRENT_FUNCTION);
+  }
+
+  /*--- The primal iterations are not recorded. The tape of the previous design is discarded and the next
+   *    call to Preprocess records the main variables again, around the new primal solution. ---*/
+
+  AD::Reset();
+  RecordingState = RECORDING::CLEAR_INDICES;
+
+  /*--- Deform the mesh once for the boundary displacements currently imposed (the recordings deform
+   *    it again, which is cheap since the mesh solver keeps its operator). ---*/
+
+  if (config->GetDeform_Mesh()) {
+    direct_iteration->SetMesh_Deformation(geometry_container[ZONE_0][INST_0], solver, numerics, config,
+                                          RECORDING::CLEAR_INDICES);
+    CGeometry::ComputeWallDistance(config_container, geometry_container);
+  }
+
+  /*--- Iterate the direct solver starting from the current solution (i.e. that of the previous design). ---*/
+
+  direct_iteration->Preprocess(direct_output, integration_container, geometry_container, solver_container,
+                               numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                               ZONE_0, INST_0);
+
+  const bool fluid = config->GetFluidProblem();
+  bool converged = false;
+
+  for (auto Iter = 0ul; Iter < nIter && !converged; Iter++) {
+
+    config->SetInnerIter(Iter);
+
+    direct_iteration->Iterate(direct_output, integration_container, geometry_container, solver_container,
+                              numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                              ZONE_0, INST_0);
+
+    converged = direct_iteration->Monitor(direct_output, integration_container, geometry_container, solver_container,
+                                          numerics_container, config_container, surface_movement, grid_movement,
+                                          FFDBox, ZONE_0, INST_0);
+
+    /*--- The convergence fields of the config refer to the adjoint, monitor the first primal residual. ---*/
+
+    if (fluid) converged |= (log10(solver[FLOW_SOL]->GetRes_RMS(0)) < config->GetMinLogResidual());
+  }
+
+  direct_iteration->Postprocess(direct_output, integration_container, geometry_container, solver_container,
+                                numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                                ZONE_0, INST_0);
+
+  if (rank == MASTER_NODE) {
+    cout << "\nPrimal solution " << (converged ? "converged" : "not converged") << " after "
+         << config->GetInnerIter() + 1 << " iterations." << endl;
+  }
+
+  return converged;
+}
+
 void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
 
   AD::Reset();
@@ -95,6 +95,9 @@
 #include "../../include/iteration/CIterationFactory.hpp"
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
+#include "../../../Common/include/toolboxes/CMemoryTracker.hpp"
+#include "../../../Common/include/toolboxes/CCommProfiler.hpp"
 
 #include <cassert>
 
@@ -118,6 +121,16 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   PreprocessInput(config_container, driver_config);
 
+  /*--- Start the runtime profiler, the setup of the driver is its first region. ---*/
+
+  CProfiler::Initialize(config_container[ZONE_0]->GetProfiling(), config_container[ZONE_0]->GetProfiling_Counters(),
+                        config_container[ZONE_0]->GetProfiling_Raw_Events());
+  CCommProfiler::Initialize(config_container[ZONE_0]->GetProfiling() && config_container[ZONE_0]->GetProfiling_Comms());
+  if (config_container[ZONE_0]->GetProfiling() && config_container[ZONE_0]->GetProfiling_Roofline()) {
+    CProfiler::MeasureMachine();
+  }
+  SU2_PROFILE_REGION("Setup");
+
   /*--- Retrieve dimension from mesh file ---*/
 
   nDim = CConfig::GetnDim(config_container[ZONE_0]->GetMesh_FileName(),
@@ -253,6 +266,8 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   PreprocessPythonInterface(config_container, geometry_container, solver_container);
 
+  if (config_container[ZONE_0]->GetWrt_MemoryReport()) CMemoryTracker::Print("after preprocessing");
+
 
   /*--- Preprocessing time is reported now, but not included in the next compute portion. ---*/
 
@@ -344,6 +359,8 @@ void CDriver::Finalize() {
 
   const bool wrt_perf = config_container[ZONE_0]->GetWrt_Performance();
 
+  if (config_container[ZONE_0]->GetWrt_MemoryReport()) CMemoryTracker::Print("at the end of the calculation");
+
     /*--- Output some information to the console. ---*/
 
   if (rank == MASTER_NODE) {
@@ -453,10 +470,16 @@ void CDriver::Finalize() {
   if (rank == MASTER_NODE) cout << "Deleted CVolumetricMovement class." << endl;
 
   /*--- Output profiling information ---*/
-  // Note that for now this is called only by a single thread, but all
-  // necessary variables have been made thread private for safety (tick/tock)!!
 
-  config_container[ZONE_0]->SetProfilingCSV();
+  if (CProfiler::IsEnabled()) {
+    CProfiler::Print();
+    CProfiler::Write(config_container[ZONE_0]->GetProfiling_FileName(),
+                     config_container[ZONE_0]->GetProfiling_Format(), "final");
+  }
+  if (CCommProfiler::IsEnabled()) {
+    CCommProfiler::Print();
+    CCommProfiler::Write(config_container[ZONE_0]->GetProfiling_FileName());
+  }
   config_container[ZONE_0]->GEMMProfilingCSV();
 
   /*--- Deallocate config container ---*/
@@ -597,6 +620,8 @@ void CDriver::PreprocessInput(CConfig **&config, CConfig *&driver_config) {
 
 void CDriver::InitializeGeometry(CConfig* config, CGeometry **&geometry, bool dummy){
 
+  SU2_MEMORY_SCOPE("Geometry");
+
   if (!dummy){
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Geometry Preprocessing ( Zone " << config->GetiZone() <<" ) -------------------" << endl;
@@ -1010,6 +1035,8 @@ void CDriver::InitializeGeometryDGFEM(CConfig* config, CGeometry **&geometry) {
 
 void CDriver::InitializeSolver(CConfig* config, CGeometry** geometry, CSolver ***&solver) {
 
+  SU2_MEMORY_SCOPE("Solvers");
+
   MAIN_SOLVER kindSolver = config->GetKind_Solver();
 
   if (rank == MASTER_NODE)
@@ -1145,6 +1172,7 @@ void CDriver::RestartSolver(CSolver ***solver, CGeometry **geometry,
         END_SU2_OMP_PARALLEL
       }
     }
+    CSolver::ClearBlendedRestart();
   }
 
   /*--- Restart adjoint solvers. ---*/
@@ -2106,13 +2134,13 @@ void CDriver::InitializeNumerics(CConfig *config, CGeometry **geometry, CSolver
 
   if (config->AddRadiation()) {
     /*--- Definition of the viscous scheme for each equation and mesh level ---*/
-    numerics[MESH_0][RAD_SOL][VISC_TERM] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][visc_term] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
 
     /*--- Definition of the source term integration scheme for each equation and mesh level ---*/
-    numerics[MESH_0][RAD_SOL][SOURCE_FIRST_TERM] = new CSourceP1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][source_first_term] = new CSourceP1(nDim, nVar_Rad, config);
 
     /*--- Definition of the boundary condition method ---*/
-    numerics[MESH_0][RAD_SOL][VISC_BOUND_TERM] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][visc_bound_term] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
   }
 
   /*--- Solver definition for the flow adjoint problem ---*/
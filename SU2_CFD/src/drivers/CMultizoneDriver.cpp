@@ -115,6 +115,23 @@ CMultizoneDriver::CMultizoneDriver(char* confFile, unsigned short val_nZone, SU2
     }
   }
 
+  /*----------------------------------------------------*/
+  /*- Interface quasi-Newton acceleration of the BGS ---*/
+  /*----------------------------------------------------*/
+
+  /*--- The data sent by a zone with IQN_ILS relaxation is accelerated, for FSI this should be set
+   * in the structural zone (displacements), for CHT in the solid zone (temperatures). ---*/
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const auto config = config_container[iZone];
+    if (config->GetDiscrete_Adjoint() || !config->GetRelaxation() ||
+        config->GetRelaxation_Method_BGS() != BGS_RELAXATION::IQN_ILS) continue;
+
+    for (auto jZone = 0u; jZone < nZone; jZone++) {
+      if (jZone != iZone && interface_container[iZone][jZone] != nullptr)
+        interface_container[iZone][jZone]->SetQuasiNewtonAcceleration(config->GetnQuasiNewtonSamples_BGS());
+    }
+  }
+
 }
 
 CMultizoneDriver::~CMultizoneDriver() {
@@ -295,6 +312,9 @@ void CMultizoneDriver::RunGaussSeidel() {
     if (mixingplane) SetMixingPlane(iZone);
   }
 
+  /*--- The quasi-Newton history of the previous time step is not used. ---*/
+  ResetQuasiNewtonAcceleration(true);
+
   /*--- Loop over the number of outer iterations ---*/
   for (auto iOuter_Iter = 0ul; iOuter_Iter < driver_config->GetnOuter_Iter(); iOuter_Iter++) {
 
@@ -342,6 +362,8 @@ void CMultizoneDriver::RunGaussSeidel() {
 
   }
 
+  ResetQuasiNewtonAcceleration(false);
+
 }
 
 void CMultizoneDriver::RunJacobi() {
@@ -353,6 +375,9 @@ void CMultizoneDriver::RunJacobi() {
     config_container[iZone]->SetOuterIter(0ul);
   }
 
+  /*--- The quasi-Newton history of the previous time step is not used. ---*/
+  ResetQuasiNewtonAcceleration(true);
+
   /*--- Loop over the number of outer iterations ---*/
   for (auto iOuter_Iter = 0ul; iOuter_Iter < driver_config->GetnOuter_Iter(); iOuter_Iter++){
 
@@ -407,6 +432,19 @@ void CMultizoneDriver::RunJacobi() {
 
   }
 
+  ResetQuasiNewtonAcceleration(false);
+
+}
+
+void CMultizoneDriver::ResetQuasiNewtonAcceleration(bool active) {
+
+  for (auto donorZone = 0u; donorZone < nZone; donorZone++) {
+    for (auto targetZone = 0u; targetZone < nZone; targetZone++) {
+      if (donorZone == targetZone || interface_container[donorZone][targetZone] == nullptr) continue;
+      interface_container[donorZone][targetZone]->ResetQuasiNewtonAcceleration();
+      interface_container[donorZone][targetZone]->SetQuasiNewtonActive(active);
+    }
+  }
 }
 
 void CMultizoneDriver::Corrector(unsigned short val_iZone) {
@@ -452,6 +490,7 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 void CMultizoneDriver::Update() {
 
   /*--- For enabling a consistent restart, we need to update the mesh with the interface information that introduces displacements --*/
+  /*--- The quasi-Newton acceleration is not active here, the converged data is transferred as is. ---*/
   /*--- Loop over the number of zones (IZONE) ---*/
   for (iZone = 0; iZone < nZone; iZone++){
 
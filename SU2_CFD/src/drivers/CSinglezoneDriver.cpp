@@ -61,6 +61,13 @@ void CSinglezoneDriver::StartSolver() {
            << driver_config->GetnTime_Iter() - config_container[ZONE_0]->GetRestart_Iter() << " time steps." << endl;
   }
 
+  /*--- Sweep of steady conditions on the same mesh. ---*/
+  if (config_container[ZONE_0]->GetnSweep_AoA() > 0 && config_container[ZONE_0]->GetFluidProblem() &&
+      !config_container[ZONE_0]->GetDiscrete_Adjoint() && !config_container[ZONE_0]->GetContinuous_Adjoint()) {
+    RunSweep_AoA();
+    return;
+  }
+
   /*--- Set the initial time iteration to the restart iteration. ---*/
   if (config_container[ZONE_0]->GetRestart() && driver_config->GetTime_Domain())
     TimeIter = config_container[ZONE_0]->GetRestart_Iter();
@@ -102,6 +109,81 @@ void CSinglezoneDriver::StartSolver() {
 
 }
 
+void CSinglezoneDriver::RunSweep_AoA() {
+
+  auto* config = config_container[ZONE_0];
+  auto* output = output_container[ZONE_0];
+  const auto nSweep = config->GetnSweep_AoA();
+  const auto nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  const auto nVar = GetTotalNumberOfVariables(ZONE_0, false);
+
+  /*--- Converged solutions of the conditions solved so far, to warm start the next ones. ---*/
+
+  vector<su2passivematrix> Solutions;
+  vector<su2double> SolvedAoA;
+
+  /*--- Summary of the sweep, one line per condition with the aerodynamic coefficients. ---*/
+
+  ofstream Summary;
+  if (rank == MASTER_NODE) {
+    Summary.open(config->GetConv_FileName() + "_sweep.csv");
+    Summary.precision(config->GetOutput_Precision());
+    Summary << "\"AoA\", \"Inner_Iter\", \"Converged\"";
+    for (const auto& field : output->GetHistoryGroup("AERO_COEFF")) Summary << ", \"" << field.fieldName << "\"";
+    Summary << "\n";
+  }
+
+  for (auto iSweep = 0u; iSweep < nSweep; iSweep++) {
+
+    const su2double AoA = config->GetSweep_AoA(iSweep);
+
+    if (rank == MASTER_NODE) {
+      cout << "\n------------------------ Sweep condition " << iSweep+1 << " of " << nSweep << ", AoA = "
+           << AoA << " deg ------------------------" << endl;
+    }
+
+    /*--- Update the free-stream direction, which is shared by all multigrid levels. ---*/
+
+    config->SetAoA(AoA);
+    solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->UpdateFarfieldVelocity(config);
+
+    TimeIter = 0;
+    StopCalc = false;
+    Preprocess(TimeIter);
+
+    /*--- Start from the nearest condition already solved (the initial condition of
+     *    the problem, e.g. the restart file, is only used for the first one). ---*/
+
+    if (!Solutions.empty()) {
+      unsigned long nearest = 0;
+      for (auto i = 1ul; i < SolvedAoA.size(); i++) {
+        if (fabs(SolvedAoA[i] - AoA) < fabs(SolvedAoA[nearest] - AoA)) nearest = i;
+      }
+      SetAllSolutions(ZONE_0, false, Solutions[nearest]);
+    }
+
+    Run();
+    Postprocess();
+    Update();
+    StopCalc = Monitor(TimeIter);
+    Output(TimeIter);
+
+    Solutions.emplace_back(nPoint, nVar);
+    GetAllSolutions(ZONE_0, false, Solutions.back());
+    SolvedAoA.push_back(AoA);
+
+    if (rank == MASTER_NODE) {
+      Summary << AoA << ", " << config->GetInnerIter() + 1 << ", " << output->GetConvergence();
+      for (const auto& field : output->GetHistoryGroup("AERO_COEFF")) Summary << ", " << field.value;
+      Summary << endl;
+    }
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "\nSummary of the sweep written to " << config->GetConv_FileName() << "_sweep.csv." << endl;
+  }
+}
+
 void CSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
   /*--- Set the current time iteration in the config and also in the driver
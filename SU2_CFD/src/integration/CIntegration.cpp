@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 
 CIntegration::CIntegration() {
@@ -47,21 +48,29 @@ void CIntegration::Space_Integration(CGeometry *geometry,
                     (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND));
 
   /*--- Compute inviscid residuals ---*/
-
-  switch (config->GetKind_ConvNumScheme()) {
-    case SPACE_CENTERED:
-      solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
-      break;
-    case SPACE_UPWIND:
-      solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics, config, iMesh);
-      break;
+  {
+    SU2_PROFILE_REGION("Convective residual");
+    switch (config->GetKind_ConvNumScheme()) {
+      case SPACE_CENTERED:
+        solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+        break;
+      case SPACE_UPWIND:
+        solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics, config, iMesh);
+        break;
+    }
   }
 
   /*--- Compute viscous residuals ---*/
-  solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  {
+    SU2_PROFILE_REGION("Viscous residual");
+    solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  }
 
   /*--- Compute source term residuals ---*/
-  solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  {
+    SU2_PROFILE_REGION("Source residual");
+    solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  }
 
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
 
@@ -77,6 +86,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   /// TODO: Check if this is really needed.
   //const auto pausePreacc = (omp_get_num_threads() > 1) && AD::PausePreaccumulation();
 
+  SU2_PROFILE_REGION("Boundary conditions");
+
   /*--- Boundary conditions that depend on other boundaries (they require MPI sincronization)---*/
 
   solver_container[MainSolver]->BC_Fluid_Interface(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config);
@@ -196,6 +207,8 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
 
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
 
+  SU2_PROFILE_REGION("Time integration");
+
   switch (config->GetKind_TimeIntScheme()) {
     case (RUNGE_KUTTA_EXPLICIT):
       solver_container[MainSolver]->ExplicitRK_Iteration(geometry, solver_container, config, iRKStep);
@@ -110,10 +110,9 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
 
   /*--- Computes primitive variables and gradients in the finest mesh (useful for the next solver (turbulence) and output ---*/
 
-  solver_container[iZone][iInst][MESH_0][Solver_Position]->Preprocessing(geometry[iZone][iInst][MESH_0],
-                                                                         solver_container[iZone][iInst][MESH_0],
-                                                                         config[iZone], MESH_0, NO_RK_ITER,
-                                                                         RunTime_EqSystem, true);
+  SolverPreprocessing(solver_container[iZone][iInst][MESH_0][Solver_Position], geometry[iZone][iInst][MESH_0],
+                      solver_container[iZone][iInst][MESH_0], config[iZone], MESH_0, NO_RK_ITER,
+                      RunTime_EqSystem, true);
 
   /*--- Compute non-dimensional parameters and the convergence monitor ---*/
 
@@ -176,7 +175,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       /*--- Send-Receive boundary conditions, and preprocessing ---*/
 
-      solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
+      SolverPreprocessing(solver_fine, geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
 
 
       if (iRKStep == 0) {
@@ -232,7 +231,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     /*--- Compute $r_k = P_k + F_k(u_k)$ ---*/
 
-    solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, NO_RK_ITER, RunTime_EqSystem, false);
+    SolverPreprocessing(solver_fine, geometry_fine, solver_container_fine, config, iMesh, NO_RK_ITER, RunTime_EqSystem, false);
 
     Space_Integration(geometry_fine, solver_container_fine, numerics_fine, config, iMesh, NO_RK_ITER, RunTime_EqSystem);
 
@@ -242,7 +241,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     SetRestricted_Solution(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config);
 
-    solver_coarse->Preprocessing(geometry_coarse, solver_container_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem, false);
+    SolverPreprocessing(solver_coarse, geometry_coarse, solver_container_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem, false);
 
     Space_Integration(geometry_coarse, solver_container_coarse, numerics_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem);
 
@@ -283,7 +282,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       for (unsigned short iRKStep = 0; iRKStep < iRKLimit; iRKStep++) {
 
-        solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
+        SolverPreprocessing(solver_fine, geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
 
         if (iRKStep == 0) {
           solver_fine->Set_OldSolution();
@@ -124,7 +124,7 @@ void CNewtonIntegration::ComputeResiduals(ResEvalType type) {
     SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
   }
 
-  solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+  SolverPreprocessing(solvers[FLOW_SOL], geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
 
   if (type == ResEvalType::DEFAULT) {
     solvers[FLOW_SOL]->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
@@ -258,7 +258,7 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
   /*--- Call the various post processings. ---*/
 
-  solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, true);
+  SolverPreprocessing(solvers[FLOW_SOL], geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, true);
 
   solvers[FLOW_SOL]->Postprocessing(geometry, solvers, config, MESH_0);
 
@@ -50,8 +50,8 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
 
   /*--- Preprocessing ---*/
 
-  solvers_fine[Solver_Position]->Preprocessing(geometry_fine, solvers_fine, config[iZone],
-                                               FinestMesh, 0, RunTime_EqSystem, false);
+  SolverPreprocessing(solvers_fine[Solver_Position], geometry_fine, solvers_fine, config[iZone],
+                      FinestMesh, 0, RunTime_EqSystem, false);
 
   /*--- Set the old solution ---*/
 
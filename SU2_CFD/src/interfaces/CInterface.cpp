@@ -59,6 +59,50 @@ CInterface::~CInterface() {
   delete[] SpanLevelDonor;
 }
 
+void CInterface::SetQuasiNewtonAcceleration(unsigned short nSamples) {
+  nQuasiNewtonSamples = nSamples;
+  InterfaceCorrector.clear();
+}
+
+void CInterface::ResetQuasiNewtonAcceleration() {
+  InterfaceCorrector.clear();
+}
+
+void CInterface::AccelerateDonorData(unsigned short iMarkerInt, const CSolver* donor_solution,
+                                     su2activematrix& donorVar) {
+
+  auto& corrector = InterfaceCorrector[make_pair(iMarkerInt, donor_solution)];
+
+  /*--- Allocate on first use with the size of this transfer. ---*/
+  const bool firstSample = (corrector.size() == 0);
+  if (firstSample) {
+    corrector.resize(nQuasiNewtonSamples, donorVar.rows(), donorVar.cols());
+  }
+  if (corrector.FPresult().rows() != donorVar.rows() || corrector.FPresult().cols() != donorVar.cols()) {
+    SU2_MPI::Error("The size of the data transferred through an interface changed.", CURRENT_FUNCTION);
+  }
+
+  for (auto iVertex = 0ul; iVertex < donorVar.rows(); iVertex++)
+    for (auto iVar = 0u; iVar < donorVar.cols(); iVar++)
+      corrector.FPresult(iVertex, iVar) = SU2_TYPE::GetValue(donorVar(iVertex, iVar));
+
+  /*--- The input that produced the first result is not known, so it is not a sample of the history, it is
+   * sent as is and becomes the input of the next fixed-point iteration (the first step is a plain BGS step).
+   * Taking the input equal to the result would give a secant with no change of the input, and the
+   * correction would then cancel the update. ---*/
+  if (firstSample) {
+    corrector.solution() = corrector.FPresult();
+    return;
+  }
+
+  /*--- All ranks take part in the computation, even without donor vertices, due to the reductions. ---*/
+  corrector.compute();
+
+  for (auto iVertex = 0ul; iVertex < donorVar.rows(); iVertex++)
+    for (auto iVar = 0u; iVar < donorVar.cols(); iVar++)
+      donorVar(iVertex, iVar) = corrector(iVertex, iVar);
+}
+
 void CInterface::BroadcastData(const CInterpolator& interpolator,
                                CSolver *donor_solution, CSolver *target_solution,
                                CGeometry *donor_geometry, CGeometry *target_geometry,
@@ -123,6 +167,10 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
       }
     }
 
+    /*--- Accelerate the coupling iterations by correcting the values sent by the donor. ---*/
+
+    if (quasiNewtonActive && nQuasiNewtonSamples > 1) AccelerateDonorData(iMarkerInt, donor_solution, sendDonorVar);
+
     /*--- Gather data. ---*/
 
     const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
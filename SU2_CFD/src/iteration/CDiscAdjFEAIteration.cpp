@@ -115,25 +115,39 @@ void CDiscAdjFEAIteration::LoadDynamic_Solution(CGeometry**** geometry, CSolver*
 
 void CDiscAdjFEAIteration::IterateDiscAdj(CGeometry**** geometry, CSolver***** solver, CConfig** config,
                                           unsigned short iZone, unsigned short iInst, bool CrossTerm) {
+  auto adj_solver = solver[iZone][iInst][MESH_0][ADJFEA_SOL];
+  auto geometry0 = geometry[iZone][iInst][MESH_0];
+
+  SU2_OMP_PARALLEL_(if(adj_solver->GetHasHybridParallel())) {
 
   /*--- Extract the adjoints of the conservative input variables and store them for the next iteration ---*/
 
-  solver[iZone][iInst][MESH_0][ADJFEA_SOL]->ExtractAdjoint_Solution(geometry[iZone][iInst][MESH_0], config[iZone],
-                                                                    CrossTerm);
+  adj_solver->ExtractAdjoint_Solution(geometry0, config[iZone], CrossTerm);
 
-  solver[iZone][iInst][MESH_0][ADJFEA_SOL]->ExtractAdjoint_Variables(geometry[iZone][iInst][MESH_0], config[iZone]);
+  adj_solver->ExtractAdjoint_Variables(geometry0, config[iZone]);
+
+  }
+  END_SU2_OMP_PARALLEL
 }
 
 void CDiscAdjFEAIteration::RegisterInput(CSolver***** solver, CGeometry**** geometry, CConfig** config,
                                          unsigned short iZone, unsigned short iInst, RECORDING kind_recording) {
   if (kind_recording != RECORDING::MESH_COORDS) {
+    auto adj_solver = solver[iZone][iInst][MESH_0][ADJFEA_SOL];
+    auto geometry0 = geometry[iZone][iInst][MESH_0];
+
+    SU2_OMP_PARALLEL_(if(adj_solver->GetHasHybridParallel())) {
+
     /*--- Register structural displacements as input ---*/
 
-    solver[iZone][iInst][MESH_0][ADJFEA_SOL]->RegisterSolution(geometry[iZone][iInst][MESH_0], config[iZone]);
+    adj_solver->RegisterSolution(geometry0, config[iZone]);
 
     /*--- Register variables as input ---*/
 
-    solver[iZone][iInst][MESH_0][ADJFEA_SOL]->RegisterVariables(geometry[iZone][iInst][MESH_0], config[iZone]);
+    adj_solver->RegisterVariables(geometry0, config[iZone]);
+
+    }
+    END_SU2_OMP_PARALLEL
   } else {
     /*--- Register topology optimization densities (note direct solver) ---*/
 
@@ -265,17 +279,30 @@ void CDiscAdjFEAIteration::SetDependencies(CSolver***** solver, CGeometry**** ge
 
 void CDiscAdjFEAIteration::RegisterOutput(CSolver***** solver, CGeometry**** geometry, CConfig** config,
                                           unsigned short iZone, unsigned short iInst) {
+  auto adj_solver = solver[iZone][iInst][MESH_0][ADJFEA_SOL];
+
+  SU2_OMP_PARALLEL_(if(adj_solver->GetHasHybridParallel())) {
+
   /*--- Register conservative variables as output of the iteration ---*/
 
-  solver[iZone][iInst][MESH_0][ADJFEA_SOL]->RegisterOutput(geometry[iZone][iInst][MESH_0], config[iZone]);
+  adj_solver->RegisterOutput(geometry[iZone][iInst][MESH_0], config[iZone]);
+
+  }
+  END_SU2_OMP_PARALLEL
 }
 
 void CDiscAdjFEAIteration::InitializeAdjoint(CSolver***** solver, CGeometry**** geometry, CConfig** config,
                                              unsigned short iZone, unsigned short iInst) {
   /*--- Initialize the adjoints the conservative variables ---*/
 
+  auto adj_solver = solver[iZone][iInst][MESH_0][ADJFEA_SOL];
+
   AD::ResizeAdjoints();
-  solver[iZone][iInst][MESH_0][ADJFEA_SOL]->SetAdjoint_Output(geometry[iZone][iInst][MESH_0], config[iZone]);
+
+  SU2_OMP_PARALLEL_(if(adj_solver->GetHasHybridParallel())) {
+    adj_solver->SetAdjoint_Output(geometry[iZone][iInst][MESH_0], config[iZone]);
+  }
+  END_SU2_OMP_PARALLEL
 }
 
 bool CDiscAdjFEAIteration::Monitor(COutput* output, CIntegration**** integration, CGeometry**** geometry,
@@ -123,8 +123,22 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
   /*--- Incorporate a weakly-coupled radiation model to the analysis ---*/
   if (config[val_iZone]->AddRadiation()) {
     config[val_iZone]->SetGlobalParam(main_solver, RUNTIME_RADIATION_SYS);
-    integration[val_iZone][val_iInst][RAD_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
-                                                                     RUNTIME_RADIATION_SYS, val_iZone, val_iInst);
+
+    /*--- Once the radiation field changes little, only solve for it every few flow iterations,
+     * in between, just update the source term with the current temperature. ---*/
+    auto rad_solver = solver[val_iZone][val_iInst][MESH_0][RAD_SOL];
+    const auto rad_freq = config[val_iZone]->GetRad_Update_Freq();
+    const bool skip_rad = !disc_adj && (rad_freq > 1) && (InnerIter % rad_freq != 0) &&
+                          (log10(rad_solver->GetRes_RMS(0)) < config[val_iZone]->GetRad_Update_Residual());
+
+    if (skip_rad) {
+      rad_solver->Postprocessing(geometry[val_iZone][val_iInst][MESH_0], solver[val_iZone][val_iInst][MESH_0],
+                                 config[val_iZone], MESH_0);
+    }
+    else {
+      integration[val_iZone][val_iInst][RAD_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
+                                                                       RUNTIME_RADIATION_SYS, val_iZone, val_iInst);
+    }
   }
 
   /*--- Adapt the CFL number using an exponential progression with under-relaxation approach. ---*/
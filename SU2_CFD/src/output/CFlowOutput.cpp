@@ -31,6 +31,7 @@
 #include <iomanip>
 
 #include "../../include/output/CFlowOutput.hpp"
+#include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
@@ -1148,6 +1149,18 @@ void CFlowOutput::AddHistoryOutputFieldsScalarLinsol(const CConfig* config) {
     case SPECIES_MODEL::NONE: break;
   }
 }
+
+void CFlowOutput::AddHistoryOutputFieldsCostControl(const CConfig* config) {
+  if (!config->GetCFL_Adapt() || !config->GetCFL_Adapt_Cost()) return;
+
+  /// BEGIN_GROUP: CFL_COST, DESCRIPTION: Settings chosen by the cost-aware CFL adaption (CFL_ADAPT_COST= YES).
+  AddHistoryOutput("CFL_LIMIT", "CFL Limit", ScreenOutputFormat::SCIENTIFIC, "CFL_COST", "Upper limit of the local CFL numbers.");
+  AddHistoryOutput("LINSOL_TOL", "LinSolTol", ScreenOutputFormat::SCIENTIFIC, "CFL_COST", "Tolerance of the linear solvers.");
+  AddHistoryOutput("LINSOL_MAX_ITER", "LinSolMaxIter", ScreenOutputFormat::INTEGER, "CFL_COST", "Maximum number of iterations of the linear solvers.");
+  AddHistoryOutput("PREC_PERIOD", "PrecPeriod", ScreenOutputFormat::INTEGER, "CFL_COST", "Linear solves between preconditioner builds.");
+  AddHistoryOutput("CONV_RATE", "ConvRate", ScreenOutputFormat::SCIENTIFIC, "CFL_COST", "Average reduction of the RMS residuals in the last window, in orders of magnitude per second.");
+  /// END_GROUP
+}
 // clang-format on
 
 void CFlowOutput::LoadHistoryDataScalar(const CConfig* config, const CSolver* const* solver) {
@@ -1237,6 +1250,18 @@ void CFlowOutput::LoadHistoryDataScalar(const CConfig* config, const CSolver* co
   }
 }
 
+void CFlowOutput::LoadHistoryDataCostControl(const CConfig* config, const CSolver* flow_solver) {
+  if (!config->GetCFL_Adapt() || !config->GetCFL_Adapt_Cost()) return;
+
+  using Control = CCFLCostController;
+  const auto& control = flow_solver->GetCostController();
+  SetHistoryOutputValue("CFL_LIMIT", control.GetValue(Control::CFL_MAX));
+  SetHistoryOutputValue("LINSOL_TOL", control.GetValue(Control::LINSOL_TOL));
+  SetHistoryOutputValue("LINSOL_MAX_ITER", control.GetValue(Control::LINSOL_ITER));
+  SetHistoryOutputValue("PREC_PERIOD", control.GetValue(Control::PREC_PERIOD));
+  SetHistoryOutputValue("CONV_RATE", control.GetRate());
+}
+
 void CFlowOutput::SetVolumeOutputFieldsScalarSolution(const CConfig* config){
   /*--- Only place outputs of the "SOLUTION" group here. ---*/
 
@@ -2353,6 +2378,28 @@ void CFlowOutput::WriteAdditionalFiles(CConfig *config, CGeometry *geometry, CSo
 
 }
 
+void CFlowOutput::WriteSnapshotFiles(CConfig *config, CGeometry *geometry, CSolver **solver_container){
+
+  if (!config->GetSave_libROM()) return;
+
+  /*--- Load and sort the data again, as no volume files may have been written for the final solution. ---*/
+
+  LoadDataIntoSorter(config, geometry, solver_container);
+  volumeDataSorter->SortOutputData();
+
+  ostringstream fileName;
+  fileName << config->GetlibROMbase_FileName() << "_snapshot_" << setw(5) << setfill('0') << nSnapshot;
+
+  if (rank == MASTER_NODE) {
+    cout << "Writing ROM snapshot: " << fileName.str() << CSU2BinaryFileWriter::fileExt << endl;
+  }
+
+  CSU2BinaryFileWriter fileWriter(volumeDataSorter);
+  fileWriter.WriteData(fileName.str());
+
+  ++nSnapshot;
+}
+
 void CFlowOutput::WriteMetaData(const CConfig *config){
 
   ofstream meta_file;
@@ -29,6 +29,7 @@
 #include "../../include/solvers/CSolver.hpp"
 
 #include "../../include/output/COutput.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 #include "../../include/output/filewriter/CFVMDataSorter.hpp"
 #include "../../include/output/filewriter/CFEMDataSorter.hpp"
 #include "../../include/output/filewriter/CCGNSFileWriter.hpp"
@@ -190,6 +191,8 @@ void COutput::SetHistoryOutput(CGeometry *geometry,
                                   unsigned long OuterIter,
                                   unsigned long InnerIter) {
 
+  SU2_PROFILE_REGION("History output");
+
   curTimeIter  = TimeIter;
   curAbsTimeIter = TimeIter - config->GetRestart_Iter();
   curOuterIter = OuterIter;
@@ -209,6 +212,10 @@ void COutput::SetHistoryOutput(CGeometry *geometry,
 
   OutputScreenAndHistory(config);
 
+  /*--- In multizone problems the profile is written by the driver output, per outer iteration. ---*/
+
+  if (!multiZone) WriteProfilingFile(config, config->GetTime_Domain() ? curTimeIter : curInnerIter);
+
 }
 
 void COutput::SetHistoryOutput(CGeometry *geometry,
@@ -247,6 +254,19 @@ void COutput::SetMultizoneHistoryOutput(COutput **output, CConfig **config, CCon
 
   OutputScreenAndHistory(driver_config);
 
+  WriteProfilingFile(driver_config, driver_config->GetTime_Domain() ? curTimeIter : curOuterIter);
+
+}
+
+void COutput::WriteProfilingFile(const CConfig *config, unsigned long Iter) {
+
+  /*--- Only once per iteration, the history of unsteady problems is updated every inner iteration. ---*/
+
+  const auto freq = config->GetProfiling_Freq();
+  if (!CProfiler::IsEnabled() || freq == 0 || Iter % freq != 0 || Iter == lastProfilingIter) return;
+  lastProfilingIter = Iter;
+
+  CProfiler::Write(config->GetProfiling_FileName(), config->GetProfiling_Format(), to_string(Iter));
 }
 
 void COutput::OutputScreenAndHistory(CConfig *config) {
@@ -760,6 +780,8 @@ bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
 bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing) {
 
+  SU2_PROFILE_REGION("Output");
+
   bool isFileWrite = false, dataIsLoaded = false;
   const auto nVolumeFiles = config->GetnVolumeOutputFiles();
   const auto* VolumeFiles = config->GetVolumeOutputFiles();
@@ -807,6 +829,12 @@ bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** sol
     headerNeeded = true;
   }
 
+  /*--- Snapshots are only taken of the final solution of steady problems. ---*/
+
+  if (force_writing && !config->GetTime_Domain()) {
+    WriteSnapshotFiles(config, geometry, solver_container);
+  }
+
   return isFileWrite;
 }
 
@@ -1547,6 +1575,11 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
   curGetFieldIndex = 0;
   fieldGetIndexCache.clear();
 
+  /*--- The hyper-reduced ROM only updates the solution where the residual is sampled. ---*/
+  if (!femOutput && (solver[FLOW_SOL] != nullptr)) {
+    solver[FLOW_SOL]->ReconstructFullSolution(geometry, solver, config);
+  }
+
   if (femOutput){
 
     /*--- Create an object of the class CMeshFEM_DG and retrieve the necessary
@@ -2015,6 +2048,21 @@ void COutput::SetCommonHistoryFields() {
 
   AddHistoryOutput("NONPHYSICAL_POINTS", "Nonphysical_Points", ScreenOutputFormat::INTEGER, "NONPHYSICAL_POINTS", "The number of non-physical points in the solution");
 
+  /// BEGIN_GROUP: PERF_TIME, DESCRIPTION: Time breakdown since the previous history evaluation (requires PROFILING= YES).
+  AddHistoryOutput("TIME_ITERATION", "Time_Iter(s)", ScreenOutputFormat::SCIENTIFIC, "PERF_TIME", "Wall-clock time since the previous history evaluation (max over ranks).");
+  AddHistoryOutput("TIME_RESIDUAL", "Time_Res(s)", ScreenOutputFormat::SCIENTIFIC, "PERF_TIME", "Time in preprocessing, residual, and boundary conditions (max over ranks).");
+  AddHistoryOutput("TIME_LINSOL", "Time_LinSol(s)", ScreenOutputFormat::SCIENTIFIC, "PERF_TIME", "Time in the linear solvers (max over ranks).");
+  AddHistoryOutput("TIME_COMMS", "Time_Comms(s)", ScreenOutputFormat::SCIENTIFIC, "PERF_TIME", "Time in point-to-point MPI communications (max over ranks).");
+  AddHistoryOutput("TIME_MPI_WAIT", "Time_Wait(s)", ScreenOutputFormat::SCIENTIFIC, "PERF_TIME", "Time waiting for MPI messages, part of TIME_COMMS (max over ranks).");
+  AddHistoryOutput("TIME_OUTPUT", "Time_Output(s)", ScreenOutputFormat::SCIENTIFIC, "PERF_TIME", "Time writing history, screen, and solution output (max over ranks).");
+  /// END_GROUP
+
+  /// BEGIN_GROUP: PERF_RATE, DESCRIPTION: Achieved rates since the previous history evaluation (requires PROFILING= YES).
+  AddHistoryOutput("BANDWIDTH_SPMV", "BW_SpMV(GB/s)", ScreenOutputFormat::FIXED, "PERF_RATE", "Memory bandwidth of the sparse matrix-vector products (min over ranks).");
+  AddHistoryOutput("GFLOPS_SPMV", "GFLOPs_SpMV", ScreenOutputFormat::FIXED, "PERF_RATE", "GFLOP/s of the sparse matrix-vector products (min over ranks).");
+  AddHistoryOutput("BANDWIDTH_EDGE", "BW_Edge(GB/s)", ScreenOutputFormat::FIXED, "PERF_RATE", "Memory bandwidth of the vectorized edge flux loops (min over ranks).");
+  /// END_GROUP
+
 }
 
 void COutput::SetCustomOutputs(const CConfig* config) {
@@ -2205,6 +2253,61 @@ void COutput::LoadCommonHistoryData(const CConfig *config) {
   SetHistoryOutputValue("WALL_TIME", UsedTime);
 
   SetHistoryOutputValue("NONPHYSICAL_POINTS", config->GetNonphysical_Points());
+
+  LoadPerformanceHistoryData(config);
+}
+
+void COutput::LoadPerformanceHistoryData(const CConfig *config) {
+
+  if (!CProfiler::IsEnabled()) return;
+
+  /*--- Cumulative totals of the profiler regions of this rank, the regions are not nested in each other
+   *    except for "MPI comms" and "MPI wait", which are part of the other regions. ---*/
+
+  auto time = [](const char* name) { return CProfiler::GetTotals(name).time; };
+  const auto spmv = CProfiler::GetTotals("SpMV");
+  const auto edge = CProfiler::GetTotals("Edge loop");
+
+  const vector<passivedouble> totals = {
+    SU2_MPI::Wtime(),
+    time("Preprocessing") + time("Convective residual") + time("Viscous residual") + time("Source residual") +
+      time("Boundary conditions"),
+    time("Linear solver"),
+    time("MPI comms"),
+    time("MPI wait"),
+    time("Output") + time("History output"),
+    spmv.time, spmv.bytes, spmv.flops,
+    edge.time, edge.bytes};
+
+  if (perfTotals.empty()) {
+    perfTotals.resize(totals.size(), 0.0);
+    perfTotals[0] = SU2_TYPE::GetValue(config->Get_StartTime());
+  }
+
+  vector<passivedouble> delta(totals.size());
+  for (auto i = 0ul; i < totals.size(); ++i) delta[i] = totals[i] - perfTotals[i];
+  perfTotals = totals;
+
+  /*--- Times are reduced with MAX and rates with MIN, the slowest rank stands out in both. ---*/
+
+  auto rate = [](passivedouble work, passivedouble time) { return (time > 0) ? 1e-9 * work / time : 0.0; };
+
+  passivedouble localTimes[] = {delta[0], delta[1], delta[2], delta[3], delta[4], delta[5]};
+  passivedouble localRates[] = {rate(delta[7], delta[6]), rate(delta[8], delta[6]), rate(delta[10], delta[9])};
+  passivedouble times[6], rates[3];
+
+  SelectMPIWrapper<passivedouble>::W::Allreduce(localTimes, times, 6, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  SelectMPIWrapper<passivedouble>::W::Allreduce(localRates, rates, 3, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+
+  SetHistoryOutputValue("TIME_ITERATION", times[0]);
+  SetHistoryOutputValue("TIME_RESIDUAL", times[1]);
+  SetHistoryOutputValue("TIME_LINSOL", times[2]);
+  SetHistoryOutputValue("TIME_COMMS", times[3]);
+  SetHistoryOutputValue("TIME_MPI_WAIT", times[4]);
+  SetHistoryOutputValue("TIME_OUTPUT", times[5]);
+  SetHistoryOutputValue("BANDWIDTH_SPMV", rates[0]);
+  SetHistoryOutputValue("GFLOPS_SPMV", rates[1]);
+  SetHistoryOutputValue("BANDWIDTH_EDGE", rates[2]);
 }
 
 
@@ -26,6 +26,7 @@
  */
 
 #include "../../../include/output/filewriter/CParallelDataSorter.hpp"
+#include "../../../../Common/include/toolboxes/CMemoryTracker.hpp"
 #include <cassert>
 #include <numeric>
 
@@ -89,6 +90,7 @@ CParallelDataSorter::~CParallelDataSorter(){
   delete [] dataBuffer;
   delete [] Index;
   delete [] idSend;
+  CMemoryTracker::Account("Output sorters", -bufferBytes);
 
 }
 
@@ -304,6 +306,13 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
 
   Index = new unsigned long[nLocalPointsBeforeSort]();
 
+  /*--- Account for the buffers in the memory report. ---*/
+
+  CMemoryTracker::Account("Output sorters", -bufferBytes);
+  bufferBytes = sizeof(passivedouble) * VARS_PER_POINT * (nPoint_Send[size] + nPoint_Recv[size]) +
+                sizeof(unsigned long) * (nPoint_Send[size] + nLocalPointsBeforeSort);
+  CMemoryTracker::Account("Output sorters", bufferBytes);
+
   /*--- Loop through our elements and load the elems and their
    additional data that we will send to the other procs. ---*/
 
@@ -47,6 +47,8 @@ CDiscAdjFEASolver::CDiscAdjFEASolver(CGeometry *geometry, CConfig *config, CSolv
   nPoint       = geometry->GetnPoint();
   nPointDomain = geometry->GetnPointDomain();
 
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+
   /*--- Define some auxiliary vectors related to the residual ---*/
 
   Residual_RMS.resize(nVar,1.0);
@@ -126,17 +128,21 @@ void CDiscAdjFEASolver::SetRecording(CGeometry* geometry, CConfig *config){
 
   /*--- Reset the solution to the initial (converged) solution ---*/
 
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
     for (auto iVar = 0u; iVar < nVar; iVar++)
       direct_solver->GetNodes()->SetSolution(iPoint, iVar, nodes->GetSolution_Direct(iPoint)[iVar]);
   }
+  END_SU2_OMP_FOR
 
   /*--- Reset the input for time n ---*/
 
   if (config->GetTime_Domain()) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
       for (auto iVar = 0u; iVar < nVar; iVar++)
         AD::ResetInput(direct_solver->GetNodes()->GetSolution_time_n(iPoint)[iVar]);
+    END_SU2_OMP_FOR
   }
 
   /*--- Set indices to zero ---*/
@@ -173,6 +179,8 @@ void CDiscAdjFEASolver::RegisterVariables(CGeometry *geometry, CConfig *config,
 
     const bool pseudo_static = config->GetPseudoStatic();
 
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+
     for (iVar = 0; iVar < nMPROP; iVar++) {
       E[iVar]      = config->GetElasticyMod(iVar);
       Nu[iVar]     = config->GetPoissonRatio(iVar);
@@ -200,6 +208,9 @@ void CDiscAdjFEASolver::RegisterVariables(CGeometry *geometry, CConfig *config,
       if (fea_dv) DV.Register();
     }
 
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
     /*--- Register or reset the flow tractions ---*/
     if (config->GetnMarker_Fluid_Load() > 0) {
       direct_solver->GetNodes()->RegisterFlowTraction(reset);
@@ -230,43 +241,50 @@ void CDiscAdjFEASolver::ExtractAdjoint_Solution(CGeometry *geometry, CConfig *co
 
   if (!config->GetMultizone_Problem()) nodes->Set_OldSolution();
 
-  /*--- Extract and store the adjoint solution ---*/
+  /*--- Thread-local residual variables. ---*/
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  unsigned long idxMax[MAXNVAR] = {0};
+
+  /*--- Extract and store the adjoint solution, compute the residuals. ---*/
 
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
     su2double Solution[MAXNVAR] = {0.0};
     direct_solver->GetNodes()->GetAdjointSolution(iPoint,Solution);
     nodes->SetSolution(iPoint,Solution);
+
+    if (CrossTerm || iPoint >= nPointDomain) continue;
+
+    for (auto iVar = 0u; iVar < nVar; iVar++) {
+      su2double residual = Solution[iVar] - nodes->GetSolution_Old(iPoint, iVar);
+      ResidualReductions_PerThread(iPoint,iVar,residual,resRMS,resMax,idxMax);
+    }
   }
+  END_SU2_OMP_FOR
 
   if (CrossTerm) return;
 
   /*--- Extract and store the adjoint solution at time n (including accel. and velocity) ---*/
 
   if (config->GetTime_Domain()) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
       su2double Solution[MAXNVAR] = {0.0};
       direct_solver->GetNodes()->GetAdjointSolution_time_n(iPoint,Solution);
       nodes->Set_Solution_time_n(iPoint,Solution);
     }
+    END_SU2_OMP_FOR
   }
 
-  /*--- Set the residuals ---*/
-
-  SetResToZero();
+  /*--- "Add" residuals from all threads to global residual variables. ---*/
 
-  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
-    for (auto iVar = 0u; iVar < nVar; iVar++){
-      su2double residual = nodes->GetSolution(iPoint, iVar) - nodes->GetSolution_Old(iPoint, iVar);
+  ResidualReductions_FromAllThreads(geometry, config, resRMS,resMax,idxMax);
 
-      Residual_RMS[iVar] += residual*residual;
-      AddRes_Max(iVar,fabs(residual),geometry->nodes->GetGlobalIndex(iPoint),geometry->nodes->GetCoord(iPoint));
-    }
+  SU2_OMP_MASTER {
+    SetIterLinSolver(direct_solver->System.GetIterations());
+    SetResLinSolver(direct_solver->System.GetResidual());
   }
-
-  SetResidual_RMS(geometry, config);
-
-  SetIterLinSolver(direct_solver->System.GetIterations());
-  SetResLinSolver(direct_solver->System.GetResidual());
+  END_SU2_OMP_MASTER
 
 }
 
@@ -276,22 +294,27 @@ void CDiscAdjFEASolver::ExtractAdjoint_Variables(CGeometry *geometry, CConfig *c
 
   /*--- Sensitivities of material properties and design variables. ---*/
 
-  E.GetDerivative();
-  Nu.GetDerivative();
-  Rho.GetDerivative();
-  Rho_DL.GetDerivative();
-  if (de_effects) EField.GetDerivative();
-  if (fea_dv) DV.GetDerivative();
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    E.GetDerivative();
+    Nu.GetDerivative();
+    Rho.GetDerivative();
+    Rho_DL.GetDerivative();
+    if (de_effects) EField.GetDerivative();
+    if (fea_dv) DV.GetDerivative();
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
   /*--- Extract the flow traction sensitivities. ---*/
 
   if (config->GetnMarker_Fluid_Load() > 0) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
     for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++){
       for (unsigned short iDim = 0; iDim < nDim; iDim++){
         su2double val_sens = direct_solver->GetNodes()->ExtractFlowTractionSensitivity(iPoint,iDim);
         nodes->SetFlowTractionSensitivity(iPoint, iDim, val_sens);
       }
     }
+    END_SU2_OMP_FOR
   }
 
 }
@@ -302,11 +325,11 @@ void CDiscAdjFEASolver::SetAdjoint_Output(CGeometry *geometry, CConfig *config){
   const bool deform_mesh = (config->GetnMarker_Deform_Mesh() > 0);
   const bool multizone = config->GetMultizone_Problem();
 
-  su2double Solution[MAXNVAR] = {0.0};
-
-  unsigned short iVar;
-
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint++){
+    su2double Solution[MAXNVAR] = {0.0};
+    unsigned short iVar;
+
     for (iVar = 0; iVar < nVar; iVar++)
       Solution[iVar] = nodes->GetSolution(iPoint,iVar);
 
@@ -327,14 +350,17 @@ void CDiscAdjFEASolver::SetAdjoint_Output(CGeometry *geometry, CConfig *config){
 
     direct_solver->GetNodes()->SetAdjointSolution(iPoint,Solution);
   }
+  END_SU2_OMP_FOR
 }
 
 void CDiscAdjFEASolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config_container, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output){
 
   if (config_container->GetTime_Domain()) {
+    SU2_OMP_PARALLEL_(for schedule(static,omp_chunk_size))
     for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
       for (auto iVar=0u; iVar < nVar; iVar++)
         nodes->SetDual_Time_Derivative(iPoint, iVar, nodes->GetSolution_time_n(iPoint, iVar));
+    END_SU2_OMP_PARALLEL
   }
 }
 
@@ -1660,10 +1660,14 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, c
    *    further reduction if function is called in parallel ---*/
   unsigned long nonPhysicalPoints = 0;
 
+  /*--- All points, or those needed by the hyper-reduced ROM. ---*/
+  const IndexSubset<> points(GetStatePoints(), nPoint);
+
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  SU2_OMP_FOR_STAT_PROFILED("Point loops", omp_chunk_size)
+  for (unsigned long k = 0; k < points.size; k++) {
+    const auto iPoint = points[k];
 
     /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
 
@@ -1674,7 +1678,7 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, c
 
     if (!physical) nonPhysicalPoints++;
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
   AD::EndNoSharedReading();
 
@@ -1778,11 +1782,13 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
   else AD::StartNoSharedReading();
 
+  EdgeLoopTuningStart();
+
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
+  ForEachEdgeColor([&](const auto& color)
   {
   /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  SU2_OMP_FOR_DYN_PROFILED("Edge colors", nextMultiple(OMP_MIN_SIZE, color.groupSize))
   for(auto k = 0ul; k < color.size; ++k) {
 
     auto iEdge = color.indices[k];
@@ -1951,8 +1957,10 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
     Viscous_Residual(iEdge, geometry, solver_container,
                      numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
   }
-  END_SU2_OMP_FOR
-  } // end color loop
+  END_SU2_OMP_FOR_PROFILED
+  }); // end color loop
+
+  EdgeLoopTuningStop(*geometry);
 
   FinalizeResidualComputation(geometry, pausePreacc, counter_local, config);
 }
@@ -4306,7 +4314,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_DYN_PROFILED("Boundary loops", OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -4528,7 +4536,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
     }
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
   /*--- Free locally allocated memory ---*/
   delete [] Normal;
@@ -6502,7 +6510,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_DYN_PROFILED("Boundary loops", OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Allocate the value at the inlet ---*/
@@ -6781,7 +6789,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
     }
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
 }
 
@@ -6805,7 +6813,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_DYN_PROFILED("Boundary loops", OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     /*--- Allocate the value at the outlet ---*/
@@ -6952,7 +6960,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
     }
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
   /*--- Free locally allocated memory ---*/
   delete [] Normal;
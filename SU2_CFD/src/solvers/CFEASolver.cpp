@@ -161,6 +161,11 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CFEASolverBase(ge
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysReact.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  /*--- The linear stiffness matrix is symmetric (BCs are enforced symmetrically), this allows the
+   * discrete adjoint to reuse the primal preconditioner instead of transposing the matrix (opt-in). ---*/
+  System.SetSymmetricSystem(config->GetGeometricConditions() == STRUCT_DEFORMATION::SMALL &&
+                            config->GetDiscAdj_Reuse_Primal_Prec());
+
   /*--- Initialize structures for hybrid-parallel mode. ---*/
   HybridParallelInitialization(geometry);
 
@@ -2576,8 +2581,9 @@ void CFEASolver::ComputeAitken_Coefficient(CGeometry *geometry, const CConfig *c
 
   /*--- Only when there is movement, and a dynamic coefficient is requested, it makes sense to compute the Aitken's coefficient ---*/
 
-  if (RelaxMethod_FSI == BGS_RELAXATION::NONE) {
+  if (RelaxMethod_FSI == BGS_RELAXATION::NONE || RelaxMethod_FSI == BGS_RELAXATION::IQN_ILS) {
 
+    /*--- With IQN-ILS the relaxation is applied by the interface to the transferred displacements. ---*/
     WAitken_Dyn = 1.0;
 
   }
@@ -3209,7 +3215,6 @@ void CFEASolver::FilterElementDensities(CGeometry *geometry, const CConfig *conf
   physical densities which are the ones used to penalize their stiffness. ---*/
 
   ENUM_PROJECTION_FUNCTION type;
-  unsigned short search_lim;
   su2double param, radius;
 
   vector<pair<ENUM_FILTER_KERNEL,su2double> > kernels;
@@ -3221,7 +3226,6 @@ void CFEASolver::FilterElementDensities(CGeometry *geometry, const CConfig *conf
     kernels.emplace_back(type,param);
     filter_radius.push_back(radius);
   }
-  search_lim = config->GetTopology_Search_Limit();
   config->GetTopology_Optim_Projection(type,param);
 
   auto *physical_rho = new su2double [nElement];
@@ -3237,7 +3241,7 @@ void CFEASolver::FilterElementDensities(CGeometry *geometry, const CConfig *conf
   }
   END_SU2_OMP_PARALLEL
 
-  geometry->FilterValuesAtElementCG(filter_radius, kernels, search_lim, physical_rho);
+  geometry->FilterValuesAtElementCG(filter_radius, kernels, physical_rho);
 
   SU2_OMP_PARALLEL
   {
@@ -108,8 +108,15 @@ CGradientSmoothingSolver::CGradientSmoothingSolver(CGeometry *geometry, CConfig
   /*--- initializations for linear equation systems ---*/
   if ( !config->GetSmoothOnSurface() ) {
     nVar = config->GetSmoothSepDim() ? 1 : nDim;
-    LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
-    LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
+
+    /*--- With point-wise preconditioners the separated dimensions share the scalar operator
+     *    and are solved together, i.e. the vectors hold nDim right-hand sides. ---*/
+    const auto prec = config->GetKind_Grad_Linear_Solver_Prec();
+    batchedDims = config->GetSmoothSepDim() && (prec == JACOBI || prec == AMG);
+    const auto nVarVec = batchedDims ? nDim : nVar;
+
+    LinSysSol.Initialize(nPoint, nPointDomain, nVarVec, 0.0);
+    LinSysRes.Initialize(nPoint, nPointDomain, nVarVec, 0.0);
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config, false, true);
   } else {
     if (config->GetSobMode() == ENUM_SOBOLEV_MODUS::PARAM_LEVEL_COMPLETE) {
@@ -174,16 +181,25 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingVolume(CGeometry* geometry,
   /*--- current dimension if we run consecutive on each dimension ---*/
   unsigned int iDim = 0;
 
-  /*--- Set vector and sparse matrix to 0 ---*/
+  /*--- Set vectors to 0, the sparse matrix is only reassembled if the mesh changed. ---*/
   LinSysSol.SetValZero();
   LinSysRes.SetValZero();
-  Jacobian.SetValZero();
 
-  /*--- Compute the stiffness matrix for the smoothing operator. ---*/
-  Compute_StiffMatrix(geometry, numerics, config);
+  const bool reuseOperator = OperatorIsCurrent(geometry);
+
+  if (!reuseOperator) {
+    Jacobian.SetValZero();
 
-  /*--- Impose boundary conditions to the RHS and solve the system. ---*/
-  if (config->GetSmoothSepDim()) {
+    /*--- Compute the stiffness matrix for the smoothing operator,
+     *    the operator is isotropic, all dimensions share the same matrix. ---*/
+    SetCurrentDim(0);
+    Compute_StiffMatrix(geometry, numerics, config);
+  }
+  System.SetReusePreconditioner(reuseOperator);
+
+  /*--- Impose boundary conditions to the RHS and solve the system.
+   *    The BC only enforce zeros, imposing them again on a reused matrix does not change it. ---*/
+  if (config->GetSmoothSepDim() && !batchedDims) {
     for (iDim = 0; iDim < nDim ; iDim++) {
 
       SetCurrentDim(iDim);
@@ -198,6 +214,9 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingVolume(CGeometry* geometry,
 
       LinSysSol.SetValZero();
       LinSysRes.SetValZero();
+
+      /*--- The matrix is the same for the remaining dimensions. ---*/
+      System.SetReusePreconditioner(true);
     }
 
   } else {
@@ -209,21 +228,30 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingVolume(CGeometry* geometry,
 
     WriteSensitivity(geometry, config);
   }
+
+  /*--- Reuse is decided again by each smoothing, it must not leak into other solves. ---*/
+  System.SetReusePreconditioner(false);
 }
 
 void CGradientSmoothingSolver::ApplyGradientSmoothingSurface(CGeometry* geometry, CNumerics* numerics,
                                                              const CConfig* config) {
-  /*--- Set vector and sparse matrix to 0 ---*/
+  /*--- Set vectors to 0, the sparse matrix is only reassembled if the mesh changed. ---*/
   LinSysSol.SetValZero();
   LinSysRes.SetValZero();
-  Jacobian.SetValZero();
-  std::fill(visited.begin(), visited.end(), false);
+
+  const bool reuseOperator = OperatorIsCurrent(geometry);
+
+  if (!reuseOperator) {
+    Jacobian.SetValZero();
+    std::fill(visited.begin(), visited.end(), false);
+  }
+  System.SetReusePreconditioner(reuseOperator);
 
   /*--- Loop over all DV markers to compute the stiffness matrix for the smoothing operator. ---*/
   for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_DV(iMarker) == YES) {
       /*--- Compute the stiffness matrix for the smoothing operator. ---*/
-      Compute_Surface_StiffMatrix(geometry, numerics, config, iMarker);
+      if (!reuseOperator) Compute_Surface_StiffMatrix(geometry, numerics, config, iMarker);
 
       Compute_Surface_Residual(geometry, config, iMarker);
 
@@ -234,12 +262,14 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingSurface(CGeometry* geometry
   }
 
   /*--- Set the matrix to identity if the current mpi rank holds no part of the DV marker. ---*/
-  Complete_Surface_StiffMatrix(geometry);
+  if (!reuseOperator) Complete_Surface_StiffMatrix(geometry);
 
   /*--- Solve the system and write the result back. ---*/
   Solve_Linear_System(geometry, config);
 
   WriteSensitivity(geometry, config);
+
+  System.SetReusePreconditioner(false);
 }
 
 void CGradientSmoothingSolver::ApplyGradientSmoothingDV(CGeometry* geometry, CNumerics* numerics,
@@ -254,9 +284,6 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingDV(CGeometry* geometry, CNu
   vector<su2double> x(nDVtotal, 0.0);
   hessian.Initialize(nDVtotal);
 
-  /*--- Reset the Jacobian to 0 ---*/
-  Jacobian.SetValZero();
-
   /*--- Record the parameterization on the AD tape. ---*/
   if (rank == MASTER_NODE)  cout << " calculate the original gradient" << endl;
   RecordParameterizationJacobian(geometry, surface_movement, activeCoord, config);
@@ -360,6 +387,34 @@ void CGradientSmoothingSolver::ApplyGradientSmoothingDV(CGeometry* geometry, CNu
   deltaP = x;
 
   OutputDVGradient(config);
+
+  /*--- The operator of the matrix-vector product is not the one the preconditioner was built for (e.g. the surface
+   *    version has nDim components), the next smoothing must assemble the matrix and build the preconditioner. ---*/
+  assembledCoord.resize(0, 0);
+  System.SetReusePreconditioner(false);
+}
+
+bool CGradientSmoothingSolver::OperatorIsCurrent(const CGeometry* geometry) {
+  bool current = (assembledCoord.rows() == nPoint);
+
+  for (auto iPoint = 0ul; current && iPoint < nPoint; iPoint++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      current &= (assembledCoord(iPoint, iDim) == SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim)));
+    }
+  }
+
+  /*--- The decision must be the same on all ranks, the preconditioners may communicate. ---*/
+  int local = current, global = 0;
+  SU2_MPI::Allreduce(&local, &global, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  current = global;
+
+  if (!current) {
+    assembledCoord.resize(nPoint, nDim);
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iDim = 0u; iDim < nDim; iDim++)
+        assembledCoord(iPoint, iDim) = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+  }
+  return current;
 }
 
 void CGradientSmoothingSolver::Compute_StiffMatrix(CGeometry* geometry, CNumerics* numerics, const CConfig* config) {
@@ -523,7 +578,7 @@ void CGradientSmoothingSolver::Compute_Residual(CGeometry* geometry, const CConf
       Jac_X = element_container[GRAD_TERM][EL_KIND]->GetJ_X(iGauss);
 
       for (unsigned int iNode = 0; iNode < nNodes; iNode++) {
-        if (config->GetSmoothSepDim()) {
+        if (config->GetSmoothSepDim() && !batchedDims) {
           Residual[GetCurrentDim()] +=
               Weight * Jac_X * element_container[GRAD_TERM][EL_KIND]->GetNi(iNode, iGauss) * nodes->GetSensitivity(indexNode[iNode], GetCurrentDim());
           LinSysRes.AddBlock(indexNode[iNode], &Residual[GetCurrentDim()]);
@@ -682,7 +737,13 @@ CSysMatrixVectorProduct<scalar_type> CGradientSmoothingSolver::GetStiffnessMatri
                                                                                                CNumerics* numerics,
                                                                                                const CConfig* config) {
 
-  /*--- Compute the sparse stiffness matrix ---*/
+  /*--- Compute the sparse stiffness matrix, unless the one of the previous design iteration is still valid. ---*/
+  if (OperatorIsCurrent(geometry)) {
+    return CSysMatrixVectorProduct<scalar_type>(Jacobian, geometry, config);
+  }
+
+  Jacobian.SetValZero();
+
   if (config->GetSmoothOnSurface()) {
     for (unsigned int iMarker = 0; iMarker < config->GetnMarker_CfgFile(); iMarker++) {
       if (config->GetMarker_All_DV(iMarker) == YES) {
@@ -935,7 +996,7 @@ void CGradientSmoothingSolver::WriteSensitivity(CGeometry* geometry, const CConf
       }
     }
   } else {
-    if (config->GetSmoothSepDim()) {
+    if (config->GetSmoothSepDim() && !batchedDims) {
       for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
         nodes->SetSensitivity(iPoint, GetCurrentDim(), LinSysSol[iPoint]);
       }
@@ -203,13 +203,9 @@ void CHeatSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
     skipVars += 1 + nDim;
   }
 
-  /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
+  /*--- Read the restart data from either an ASCII or binary SU2 file, or blend several files. ---*/
 
-  if (config->GetRead_Binary_Restart()) {
-    Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename);
-  } else {
-    Read_SU2_Restart_ASCII(geometry[MESH_0], config, restart_filename);
-  }
+  Read_SU2_Restart(geometry[MESH_0], config, restart_filename);
 
   /*--- Load data from the restart into correct containers. ---*/
   unsigned long counter = 0;
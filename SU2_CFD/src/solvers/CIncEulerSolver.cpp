@@ -1032,12 +1032,16 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
 unsigned long CIncEulerSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
+  unsigned long nonPhysicalPoints = 0;
+
+  /*--- All points, or those needed by the hyper-reduced ROM. ---*/
+  const IndexSubset<> points(GetStatePoints(), nPoint);
 
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  SU2_OMP_FOR_STAT_PROFILED("Point loops", omp_chunk_size)
+  for (unsigned long k = 0; k < points.size; k++) {
+    const auto iPoint = points[k];
 
     /*--- Incompressible flow, primitive variables ---*/
 
@@ -1047,7 +1051,7 @@ unsigned long CIncEulerSolver::SetPrimitive_Variables(CSolver **solver_container
 
     if (!physical) nonPhysicalPoints++;
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
   AD::EndNoSharedReading();
 
@@ -1125,11 +1129,13 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
   if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
   else AD::StartNoSharedReading();
 
+  EdgeLoopTuningStart();
+
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
+  ForEachEdgeColor([&](const auto& color)
   {
   /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  SU2_OMP_FOR_DYN_PROFILED("Edge colors", nextMultiple(OMP_MIN_SIZE, color.groupSize))
   for(auto k = 0ul; k < color.size; ++k) {
 
     auto iEdge = color.indices[k];
@@ -1188,8 +1194,10 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
     Viscous_Residual(iEdge, geometry, solver_container,
                      numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
   }
-  END_SU2_OMP_FOR
-  } // end color loop
+  END_SU2_OMP_FOR_PROFILED
+  }); // end color loop
+
+  EdgeLoopTuningStop(*geometry);
 
   /*--- Restore preaccumulation and adjoint evaluation state. ---*/
   AD::ResumePreaccumulation(pausePreacc);
@@ -1230,11 +1238,13 @@ void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
   if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
   else AD::StartNoSharedReading();
 
+  EdgeLoopTuningStart();
+
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
+  ForEachEdgeColor([&](const auto& color)
   {
   /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  SU2_OMP_FOR_DYN_PROFILED("Edge colors", nextMultiple(OMP_MIN_SIZE, color.groupSize))
   for(auto k = 0ul; k < color.size; ++k) {
 
     auto iEdge = color.indices[k];
@@ -1365,8 +1375,10 @@ void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
                      numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
 
   }
-  END_SU2_OMP_FOR
-  } // end color loop
+  END_SU2_OMP_FOR_PROFILED
+  }); // end color loop
+
+  EdgeLoopTuningStop(*geometry);
 
   FinalizeResidualComputation(geometry, pausePreacc, counter_local, config);
 }
@@ -2084,7 +2096,7 @@ void CIncEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_contain
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_DYN_PROFILED("Boundary loops", OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -2197,7 +2209,7 @@ void CIncEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_contain
       Jacobian.SubtractBlock2Diag(iPoint, residual_v.jacobian_i);
 
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
 }
 
@@ -2222,7 +2234,7 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_DYN_PROFILED("Boundary loops", OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -2452,7 +2464,7 @@ void CIncEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
     if (implicit)
       Jacobian.SubtractBlock2Diag(iPoint, residual_v.jacobian_i);
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 }
 
 void CIncEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
@@ -2473,7 +2485,7 @@ void CIncEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
   /*--- Loop over all the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_DYN_PROFILED("Boundary loops", OMP_MIN_SIZE)
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -2650,7 +2662,7 @@ void CIncEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
       Jacobian.SubtractBlock2Diag(iPoint, residual_v.jacobian_i);
 
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
 }
 
@@ -281,7 +281,7 @@ void CIncNSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CS
 
 unsigned long CIncNSSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
+  unsigned long nonPhysicalPoints = 0;
   su2double eddy_visc = 0.0, turb_ke = 0.0, DES_LengthScale = 0.0;
   const su2double* scalar = nullptr;
   const TURB_MODEL turb_model = config->GetKind_Turb_Model();
@@ -289,10 +289,14 @@ unsigned long CIncNSSolver::SetPrimitive_Variables(CSolver **solver_container, c
 
   bool tkeNeeded = (turb_model == TURB_MODEL::SST);
 
+  /*--- All points, or those needed by the hyper-reduced ROM. ---*/
+  const IndexSubset<> points(GetStatePoints(), nPoint);
+
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+  SU2_OMP_FOR_STAT_PROFILED("Point loops", omp_chunk_size)
+  for (unsigned long k = 0; k < points.size; k++) {
+    const auto iPoint = points[k];
 
     /*--- Retrieve the value of the kinetic energy (if needed) ---*/
 
@@ -323,7 +327,7 @@ unsigned long CIncNSSolver::SetPrimitive_Variables(CSolver **solver_container, c
     nodes->SetDES_LengthScale(iPoint,DES_LengthScale);
 
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
   AD::EndNoSharedReading();
 
@@ -381,7 +385,7 @@ void CIncNSSolver::BC_Wall_Generic(const CGeometry *geometry, const CConfig *con
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_DYN_PROFILED("Boundary loops", OMP_MIN_SIZE)
   for (auto iVertex = 0ul; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
@@ -501,7 +505,7 @@ void CIncNSSolver::BC_Wall_Generic(const CGeometry *geometry, const CConfig *con
       break;
     } // switch
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 }
 
 void CIncNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver**, CNumerics*,
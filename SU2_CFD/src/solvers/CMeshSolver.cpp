@@ -488,15 +488,12 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
   InitiateComms(geometry[MESH_0], config, MESH_DISPLACEMENTS);
   CompleteComms(geometry[MESH_0], config, MESH_DISPLACEMENTS);
 
-  /*--- Compute the stiffness matrix, no point recording because we clear the residual. ---*/
+  /*--- Set the stiffness matrix. ---*/
+  SetStiffMatrix(geometry[MESH_0], numerics, config);
 
-  const bool wasActive = AD::BeginPassive();
-
-  Compute_StiffMatrix(geometry[MESH_0], numerics, config);
-
-  AD::EndPassive(wasActive);
-
-  /*--- Clear residual (loses AD info), we do not want an incremental solution. ---*/
+  /*--- Clear residual (loses AD info), we do not want an incremental solution.
+   *    The previous displacements (kept in LinSysSol) are the initial guess of the linear solver,
+   *    except in FSI where LinSysSol is also used to compute the grid velocity. ---*/
   SU2_OMP_PARALLEL {
     LinSysRes.SetValZero();
 
@@ -541,6 +538,32 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
 
 }
 
+void CMeshSolver::SetStiffMatrix(CGeometry *geometry, CNumerics **numerics, const CConfig *config){
+
+  /*--- No point recording because we clear the residual. ---*/
+  const bool wasActive = AD::BeginPassive();
+
+  const bool reuse = !StiffMatrix.empty();
+
+  if (reuse) {
+    SU2_OMP_PARALLEL {
+      Jacobian.SetValues(StiffMatrix);
+    }
+    END_SU2_OMP_PARALLEL
+  }
+  else {
+    Compute_StiffMatrix(geometry, numerics, config);
+    Jacobian.GetValues(StiffMatrix);
+  }
+
+  AD::EndPassive(wasActive);
+
+  /*--- The boundary conditions are always imposed on the same nodes, therefore the constrained
+   *    matrix and its preconditioner are also the same, unless nodes are clamped based on their
+   *    current position. The discrete adjoint may build a preconditioner for the transposed matrix. ---*/
+  System.SetReusePreconditioner(reuse && !config->GetHold_GridFixed() && !config->GetDiscrete_Adjoint());
+}
+
 void CMeshSolver::UpdateGridCoord(CGeometry *geometry, const CConfig *config){
 
   /*--- Update the grid coordinates using the solution of the linear system ---*/
@@ -573,13 +596,8 @@ void CMeshSolver::ComputeGridVelocity_FromBoundary(CGeometry **geometry, CNumeri
     SU2_MPI::Error("It is not possible to compute grid velocity from boundary velocity for single zone problems.\n"
                    "MARKER_FLUID_LOAD should only be used for structural boundaries.", CURRENT_FUNCTION);
 
-  /*--- Compute the stiffness matrix, no point recording because we clear the residual. ---*/
-
-  const bool wasActive = AD::BeginPassive();
-
-  Compute_StiffMatrix(geometry[MESH_0], numerics, config);
-
-  AD::EndPassive(wasActive);
+  /*--- Set the stiffness matrix. ---*/
+  SetStiffMatrix(geometry[MESH_0], numerics, config);
 
   const su2double velRef = config->GetVelocity_Ref();
   const su2double invVelRef = 1.0 / velRef;
@@ -763,15 +781,11 @@ void CMeshSolver::SetDualTime_Mesh(){
 
 void CMeshSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *config, int val_iter, bool val_update_geo) {
 
-  /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
+  /*--- Read the restart data from either an ASCII or binary SU2 file, or blend several files. ---*/
 
   string filename = config->GetFilename(config->GetSolution_FileName(), "", val_iter);
 
-  if (config->GetRead_Binary_Restart()) {
-    Read_SU2_Restart_Binary(geometry[MESH_0], config, filename);
-  } else {
-    Read_SU2_Restart_ASCII(geometry[MESH_0], config, filename);
-  }
+  Read_SU2_Restart(geometry[MESH_0], config, filename);
 
   /*--- Load data from the restart into correct containers. ---*/
 
@@ -135,10 +135,14 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, cons
   const TURB_MODEL turb_model = config->GetKind_Turb_Model();
   const bool tkeNeeded = (turb_model == TURB_MODEL::SST);
 
+  /*--- All points, or those needed by the hyper-reduced ROM. ---*/
+  const IndexSubset<> points(GetStatePoints(), nPoint);
+
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  SU2_OMP_FOR_STAT_PROFILED("Point loops", omp_chunk_size)
+  for (unsigned long k = 0; k < points.size; k++) {
+    const auto iPoint = points[k];
 
     /*--- Retrieve the value of the kinetic energy (if needed). ---*/
 
@@ -164,7 +168,7 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, cons
     nonPhysicalPoints += !physical;
 
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
   AD::EndNoSharedReading();
 
@@ -460,7 +464,7 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_DYN_PROFILED("Boundary loops", OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
@@ -569,7 +573,7 @@ void CNSSolver::BC_HeatFlux_Wall_Generic(const CGeometry* geometry, const CConfi
       }
     }
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
   if (Jacobian_i)
     for (auto iVar = 0u; iVar < nVar; iVar++)
@@ -647,7 +651,7 @@ void CNSSolver::BC_Isothermal_Wall_Generic(CGeometry *geometry, CSolver **solver
 
   /*--- Loop over boundary points ---*/
 
-  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  SU2_OMP_FOR_DYN_PROFILED("Boundary loops", OMP_MIN_SIZE)
   for (auto iVertex = 0u; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
     const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
@@ -767,7 +771,7 @@ void CNSSolver::BC_Isothermal_Wall_Generic(CGeometry *geometry, CSolver **solver
       }
     }
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_FOR_PROFILED
 
   if (Jacobian_i)
     for (auto iVar = 0u; iVar < nVar; iVar++)
@@ -72,7 +72,14 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
     }
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (P1 radiation equation)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+
+    if (ReducerStrategy)
+      EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
+
+    /*--- The P1 Jacobian (including the pseudo time step) only depends on the geometry,
+     * it is assembled once and reused together with its preconditioner. ---*/
+    reuseJacobian = !config->GetDiscrete_Adjoint() && !config->GetDynamic_Grid();
 
   }
 
@@ -138,15 +145,12 @@ CRadP1Solver::~CRadP1Solver() {
 
 void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint;
-
-  /*--- Initialize the residual vector ---*/
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
-    LinSysRes.SetBlock_Zero(iPoint);
-  }
+  /*--- Initialize the residual vector and the Jacobian matrix, the latter only when it
+   * needs to be assembled (it only depends on the geometry and is reused otherwise). ---*/
 
-  /*--- Initialize the Jacobian matrix ---*/
-  Jacobian.SetValZero();
+  LinSysRes.SetValZero();
+  if (ReducerStrategy) EdgeFluxes.SetValZero();
+  if (updateJacobian) Jacobian.SetValZero();
 
   /*--- Compute the Solution gradients ---*/
   if (config->GetReconstructionGradientRequired()) {
@@ -161,67 +165,96 @@ void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
 void CRadP1Solver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh) {
 
-  unsigned long iPoint;
-  su2double Energy, Temperature;
-  su2double SourceTerm, SourceTerm_Derivative;
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Retrieve the radiative energy ---*/
-    Energy = nodes->GetSolution(iPoint, 0);
+    const su2double Energy = nodes->GetSolution(iPoint, 0);
 
     /*--- Retrieve temperature from the flow solver ---*/
-    Temperature = solver_container[FLOW_SOL]->GetNodes()->GetTemperature(iPoint);
+    const su2double Temperature = flowNodes->GetTemperature(iPoint);
 
     /*--- Compute the divergence of the radiative flux ---*/
-    SourceTerm = Absorption_Coeff*(Energy - 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0));
+    const su2double SourceTerm = Absorption_Coeff*(Energy - 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0));
 
     /*--- Compute the derivative of the source term with respect to the temperature ---*/
-    SourceTerm_Derivative =  - 16.0*Absorption_Coeff*STEFAN_BOLTZMANN*pow(Temperature,3.0);
+    const su2double SourceTerm_Derivative =  - 16.0*Absorption_Coeff*STEFAN_BOLTZMANN*pow(Temperature,3.0);
 
     /*--- Store the source term and its derivative ---*/
     nodes->SetRadiative_SourceTerm(iPoint, 0, SourceTerm);
     nodes->SetRadiative_SourceTerm(iPoint, 1, SourceTerm_Derivative);
 
   }
+  END_SU2_OMP_FOR
 
 }
 
 void CRadP1Solver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[VISC_TERM];
+  CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+   * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
+  else AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring) {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; ++k) {
 
-  unsigned long iEdge, iPoint, jPoint;
+      auto iEdge = color.indices[k];
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      /*--- Points in edge ---*/
 
-    /*--- Points in edge ---*/
+      auto iPoint = geometry->edges->GetNode(iEdge,0);
+      auto jPoint = geometry->edges->GetNode(iEdge,1);
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+      /*--- Points coordinates, and normal vector ---*/
 
-    /*--- Points coordinates, and normal vector ---*/
+      numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
+                         geometry->nodes->GetCoord(jPoint));
+      numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
-    numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
-                       geometry->nodes->GetCoord(jPoint));
-    numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+      /*--- Radiation variables w/o reconstruction, and its gradients ---*/
 
-    /*--- Radiation variables w/o reconstruction, and its gradients ---*/
+      numerics->SetRadVar(nodes->GetSolution(iPoint), nodes->GetSolution(jPoint));
+      numerics->SetRadVarGradient(nodes->GetGradient(iPoint), nodes->GetGradient(jPoint));
 
-    numerics->SetRadVar(nodes->GetSolution(iPoint), nodes->GetSolution(jPoint));
-    numerics->SetRadVarGradient(nodes->GetGradient(iPoint), nodes->GetGradient(jPoint));
+      /*--- Compute residual, and Jacobians (thread-local storage). ---*/
 
-    /*--- Compute residual, and Jacobians ---*/
+      su2double residual[MAXNVAR] = {0.0}, block_i[MAXNVAR] = {0.0}, block_j[MAXNVAR] = {0.0};
+      su2double* jacobian_i[MAXNVAR] = {block_i};
+      su2double* jacobian_j[MAXNVAR] = {block_j};
 
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+      numerics->ComputeResidual(residual, jacobian_i, jacobian_j, config);
 
-    /*--- Add and subtract residual, and update Jacobian ---*/
+      /*--- Add and subtract residual, and update Jacobian ---*/
+
+      if (ReducerStrategy) {
+        EdgeFluxes.SubtractBlock(iEdge, residual);
+        if (updateJacobian) Jacobian.UpdateBlocksSub(iEdge, jacobian_i, jacobian_j);
+      } else {
+        LinSysRes.SubtractBlock(iPoint, residual);
+        LinSysRes.AddBlock(jPoint, residual);
+        if (updateJacobian) Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, jacobian_i, jacobian_j);
+      }
+    }
+    END_SU2_OMP_FOR
+  } // end color loop
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
-    Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
 
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (updateJacobian) Jacobian.SetDiagonalAsColumnSum();
   }
 
 }
@@ -229,13 +262,16 @@ void CRadP1Solver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contai
 void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                   CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Conservative variables w/o reconstruction ---*/
 
-    numerics->SetPrimitive(solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint), nullptr);
+    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
 
     /*--- Radiation variables w/o reconstruction ---*/
 
@@ -247,395 +283,350 @@ void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 
     /*--- Compute the source term ---*/
 
-    numerics->ComputeResidual(Residual, Jacobian_i, config);
+    su2double residual[MAXNVAR] = {0.0}, block_i[MAXNVAR] = {0.0};
+    su2double* jacobian_i[MAXNVAR] = {block_i};
+
+    numerics->ComputeResidual(residual, jacobian_i, config);
 
     /*--- Subtract residual and the Jacobian ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
+    LinSysRes.SubtractBlock(iPoint, residual);
+    if (updateJacobian) Jacobian.SubtractBlock2Diag(iPoint, jacobian_i);
 
   }
+  END_SU2_OMP_FOR
 
 }
 
 void CRadP1Solver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config,
                                        unsigned short val_marker) {
 
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
-
-  su2double Theta, Ib_w, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
-  su2double Twall;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
   /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
   /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
 
-    /*--- Retrieve the specified wall temperature ---*/
-  Twall = config->GetIsothermal_Temperature(Marker_Tag)/config->GetTemperature_Ref();
+  /*--- Retrieve the specified wall temperature ---*/
+  const su2double Twall = config->GetIsothermal_Temperature(Marker_Tag)/config->GetTemperature_Ref();
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
-    if (geometry->nodes->GetDomain(iPoint)) {
-
-      /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
-
-      Area = GeometryToolbox::Norm(nDim, Normal);
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      // Weak application of the boundary condition
-
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
+    /*--- Compute dual-grid area and boundary normal ---*/
+    const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[val_marker][iVertex]->GetNormal());
 
-      /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
+    /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
 
-      /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
+    /*--- Compute the blackbody intensity at the wall. ---*/
+    const su2double Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
 
-      /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = 1.0*Theta*(Ib_w - Radiative_Energy);
+    /*--- Compute the radiative heat flux. ---*/
+    const su2double Radiative_Energy = nodes->GetSolution(iPoint, 0);
+    const su2double Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
 
-      /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
+    /*--- Compute the Viscous contribution to the residual ---*/
+    const su2double Res_Visc[MAXNVAR] = {Radiative_Heat_Flux*Area};
 
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
+    /*--- Apply to the residual vector ---*/
+    LinSysRes.SubtractBlock(iPoint, Res_Visc);
 
-      /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
+    /*--- Compute the Jacobian contribution (constant, only needed while it is being assembled). ---*/
+    if (implicit && updateJacobian) {
+      su2double block_i[MAXNVAR] = {- Theta};
+      su2double* jacobian_i[MAXNVAR] = {block_i};
+      Jacobian.SubtractBlock2Diag(iPoint, jacobian_i);
     }
   }
+  END_SU2_OMP_FOR
 
 }
 
 void CRadP1Solver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
-
-  su2double Theta, Ib_w, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
-  su2double Twall;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
   /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
   /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
 
   /*--- Retrieve the specified wall temperature ---*/
-  Twall = GetTemperature_Inf();
+  const su2double Twall = GetTemperature_Inf();
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
-    if (geometry->nodes->GetDomain(iPoint)) {
-
-      /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
-
-      Area = GeometryToolbox::Norm(nDim, Normal);
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      // Weak application of the boundary condition
+    /*--- Compute dual-grid area and boundary normal ---*/
+    const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[val_marker][iVertex]->GetNormal());
 
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
-
-      /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
+    /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
 
-      /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
+    /*--- Compute the blackbody intensity at the wall. ---*/
+    const su2double Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
 
-      /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = 1.0*Theta*(Ib_w - Radiative_Energy);
+    /*--- Compute the radiative heat flux. ---*/
+    const su2double Radiative_Energy = nodes->GetSolution(iPoint, 0);
+    const su2double Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
 
-      /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
+    /*--- Compute the Viscous contribution to the residual ---*/
+    const su2double Res_Visc[MAXNVAR] = {Radiative_Heat_Flux*Area};
 
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
+    /*--- Apply to the residual vector ---*/
+    LinSysRes.SubtractBlock(iPoint, Res_Visc);
 
-      /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
+    /*--- Compute the Jacobian contribution (constant, only needed while it is being assembled). ---*/
+    if (implicit && updateJacobian) {
+      su2double block_i[MAXNVAR] = {- Theta};
+      su2double* jacobian_i[MAXNVAR] = {block_i};
+      Jacobian.SubtractBlock2Diag(iPoint, jacobian_i);
     }
   }
+  END_SU2_OMP_FOR
 
 }
 
 void CRadP1Solver::BC_Marshak(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                               unsigned short val_marker) {
 
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
-
-  su2double Theta, Ib_w, Temperature, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
   /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
   /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
+
+  const auto flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
-    if (geometry->nodes->GetDomain(iPoint)) {
-
-      /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
-
-      Area = GeometryToolbox::Norm(nDim, Normal);
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      // Weak application of the boundary condition
-
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
+    /*--- Compute dual-grid area and boundary normal ---*/
+    const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[val_marker][iVertex]->GetNormal());
 
-      /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
+    /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
 
-      /*--- Retrieve temperature from the flow solver ---*/
-      Temperature = solver_container[FLOW_SOL]->GetNodes()->GetTemperature(iPoint);
-
-      /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0);
+    /*--- Retrieve temperature from the flow solver ---*/
+    const su2double Temperature = flowNodes->GetTemperature(iPoint);
 
-      /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
+    /*--- Compute the blackbody intensity at the wall. ---*/
+    const su2double Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0);
 
-      /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
+    /*--- Compute the radiative heat flux. ---*/
+    const su2double Radiative_Energy = nodes->GetSolution(iPoint, 0);
+    const su2double Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
 
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
+    /*--- Compute the Viscous contribution to the residual ---*/
+    const su2double Res_Visc[MAXNVAR] = {Radiative_Heat_Flux*Area};
 
-      /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
+    /*--- Apply to the residual vector ---*/
+    LinSysRes.SubtractBlock(iPoint, Res_Visc);
 
+    /*--- Compute the Jacobian contribution (constant, only needed while it is being assembled). ---*/
+    if (implicit && updateJacobian) {
+      su2double block_i[MAXNVAR] = {- Theta};
+      su2double* jacobian_i[MAXNVAR] = {block_i};
+      Jacobian.SubtractBlock2Diag(iPoint, jacobian_i);
     }
   }
+  END_SU2_OMP_FOR
 
 }
 
-
 void CRadP1Solver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iVar;
-  unsigned long iPoint, total_index, IterLinSol = 0;
-  su2double Vol;
-  su2double Delta;
-
-  /*--- Set maximum residual to zero ---*/
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
 
   SetResToZero();
 
-  /*--- Build implicit system ---*/
+  su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
+  unsigned long idxMax[MAXNVAR] = {0};
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  /*--- Build implicit system ---*/
 
-    /*--- Read the volume ---*/
+  SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    Vol = geometry->nodes->GetVolume(iPoint);
+    /*--- Modify matrix diagonal to assure diagonal dominance. The pseudo time step only
+     * depends on the geometry, thus a reused Jacobian already contains this term. ---*/
 
-    /*--- Modify matrix diagonal to assure diagonal dominance ---*/
+    const su2double dt = nodes->GetDelta_Time(iPoint);
 
-    if (nodes->GetDelta_Time(iPoint) != 0.0) {
-      Delta = Vol / nodes->GetDelta_Time(iPoint);
-      Jacobian.AddVal2Diag(iPoint, Delta);
+    if (dt != 0.0) {
+      if (updateJacobian) Jacobian.AddVal2Diag(iPoint, geometry->nodes->GetVolume(iPoint) / dt);
     }
     else {
-      Jacobian.SetVal2Diag(iPoint, 1.0);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        total_index = iPoint*nVar + iVar;
-        LinSysRes[total_index] = 0.0;
-      }
+      if (updateJacobian) Jacobian.SetVal2Diag(iPoint, 1.0);
+      LinSysRes.SetBlock_Zero(iPoint);
     }
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar+iVar;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const unsigned long total_index = iPoint*nVar+iVar;
       LinSysRes[total_index] = - (LinSysRes[total_index]);
       LinSysSol[total_index] = 0.0;
-      Residual_RMS[iVar] += LinSysRes[total_index]*LinSysRes[total_index];
-      AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->nodes->GetGlobalIndex(iPoint), geometry->nodes->GetCoord(iPoint));
+      ResidualReductions_PerThread(iPoint, iVar, LinSysRes[total_index], resRMS, resMax, idxMax);
     }
   }
+  END_SU2_OMP_FOR
 
   /*--- Initialize residual and solution at the ghost points ---*/
 
-  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = 0.0;
-      LinSysSol[total_index] = 0.0;
-    }
+  SU2_OMP_FOR_(schedule(static, OMP_MIN_SIZE) SU2_NOWAIT)
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    LinSysRes.SetBlock_Zero(iPoint);
+    LinSysSol.SetBlock_Zero(iPoint);
   }
+  END_SU2_OMP_FOR
 
   /*--- Solve or smooth the linear system ---*/
 
-  IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  const auto IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
+  /*--- The the number of iterations of the linear solver ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    SetIterLinSolver(IterLinSol);
+    SetResLinSolver(System.GetResidual());
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
       nodes->AddSolution(iPoint, iVar, LinSysSol[iPoint*nVar+iVar]);
     }
   }
-
-  /*--- The the number of iterations of the linear solver ---*/
-
-  SetIterLinSolver(IterLinSol);
+  END_SU2_OMP_FOR
 
   /*--- MPI solution ---*/
 
   InitiateComms(geometry, config, SOLUTION);
   CompleteComms(geometry, config, SOLUTION);
 
-  /*--- Compute the root mean square residual ---*/
+  /*--- "Add" residuals from all threads to global residual variables, compute the RMS residual. ---*/
 
-  SetResidual_RMS(geometry, config);
+  ResidualReductions_FromAllThreads(geometry, config, resRMS, resMax, idxMax);
+
+  /*--- The Jacobian (and the pseudo time step) only depend on the geometry, from now on
+   * keep the assembled matrix and the preconditioner built for it. ---*/
+
+  if (reuseJacobian && updateJacobian) {
+    SU2_OMP_BARRIER
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      updateJacobian = false;
+      System.SetReusePreconditioner(true);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
 
 }
 
 void CRadP1Solver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                unsigned short iMesh, unsigned long Iteration) {
 
-  unsigned short iMarker;
-  unsigned long iEdge, iVertex, iPoint = 0, jPoint = 0;
-  su2double Area, Vol, Lambda;
-  su2double Global_Delta_Time = 1E6, Local_Delta_Time = 0.0, K_v = 0.25;
-  su2double CFL = config->GetCFL_Rad();
-  su2double GammaP1 = 1.0 / (3.0*(Absorption_Coeff + Scattering_Coeff));
-  const su2double* Normal;
-
-  /*--- Compute spectral radius based on thermal conductivity ---*/
+  /*--- The time step only enters the (reused) Jacobian, nothing to update. ---*/
 
-  Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
+  if (!updateJacobian) return;
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    nodes->SetMax_Lambda_Visc(iPoint, 0.0);
-  }
-
-  /*--- Loop interior edges ---*/
+  const su2double K_v = 0.25;
+  const su2double CFL = config->GetCFL_Rad();
+  const su2double GammaP1 = 1.0 / (3.0*(Absorption_Coeff + Scattering_Coeff));
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Compute spectral radius based on thermal conductivity. Loop over the
+   * edges of each point to avoid write conflicts between threads. ---*/
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    /*--- Get the edge's normal vector to compute the edge's area ---*/
-    Normal = geometry->edges->GetNormal(iEdge);
-    Area = GeometryToolbox::Norm(nDim, Normal);
+    su2double Lambda = 0.0;
 
-    /*--- Viscous contribution ---*/
+    for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
 
-    Lambda = GammaP1*Area*Area;
-    if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
-    if (geometry->nodes->GetDomain(jPoint)) nodes->AddMax_Lambda_Visc(jPoint, Lambda);
+      /*--- Get the edge's normal vector to compute the edge's area ---*/
+      const su2double Area = GeometryToolbox::Norm(nDim, geometry->edges->GetNormal(iEdge));
 
+      /*--- Viscous contribution ---*/
+      Lambda += GammaP1*Area*Area;
+    }
+    nodes->SetMax_Lambda_Visc(iPoint, Lambda);
   }
+  END_SU2_OMP_FOR
 
   /*--- Loop boundary edges ---*/
 
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      Area = GeometryToolbox::Norm(nDim, Normal);
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[iMarker][iVertex]->GetNormal());
 
       /*--- Viscous contribution ---*/
 
-      Lambda = GammaP1*Area*Area;
-      if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+      if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, GammaP1*Area*Area);
 
     }
+    END_SU2_OMP_FOR
   }
 
   /*--- Each element uses their own speed, steady state simulation ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  su2double minDt = 1.E6, maxDt = 0.0;
 
-    Vol = geometry->nodes->GetVolume(iPoint);
+  SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    const su2double Vol = geometry->nodes->GetVolume(iPoint);
 
     if (Vol != 0.0) {
 
       /*--- Time step setting method ---*/
 
-       Local_Delta_Time = CFL*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
+      su2double Local_Delta_Time = CFL*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
 
       /*--- Min-Max-Logic ---*/
 
-      Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
-      Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
-      Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
+      minDt = min(minDt, Local_Delta_Time);
+      maxDt = max(maxDt, Local_Delta_Time);
       if (Local_Delta_Time > config->GetMax_DeltaTime())
         Local_Delta_Time = config->GetMax_DeltaTime();
 
@@ -645,16 +636,32 @@ void CRadP1Solver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
       nodes->SetDelta_Time(iPoint, 0.0);
     }
   }
+  END_SU2_OMP_FOR
+
+  /*--- Combine the values of all threads. ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  SU2_OMP_CRITICAL {
+    Min_Delta_Time = min(Min_Delta_Time, minDt);
+    Max_Delta_Time = max(Max_Delta_Time, maxDt);
+  }
+  END_SU2_OMP_CRITICAL
 
   /*--- Compute the max and the min dt (in parallel) ---*/
   if (config->GetComm_Level() == COMM_FULL) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      su2double sbuf_time;
+      sbuf_time = Min_Delta_Time;
+      SU2_MPI::Allreduce(&sbuf_time, &Min_Delta_Time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
 
-    su2double sbuf_time;
-    sbuf_time = Min_Delta_Time;
-    SU2_MPI::Allreduce(&sbuf_time, &Min_Delta_Time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
-
-    sbuf_time = Max_Delta_Time;
-    SU2_MPI::Allreduce(&sbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+      sbuf_time = Max_Delta_Time;
+      SU2_MPI::Allreduce(&sbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
   }
 
 }
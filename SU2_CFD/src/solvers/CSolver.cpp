@@ -43,6 +43,8 @@
 #include "../../../Common/include/toolboxes/MMS/CTGVSolution.hpp"
 #include "../../../Common/include/toolboxes/MMS/CUserDefinedSolution.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
+#include "../../../Common/include/toolboxes/CCommProfiler.hpp"
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
@@ -342,6 +344,8 @@ void CSolver::InitiatePeriodicComms(CGeometry *geometry,
 
   if (commType == PERIODIC_NONE) return;
 
+  SU2_PROFILE_REGION("MPI comms");
+
   if (rotate_periodic && config->GetNEMOProblem()) {
     SU2_MPI::Error("The NEMO solvers do not support rotational periodicity yet.", CURRENT_FUNCTION);
   }
@@ -423,6 +427,7 @@ void CSolver::InitiatePeriodicComms(CGeometry *geometry,
     /*--- Post all non-blocking recvs first before sends. ---*/
 
     geometry->PostPeriodicRecvs(geometry, config, MPI_TYPE, COUNT_PER_POINT);
+    geometry->ProfilePeriodicComms(commType, COUNT_PER_POINT, MPI_TYPE);
 
     for (iMessage = 0; iMessage < geometry->nPeriodicSend; iMessage++) {
 
@@ -1003,6 +1008,8 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
 
   if (commType == PERIODIC_NONE) return;
 
+  SU2_PROFILE_REGION("MPI comms");
+
   /*--- Set the size of the data packet and type depending on quantity. ---*/
 
   unsigned short COUNT_PER_POINT = 0, MPI_TYPE = 0, ICOUNT = 0, JCOUNT = 0;
@@ -1055,7 +1062,8 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
 #ifdef HAVE_MPI
       /*--- Once we have recv'd a message, get the source rank. ---*/
       int ind;
-      SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitany(geometry->nPeriodicRecv, geometry->req_PeriodicRecv, &ind, &status);)
+      SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_PROFILE_REGION("MPI wait"); SU2_COMM_WAIT(CCommProfiler::PeriodicId(commType));
+                                 SU2_MPI::Waitany(geometry->nPeriodicRecv, geometry->req_PeriodicRecv, &ind, &status);)
       source = status.MPI_SOURCE;
 #else
       /*--- For serial calculations, we know the rank. ---*/
@@ -1309,7 +1317,9 @@ void CSolver::CompletePeriodicComms(CGeometry *geometry,
      data in the loop above at this point. ---*/
 
 #ifdef HAVE_MPI
-    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(geometry->nPeriodicSend, geometry->req_PeriodicSend, MPI_STATUS_IGNORE);)
+    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_PROFILE_REGION("MPI wait"); SU2_COMM_WAIT(CCommProfiler::PeriodicId(commType));
+                               SU2_MPI::Waitall(geometry->nPeriodicSend, geometry->req_PeriodicSend,
+                                                MPI_STATUS_IGNORE);)
 #endif
   }
 
@@ -1408,6 +1418,8 @@ void CSolver::InitiateComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  SU2_PROFILE_REGION("MPI comms");
+
   /*--- Local variables ---*/
 
   unsigned short iVar, iDim;
@@ -1447,6 +1459,7 @@ void CSolver::InitiateComms(CGeometry *geometry,
     /*--- Post all non-blocking recvs first before sends. ---*/
 
     geometry->PostP2PRecvs(geometry, config, MPI_TYPE, COUNT_PER_POINT, false);
+    geometry->ProfileP2PComms(commType, COUNT_PER_POINT, MPI_TYPE, false);
 
     for (iMessage = 0; iMessage < geometry->nP2PSend; iMessage++) {
 
@@ -1550,6 +1563,8 @@ void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  SU2_PROFILE_REGION("MPI comms");
+
   /*--- Local variables ---*/
 
   unsigned short iDim, iVar;
@@ -1586,7 +1601,8 @@ void CSolver::CompleteComms(CGeometry *geometry,
       /*--- For efficiency, recv the messages dynamically based on
        the order they arrive. ---*/
 
-      SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);)
+      SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_PROFILE_REGION("MPI wait"); SU2_COMM_WAIT(CCommProfiler::HaloId(commType));
+                                 SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);)
 
       /*--- Once we have recv'd a message, get the source rank. ---*/
 
@@ -1691,7 +1707,8 @@ void CSolver::CompleteComms(CGeometry *geometry,
      data in the loop above at this point. ---*/
 
 #ifdef HAVE_MPI
-    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);)
+    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_PROFILE_REGION("MPI wait"); SU2_COMM_WAIT(CCommProfiler::HaloId(commType));
+                               SU2_MPI::Waitall(geometry->nP2PSend, geometry->req_P2PSend, MPI_STATUS_IGNORE);)
 #endif
   }
 
@@ -1702,6 +1719,8 @@ void CSolver::ResetCFLAdapt() {
   Old_Func = 0;
   New_Func = 0;
   NonLinRes_Counter = 0;
+  /*--- The cost control keeps its state across time steps, only the window in progress is discarded. ---*/
+  CostControlRestart = true;
 }
 
 
@@ -1719,6 +1738,7 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
   const su2double CFLMax            = config->GetCFL_AdaptParam(3);
   const su2double acceptableLinTol  = config->GetCFL_AdaptParam(4);
   const bool fullComms              = (config->GetComm_Level() == COMM_FULL);
+  const bool costControl            = config->GetCFL_Adapt_Cost();
 
   /* Number of iterations considered to check for stagnation. */
   const auto Res_Count = min(100ul, config->GetnInner_Iter()-1);
@@ -1750,8 +1770,10 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
     /* Max linear residual between flow and turbulence. */
     const su2double linRes = max(solverFlow->GetResLinSolver(), linResTurb);
 
-    /* Tolerance limited to an acceptable value. */
-    const su2double linTol = max(acceptableLinTol, config->GetLinear_Solver_Error());
+    /* Tolerance limited to an acceptable value, the cost control may have changed the tolerance. */
+    const su2double solverTol = (costControl && CostControlReady) ?
+                                CostControl.GetValue(CCFLCostController::LINSOL_TOL) : config->GetLinear_Solver_Error();
+    const su2double linTol = max(acceptableLinTol, solverTol);
 
     /* Check that we are meeting our nonlinear residual reduction target
      over time so that we do not get stuck in limit cycles, this is done
@@ -1815,10 +1837,19 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
           for (auto& val : NonLinRes_Series) val = 0.0;
         }
       }
+
+      /* Update the CFL limit and linear solver settings from the measured convergence rate per second. */
+
+      if (costControl) AdaptCostControl(solverTurb, config, resetCFL);
     }
     } /* End safe global access, now all threads update the CFL number. */
     END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
+    /* The cost control lowers the upper limit if high CFL numbers are not worth their cost. */
+
+    const su2double CFLLimit = (costControl && CostControlReady && !CostControl.InWarmup()) ?
+                               min(CFLMax, su2double(CostControl.GetValue(CCFLCostController::CFL_MAX))) : CFLMax;
+
     /* Loop over all points on this grid and apply CFL adaption. */
 
     su2double myCFLMin = 1e30, myCFLMax = 0.0, myCFLSum = 0.0;
@@ -1868,8 +1899,8 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
       if (CFL*CFLFactor <= CFLMin) {
         CFL       = CFLMin;
         CFLFactor = MGFactor[iMesh];
-      } else if (CFL*CFLFactor >= CFLMax) {
-        CFL       = CFLMax;
+      } else if (CFL*CFLFactor >= CFLLimit) {
+        CFL       = CFLLimit;
         CFLFactor = MGFactor[iMesh];
       }
 
@@ -1926,6 +1957,76 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
 
 }
 
+void CSolver::AdaptCostControl(CSolver *solverTurb, const CConfig *config, bool restart) {
+
+  using Control = CCFLCostController;
+  const passivedouble func = SU2_TYPE::GetValue(New_Func);
+  const passivedouble time = SU2_MPI::Wtime();
+  const auto CFLMin = SU2_TYPE::GetValue(config->GetCFL_AdaptParam(2));
+  const auto CFLMax = SU2_TYPE::GetValue(config->GetCFL_AdaptParam(3));
+
+  if (!CostControlReady) {
+    /*--- The preconditioner can only be reused if its application does not depend on the matrix
+     (which changes every iteration), CFL_ADAPT_PARAM and LINEAR_SOLVER_ITER are the upper limits. ---*/
+    const auto kindPrec = config->GetKind_Linear_Solver_Prec();
+    const bool canReuse = (kindPrec == ILU) || (kindPrec == JACOBI);
+    const auto maxIter = static_cast<double>(config->GetLinear_Solver_Iter());
+
+    /*--- Two windows of warm-up to let the CFL ramp up, trials are kept if they improve the rate by 5%.
+     The CFL limit is not applied during the warm-up, it is set when the search starts. ---*/
+    CostControl.Initialize(SU2_TYPE::Int(config->GetCFL_AdaptCostParam(0)), 2, 0.05);
+    CostControl.SetParameter(Control::CFL_MAX, CFLMax, CFLMin, CFLMax, 2.0);
+    CostControl.SetParameter(Control::LINSOL_TOL, SU2_TYPE::GetValue(config->GetLinear_Solver_Error()),
+                             SU2_TYPE::GetValue(config->GetCFL_AdaptCostParam(1)),
+                             SU2_TYPE::GetValue(config->GetCFL_AdaptCostParam(2)), sqrt(10.0));
+    CostControl.SetParameter(Control::LINSOL_ITER, maxIter, min(2.0, maxIter), maxIter, 1.5, true);
+    CostControl.SetParameter(Control::PREC_PERIOD, 1, 1, canReuse ? SU2_TYPE::Int(config->GetCFL_AdaptCostParam(3)) : 1,
+                             2.0, true);
+    CostControlReady = true;
+    restart = true;
+  }
+
+  restart |= CostControlRestart;
+  CostControlRestart = false;
+
+  if (restart) {
+    CostControl.Restart();
+    CostWindowFunc = func;
+    CostWindowTime = time;
+  }
+  else if (CostControl.Iterate()) {
+    /*--- Average over ranks for all of them to take the same decisions, the rate is the average
+     reduction of the RMS residuals of all equations, in orders of magnitude per second. ---*/
+    passivedouble local[2] = {func - CostWindowFunc, time - CostWindowTime}, global[2] = {0.0, 0.0};
+    SelectMPIWrapper<passivedouble>::W::Allreduce(local, global, 2, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+    const auto nEqn = nVar + (solverTurb ? solverTurb->GetnVar() : 0);
+    const bool warmup = CostControl.InWarmup();
+    CostControl.Update(-global[0] / (nEqn * max(global[1], EPS)));
+
+    /*--- The search of the CFL limit starts from the (global) maximum CFL reached during the warm-up,
+     CFL_ADAPT_PARAM[3] is often a very large number which the search would never come down from. ---*/
+    if (warmup && !CostControl.InWarmup()) {
+      const auto CFL = min(max(SU2_TYPE::GetValue(Max_CFL_Local), CFLMin), CFLMax);
+      CostControl.SetParameter(Control::CFL_MAX, CFL, CFLMin, CFLMax, 2.0);
+    }
+    CostWindowFunc = func;
+    CostWindowTime = time;
+  }
+
+  /*--- Settings of the next linear solves. ---*/
+
+  const auto tol = CostControl.GetValue(Control::LINSOL_TOL);
+  const auto iter = static_cast<unsigned long>(CostControl.GetValue(Control::LINSOL_ITER));
+  const bool build = CostControl.BuildPreconditioner();
+
+  for (auto* solver : {static_cast<CSolver*>(this), solverTurb}) {
+    if (!solver) continue;
+    solver->System.SetSolverParameters(tol, iter);
+    solver->System.SetReusePreconditioner(!build);
+  }
+}
+
 void CSolver::SetResidual_RMS(const CGeometry *geometry, const CConfig *config) {
 
   if (geometry->GetMGLevel() != MESH_0) return;
@@ -3124,6 +3225,133 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   }
 }
 
+void CSolver::Read_SU2_Restart(CGeometry *geometry, const CConfig *config, const string& val_filename) {
+
+  if (config->GetnRestart_Blend_Files() > 0) {
+    BlendRestartData(geometry, config);
+  } else if (config->GetRead_Binary_Restart()) {
+    Read_SU2_Restart_Binary(geometry, config, val_filename);
+  } else {
+    Read_SU2_Restart_ASCII(geometry, config, val_filename);
+  }
+}
+
+CSolver::CBlendedRestart CSolver::BlendedRestart;
+
+void CSolver::BlendRestartData(CGeometry *geometry, const CConfig *config) {
+
+  /*--- The blend is formed once per zone, the files contain the fields of all the solvers. ---*/
+
+  if (BlendedRestart.config != config || BlendedRestart.geometry != geometry) {
+    ReadBlendedRestart(geometry, config);
+  }
+
+  Restart_Vars = new int[BlendedRestart.vars.size()];
+  copy(BlendedRestart.vars.begin(), BlendedRestart.vars.end(), Restart_Vars);
+  Restart_Data = new passivedouble[BlendedRestart.data.size()];
+  copy(BlendedRestart.data.begin(), BlendedRestart.data.end(), Restart_Data);
+  fields = BlendedRestart.fields;
+}
+
+void CSolver::ClearBlendedRestart() {
+  BlendedRestart = CBlendedRestart();
+}
+
+void CSolver::ReadBlendedRestart(CGeometry *geometry, const CConfig *config) {
+
+  const unsigned short nFiles = config->GetnRestart_Blend_Files();
+  const unsigned short nParam = config->GetnRestart_Blend_Params();
+
+  /*--- Distance of each solution to the current problem in parameter space,
+   *    each parameter is normalized by its range over all the solutions. ---*/
+
+  vector<passivedouble> dist(nFiles, 0.0);
+
+  for (auto iParam = 0u; iParam < nParam; ++iParam) {
+    passivedouble minVal = numeric_limits<passivedouble>::max(), maxVal = -minVal;
+    for (auto iFile = 0u; iFile < nFiles; ++iFile) {
+      const auto val = SU2_TYPE::GetValue(config->GetRestart_Blend_Coord(iFile, iParam));
+      minVal = min(minVal, val);
+      maxVal = max(maxVal, val);
+    }
+    const passivedouble range = (maxVal > minVal) ? maxVal - minVal : 1.0;
+    const auto current = SU2_TYPE::GetValue(config->GetBlend_Param_Value(config->GetRestart_Blend_Param(iParam)));
+
+    for (auto iFile = 0u; iFile < nFiles; ++iFile) {
+      const auto val = SU2_TYPE::GetValue(config->GetRestart_Blend_Coord(iFile, iParam));
+      dist[iFile] += pow((val - current) / range, 2);
+    }
+  }
+
+  /*--- Inverse distance weighting of the nParam+1 nearest solutions (enough to surround
+   *    the current problem), if one of them matches the current problem it is used alone. ---*/
+
+  vector<unsigned short> order(nFiles);
+  iota(order.begin(), order.end(), 0);
+  sort(order.begin(), order.end(), [&dist](unsigned short a, unsigned short b) { return dist[a] < dist[b]; });
+
+  auto nBlend = min<unsigned short>(nFiles, nParam + 1);
+  if (dist[order[0]] < 1e-16) nBlend = 1;
+
+  vector<passivedouble> weight(nBlend, 1.0);
+  if (nBlend > 1) {
+    passivedouble sum = 0.0;
+    for (auto i = 0u; i < nBlend; ++i) {
+      weight[i] = 1.0 / dist[order[i]];
+      sum += weight[i];
+    }
+    for (auto& w : weight) w /= sum;
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "Restart blended from:";
+    for (auto i = 0u; i < nBlend; ++i)
+      cout << " " << config->GetRestart_Blend_File(order[i]) << " (" << weight[i] << ")";
+    cout << endl;
+  }
+
+  /*--- Read and accumulate the solutions, they are interpolated if they come from other meshes. ---*/
+
+  auto& blended = BlendedRestart.data;
+  blended.clear();
+  int nFields = 0;
+
+  for (auto i = 0u; i < nBlend; ++i) {
+    string fileName = config->GetRestart_Blend_File(order[i]);
+    const auto lastindex = fileName.find_last_of('.');
+    const bool ascii = (lastindex != string::npos) && (fileName.substr(lastindex) == ".csv");
+    fileName = fileName.substr(0, lastindex);
+
+    delete [] Restart_Vars;
+    Restart_Vars = nullptr;
+
+    if (ascii) Read_SU2_Restart_ASCII(geometry, config, fileName);
+    else Read_SU2_Restart_Binary(geometry, config, fileName);
+
+    const auto size = static_cast<size_t>(Restart_Vars[1]) * geometry->GetnPointDomain();
+
+    if (i == 0) {
+      nFields = Restart_Vars[1];
+      blended.resize(size, 0.0);
+    } else if (Restart_Vars[1] != nFields) {
+      SU2_MPI::Error("The RESTART_BLEND_FILES do not contain the same fields.", CURRENT_FUNCTION);
+    }
+
+    for (size_t k = 0; k < size; ++k) blended[k] += weight[i] * Restart_Data[k];
+
+    delete [] Restart_Data;
+    Restart_Data = nullptr;
+  }
+
+  BlendedRestart.vars.assign(Restart_Vars, Restart_Vars + 5);
+  BlendedRestart.fields = fields;
+  BlendedRestart.config = config;
+  BlendedRestart.geometry = geometry;
+
+  delete [] Restart_Vars;
+  Restart_Vars = nullptr;
+}
+
 void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *config) {
 
   if (geometry->GetGlobal_nPointDomain() == 0) return;
@@ -4310,7 +4538,10 @@ void CSolver::SavelibROM(CGeometry *geometry, CConfig *config, bool converged) {
   }
 
 #else
-  SU2_MPI::Error("SU2 was not compiled with libROM support.", CURRENT_FUNCTION);
+  /*--- The snapshots of steady problems are also written by the output in SU2 format, which is what the
+   *    reduced-order model (REDUCED_ORDER_MODEL) reads, therefore libROM is not required in that case. ---*/
+  if (config->GetTime_Domain())
+    SU2_MPI::Error("SU2 was not compiled with libROM support.", CURRENT_FUNCTION);
 #endif
 
 }
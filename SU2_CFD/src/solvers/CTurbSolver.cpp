@@ -108,13 +108,9 @@ void CTurbSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfig*
 
   /*--- To make this routine safe to call in parallel most of it can only be executed by one thread. ---*/
   BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
-    /*--- Read the restart data from either an ASCII or binary SU2 file. ---*/
+    /*--- Read the restart data from either an ASCII or binary SU2 file, or blend several files. ---*/
 
-    if (config->GetRead_Binary_Restart()) {
-      Read_SU2_Restart_Binary(geometry[MESH_0], config, restart_filename);
-    } else {
-      Read_SU2_Restart_ASCII(geometry[MESH_0], config, restart_filename);
-    }
+    Read_SU2_Restart(geometry[MESH_0], config, restart_filename);
 
     /*--- Skip flow variables ---*/
 
@@ -69,8 +69,11 @@ void CFEABoundVariable::Clear_SurfaceLoad_Res() { Residual_Ext_Surf.setConstant(
 
 void CFEABoundVariable::RegisterFlowTraction(bool reset) {
   if (!fsi_analysis) return;
-  for (unsigned long iVertex = 0; iVertex < FlowTraction.rows(); iVertex++)
+  const auto nVertex = FlowTraction.rows();
+  SU2_OMP_FOR_STAT(roundUpDiv(nVertex,omp_get_num_threads()))
+  for (unsigned long iVertex = 0; iVertex < nVertex; iVertex++)
     for (unsigned long iVar = 0; iVar < nVar; iVar++)
       if (reset) AD::ResetInput(FlowTraction(iVertex,iVar));
       else AD::RegisterInput(FlowTraction(iVertex,iVar));
+  END_SU2_OMP_FOR
 }
@@ -26,6 +26,7 @@
 
 #include "../../include/variables/CFlowVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CMemoryTracker.hpp"
 
 CFlowVariable::CFlowVariable(unsigned long npoint, unsigned long ndim, unsigned long nvar, unsigned long nprimvar,
                              unsigned long nprimvargrad, const CConfig* config)
@@ -48,32 +49,42 @@ CFlowVariable::CFlowVariable(unsigned long npoint, unsigned long ndim, unsigned
 
   /*--- Primitive variables and gradients (see derived classes for what is stored each column) ---*/
 
-  Primitive.resize(nPoint, nPrimVar) = su2double(0.0);
-
-  if (config->GetMUSCL_Flow() || config->GetViscous() || config->GetContinuous_Adjoint()) {
-    Gradient_Primitive.resize(nPoint, nPrimVarGrad, nDim, 0.0);
+  {
+    SU2_MEMORY_SCOPE("Primitive variables");
+    Primitive.resize(nPoint, nPrimVar) = su2double(0.0);
   }
+  {
+    SU2_MEMORY_SCOPE("Gradients");
 
-  if (config->GetReconstructionGradientRequired() && config->GetKind_ConvNumScheme_Flow() != SPACE_CENTERED) {
-    Gradient_Aux.resize(nPoint, nPrimVarGrad, nDim, 0.0);
-  }
+    if (config->GetMUSCL_Flow() || config->GetViscous() || config->GetContinuous_Adjoint()) {
+      Gradient_Primitive.resize(nPoint, nPrimVarGrad, nDim, 0.0);
+    }
+
+    if (config->GetReconstructionGradientRequired() && config->GetKind_ConvNumScheme_Flow() != SPACE_CENTERED) {
+      Gradient_Aux.resize(nPoint, nPrimVarGrad, nDim, 0.0);
+    }
 
-  if (config->GetLeastSquaresRequired()) {
-    Rmatrix.resize(nPoint, nDim, nDim, 0.0);
+    if (config->GetLeastSquaresRequired()) {
+      Rmatrix.resize(nPoint, nDim, nDim, 0.0);
+    }
   }
+  {
+    SU2_MEMORY_SCOPE("Limiters");
 
-  /*--- Allocate undivided laplacian (centered) ---*/
+    /*--- Allocate undivided laplacian (centered) ---*/
 
-  if (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) {
-    Undivided_Laplacian.resize(nPoint, nVar);
-  }
+    if (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) {
+      Undivided_Laplacian.resize(nPoint, nVar);
+    }
 
-  /*--- Allocate the slope limiter (MUSCL upwind) ---*/
+    /*--- Allocate the slope limiter (MUSCL upwind) ---*/
 
-  if (config->GetKind_SlopeLimit_Flow() != LIMITER::NONE && config->GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE) {
-    Limiter_Primitive.resize(nPoint, nPrimVarGrad) = su2double(0.0);
-    Solution_Max.resize(nPoint, nPrimVarGrad) = su2double(0.0);
-    Solution_Min.resize(nPoint, nPrimVarGrad) = su2double(0.0);
+    if (config->GetKind_SlopeLimit_Flow() != LIMITER::NONE &&
+        config->GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE) {
+      Limiter_Primitive.resize(nPoint, nPrimVarGrad) = su2double(0.0);
+      Solution_Max.resize(nPoint, nPrimVarGrad) = su2double(0.0);
+      Solution_Min.resize(nPoint, nPrimVarGrad) = su2double(0.0);
+    }
   }
 
   Velocity2.resize(nPoint) = su2double(0.0);
@@ -26,28 +26,35 @@
  */
 
 #include "../../include/variables/CScalarVariable.hpp"
+#include "../../../Common/include/toolboxes/CMemoryTracker.hpp"
 
 CScalarVariable::CScalarVariable(unsigned long npoint, unsigned long ndim, unsigned long nvar, const CConfig* config)
     : CVariable(npoint, ndim, nvar, config),
       Gradient_Reconstruction(config->GetReconstructionGradientRequired() ? Gradient_Aux : Gradient) {
   /*--- Gradient related fields ---*/
+  {
+    SU2_MEMORY_SCOPE("Gradients");
 
-  Gradient.resize(nPoint, nVar, nDim, 0.0);
+    Gradient.resize(nPoint, nVar, nDim, 0.0);
 
-  if (config->GetReconstructionGradientRequired()) {
-    Gradient_Aux.resize(nPoint, nVar, nDim, 0.0);
-  }
+    if (config->GetReconstructionGradientRequired()) {
+      Gradient_Aux.resize(nPoint, nVar, nDim, 0.0);
+    }
 
-  if (config->GetLeastSquaresRequired()) {
-    Rmatrix.resize(nPoint, nDim, nDim, 0.0);
+    if (config->GetLeastSquaresRequired()) {
+      Rmatrix.resize(nPoint, nDim, nDim, 0.0);
+    }
   }
 
   /*--- Always allocate the slope limiter, and the auxiliary
    variables (check the logic - JST with 2nd order Turb model) ---*/
+  {
+    SU2_MEMORY_SCOPE("Limiters");
 
-  Limiter.resize(nPoint, nVar) = su2double(0.0);
-  Solution_Max.resize(nPoint, nVar) = su2double(0.0);
-  Solution_Min.resize(nPoint, nVar) = su2double(0.0);
+    Limiter.resize(nPoint, nVar) = su2double(0.0);
+    Solution_Max.resize(nPoint, nVar) = su2double(0.0);
+    Solution_Min.resize(nPoint, nVar) = su2double(0.0);
+  }
 
   Delta_Time.resize(nPoint) = su2double(0.0);
 
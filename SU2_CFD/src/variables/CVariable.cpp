@@ -27,6 +27,7 @@
 
 #include "../../include/variables/CVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CMemoryTracker.hpp"
 
 CVariable::CVariable(unsigned long npoint, unsigned long nvar, const CConfig *config) {
 
@@ -37,6 +38,7 @@ CVariable::CVariable(unsigned long npoint, unsigned long nvar, const CConfig *co
   nVar = nvar;
 
   /*--- Allocate the solution array. ---*/
+  SU2_MEMORY_SCOPE("Solution variables");
   Solution.resize(nPoint,nVar) = su2double(0.0);
 
   if (config->GetMultizone_Problem())
@@ -54,6 +56,7 @@ CVariable::CVariable(unsigned long npoint, unsigned long ndim, unsigned long nva
 
   /*--- Allocate fields common to all problems. Do not allocate fields
    that are specific to one solver, i.e. not common, in this class. ---*/
+  SU2_MEMORY_SCOPE("Solution variables");
   Solution.resize(nPoint,nVar) = su2double(0.0);
 
   Solution_Old.resize(nPoint,nVar) = su2double(0.0);
@@ -58,6 +58,14 @@ class CDeformationDriver : public CDriverBase {
    */
   void Finalize() override;
 
+  /*!
+   * \brief Deform the mesh, with the linear elasticity solver (CMeshSolver) if DEFORM_MESH= YES,
+   *        otherwise with the legacy implementation driven by the design variables.
+   * \note The mesh solver and its stiffness matrix and preconditioner persist across calls, each call only
+   *       solves for the new boundary displacements, starting from the previous volume displacements.
+   */
+  void DeformMesh() override;
+
  protected:
   /*!
    * \brief Read in the config and mesh files.
@@ -89,11 +97,6 @@ class CDeformationDriver : public CDriverBase {
    */
   void OutputFiles();
 
-  /*!
-   * \brief Mesh deformation based on linear elasticity solver (CMeshSolver).
-   */
-  void DeformMesh();
-
   /*!
    * \brief Mesh deformation based on legacy implementation.
    */
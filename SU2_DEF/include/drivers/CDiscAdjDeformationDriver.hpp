@@ -36,6 +36,11 @@ class CDiscAdjDeformationDriver : public CDriverBase {
  protected:
   su2double** Gradient;
 
+  /*--- The Sobolev smoothing solver of each zone is kept across runs, which allows
+   *    the assembled operator and its preconditioner to be reused on the same mesh. ---*/
+  vector<std::unique_ptr<CSolver> > smoothing_solver;     /*!< \brief Gradient smoothing solver of each zone. */
+  vector<std::unique_ptr<CNumerics> > smoothing_numerics; /*!< \brief Gradient smoothing numerics of each zone. */
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -84,6 +89,19 @@ class CDiscAdjDeformationDriver : public CDriverBase {
    */
   void SetProjection_FD(CGeometry* geometry, CConfig* config, CSurfaceMovement* surface_movement, su2double** Gradient);
 
+  /*!
+   * \brief Sensitivity of the objective w.r.t. the control points of an FFD box, computed in a single pass over
+   *        the surface points of the box, by applying the transpose of the FFD map to the surface sensitivity.
+   * \note The FFD map is linear in the control points, the gradient w.r.t. any FFD design variable is then the
+   *       dot product of these sensitivities with the displacements of the control points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] FFDBox - FFD box.
+   * \param[out] cpSens - Sensitivity w.r.t. the control points (see CFreeFormDefBox::AddControlPointSensitivity).
+   */
+  void SetControlPointSensitivity(CGeometry* geometry, const CConfig* config, CFreeFormDefBox* FFDBox,
+                                  vector<su2double>& cpSens) const;
+
   /*!
    * \brief Projection of the surface sensitivity using algorithmic differentiation (AD).
    * \param[in] geometry - Geometrical definition of the problem.
@@ -110,6 +128,13 @@ class CDiscAdjDeformationDriver : public CDriverBase {
    */
   void SetSensitivity_Files(CGeometry**** geometry, CConfig** config, unsigned short val_nZone);
 
+  /*!
+   * \brief Create the Sobolev smoothing solver and numerics of a zone, if they do not exist yet.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SmoothingSolver_Preprocessing(CGeometry* geometry, CConfig* config);
+
   /*!
    * \brief Treatment of derivatives with the Sobolev smoothing solver.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -312,11 +312,13 @@ void CDeformationDriver::DeformLegacy() {
     if (config_container[iZone]->GetDesign_Variable(0) != NO_DEFORMATION) {
       unsigned short nInst_Zone = nInst[iZone];
 
-      /*--- Definition of the Class for grid movement. ---*/
+      /*--- Definition of the Class for grid movement, kept if the mesh is deformed again. ---*/
 
-      grid_movement[iZone] = new CVolumetricMovement*[nInst_Zone]();
-      grid_movement[iZone][INST_0] =
-          new CVolumetricMovement(geometry_container[iZone][INST_0][MESH_0], config_container[iZone]);
+      if (grid_movement[iZone] == nullptr) {
+        grid_movement[iZone] = new CVolumetricMovement*[nInst_Zone]();
+        grid_movement[iZone][INST_0] =
+            new CVolumetricMovement(geometry_container[iZone][INST_0][MESH_0], config_container[iZone]);
+      }
 
       /*--- Save original coordinates to be reused in convexity checking procedure. ---*/
 
@@ -355,6 +357,7 @@ void CDeformationDriver::DeformLegacy() {
 
         /*--- Definition and initialization of the surface deformation class. ---*/
 
+        delete surface_movement[iZone];
         surface_movement[iZone] = new CSurfaceMovement();
         haveSurfaceDeformation = true;
 
@@ -372,6 +372,9 @@ void CDiscAdjDeformationDriver::Finalize() {
   }
   delete[] Gradient;
 
+  smoothing_solver.clear();
+  smoothing_numerics.clear();
+
   if (rank == MASTER_NODE) cout << "\n------------------------- Finalize Solver  -------------------------" << endl;
 
   CommonFinalize();
@@ -386,7 +389,7 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
                                                  CSurfaceMovement* surface_movement, su2double** Gradient) {
   unsigned short iDV, nDV, iFFDBox, nDV_Value, iMarker, iDim;
   unsigned long iVertex, iPoint;
-  su2double delta_eps, my_Gradient, localGradient, *Normal, dS, *VarCoord, Sensitivity, dalpha[3], deps[3], dalpha_deps;
+  su2double delta_eps, my_Gradient, *Normal, dS, *VarCoord, Sensitivity, dalpha[3], deps[3], dalpha_deps;
   bool *UpdatePoint, MoveSurface, Local_MoveSurface;
   CFreeFormDefBox** FFDBox;
 
@@ -394,6 +397,29 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
 
   nDV = config->GetnDV();
 
+  /*--- With cartesian FFD boxes the surface sensitivity is projected once onto the control points, then each
+   * design variable only moves control points, instead of deforming the surface and projecting again. ---*/
+
+  const bool projectFFD = (config->GetFFD_CoordSystem() == CARTESIAN);
+  vector<vector<su2double> > ControlPointSens(MAX_NUMBER_FFD), ControlPointCoord(MAX_NUMBER_FFD);
+
+  auto ControlPointGradient = [&](unsigned short iBox) {
+    const auto* Box = FFDBox[iBox];
+    su2double grad = 0.0;
+    unsigned long iCP = 0;
+    for (unsigned short i = 0; i < Box->GetlOrder(); i++)
+      for (unsigned short j = 0; j < Box->GetmOrder(); j++)
+        for (unsigned short k = 0; k < Box->GetnOrder(); k++, iCP++)
+          for (unsigned short kDim = 0; kDim < 3; kDim++)
+            grad += (Box->GetCoordControlPoints(i, j, k)[kDim] - ControlPointCoord[iBox][3 * iCP + kDim]) *
+                    ControlPointSens[iBox][3 * iCP + kDim];
+    return grad;
+  };
+
+  /*--- Local contributions to the gradient, reduced once for all the design variables. ---*/
+
+  vector<su2double> LocalGradient(nDV, 0.0), GlobalGradient(nDV, 0.0);
+
   /*--- Boolean controlling points to be updated. ---*/
 
   UpdatePoint = new bool[geometry->GetnPoint()];
@@ -454,13 +480,29 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
           surface_movement->CheckFFDIntersections(geometry, config, FFDBox[iFFDBox], iFFDBox);
         }
 
+        if (projectFFD) {
+          if (rank == MASTER_NODE) cout << "Project the surface sensitivity onto the FFD control points." << endl;
+
+          for (iFFDBox = 0; iFFDBox < surface_movement->GetnFFDBox(); iFFDBox++) {
+            SetControlPointSensitivity(geometry, config, FFDBox[iFFDBox], ControlPointSens[iFFDBox]);
+
+            auto& Coord = ControlPointCoord[iFFDBox];
+            Coord.clear();
+            for (unsigned short i = 0; i < FFDBox[iFFDBox]->GetlOrder(); i++)
+              for (unsigned short j = 0; j < FFDBox[iFFDBox]->GetmOrder(); j++)
+                for (unsigned short k = 0; k < FFDBox[iFFDBox]->GetnOrder(); k++)
+                  for (iDim = 0; iDim < 3; iDim++)
+                    Coord.push_back(FFDBox[iFFDBox]->GetCoordControlPoints(i, j, k)[iDim]);
+          }
+        }
+
         if (rank == MASTER_NODE)
           cout << "-------------------------------------------------------------------------" << endl;
       }
 
       if (rank == MASTER_NODE) {
         cout << endl << "Design variable number " << iDV << "." << endl;
-        cout << "Performing 3D deformation of the surface." << endl;
+        if (!projectFFD) cout << "Performing 3D deformation of the surface." << endl;
       }
 
       /*--- Apply the control point change. ---*/
@@ -512,13 +554,20 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
             break;
         }
 
-        /*--- Recompute cartesian coordinates using the new control points position. ---*/
+        /*--- Recompute cartesian coordinates using the new control points position,
+         * or use the projection onto the control points. ---*/
 
         if (Local_MoveSurface) {
-          MoveSurface = true;
-          surface_movement->SetCartesianCoord(geometry, config, FFDBox[iFFDBox], iFFDBox, true);
+          if (projectFFD) {
+            LocalGradient[iDV] += ControlPointGradient(iFFDBox);
+          } else {
+            MoveSurface = true;
+            surface_movement->SetCartesianCoord(geometry, config, FFDBox[iFFDBox], iFFDBox, true);
+          }
         }
       }
+
+      if (projectFFD) LocalGradient[iDV] /= config->GetDV_Value(iDV);
     }
 
     /*--- Hicks-Henne design variable. ---*/
@@ -625,8 +674,16 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
         }
       }
 
-      SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
-      Gradient[iDV][0] += localGradient;
+      LocalGradient[iDV] += my_Gradient;
+    }
+  }
+
+  SU2_MPI::Allreduce(LocalGradient.data(), GlobalGradient.data(), nDV, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  for (iDV = 0; iDV < nDV; iDV++) {
+    if ((config->GetDesign_Variable(iDV) != ANGLE_OF_ATTACK) &&
+        (config->GetDesign_Variable(iDV) != FFD_ANGLE_OF_ATTACK)) {
+      Gradient[iDV][0] += GlobalGradient[iDV];
     }
   }
 
@@ -644,9 +701,60 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
   delete[] UpdatePoint;
 }
 
+void CDiscAdjDeformationDriver::SetControlPointSensitivity(CGeometry* geometry, const CConfig* config,
+                                                           CFreeFormDefBox* FFDBox, vector<su2double>& cpSens) const {
+  const auto nDim = geometry->GetnDim();
+  const auto nSurfacePoint = FFDBox->GetnSurfacePoint();
+
+  cpSens.assign(3ul * FFDBox->GetlOrder() * FFDBox->GetmOrder() * FFDBox->GetnOrder(), 0.0);
+
+  /*--- As in the finite difference projection, each domain point contributes once,
+   * with the normal and sensitivity of its first vertex on a DV marker. ---*/
+
+  vector<unsigned short> FirstMarker(geometry->GetnPoint(), config->GetnMarker_All());
+  for (auto iMarker = config->GetnMarker_All(); iMarker > 0; iMarker--) {
+    if (config->GetMarker_All_DV(iMarker - 1) != YES) continue;
+    for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker - 1]; iVertex++)
+      FirstMarker[geometry->vertex[iMarker - 1][iVertex]->GetNode()] = iMarker - 1;
+  }
+
+  SU2_OMP_PARALLEL {
+    vector<su2double> myCpSens(cpSens.size(), 0.0);
+
+    SU2_OMP_FOR_DYN(256)
+    for (auto iSurfacePoint = 0ul; iSurfacePoint < nSurfacePoint; iSurfacePoint++) {
+      const auto iMarker = FFDBox->Get_MarkerIndex(iSurfacePoint);
+      const auto iPoint = FFDBox->Get_PointIndex(iSurfacePoint);
+
+      if ((iPoint >= geometry->GetnPointDomain()) || (FirstMarker[iPoint] != iMarker)) continue;
+
+      auto* vertex = geometry->vertex[iMarker][FFDBox->Get_VertexIndex(iSurfacePoint)];
+      const su2double* Normal = vertex->GetNormal();
+
+      su2double Area = 0.0;
+      for (auto iDim = 0u; iDim < nDim; iDim++) Area += Normal[iDim] * Normal[iDim];
+      Area = sqrt(Area);
+
+      /*--- Sensitivity w.r.t. the coordinates of the point (see SetProjection_FD). ---*/
+
+      su2double Sens[3] = {0.0}, ParamCoord[3] = {0.0};
+      for (auto iDim = 0u; iDim < nDim; iDim++) Sens[iDim] = -vertex->GetAuxVar() * Normal[iDim] / Area;
+
+      FFDBox->Get_ParametricCoord(iSurfacePoint, ParamCoord);
+      FFDBox->AddControlPointSensitivity(ParamCoord, Sens, myCpSens.data());
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_CRITICAL
+    for (auto i = 0ul; i < cpSens.size(); i++) cpSens[i] += myCpSens[i];
+    END_SU2_OMP_CRITICAL
+  }
+  END_SU2_OMP_PARALLEL
+}
+
 void CDiscAdjDeformationDriver::SetProjection_AD(CGeometry* geometry, CConfig* config,
                                                  CSurfaceMovement* surface_movement, su2double** Gradient) {
-  su2double *VarCoord = nullptr, Sensitivity, my_Gradient, localGradient, *Normal, Area = 0.0;
+  su2double *VarCoord = nullptr, Sensitivity, localGradient, *Normal, Area = 0.0;
   unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV;
   unsigned long iVertex, nVertex, iPoint;
 
@@ -728,11 +836,23 @@ void CDiscAdjDeformationDriver::SetProjection_AD(CGeometry* geometry, CConfig* c
 
   AD::ComputeAdjoint();
 
+  /*--- The reverse sweep gives the derivatives w.r.t. all the design variables, reduce them all at once. ---*/
+
+  vector<su2double> LocalGradient, GlobalGradient;
   for (iDV = 0; iDV < nDV; iDV++) {
     for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
-      my_Gradient = SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value));
+      LocalGradient.push_back(SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value)));
+    }
+  }
+  GlobalGradient.resize(LocalGradient.size());
+
+  SU2_MPI::Allreduce(LocalGradient.data(), GlobalGradient.data(), LocalGradient.size(), MPI_DOUBLE, MPI_SUM,
+                     SU2_MPI::GetComm());
 
-      SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  auto iGradient = 0ul;
+  for (iDV = 0; iDV < nDV; iDV++) {
+    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
+      localGradient = GlobalGradient[iGradient++];
 
       /*--- Angle of Attack design variable (this is different, the value comes form the input file). ---*/
 
@@ -902,6 +1022,20 @@ void CDiscAdjDeformationDriver::SetSensitivity_Files(CGeometry**** geometry, CCo
   }
 }
 
+void CDiscAdjDeformationDriver::SmoothingSolver_Preprocessing(CGeometry* geometry, CConfig* config) {
+  const auto iZone = config->GetiZone();
+
+  if (smoothing_solver.size() <= iZone) {
+    smoothing_solver.resize(iZone + 1);
+    smoothing_numerics.resize(iZone + 1);
+  }
+  if (smoothing_solver[iZone]) return;
+
+  smoothing_solver[iZone].reset(new CGradientSmoothingSolver(geometry, config));
+  unsigned dim = (config->GetSmoothOnSurface() ? geometry->GetnDim() - 1 : geometry->GetnDim());
+  smoothing_numerics[iZone].reset(new CGradSmoothing(dim, config));
+}
+
 void CDiscAdjDeformationDriver::DerivativeTreatment_MeshSensitivity(CGeometry* geometry, CConfig* config,
                                                                     CVolumetricMovement* grid_movement) {
   int rank = SU2_MPI::GetRank();
@@ -913,11 +1047,11 @@ void CDiscAdjDeformationDriver::DerivativeTreatment_MeshSensitivity(CGeometry* g
     SU2_MPI::Error("Unsupported operation modus for the Sobolev Smoothing Solver.", CURRENT_FUNCTION);
   }
 
-  /*-- Construct the smoothing solver and numerics. ---*/
+  /*-- Get the smoothing solver and numerics, they persist across calls for the same zone. ---*/
 
-  std::unique_ptr<CSolver> solver(new CGradientSmoothingSolver(geometry, config));
-  unsigned dim = (config->GetSmoothOnSurface() ? geometry->GetnDim() - 1 : geometry->GetnDim());
-  std::unique_ptr<CNumerics> numerics(new CGradSmoothing(dim, config));
+  SmoothingSolver_Preprocessing(geometry, config);
+  auto* solver = smoothing_solver[config->GetiZone()].get();
+  auto* numerics = smoothing_numerics[config->GetiZone()].get();
 
   if (rank == MASTER_NODE) cout << "Sobolev Smoothing of derivatives is active." << endl;
 
@@ -938,7 +1072,7 @@ void CDiscAdjDeformationDriver::DerivativeTreatment_MeshSensitivity(CGeometry* g
 
       /*--- Perform the smoothing procedure on all boundaries marked as DV marker. ---*/
 
-      solver->ApplyGradientSmoothingSurface(geometry, numerics.get(), config);
+      solver->ApplyGradientSmoothingSurface(geometry, numerics, config);
 
       /*--- After applying the solver write the results back. ---*/
 
@@ -950,7 +1084,7 @@ void CDiscAdjDeformationDriver::DerivativeTreatment_MeshSensitivity(CGeometry* g
 
       solver->ReadSensFromGeometry(geometry);
 
-      solver->ApplyGradientSmoothingVolume(geometry, numerics.get(), config);
+      solver->ApplyGradientSmoothingVolume(geometry, numerics, config);
 
       /*--- After applying the solver write the results back. ---*/
 
@@ -975,11 +1109,11 @@ void CDiscAdjDeformationDriver::DerivativeTreatment_Gradient(CGeometry* geometry
     SU2_MPI::Error("Unsupported operation modus for the Sobolev Smoothing Solver.", CURRENT_FUNCTION);
   }
 
-  /*-- Construct the smoothing solver and numerics. ---*/
+  /*-- Get the smoothing solver and numerics, they persist across calls for the same zone. ---*/
 
-  std::unique_ptr<CSolver> solver(new CGradientSmoothingSolver(geometry, config));
-  unsigned dim = (config->GetSmoothOnSurface() ? geometry->GetnDim() - 1 : geometry->GetnDim());
-  std::unique_ptr<CNumerics> numerics(new CGradSmoothing(dim, config));
+  SmoothingSolver_Preprocessing(geometry, config);
+  auto* solver = smoothing_solver[config->GetiZone()].get();
+  auto* numerics = smoothing_numerics[config->GetiZone()].get();
 
   if (rank == MASTER_NODE) cout << "Sobolev Smoothing of derivatives is active." << endl;
 
@@ -989,7 +1123,7 @@ void CDiscAdjDeformationDriver::DerivativeTreatment_Gradient(CGeometry* geometry
 
   /*--- Apply the smoothing procedure on the DV level. ---*/
   if (config->GetSobMode() == ENUM_SOBOLEV_MODUS::PARAM_LEVEL_COMPLETE) {
-    solver->ApplyGradientSmoothingDV(geometry, numerics.get(), surface_movement, grid_movement, config, Gradient);
+    solver->ApplyGradientSmoothingDV(geometry, numerics, surface_movement, grid_movement, config, Gradient);
 
     /*--- If smoothing already took place on the mesh level, or none is requested, just do standard projection. ---*/
   } else if (config->GetSobMode() == ENUM_SOBOLEV_MODUS::ONLY_GRAD ||
@@ -41,3 +41,48 @@
 #include "../../Common/include/grid_movement/CFreeFormDefBox.hpp"
 
 using namespace std;
+
+/*!
+ * \brief Evaluate the geometrical functions of one airfoil section (area, thickness, chord, etc.).
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in] Plane_P0 - Point in the section plane.
+ * \param[in] Plane_Normal - Normal of the section plane.
+ * \param[in] Xcoord_Airfoil - X coordinates of the section.
+ * \param[in] Ycoord_Airfoil - Y coordinates of the section.
+ * \param[in] Zcoord_Airfoil - Z coordinates of the section.
+ * \param[in] iPlane - Index of the section.
+ * \param[in] nPlane - Number of sections.
+ * \param[out] ObjectiveFunc - Functions of all sections, stored function-major (iFunc * nPlane + iPlane).
+ */
+void ComputeSection_Functions(CGeometry* geometry, CConfig* config, su2double* Plane_P0, su2double* Plane_Normal,
+                              vector<su2double>& Xcoord_Airfoil, vector<su2double>& Ycoord_Airfoil,
+                              vector<su2double>& Zcoord_Airfoil, unsigned short iPlane, unsigned short nPlane,
+                              su2double* ObjectiveFunc);
+
+/*!
+ * \brief Write the header of the gradient file.
+ * \param[in] Gradient_file - Output file.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in] nDim - Number of dimensions.
+ * \param[in] nPlane - Number of sections.
+ * \param[in] tabTecplot - Tecplot (true) or CSV (false) format.
+ */
+void WriteGradient_Header(ofstream& Gradient_file, const CConfig* config, unsigned short nDim, unsigned short nPlane,
+                          bool tabTecplot);
+
+/*!
+ * \brief Compute the gradients of all geometrical functions w.r.t. all design variables using reverse-mode AD.
+ * \note The surface deformation and the function evaluation are recorded once, then each function is obtained
+ *       with one reverse sweep of the tape, instead of one geometry evaluation per design variable.
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in] surface_movement - Surface movement class.
+ * \param[in] Plane_P0 - Points in the section planes.
+ * \param[in] Plane_Normal - Normals of the section planes.
+ * \param[in] nPlane - Number of sections.
+ * \param[in] Gradient_file - Output file (only used by the master node).
+ * \param[in] tabTecplot - Tecplot (true) or CSV (false) format.
+ */
+void SetGradient_AD(CGeometry* geometry, CConfig* config, CSurfaceMovement* surface_movement, su2double** Plane_P0,
+                    su2double** Plane_Normal, unsigned short nPlane, ofstream& Gradient_file, bool tabTecplot);
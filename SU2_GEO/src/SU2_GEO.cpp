@@ -28,6 +28,240 @@
 #include "../include/SU2_GEO.hpp"
 using namespace std;
 
+void ComputeSection_Functions(CGeometry* geometry, CConfig* config, su2double* Plane_P0, su2double* Plane_Normal,
+                              vector<su2double>& Xcoord_Airfoil, vector<su2double>& Ycoord_Airfoil,
+                              vector<su2double>& Zcoord_Airfoil, unsigned short iPlane, unsigned short nPlane,
+                              su2double* ObjectiveFunc) {
+  if (config->GetGeo_Description() == FUSELAGE) {
+    ObjectiveFunc[0 * nPlane + iPlane] =
+        geometry->Compute_Area(Plane_P0, Plane_Normal, config, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+    ObjectiveFunc[1 * nPlane + iPlane] =
+        geometry->Compute_Length(Plane_P0, Plane_Normal, config, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+    ObjectiveFunc[2 * nPlane + iPlane] =
+        geometry->Compute_Width(Plane_P0, Plane_Normal, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+    ObjectiveFunc[3 * nPlane + iPlane] = geometry->Compute_WaterLineWidth(Plane_P0, Plane_Normal, config,
+                                                                          Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+    ObjectiveFunc[4 * nPlane + iPlane] =
+        geometry->Compute_Height(Plane_P0, Plane_Normal, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+  } else {
+    ObjectiveFunc[0 * nPlane + iPlane] =
+        geometry->Compute_Area(Plane_P0, Plane_Normal, config, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+    ObjectiveFunc[1 * nPlane + iPlane] =
+        geometry->Compute_MaxThickness(Plane_P0, Plane_Normal, config, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+    ObjectiveFunc[2 * nPlane + iPlane] =
+        geometry->Compute_Chord(Plane_P0, Plane_Normal, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+    ObjectiveFunc[3 * nPlane + iPlane] =
+        geometry->Compute_LERadius(Plane_P0, Plane_Normal, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+    ObjectiveFunc[4 * nPlane + iPlane] = ObjectiveFunc[1 * nPlane + iPlane] / ObjectiveFunc[2 * nPlane + iPlane];
+    ObjectiveFunc[5 * nPlane + iPlane] =
+        geometry->Compute_Twist(Plane_P0, Plane_Normal, Xcoord_Airfoil, Ycoord_Airfoil, Zcoord_Airfoil);
+  }
+}
+
+void WriteGradient_Header(ofstream& Gradient_file, const CConfig* config, unsigned short nDim, unsigned short nPlane,
+                          bool tabTecplot) {
+  unsigned short iPlane;
+
+  if (tabTecplot) Gradient_file << "TITLE = \"SU2_GEO Gradient\"" << endl;
+  if (tabTecplot) Gradient_file << "VARIABLES = //" << endl;
+
+  if (nDim == 2) {
+    Gradient_file << "\"DESIGN_VARIABLE\",\"AIRFOIL_AREA\",\"AIRFOIL_THICKNESS\",\"AIRFOIL_CHORD\",\"AIRFOIL_"
+                     "LE_RADIUS\",\"AIRFOIL_TOC\",\"AIRFOIL_ALPHA\"";
+  } else if (nDim == 3) {
+    if (config->GetGeo_Description() == FUSELAGE) {
+      Gradient_file << "\"DESIGN_VARIABLE\",";
+      Gradient_file << "\"FUSELAGE_VOLUME\",\"FUSELAGE_WETTED_AREA\",\"FUSELAGE_MIN_WIDTH\",\"FUSELAGE_MAX_"
+                       "WIDTH\",\"FUSELAGE_MIN_WATERLINE_WIDTH\",\"FUSELAGE_MAX_WATERLINE_WIDTH\",\"FUSELAGE_"
+                       "MIN_HEIGHT\",\"FUSELAGE_MAX_HEIGHT\",\"FUSELAGE_MAX_CURVATURE\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_AREA\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_LENGTH\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_WIDTH\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++)
+        Gradient_file << "\"STATION" << (iPlane + 1) << "_WATERLINE_WIDTH\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) {
+        Gradient_file << "\"STATION" << (iPlane + 1) << "_HEIGHT\"";
+        if (iPlane != nPlane - 1) Gradient_file << ",";
+      }
+    } else if (config->GetGeo_Description() == NACELLE) {
+      Gradient_file << "\"DESIGN_VARIABLE\",";
+      Gradient_file
+          << "\"NACELLE_VOLUME\",\"NACELLE_MIN_THICKNESS\",\"NACELLE_MAX_THICKNESS\",\"NACELLE_MIN_CHORD\","
+             "\"NACELLE_MAX_CHORD\",\"NACELLE_MIN_LE_RADIUS\",\"NACELLE_MAX_LE_RADIUS\",\"NACELLE_MIN_TOC\","
+             "\"NACELLE_MAX_TOC\",\"NACELLE_OBJFUN_MIN_TOC\",\"NACELLE_MAX_TWIST\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_AREA\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++)
+        Gradient_file << "\"STATION" << (iPlane + 1) << "_THICKNESS\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_CHORD\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++)
+        Gradient_file << "\"STATION" << (iPlane + 1) << "_LE_RADIUS\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_TOC\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) {
+        Gradient_file << "\"STATION" << (iPlane + 1) << "_TWIST\"";
+        if (iPlane != nPlane - 1) Gradient_file << ",";
+      }
+    } else {
+      Gradient_file << "\"DESIGN_VARIABLE\",";
+      Gradient_file
+          << "\"WING_VOLUME\",\"WING_MIN_THICKNESS\",\"WING_MAX_THICKNESS\",\"WING_MIN_CHORD\",\"WING_MAX_"
+             "CHORD\",\"WING_MIN_LE_RADIUS\",\"WING_MAX_LE_RADIUS\",\"WING_MIN_TOC\",\"WING_MAX_TOC\",\"WING_"
+             "OBJFUN_MIN_TOC\",\"WING_MAX_TWIST\",\"WING_MAX_CURVATURE\",\"WING_MAX_DIHEDRAL\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_AREA\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++)
+        Gradient_file << "\"STATION" << (iPlane + 1) << "_THICKNESS\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_CHORD\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++)
+        Gradient_file << "\"STATION" << (iPlane + 1) << "_LE_RADIUS\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_TOC\",";
+      for (iPlane = 0; iPlane < nPlane; iPlane++) {
+        Gradient_file << "\"STATION" << (iPlane + 1) << "_TWIST\"";
+        if (iPlane != nPlane - 1) Gradient_file << ",";
+      }
+    }
+  }
+
+  if (tabTecplot)
+    Gradient_file << "\nZONE T= \"Geometrical variables (gradient)\"" << endl;
+  else
+    Gradient_file << endl;
+}
+
+void SetGradient_AD(CGeometry* geometry, CConfig* config, CSurfaceMovement* surface_movement, su2double** Plane_P0,
+                    su2double** Plane_Normal, unsigned short nPlane, ofstream& Gradient_file, bool tabTecplot) {
+  const int rank = SU2_MPI::GetRank();
+  const unsigned short nDim = geometry->GetnDim();
+  const unsigned short nDV = config->GetnDV();
+  const unsigned short nSectionFunc = (config->GetGeo_Description() == FUSELAGE) ? 5 : 6;
+
+  if (rank == MASTER_NODE)
+    cout << endl << endl << "---------- Gradient evaluation using algorithmic differentiation ---------" << endl;
+
+  /*--- The design variable values are the finite difference steps, the gradient is computed in their
+   direction (normalized by the first value) to match the finite difference definition. ---*/
+
+  vector<vector<passivedouble> > DV_Step(nDV);
+  for (auto iDV = 0u; iDV < nDV; iDV++) {
+    for (auto iDV_Value = 0u; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++)
+      DV_Step[iDV].push_back(SU2_TYPE::GetValue(config->GetDV_Value(iDV, iDV_Value)));
+    if (DV_Step[iDV][0] == 0.0) {
+      SU2_MPI::Error("The finite difference steps is zero!!", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- Start recording of operations. ---*/
+
+  AD::StartRecording();
+
+  /*--- Register design variables as input and set them to zero
+   * (since we want to have the derivative at alpha = 0, i.e. for the current design). ---*/
+
+  for (auto iDV = 0u; iDV < nDV; iDV++) {
+    for (auto iDV_Value = 0u; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
+      config->SetDV_Value(iDV, iDV_Value, 0.0);
+      AD::RegisterInput(config->GetDV_Value(iDV, iDV_Value));
+    }
+  }
+
+  /*--- Call the surface deformation routine, this sets the variation of the surface coordinates. ---*/
+
+  surface_movement->SetSurface_Deformation(geometry, config);
+
+  /*--- Evaluate the geometrical functions on the deformed surface, in the order of the gradient file. ---*/
+
+  vector<su2double> Function;
+
+  if (nDim == 3) {
+    su2double Value[13] = {0.0};
+
+    if (config->GetGeo_Description() == FUSELAGE) {
+      geometry->Compute_Fuselage(config, false, Value[0], Value[1], Value[2], Value[3], Value[4], Value[5], Value[6],
+                                 Value[7], Value[8]);
+      Function.assign(Value, Value + 9);
+    } else if (config->GetGeo_Description() == NACELLE) {
+      geometry->Compute_Nacelle(config, false, Value[0], Value[1], Value[2], Value[3], Value[4], Value[5], Value[6],
+                                Value[7], Value[8], Value[9], Value[10]);
+      Function.assign(Value, Value + 11);
+    } else {
+      geometry->Compute_Wing(config, false, Value[0], Value[1], Value[2], Value[3], Value[4], Value[5], Value[6],
+                             Value[7], Value[8], Value[9], Value[10], Value[11], Value[12]);
+      Function.assign(Value, Value + 13);
+    }
+  }
+
+  const auto nGlobalFunc = Function.size();
+  Function.resize(nGlobalFunc + nSectionFunc * nPlane, 0.0);
+
+  vector<vector<su2double> > Xcoord_Airfoil(nPlane), Ycoord_Airfoil(nPlane), Zcoord_Airfoil(nPlane),
+      Variable_Airfoil(nPlane);
+
+  geometry->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, Xcoord_Airfoil.data(), Ycoord_Airfoil.data(),
+                                    Zcoord_Airfoil.data(), Variable_Airfoil.data(), false, config);
+
+  for (auto iPlane = 0u; iPlane < nPlane; iPlane++) {
+    if ((rank == MASTER_NODE) && (Xcoord_Airfoil[iPlane].size() > 1)) {
+      ComputeSection_Functions(geometry, config, Plane_P0[iPlane], Plane_Normal[iPlane], Xcoord_Airfoil[iPlane],
+                               Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane], iPlane, nPlane, &Function[nGlobalFunc]);
+    }
+  }
+
+  for (auto& value : Function) AD::RegisterOutput(value);
+
+  /*--- Stop the recording. ---*/
+
+  AD::StopRecording();
+
+  /*--- One reverse sweep per function. The sections are gathered on the master, where the functions are
+   seeded, the contributions of each rank to the design variables are summed. ---*/
+
+  const auto nFunc = Function.size();
+  vector<passivedouble> my_Gradient(nDV), localGradient(nDV);
+  vector<vector<passivedouble> > Gradient(nDV, vector<passivedouble>(nFunc, 0.0));
+
+  for (auto iFunc = 0ul; iFunc < nFunc; iFunc++) {
+    AD::ClearAdjoints();
+
+    if (rank == MASTER_NODE) SU2_TYPE::SetDerivative(Function[iFunc], 1.0);
+
+    AD::ComputeAdjoint();
+
+    for (auto iDV = 0u; iDV < nDV; iDV++) {
+      my_Gradient[iDV] = 0.0;
+      for (auto iDV_Value = 0u; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
+        my_Gradient[iDV] +=
+            SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value)) * DV_Step[iDV][iDV_Value] / DV_Step[iDV][0];
+      }
+    }
+
+    SelectMPIWrapper<passivedouble>::W::Allreduce(my_Gradient.data(), localGradient.data(), nDV, MPI_DOUBLE, MPI_SUM,
+                                                  SU2_MPI::GetComm());
+
+    for (auto iDV = 0u; iDV < nDV; iDV++) Gradient[iDV][iFunc] = localGradient[iDV];
+  }
+
+  AD::Reset();
+
+  /*--- Screen and file output, same format as the finite difference evaluation. ---*/
+
+  if (rank == MASTER_NODE) {
+    WriteGradient_Header(Gradient_file, config, nDim, nPlane, tabTecplot);
+
+    for (auto iDV = 0u; iDV < nDV; iDV++) {
+      cout << endl << "Design variable number " << iDV << ". Gradient: ";
+      Gradient_file << iDV << ",";
+      for (auto iFunc = 0ul; iFunc < nFunc; iFunc++) {
+        cout << Gradient[iDV][iFunc];
+        Gradient_file << Gradient[iDV][iFunc];
+        if (iFunc != nFunc - 1) {
+          cout << ", ";
+          Gradient_file << ",";
+        }
+      }
+      Gradient_file << endl;
+    }
+    cout << endl;
+  }
+}
+
 int main(int argc, char* argv[]) {
   unsigned short iZone, nZone = SINGLE_ZONE;
   su2double StartTime = 0.0, StopTime = 0.0, UsedTime = 0.0;
@@ -454,11 +688,8 @@ int main(int argc, char* argv[]) {
     }
   }
 
-  for (iPlane = 0; iPlane < nPlane; iPlane++) {
-    geometry_container[ZONE_0]->ComputeAirfoil_Section(
-        Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6, nullptr, Xcoord_Airfoil[iPlane],
-        Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane], Variable_Airfoil[iPlane], true, config_container[ZONE_0]);
-  }
+  geometry_container[ZONE_0]->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, Xcoord_Airfoil, Ycoord_Airfoil,
+                                                      Zcoord_Airfoil, Variable_Airfoil, true, config_container[ZONE_0]);
 
   if (rank == MASTER_NODE)
     cout << endl << "-------------------- Objective function evaluation ----------------------" << endl;
@@ -724,9 +955,6 @@ int main(int argc, char* argv[]) {
     FFDBox = new CFreeFormDefBox*[MAX_NUMBER_FFD];
     for (iFFDBox = 0; iFFDBox < MAX_NUMBER_FFD; iFFDBox++) FFDBox[iFFDBox] = nullptr;
 
-    if (rank == MASTER_NODE)
-      cout << endl << endl << "------------- Gradient evaluation using finite differences --------------" << endl;
-
     /*--- Write the gradient in a external file ---*/
     if (rank == MASTER_NODE) {
       string filename = config_container[ZONE_0]->GetObjFunc_Grad_FileName();
@@ -739,7 +967,20 @@ int main(int argc, char* argv[]) {
       Gradient_file.open(filename.c_str(), ios::out);
     }
 
-    for (iDV = 0; iDV < config_container[ZONE_0]->GetnDV(); iDV++) {
+    /*--- With AD support (SU2_GEO_AD) all the gradients are obtained from one recording of the
+     deformation and of the geometrical functions, otherwise each design variable is perturbed. ---*/
+
+    const bool gradient_AD = config_container[ZONE_0]->GetAD_Mode();
+    const unsigned short nDV_FD = gradient_AD ? 0 : config_container[ZONE_0]->GetnDV();
+
+    if (gradient_AD) {
+      SetGradient_AD(geometry_container[ZONE_0], config_container[ZONE_0], surface_movement, Plane_P0, Plane_Normal,
+                     nPlane, Gradient_file, tabTecplot);
+    } else if (rank == MASTER_NODE) {
+      cout << endl << endl << "------------- Gradient evaluation using finite differences --------------" << endl;
+    }
+
+    for (iDV = 0; iDV < nDV_FD; iDV++) {
       /*--- Free Form deformation based ---*/
 
       if ((config_container[ZONE_0]->GetDesign_Variable(iDV) == FFD_CONTROL_POINT_2D) ||
@@ -988,12 +1229,9 @@ int main(int argc, char* argv[]) {
 
         /*--- Create airfoil structure ---*/
 
-        for (iPlane = 0; iPlane < nPlane; iPlane++) {
-          geometry_container[ZONE_0]->ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6,
-                                                             1E6, -1E6, 1E6, nullptr, Xcoord_Airfoil[iPlane],
-                                                             Ycoord_Airfoil[iPlane], Zcoord_Airfoil[iPlane],
-                                                             Variable_Airfoil[iPlane], false, config_container[ZONE_0]);
-        }
+        geometry_container[ZONE_0]->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, Xcoord_Airfoil,
+                                                            Ycoord_Airfoil, Zcoord_Airfoil, Variable_Airfoil, false,
+                                                            config_container[ZONE_0]);
       }
 
       /*--- Compute gradient ---*/
@@ -1310,68 +1548,8 @@ int main(int argc, char* argv[]) {
         cout << endl;
 
         if (iDV == 0) {
-          if (tabTecplot) Gradient_file << "TITLE = \"SU2_GEO Gradient\"" << endl;
-          if (tabTecplot) Gradient_file << "VARIABLES = //" << endl;
-
-          if (geometry_container[ZONE_0]->GetnDim() == 2) {
-            Gradient_file << "\"DESIGN_VARIABLE\",\"AIRFOIL_AREA\",\"AIRFOIL_THICKNESS\",\"AIRFOIL_CHORD\",\"AIRFOIL_"
-                             "LE_RADIUS\",\"AIRFOIL_TOC\",\"AIRFOIL_ALPHA\"";
-          } else if (geometry_container[ZONE_0]->GetnDim() == 3) {
-            if (config_container[ZONE_0]->GetGeo_Description() == FUSELAGE) {
-              Gradient_file << "\"DESIGN_VARIABLE\",";
-              Gradient_file << "\"FUSELAGE_VOLUME\",\"FUSELAGE_WETTED_AREA\",\"FUSELAGE_MIN_WIDTH\",\"FUSELAGE_MAX_"
-                               "WIDTH\",\"FUSELAGE_MIN_WATERLINE_WIDTH\",\"FUSELAGE_MAX_WATERLINE_WIDTH\",\"FUSELAGE_"
-                               "MIN_HEIGHT\",\"FUSELAGE_MAX_HEIGHT\",\"FUSELAGE_MAX_CURVATURE\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_AREA\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_LENGTH\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_WIDTH\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++)
-                Gradient_file << "\"STATION" << (iPlane + 1) << "_WATERLINE_WIDTH\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) {
-                Gradient_file << "\"STATION" << (iPlane + 1) << "_HEIGHT\"";
-                if (iPlane != nPlane - 1) Gradient_file << ",";
-              }
-            } else if (config_container[ZONE_0]->GetGeo_Description() == NACELLE) {
-              Gradient_file << "\"DESIGN_VARIABLE\",";
-              Gradient_file
-                  << "\"NACELLE_VOLUME\",\"NACELLE_MIN_THICKNESS\",\"NACELLE_MAX_THICKNESS\",\"NACELLE_MIN_CHORD\","
-                     "\"NACELLE_MAX_CHORD\",\"NACELLE_MIN_LE_RADIUS\",\"NACELLE_MAX_LE_RADIUS\",\"NACELLE_MIN_TOC\","
-                     "\"NACELLE_MAX_TOC\",\"NACELLE_OBJFUN_MIN_TOC\",\"NACELLE_MAX_TWIST\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_AREA\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++)
-                Gradient_file << "\"STATION" << (iPlane + 1) << "_THICKNESS\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_CHORD\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++)
-                Gradient_file << "\"STATION" << (iPlane + 1) << "_LE_RADIUS\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_TOC\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) {
-                Gradient_file << "\"STATION" << (iPlane + 1) << "_TWIST\"";
-                if (iPlane != nPlane - 1) Gradient_file << ",";
-              }
-            } else {
-              Gradient_file << "\"DESIGN_VARIABLE\",";
-              Gradient_file
-                  << "\"WING_VOLUME\",\"WING_MIN_THICKNESS\",\"WING_MAX_THICKNESS\",\"WING_MIN_CHORD\",\"WING_MAX_"
-                     "CHORD\",\"WING_MIN_LE_RADIUS\",\"WING_MAX_LE_RADIUS\",\"WING_MIN_TOC\",\"WING_MAX_TOC\",\"WING_"
-                     "OBJFUN_MIN_TOC\",\"WING_MAX_TWIST\",\"WING_MAX_CURVATURE\",\"WING_MAX_DIHEDRAL\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_AREA\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++)
-                Gradient_file << "\"STATION" << (iPlane + 1) << "_THICKNESS\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_CHORD\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++)
-                Gradient_file << "\"STATION" << (iPlane + 1) << "_LE_RADIUS\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) Gradient_file << "\"STATION" << (iPlane + 1) << "_TOC\",";
-              for (iPlane = 0; iPlane < nPlane; iPlane++) {
-                Gradient_file << "\"STATION" << (iPlane + 1) << "_TWIST\"";
-                if (iPlane != nPlane - 1) Gradient_file << ",";
-              }
-            }
-          }
-
-          if (tabTecplot)
-            Gradient_file << "\nZONE T= \"Geometrical variables (gradient)\"" << endl;
-          else
-            Gradient_file << endl;
+          WriteGradient_Header(Gradient_file, config_container[ZONE_0], geometry_container[ZONE_0]->GetnDim(), nPlane,
+                               tabTecplot);
         }
 
         Gradient_file << (iDV) << ",";
@@ -183,13 +183,22 @@ def GEO(config):
     """
     konfig = copy.deepcopy(config)
 
+    # gradients from a single AD recording instead of finite differences, on request
+    auto_diff = (
+        konfig.get("GEO_MODE", "FUNCTION") == "GRADIENT"
+        and konfig.get("AUTO_DIFF", "NO") == "YES"
+    )
+
     tempname = "config_GEO.cfg"
     konfig.dump(tempname)
 
     # must run with rank 1
     processes = konfig["NUMBER_PART"]
 
-    the_Command = "SU2_GEO%s %s" % (quote, tempname)
+    if auto_diff:
+        the_Command = "SU2_GEO_AD%s %s" % (quote, tempname)
+    else:
+        the_Command = "SU2_GEO%s %s" % (quote, tempname)
     the_Command = build_command(the_Command, processes)
     run_command(the_Command)
 
@@ -92,6 +92,7 @@ const unsigned int MESH_1 = 1; /*!< \brief Definition of the finest grid level.
 const unsigned int ZONE_0 = 0; /*!< \brief Definition of the first grid domain. */
 const unsigned int ZONE_1 = 1; /*!< \brief Definition of the first grid domain. */
 
+%include "pyWrapperMatrixView.i"
 %include "../../Common/include/containers/CPyWrapperMatrixView.hpp"
 %include "../../SU2_CFD/include/drivers/CDriverBase.hpp"
 %include "../../SU2_CFD/include/drivers/CDriver.hpp"
@@ -0,0 +1,96 @@
+/*
+################################################################################
+#
+# \file pyWrapperMatrixView.i
+# \brief NumPy interface of the matrix views of the Python wrapper, shared by pysu2 and pysu2ad.
+# \version 8.0.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+#
+################################################################################
+*/
+
+// The raw addresses are only used to build the buffers below.
+%ignore PassiveAddress;
+%ignore CPyWrapperMatrixView::BufferData;
+%ignore CPyWrapperMarkerMatrixView::BufferData;
+
+// Memory view (Python buffer protocol) of the storage underlying a view, read-only unless it can be modified
+// directly. NumPy arrays created on it do not copy the data, they remain valid while the driver exists.
+%define PY_WRAPPER_BUFFER(ClassName)
+%extend ClassName {
+  PyObject* _Buffer() const {
+    static char empty = 0;
+    const auto strides = $self->BufferStrides();
+    const auto rows = $self->BufferRows();
+    const auto cols = $self->Shape().second;
+    if (rows == 0 || cols == 0) return PyMemoryView_FromMemory(&empty, 0, PyBUF_READ);
+    const Py_ssize_t size = (rows - 1) * strides.first + (cols - 1) * strides.second + sizeof(passivedouble);
+    auto* data = const_cast<char*>(reinterpret_cast<const char*>($self->BufferData()));
+    return PyMemoryView_FromMemory(data, size, $self->IsBufferWritable() ? PyBUF_WRITE : PyBUF_READ);
+  }
+  %pythoncode %{
+    def _Storage(self):
+        import numpy
+        return numpy.ndarray((self.BufferRows(), self.Shape()[1]), dtype=numpy.float64,
+                             buffer=self._Buffer(), strides=self.BufferStrides())
+  %}
+}
+%enddef
+
+PY_WRAPPER_BUFFER(CPyWrapperMatrixView)
+PY_WRAPPER_BUFFER(CPyWrapperMarkerMatrixView)
+
+%extend CPyWrapperMatrixView {
+  %pythoncode %{
+    def ToNumpy(self):
+        """Returns a NumPy array that shares the memory of the solver (no copy). The array is read-only if
+        the view is, and in AD builds (use FromNumpy to modify the values)."""
+        return self._Storage()
+
+    def FromNumpy(self, values):
+        """Sets all the values of the view from an array with the shape of the view."""
+        if self.IsBufferWritable():
+            self._Storage()[:] = values
+        else:
+            for row, vals in enumerate(values):
+                self.Set(row, [float(val) for val in vals])
+  %}
+}
+
+%extend CPyWrapperMarkerMatrixView {
+  %pythoncode %{
+    def ToNumpy(self):
+        """Returns a NumPy array (copy) with the values at the vertices of the marker, gathered with a
+        single vectorized operation on the memory of the solver."""
+        import numpy
+        return self._Storage()[numpy.array(self.GetNodes(), dtype=numpy.intp)]
+
+    def FromNumpy(self, values):
+        """Sets the values at the vertices of the marker from an array with the shape of the view."""
+        import numpy
+        if self.IsBufferWritable():
+            self._Storage()[numpy.array(self.GetNodes(), dtype=numpy.intp)] = values
+        else:
+            for row, vals in enumerate(values):
+                self.Set(row, [float(val) for val in vals])
+  %}
+}
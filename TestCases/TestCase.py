@@ -26,6 +26,7 @@
 # License along with SU2. If not, see <http://www.gnu.org/licenses/>.
 from __future__ import print_function, division, absolute_import
 import time, os, subprocess, datetime, sys
+import csv
 import difflib
 import platform
 import argparse
@@ -125,6 +126,12 @@ class TestCase:
         self.reference_file_aarch64 = ""
         self.test_file      = "of_grad.dat"
 
+        # Options for performance tests, the first perf_warmup iterations are not timed.
+        # The tolerances are relative and only increases of the metrics are failures.
+        self.perf_iter   = 10
+        self.perf_warmup = 2
+        self.perf_tol    = {'time_iter': 0.15, 'mem_peak': 0.10, 'linsol_iter': 0.05}
+
     def run_test(self, running_with_tsan=False):
 
         if not self.is_enabled(running_with_tsan):
@@ -850,6 +857,183 @@ class TestCase:
         os.chdir(workdir)
         return passed
 
+    def run_perf(self, baselines, update=False, repeat=1):
+        """ Run the case with a fixed number of iterations and compare the time per iteration, the
+        peak memory, and the number of linear solver iterations with the baseline of the case.
+
+        Parameters
+        ----------
+        baselines : dict
+            Baseline metrics by test tag, the entry of this case is replaced if update is True.
+        update : bool
+            Store the measured metrics as the new baseline instead of comparing.
+        repeat : int
+            Number of runs, the fastest time per iteration is used.
+        """
+
+        if not self.is_enabled():
+            return True
+
+        print('==================== Start Perf Test: %s ===================='%self.tag)
+        passed = True
+
+        # if root, add flag to mpirun
+        self.command.allow_mpi_as_root()
+
+        self.adjust_perf_options()
+
+        logfilename = '%s_perf.log' % os.path.splitext(self.cfg_file)[0]
+        shell_command = "%s %s > %s 2>&1" % (self.command.assemble(), self.cfg_file, logfilename)
+
+        workdir = os.getcwd()
+        os.chdir(self.cfg_dir)
+        print(os.getcwd())
+
+        metrics = None
+        running_time = 0
+        for _ in range(max(repeat, 1)):
+            start   = datetime.datetime.now()
+            process = subprocess.Popen(shell_command, shell=True)  # This line launches SU2
+
+            # check for timeout
+            timed_out = False
+            while process.poll() is None:
+                time.sleep(0.1)
+                running_time = (datetime.datetime.now() - start).seconds
+                if running_time > self.timeout:
+                    try:
+                        process.kill()
+                        self.command.killall() # In case of parallel execution
+                    except AttributeError:
+                        pass
+                    timed_out = True
+
+            if timed_out or process.returncode != 0:
+                print('ERROR: The case %s.' % ('timed out, timeout=%d' % self.timeout if timed_out else 'failed'))
+                subprocess.call(['cat', logfilename])
+                passed = False
+                break
+
+            run_metrics = self.read_perf_metrics(logfilename)
+            if 'time_iter' not in run_metrics:
+                print('ERROR: The time per iteration was not found in the history file (was SU2 built with profiling?).')
+                passed = False
+                break
+            if metrics is None or run_metrics['time_iter'] < metrics['time_iter']:
+                metrics = run_metrics
+
+        if passed:
+            baseline = baselines.get(self.tag)
+            print('%-12s %14s %14s %10s' % ('Metric', 'Baseline', 'Measured', 'Change'))
+            for name in sorted(metrics):
+                ref = baseline.get(name) if baseline else None
+                if ref is None or update:
+                    print('%-12s %14s %14.6g' % (name, '-', metrics[name]))
+                    continue
+                change = (metrics[name] - ref) / ref if ref > 0 else 0.0
+                status = ''
+                if change > self.perf_tol.get(name, 0.0):
+                    status = ' REGRESSION (tol=%.0f%%)' % (100 * self.perf_tol.get(name, 0.0))
+                    passed = False
+                print('%-12s %14.6g %14.6g %+9.1f%%%s' % (name, ref, metrics[name], 100 * change, status))
+
+            if update:
+                baselines[self.tag] = metrics
+                print('Baseline updated.')
+            elif baseline is None:
+                print('WARNING: There is no baseline for this case, run with --update to create it.')
+
+        if passed:
+            print("%s: PASSED"%self.tag)
+        else:
+            print("%s: FAILED"%self.tag)
+
+        print('execution command: %s' % shell_command)
+        print('test duration: %.2f min'%(running_time/60.0))
+        print('==================== End Perf Test: %s ====================\n'%self.tag)
+
+        sys.stdout.flush()
+        os.chdir(workdir)
+        return passed
+
+    def adjust_perf_options(self):
+        """ Write a copy of the config file with the options required by run_perf. """
+
+        workdir = os.getcwd()
+        os.chdir(self.cfg_dir)
+        file_in = open(self.cfg_file, 'r')
+        lines   = file_in.readlines()
+        file_in.close()
+
+        keys = [line.strip().split("=")[0].strip() for line in lines]
+
+        if self.unsteady:
+            iter_string = "TIME_ITER"
+        elif self.multizone:
+            iter_string = "OUTER_ITER"
+        elif "INNER_ITER" in keys:
+            iter_string = "INNER_ITER"
+        else:
+            iter_string = "ITER"
+
+        # The profiler provides the time per iteration and the memory report the peak memory,
+        # the convergence criteria must not stop the run before the fixed number of iterations.
+        options = {iter_string: str(self.perf_iter),
+                   "PROFILING": "YES",
+                   "WRT_MEMORY_REPORT": "YES",
+                   "HISTORY_OUTPUT": "(ITER, PERF_TIME, LINSOL, DEFORM)",
+                   "HISTORY_WRT_FREQ_INNER": "1",
+                   "CONV_FILENAME": "perf_history",
+                   "TABULAR_FORMAT": "CSV",
+                   "CONV_RESIDUAL_MINVAL": "-99",
+                   "CONV_CAUCHY_EPS": "1e-99"}
+
+        self.cfg_file = "%s.perftest"%self.cfg_file
+        file_out = open(self.cfg_file,'w')
+        file_out.write('% This file automatically generated by the performance regression script\n')
+        for key, line in zip(keys, lines):
+            if key not in options:
+                file_out.write(line)
+        for key, value in options.items():
+            file_out.write("%s= %s\n" % (key, value))
+        file_out.close()
+        os.chdir(workdir)
+
+        return
+
+    def read_perf_metrics(self, logfilename):
+        """ Read the metrics of a performance run from the history file and the log (in the case directory). """
+
+        metrics = {}
+
+        # Time per iteration (median of the timed iterations) and total linear solver iterations.
+        if os.path.isfile("perf_history.csv"):
+            with open("perf_history.csv", 'r') as history:
+                rows = [[field.strip().strip('"') for field in row] for row in csv.reader(history)]
+            header, rows = rows[0], [row for row in rows[1:] if len(row) == len(rows[0])]
+
+            if "Time_Iter(s)" in header:
+                col = header.index("Time_Iter(s)")
+                warmup = min(self.perf_warmup, len(rows) - 1)
+                times = sorted(float(row[col]) for row in rows[warmup:])
+                if times:
+                    metrics['time_iter'] = times[len(times) // 2]
+
+            # Columns of the LINSOL_ITER* and DEFORM_ITER fields of all the solvers (and zones, "name[iZone]"),
+            # the compressible flow outputs name their LINSOL_ITER field differently from the other outputs.
+            linsol_names = ("LinSolIter", "Linear_Solver_Iterations", "DeformIter")
+            cols = [i for i, name in enumerate(header) if name.split('[')[0].startswith(linsol_names)]
+            if cols:
+                metrics['linsol_iter'] = sum(float(row[i]) for row in rows for i in cols)
+                print('Linear solver iterations of: %s' % ', '.join(header[i] for i in cols))
+
+        # Peak resident memory of the largest process, from the last memory report.
+        for line in open(logfilename, 'r'):
+            if line.startswith("Peak resident memory of the process:"):
+                metrics['mem_peak'] = float(line.split(':')[1].split()[0])
+
+        return metrics
+
     def adjust_iter(self, running_with_tsan=False):
 
         # Read the cfg file
@@ -0,0 +1,73 @@
+#!/usr/bin/env python
+
+## \file run_with_snapshots.py
+#  \brief Computes the snapshots of inv_NACA0012_snapshots.cfg, then runs a case that uses them.
+#  \version 8.0.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import os, sys, subprocess
+from optparse import OptionParser	# use a parser for configuration
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+def main():
+  """
+  The snapshot run (an angle of attack sweep) writes its output to SNAPSHOT_CONFIG.log, only the
+  output of the case that reads the snapshots (reduced-order model, blended restart) goes to the screen.
+  """
+
+  # Command line options
+  parser=OptionParser()
+  parser.add_option("-f", "--file", dest="filename", help="Read config from FILE", metavar="FILE")
+  parser.add_option("-s", "--snapshots", dest="snapshots", default="inv_NACA0012_snapshots.cfg",
+                    help="Config of the snapshot run", metavar="FILE")
+  parser.add_option("-n", "--partitions", dest="partitions", default=1, type="int",
+                    help="Number of PARTITIONS (MPI processes)", metavar="PARTITIONS")
+
+  (options, args) = parser.parse_args()
+
+  # Same convention as the SU2 python scripts, the MPI launcher can be set with SU2_MPI_COMMAND.
+  command = ["SU2_CFD"]
+  if options.partitions > 1:
+    command = (os.environ.get("SU2_MPI_COMMAND", "mpirun -n %i %s") % (options.partitions, "SU2_CFD")).split()
+
+  with open(options.snapshots.replace(".cfg", ".log"), "w") as log:
+    if subprocess.call(command + [options.snapshots], stdout=log, stderr=subprocess.STDOUT) != 0:
+      print("ERROR: The snapshot run failed.")
+      sys.exit(1)
+
+  sys.stdout.flush()
+  sys.exit(subprocess.call(command + [options.filename]))
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()
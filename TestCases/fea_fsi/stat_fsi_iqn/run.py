@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+
+## \file run.py
+#  \brief Writes the meshes of the flexible wall case (channel and wall) and runs it.
+#  \version 8.0.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import sys, subprocess
+from optparse import OptionParser	# use a parser for configuration
+
+# -------------------------------------------------------------------
+#  Mesh
+# -------------------------------------------------------------------
+
+def WriteMesh(filename, x0, x1, y0, y1, nx, ny, markers):
+  """
+  Structured mesh of quadrilaterals of the rectangle [x0,x1] x [y0,y1]. The markers are a list of
+  (name, segments), each segment is (side, xmin, xmax), the bottom and top sides are restricted to
+  the faces whose center is in [xmin,xmax], the left and right sides are taken whole.
+  """
+  points = [(x0 + (x1-x0)*i/nx, y0 + (y1-y0)*j/ny) for j in range(ny+1) for i in range(nx+1)]
+  index = lambda i, j: j*(nx+1) + i
+
+  with open(filename, "w") as f:
+    f.write("NDIME= 2\nNELEM= %d\n" % (nx*ny))
+    for j in range(ny):
+      for i in range(nx):
+        f.write("9\t%d\t%d\t%d\t%d\t%d\n" % (index(i,j), index(i+1,j), index(i+1,j+1), index(i,j+1), j*nx+i))
+
+    f.write("NPOIN= %d\n" % len(points))
+    for k, (x, y) in enumerate(points):
+      f.write("%.15e\t%.15e\t%d\n" % (x, y, k))
+
+    f.write("NMARK= %d\n" % len(markers))
+    for name, segments in markers:
+      lines = []
+      for side, xmin, xmax in segments:
+        if side in ("bottom", "top"):
+          j = 0 if side == "bottom" else ny
+          for i in range(nx):
+            if xmin <= x0 + (x1-x0)*(i+0.5)/nx <= xmax: lines.append((index(i,j), index(i+1,j)))
+        else:
+          i = 0 if side == "left" else nx
+          for j in range(ny): lines.append((index(i,j), index(i,j+1)))
+      f.write("MARKER_TAG= %s\nMARKER_ELEMS= %d\n" % (name, len(lines)))
+      for a, b in lines: f.write("3\t%d\t%d\n" % (a, b))
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+def main():
+  """
+  Channel whose bottom wall is flexible in its middle half, the wall is a thin plate clamped at both ends.
+  The meshes are small, they are written here rather than downloaded with the other test cases.
+  """
+
+  # Command line options
+  parser=OptionParser()
+  parser.add_option("-f", "--file", dest="filename", help="Read config from FILE", metavar="FILE")
+
+  (options, args) = parser.parse_args()
+
+  WriteMesh("meshFlow.su2", 0.0, 1.0, 0.0, 0.25, 40, 10,
+            [("inlet", [("left", 0.0, 0.0)]), ("outlet", [("right", 0.0, 0.0)]), ("upper", [("top", 0.0, 1.0)]),
+             ("lower", [("bottom", 0.0, 0.25), ("bottom", 0.75, 1.0)]), ("wallF", [("bottom", 0.25, 0.75)])])
+
+  WriteMesh("meshFEA.su2", 0.25, 0.75, -0.01, 0.0, 20, 2,
+            [("wallS", [("top", 0.25, 0.75)]), ("clamped", [("left", 0.0, 0.0), ("right", 0.0, 0.0)]),
+             ("bottom", [("bottom", 0.25, 0.75)])])
+
+  sys.stdout.flush()
+  sys.exit(subprocess.call(["SU2_CFD", options.filename]))
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()
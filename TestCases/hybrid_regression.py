@@ -665,6 +665,18 @@ def main():
     slinc_steady.multizone = True
     test_list.append(slinc_steady)
 
+    ###################################
+    ### Radiative Heat Transfer     ###
+    ###################################
+
+    # Radiative heat transfer, radiation solved every few flow iterations
+    p1rad_update           = TestCase('p1rad_update')
+    p1rad_update.cfg_dir   = "radiation/p1model"
+    p1rad_update.cfg_file  = "configp1_update.cfg"
+    p1rad_update.test_iter = 100
+    p1rad_update.test_vals = [-7.858812, -7.867215, -2.300250, 0.683236, -19.611000]
+    test_list.append(p1rad_update)
+
     ##########################
     ### FEA - FSI          ###
     ##########################
@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+
+## \file check_geo_gradient.py
+#  \brief Compares the gradients of the geometrical functions computed by SU2_GEO_AD with the
+#         finite differences of SU2_GEO.
+#  \version 8.0.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import os, sys, shutil, subprocess
+from optparse import OptionParser	# use a parser for configuration
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+def main():
+  """
+  Runs SU2_GEO (finite differences, the DV_VALUE are the steps) and SU2_GEO_AD on the same
+  configuration and compares the gradient files entry by entry. Entries smaller than the threshold
+  (in absolute value) are compared with an absolute tolerance, the others with a relative one.
+  """
+
+  # Command line options
+  parser=OptionParser()
+  parser.add_option("-f", "--file", dest="filename", help="Read config from FILE", metavar="FILE")
+  parser.add_option("-n", "--partitions", dest="partitions", type="int", default=1,
+                    help="Number of MPI ranks", metavar="N")
+  parser.add_option("-t", "--tolerance", dest="tol", type="float", default=1e-3,
+                    help="Relative tolerance", metavar="TOL")
+  parser.add_option("-c", "--threshold", dest="threshold", type="float", default=1e-4,
+                    help="Absolute tolerance, below which entries are not compared relatively", metavar="THRES")
+
+  (options, args) = parser.parse_args()
+
+  # The gradient file name, with the extension given by the tabular format
+  gradFile = "of_grad.dat"
+  tecplot = True
+  with open(options.filename, "r") as cfg:
+    for line in cfg:
+      key, _, value = line.partition("=")
+      if key.strip() == "GRAD_OBJFUNC_FILENAME":
+        gradFile = value.strip()
+      elif key.strip() == "TABULAR_FORMAT":
+        tecplot = value.strip() == "TECPLOT"
+  gradFile = os.path.splitext(gradFile)[0] + (".dat" if tecplot else ".csv")
+
+  launch = ""
+  if options.partitions > 1:
+    launch = "mpirun %s-n %d " % ("--allow-run-as-root " if os.geteuid() == 0 else "", options.partitions)
+
+  # Finite differences first, the file is renamed before the AD run overwrites it
+  gradients = {}
+  for exe in ["SU2_GEO", "SU2_GEO_AD"]:
+    print("Running %s" % exe)
+    if subprocess.call("%s%s %s" % (launch, exe, options.filename), shell=True) != 0:
+      print("ERROR: %s failed." % exe)
+      sys.exit(1)
+    shutil.move(gradFile, "%s_%s" % (exe, gradFile))
+    gradients[exe] = ReadGradient("%s_%s" % (exe, gradFile))
+
+  fd = gradients["SU2_GEO"]
+  ad = gradients["SU2_GEO_AD"]
+  if len(fd) == 0 or len(fd) != len(ad) or any(len(a) != len(b) for a, b in zip(fd, ad)):
+    print("ERROR: The gradient files do not have the same layout.")
+    sys.exit(1)
+
+  passed = True
+  for iDV, (rowFD, rowAD) in enumerate(zip(fd, ad)):
+    for iFunc, (valFD, valAD) in enumerate(zip(rowFD, rowAD)):
+      delta = abs(valAD - valFD)
+      if abs(valFD) > options.threshold:
+        delta /= abs(valFD)
+        tol = options.tol
+      else:
+        tol = options.threshold
+      if delta > tol:
+        print("DV %d, function %d: FD %.8e, AD %.8e" % (iDV, iFunc, valFD, valAD))
+        passed = False
+
+  if not passed:
+    print("ERROR: The AD and FD gradients differ.")
+    sys.exit(1)
+  print("The AD and FD gradients agree (%d design variables)." % len(fd))
+
+def ReadGradient(filename):
+  """ Rows of the gradient file (one per design variable), without the design variable index. """
+  rows = []
+  with open(filename, "r") as grad:
+    for line in grad:
+      try:
+        values = [float(w) for w in line.replace(",", " ").split()]
+      except ValueError:
+        continue  # header
+      if len(values) > 1:
+        rows.append(values[1:])
+  return rows
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()
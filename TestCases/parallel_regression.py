@@ -260,6 +260,24 @@ def main():
     polar_naca0012.enabled_on_cpu_arch = ["x86_64"]
     test_list.append(polar_naca0012)
 
+    # NACA0012, POD-LSPG model built from the snapshots of a two-angle sweep
+    rom_naca0012           = TestCase('rom_naca0012')
+    rom_naca0012.cfg_dir   = "euler/naca0012"
+    rom_naca0012.cfg_file  = "inv_NACA0012_rom.cfg"
+    rom_naca0012.test_iter = 10
+    rom_naca0012.test_vals = [-3.975386, -3.377935, 0.380958, 0.025838]
+    rom_naca0012.command   = TestCase.Command(exec = "python", param = "run_with_snapshots.py -n 2 -f")
+    test_list.append(rom_naca0012)
+
+    # Same model, hyper-reduced (residual sampled at 10% of the points)
+    rom_hyper_naca0012           = TestCase('rom_hyper_naca0012')
+    rom_hyper_naca0012.cfg_dir   = "euler/naca0012"
+    rom_hyper_naca0012.cfg_file  = "inv_NACA0012_rom_hyper.cfg"
+    rom_hyper_naca0012.test_iter = 10
+    rom_hyper_naca0012.test_vals = [-3.870168, -3.263654, 0.389320, 0.026338]
+    rom_hyper_naca0012.command   = TestCase.Command(exec = "python", param = "run_with_snapshots.py -n 2 -f")
+    test_list.append(rom_hyper_naca0012)
+
     # HYPERSONIC FLOW PAST BLUNT BODY
     bluntbody           = TestCase('bluntbody')
     bluntbody.cfg_dir   = "euler/bluntbody"
@@ -1230,6 +1248,14 @@ def main():
     p1rad.test_vals = [-7.743666, -7.921411, -2.111848, 0.098302, -45.023000]
     test_list.append(p1rad)
 
+    # Radiative heat transfer, radiation solved every few flow iterations
+    p1rad_update           = TestCase('p1rad_update')
+    p1rad_update.cfg_dir   = "radiation/p1model"
+    p1rad_update.cfg_file  = "configp1_update.cfg"
+    p1rad_update.test_iter = 100
+    p1rad_update.test_vals = [-7.907084, -7.921629, -2.347014, 0.643593, -18.809000]
+    test_list.append(p1rad_update)
+
 
     # #############################
     # ### Solid Heat Conduction ###
@@ -0,0 +1,151 @@
+#!/usr/bin/env python
+
+## \file perf_regression.py
+#  \brief Python script for performance regression testing of SU2 examples
+#  \author A. Aranake, A. Campos, T. Economon, T. Lukaczyk, S. Padron
+#  \version 8.0.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# make print(*args) function available in PY2.6+, does'nt work on PY < 2.6
+from __future__ import print_function
+
+import sys, os, json
+import argparse
+from TestCase import TestCase
+
+def main():
+    '''This program runs a subset of the regression cases with a fixed number of iterations and
+       compares the time per iteration, the peak memory, and the number of linear solver iterations
+       with stored baselines. The baselines depend on the machine, they should be created on the
+       machine used for the comparisons (--update) and tracked with the code. '''
+
+    parser = argparse.ArgumentParser(description='Performance regression tests of SU2.')
+    parser.add_argument('--baselines', default=os.path.join(os.path.dirname(os.path.abspath(__file__)), 'perf_baselines.json'),
+                        help='JSON file with the baseline metrics of each case.')
+    parser.add_argument('--update', action='store_true', help='Store the measured metrics as the new baselines.')
+    parser.add_argument('--ranks', type=int, default=1, help='Number of MPI ranks.')
+    parser.add_argument('--threads', type=int, default=1, help='Number of threads per rank.')
+    parser.add_argument('--repeat', type=int, default=1, help='Number of runs of each case, the fastest is used.')
+    parser.add_argument('--cases', nargs='*', default=[], help='Tags of the cases to run (default all).')
+    args = parser.parse_args()
+
+    launch = "mpirun -n %d" % args.ranks if args.ranks > 1 else ""
+    param = "-t %d" % args.threads if args.threads > 1 else ""
+
+    test_list = []
+
+    ##########################
+    ### Compressible RANS  ###
+    ##########################
+
+    turb_naca0012_sa           = TestCase('turb_naca0012_sa')
+    turb_naca0012_sa.cfg_dir   = "rans/naca0012"
+    turb_naca0012_sa.cfg_file  = "turb_NACA0012_sa.cfg"
+    turb_naca0012_sa.perf_iter = 20
+    turb_naca0012_sa.timeout   = 3200
+    test_list.append(turb_naca0012_sa)
+
+    ############################
+    ### Incompressible RANS  ###
+    ############################
+
+    inc_turb_naca0012           = TestCase('inc_turb_naca0012')
+    inc_turb_naca0012.cfg_dir   = "incomp_rans/naca0012"
+    inc_turb_naca0012.cfg_file  = "naca0012.cfg"
+    inc_turb_naca0012.perf_iter = 20
+    inc_turb_naca0012.timeout   = 1600
+    test_list.append(inc_turb_naca0012)
+
+    ######################################
+    ### DG-FEM Euler                   ###
+    ######################################
+
+    fem_euler_naca0012           = TestCase('fem_euler_naca0012')
+    fem_euler_naca0012.cfg_dir   = "hom_euler/NACA0012_5thOrder"
+    fem_euler_naca0012.cfg_file  = "fem_NACA0012_reg.cfg"
+    fem_euler_naca0012.perf_iter = 10
+    fem_euler_naca0012.timeout   = 1600
+    test_list.append(fem_euler_naca0012)
+
+    ##########################
+    ### FEA                ###
+    ##########################
+
+    # Static linear problem, a single iteration dominated by the linear solver.
+    statbeam3d             = TestCase('statbeam3d')
+    statbeam3d.cfg_dir     = "fea_fsi/StatBeam_3d"
+    statbeam3d.cfg_file    = "configBeam_3d.cfg"
+    statbeam3d.perf_iter   = 1
+    statbeam3d.perf_warmup = 0
+    statbeam3d.timeout     = 1600
+    test_list.append(statbeam3d)
+
+    ##########################
+    ### Discrete adjoint   ###
+    ##########################
+
+    discadj_rans_naca0012_sa           = TestCase('discadj_rans_naca0012_sa')
+    discadj_rans_naca0012_sa.cfg_dir   = "disc_adj_rans/naca0012"
+    discadj_rans_naca0012_sa.cfg_file  = "turb_NACA0012_sa.cfg"
+    discadj_rans_naca0012_sa.perf_iter = 10
+    discadj_rans_naca0012_sa.timeout   = 1600
+    discadj_rans_naca0012_sa.command   = TestCase.Command(launch, "SU2_CFD_AD", param)
+    test_list.append(discadj_rans_naca0012_sa)
+
+    for test in test_list:
+        if test.command.empty():
+            test.command = TestCase.Command(launch, "SU2_CFD", param)
+
+    if args.cases:
+        test_list = [test for test in test_list if test.tag in args.cases]
+
+    baselines = {}
+    if os.path.isfile(args.baselines):
+        with open(args.baselines, 'r') as f:
+            baselines = json.load(f)
+
+    pass_list = [test.run_perf(baselines, args.update, args.repeat) for test in test_list]
+
+    if args.update:
+        with open(args.baselines, 'w') as f:
+            json.dump(baselines, f, indent=2, sort_keys=True)
+            f.write('\n')
+        print('Baselines written to %s' % args.baselines)
+
+    # Tests summary
+    print('==================================================================')
+    print('Summary of the performance tests')
+    print('python version:', sys.version)
+    for i, test in enumerate(test_list):
+        if (pass_list[i]):
+            print('  passed - %s'%test.tag)
+        else:
+            print('* FAILED - %s'%test.tag)
+
+    if all(pass_list):
+        sys.exit(0)
+    else:
+        sys.exit(1)
+    # done
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,172 @@
+#!/usr/bin/env python
+
+## \file run_optimization.py
+#  \brief Shape optimization loop that keeps the SU2 solvers in memory.
+#  \version 8.0.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import sys
+from optparse import OptionParser	# use a parser for configuration
+import numpy as np
+import pysu2ad as pysu2          # imports the SU2 adjoint-wrapped module
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+def main():
+  """
+  Steepest descent on the amplitude of a bump applied to the wall, with the mesh read, partitioned and
+  preprocessed only once. Each design iteration deforms the mesh in place, solves the primal problem
+  starting from the solution of the previous design, solves the adjoint problem, and projects the
+  sensitivity w.r.t. the wall displacements onto the design variable, without writing any files.
+  The primal solution of the initial design is read from SOLUTION_FILENAME.
+  """
+
+  # Command line options
+  parser=OptionParser()
+  parser.add_option("-f", "--file", dest="filename", help="Read config from FILE", metavar="FILE")
+  parser.add_option("-n", "--iterations", dest="nDesign", type="int", default=3,
+                    help="Number of design iterations", metavar="N")
+  parser.add_option("-p", "--primal-iterations", dest="nPrimal", type="int", default=1000,
+                    help="Maximum number of primal iterations per design", metavar="N")
+  parser.add_option("-s", "--step", dest="step", type="float", default=1e-4,
+                    help="Step length of the steepest descent", metavar="STEP")
+  parser.add_option("-t", "--tolerance", dest="tol", type="float", default=0.2,
+                    help="Relative tolerance of the finite difference check of the gradient", metavar="TOL")
+  parser.add_option("--parallel", action="store_true",
+                    help="Specify if we need to initialize MPI", dest="with_MPI", default=False)
+
+  (options, args) = parser.parse_args()
+  options.nZone = 1
+
+  # Import mpi4py for parallel run
+  if options.with_MPI == True:
+    from mpi4py import MPI
+    comm = MPI.COMM_WORLD
+    rank = comm.Get_rank()
+  else:
+    comm = 0
+    rank = 0
+
+  def SumAllRanks(value):
+    return comm.allreduce(value) if options.with_MPI else value
+
+  # Initialize the driver of SU2 once, this includes reading the mesh and the initial primal solution.
+  SU2Driver = pysu2.CDiscAdjSinglezoneDriver(options.filename, options.nZone, comm)
+
+  MarkerName = 'wallF'
+  allMarkerIDs = SU2Driver.GetMarkerIndices()
+  MarkerID = allMarkerIDs[MarkerName] if MarkerName in allMarkerIDs else -1
+  nVertex = SU2Driver.GetNumberMarkerNodes(MarkerID) if MarkerID >= 0 else 0
+  nDim = SU2Driver.GetNumberDimensions()
+
+  # Shape function of the design variable: a bump along the initial normals of the wall.
+  coords = SU2Driver.MarkerInitialCoordinates(MarkerID) if MarkerID >= 0 else None
+  xCoord = np.array([coords.Get(iVertex, 0) for iVertex in range(nVertex)])
+  xMin = comm.allreduce(np.min(xCoord, initial=np.inf), op=MPI.MIN) if options.with_MPI else np.min(xCoord)
+  xMax = comm.allreduce(np.max(xCoord, initial=-np.inf), op=MPI.MAX) if options.with_MPI else np.max(xCoord)
+
+  shape = np.zeros((nVertex, nDim))
+  owned = np.zeros(nVertex, dtype=bool)
+  for iVertex in range(nVertex):
+    normal = np.array(SU2Driver.GetMarkerVertexNormals(MarkerID, iVertex, True))
+    shape[iVertex] = np.sin(np.pi * (xCoord[iVertex] - xMin) / (xMax - xMin)) * normal
+    owned[iVertex] = SU2Driver.GetNodeDomain(SU2Driver.GetMarkerNode(MarkerID, iVertex))
+
+  alpha = 0.0
+  history = []
+
+  for iDesign in range(options.nDesign):
+    if rank == 0:
+      print("\n------------------------------ Design %d -----------------------------\n" % iDesign)
+    sys.stdout.flush()
+
+    # Impose the displacements of the current design, deform the mesh and solve the primal problem.
+    for iVertex in range(nVertex):
+      SU2Driver.SetMarkerCustomDisplacement(MarkerID, iVertex, tuple(alpha * shape[iVertex]))
+
+    SU2Driver.RunPrimal(options.nPrimal)
+
+    # Record the tape around the new primal solution and solve the adjoint problem.
+    SU2Driver.Preprocess(0)
+    SU2Driver.Run()
+
+    # Sensitivity w.r.t. the wall displacements.
+    SU2Driver.Postprocess()
+
+    gradient = 0.0
+    for iVertex in range(nVertex):
+      if owned[iVertex]:
+        sens = np.array(SU2Driver.GetMarkerDisplacementSensitivity(MarkerID, iVertex))
+        gradient += np.dot(sens, shape[iVertex])
+    gradient = SumAllRanks(gradient)
+
+    objective = SU2Driver.GetObjectiveFunction()
+    history.append((alpha, objective, gradient))
+
+    # One line per design (design, alpha, objective, gradient), these are the values checked by the regression test.
+    if rank == 0:
+      print("%d %.6e %.6e %.6e" % (iDesign, alpha, objective, gradient))
+    sys.stdout.flush()
+
+    if not (np.isfinite(objective) and np.isfinite(gradient)):
+      Fail(rank, "Non-finite objective function or gradient.")
+
+    # The adjoint gradient is verified against the change of the objective between consecutive designs,
+    # the finite difference approximates the mean of the gradients of the two designs.
+    if iDesign > 0 and history[-2][0] != alpha:
+      alpha0, objective0, gradient0 = history[-2]
+      finiteDiff = (objective - objective0) / (alpha - alpha0)
+      meanGradient = 0.5 * (gradient + gradient0)
+      if rank == 0:
+        print("Finite difference of the objective = %.6e, mean adjoint gradient = %.6e" % (finiteDiff, meanGradient))
+      if abs(finiteDiff - meanGradient) > options.tol * abs(meanGradient):
+        Fail(rank, "The adjoint gradient does not match the finite difference of the objective.")
+      if objective > objective0:
+        Fail(rank, "The objective function did not decrease along the steepest descent direction.")
+
+    alpha -= options.step * gradient
+
+  # Finalize the solver and exit cleanly
+  SU2Driver.Finalize()
+
+
+
+def Fail(rank, message):
+  """Exit with an error, the regression test checks the exit code."""
+  if rank == 0:
+    print(message)
+  sys.stdout.flush()
+  sys.exit(1)
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()
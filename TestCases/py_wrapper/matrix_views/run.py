@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+
+## \file run.py
+#  \brief Checks the NumPy access (ToNumpy / FromNumpy) to the matrix views of the Python wrapper.
+#  \version 8.0.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+import numpy as np
+import pysu2
+from mpi4py import MPI
+
+def main():
+  comm = MPI.COMM_WORLD
+  rank = comm.Get_rank()
+
+  # Initialize the corresponding driver of SU2, this includes solver preprocessing.
+  try:
+    SU2Driver = pysu2.CSinglezoneDriver('config.cfg', 1, comm)
+  except TypeError as exception:
+    print('A TypeError occured in pysu2.CDriver : ', exception)
+    raise
+
+  FlowID = SU2Driver.GetSolverIndices()['C.FLOW']
+  AllMarkerIDs = SU2Driver.GetMarkerIndices()
+  MarkerName = 'y_minus'
+  MarkerID = AllMarkerIDs[MarkerName] if MarkerName in AllMarkerIDs else -1
+  nVertex = SU2Driver.GetNumberMarkerNodes(MarkerID) if MarkerID >= 0 else 0
+  nPoint = SU2Driver.GetNumberNodes()
+
+  # Writes through a writable view reach the solver (the array shares its memory).
+  Solution = SU2Driver.Solution(FlowID)
+  assert Solution.IsBufferWritable(), "The solution view should be writable."
+  Values = Solution.ToNumpy()
+  assert Values.shape == tuple(Solution.Shape()), "Wrong shape of the solution array."
+  Density = Values[:, 0].copy()
+  Values[:, 0] *= 1.01
+  for iPoint in range(nPoint):
+    assert Solution(iPoint, 0) == Values[iPoint, 0], "A write through the solution array was not seen by the solver."
+    assert Solution(iPoint, 0) != Density[iPoint], "The solution array is a copy."
+
+  # Writes to a read-only view are rejected.
+  for View in (SU2Driver.InitialCoordinates(), SU2Driver.Residual(FlowID)):
+    assert not View.IsBufferWritable(), "The view should be read-only."
+    Array = View.ToNumpy()
+    if Array.size == 0: continue
+    try:
+      Array[0, 0] = 1.0
+      raise AssertionError("A write to a read-only array was accepted.")
+    except ValueError:
+      pass
+
+  # The marker values are gathered and scattered through the nodes of the marker.
+  MarkerSolution = SU2Driver.MarkerSolution(FlowID, MarkerID) if MarkerID >= 0 else None
+  if nVertex > 0:
+    Nodes = MarkerSolution.GetNodes()
+    Gathered = MarkerSolution.ToNumpy()
+    assert Gathered.shape == tuple(MarkerSolution.Shape()), "Wrong shape of the marker array."
+    for iVertex in range(nVertex):
+      assert list(Gathered[iVertex]) == list(MarkerSolution.Get(iVertex)), "Wrong marker values."
+      assert list(Gathered[iVertex]) == list(Solution.Get(Nodes[iVertex])), "Wrong marker nodes."
+
+    MarkerSolution.FromNumpy(2 * Gathered)
+    assert np.array_equal(MarkerSolution.ToNumpy(), 2 * Gathered), "The marker values were not scattered."
+    assert np.array_equal(Values[Nodes], 2 * Gathered), "The marker values were scattered to the wrong nodes."
+
+    MarkerSolution.FromNumpy(Gathered)
+    assert np.array_equal(MarkerSolution.ToNumpy(), Gathered), "The marker values did not round-trip."
+
+  # The residual array matches the element-wise accessors, after an iteration from the perturbed solution.
+  SU2Driver.Preprocess(0)
+  SU2Driver.Run()
+
+  Residual = SU2Driver.Residual(FlowID)
+  ResidualValues = Residual.ToNumpy()
+  assert ResidualValues.shape == tuple(Residual.Shape()), "Wrong shape of the residual array."
+  nRow, nCol = Residual.Shape()
+  for iRow in range(nRow):
+    for iCol in range(nCol):
+      assert ResidualValues[iRow, iCol] == Residual.Get(iRow, iCol), "The residual array does not match Get."
+
+  MaxResidual = comm.allreduce(np.max(np.abs(ResidualValues), initial=0.0), op=MPI.MAX)
+  assert MaxResidual > 0.0, "The residual of the perturbed solution should not be zero."
+
+  if rank == 0:
+    print("All the checks of the matrix views passed.")
+
+  # Finalize the solver and exit cleanly.
+  SU2Driver.Finalize()
+
+
+if __name__ == '__main__':
+  main()
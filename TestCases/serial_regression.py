@@ -1041,6 +1041,16 @@ def main():
     stat_fsi.multizone = True
     test_list.append(stat_fsi)
 
+    # FSI, Static, 2D, flexible wall, IQN-ILS relaxation (the meshes are written by run.py)
+    stat_fsi_iqn           = TestCase('stat_fsi_iqn')
+    stat_fsi_iqn.cfg_dir   = "fea_fsi/stat_fsi_iqn"
+    stat_fsi_iqn.cfg_file  = "config.cfg"
+    stat_fsi_iqn.test_iter = 7
+    stat_fsi_iqn.test_vals = [-9.231459, -6.479244, 6.2421e-04, 0.000000]
+    stat_fsi_iqn.command   = TestCase.Command(exec = "python", param = "run.py -f")
+    stat_fsi_iqn.multizone = True
+    test_list.append(stat_fsi_iqn)
+
     # FSI, Static, 2D, new mesh solver, restart
     stat_fsi_restart           = TestCase('stat_fsi_restart')
     stat_fsi_restart.cfg_dir   = "fea_fsi/stat_fsi"
@@ -1082,6 +1092,14 @@ def main():
     p1rad.test_vals = [-7.751309, -7.923059, -2.119084, 0.091733, -44.537000]
     test_list.append(p1rad)
 
+    # Radiative heat transfer, radiation solved every few flow iterations
+    p1rad_update           = TestCase('p1rad_update')
+    p1rad_update.cfg_dir   = "radiation/p1model"
+    p1rad_update.cfg_file  = "configp1_update.cfg"
+    p1rad_update.test_iter = 100
+    p1rad_update.test_vals = [-7.888663, -7.904888, -2.328385, 0.655123, -18.871000]
+    test_list.append(p1rad_update)
+
     # ###############################
     # ### Conjugate heat transfer ###
     # ###############################
@@ -1188,6 +1206,68 @@ def main():
     pass_list = [ test.run_test() for test in test_list ]
 
 
+    ######################################
+    ### RUN SWEEP TESTS                ###
+    ######################################
+
+    # NACA0012, two angles of attack solved one after the other on the same mesh
+    sweep_naca0012                  = TestCase('sweep_naca0012')
+    sweep_naca0012.cfg_dir          = "euler/naca0012"
+    sweep_naca0012.cfg_file         = "inv_NACA0012_sweep.cfg"
+    sweep_naca0012.test_iter        = 10
+    sweep_naca0012.command          = TestCase.Command(exec = "SU2_CFD")
+    sweep_naca0012.timeout          = 1600
+    sweep_naca0012.reference_file   = "history_sweep.csv.ref"
+    sweep_naca0012.test_file        = "history_sweep.csv"
+    sweep_naca0012.comp_threshold   = 1e-6
+    sweep_naca0012.tol_file_percent = 0.1
+    pass_list.append(sweep_naca0012.run_filediff())
+    test_list.append(sweep_naca0012)
+
+    ######################################
+    ### RUN REDUCED-ORDER MODEL TESTS  ###
+    ######################################
+
+    # NACA0012, POD-LSPG model built from the snapshots of a two-angle sweep
+    rom_naca0012           = TestCase('rom_naca0012')
+    rom_naca0012.cfg_dir   = "euler/naca0012"
+    rom_naca0012.cfg_file  = "inv_NACA0012_rom.cfg"
+    rom_naca0012.test_iter = 10
+    rom_naca0012.test_vals = [-3.976118, -3.378701, 0.381003, 0.025855]
+    rom_naca0012.command   = TestCase.Command(exec = "python", param = "run_with_snapshots.py -f")
+    rom_naca0012.timeout   = 1600
+    rom_naca0012.tol       = 0.00001
+    pass_list.append(rom_naca0012.run_test())
+    test_list.append(rom_naca0012)
+
+    # Same model, hyper-reduced (residual sampled at 10% of the points)
+    rom_hyper_naca0012           = TestCase('rom_hyper_naca0012')
+    rom_hyper_naca0012.cfg_dir   = "euler/naca0012"
+    rom_hyper_naca0012.cfg_file  = "inv_NACA0012_rom_hyper.cfg"
+    rom_hyper_naca0012.test_iter = 10
+    rom_hyper_naca0012.test_vals = [-3.871050, -3.264538, 0.389349, 0.026354]
+    rom_hyper_naca0012.command   = TestCase.Command(exec = "python", param = "run_with_snapshots.py -f")
+    rom_hyper_naca0012.timeout   = 1600
+    rom_hyper_naca0012.tol       = 0.00001
+    pass_list.append(rom_hyper_naca0012.run_test())
+    test_list.append(rom_hyper_naca0012)
+
+    ######################################
+    ### RUN BLENDED RESTART TESTS      ###
+    ######################################
+
+    # NACA0012, restart at AoA 1.5 blended from the solutions at AoA 1 and 2
+    blend_naca0012           = TestCase('blend_naca0012')
+    blend_naca0012.cfg_dir   = "euler/naca0012"
+    blend_naca0012.cfg_file  = "inv_NACA0012_blend.cfg"
+    blend_naca0012.test_iter = 10
+    blend_naca0012.test_vals = [-4.447701, -3.998785, 0.399782, 0.026457]
+    blend_naca0012.command   = TestCase.Command(exec = "python", param = "run_with_snapshots.py -f")
+    blend_naca0012.timeout   = 1600
+    blend_naca0012.tol       = 0.00001
+    pass_list.append(blend_naca0012.run_test())
+    test_list.append(blend_naca0012)
+
     ######################################
     ### RUN SU2_GEO TESTS              ###
     ######################################
@@ -0,0 +1,69 @@
+/*!
+ * \file CADTPointsOnlyClass_tests.cpp
+ * \brief Unit tests for the radius search of the points-only ADT.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../Common/include/adt/CADTPointsOnlyClass.hpp"
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("ADT radius search", "[ADT]") {
+  /*--- Small trees have leaves and points with the same index as siblings, which must not be confused.
+   The result is compared with a brute force search for every point as center and several radii. ---*/
+  const unsigned short nDim = 2;
+  unsigned long seed = 12345;
+  auto random = [&seed]() {
+    seed = (1103515245 * seed + 12345) % 2147483648ul;
+    return seed / 2147483648.0;
+  };
+
+  for (unsigned long nPoint = 1; nPoint <= 20; ++nPoint) {
+    std::vector<su2double> coor(nPoint * nDim);
+    for (auto& x : coor) x = random();
+    std::vector<unsigned long> ids(nPoint);
+    std::iota(ids.begin(), ids.end(), 0ul);
+
+    CADTPointsOnlyClass tree(nDim, nPoint, coor.data(), ids.data(), false);
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (const su2double radius : {0.1, 0.3, 0.6, 2.0}) {
+        std::vector<unsigned long> found, expected;
+        tree.DetermineNodesInRadius(&coor[iPoint * nDim], radius, found);
+
+        for (auto jPoint = 0ul; jPoint < nPoint; ++jPoint) {
+          su2double dist2 = 0.0;
+          for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+            const su2double ds = coor[iPoint * nDim + iDim] - coor[jPoint * nDim + iDim];
+            dist2 += ds * ds;
+          }
+          if (dist2 <= radius * radius) expected.push_back(jPoint);
+        }
+        std::sort(found.begin(), found.end());
+        REQUIRE(found == expected);
+      }
+    }
+  }
+}
@@ -0,0 +1,97 @@
+/*!
+ * \file CAirfoilSections_tests.cpp
+ * \brief Unit tests for the batched extraction of plane sections of the surface.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <memory>
+#include <sstream>
+#include <vector>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+
+TEST_CASE("Batched plane sections", "[Geometry]") {
+  /*--- The lateral faces of a box are cut by planes with different normals. ---*/
+  const std::string options =
+      "SOLVER= EULER\n"
+      "MESH_FORMAT= BOX\n"
+      "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_plus, z_minus)\n"
+      "GEO_MARKER= (x_minus, x_plus, y_minus, y_plus)\n"
+      "MESH_BOX_SIZE= 7,6,9\n"
+      "MESH_BOX_LENGTH= 1,2,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n";
+
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+  std::stringstream ss(options);
+  auto config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+  std::unique_ptr<CGeometry> geometry;
+  {
+    auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+    geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+  }
+  geometry->SetSendReceive(config.get());
+  geometry->SetBoundaries(config.get());
+  geometry->SetPoint_Connectivity();
+  geometry->SetBoundVolume();
+  geometry->SetVertex(config.get());
+  cout.rdbuf(origBuf);
+
+  /*--- Planes between nodes, through nodes (perturbed by the cut), and oblique. ---*/
+  constexpr unsigned short nPlane = 5;
+  su2double P0[nPlane][3] = {{0, 0, 0.25}, {0, 0, 1.0 / 3}, {0, 0.9, 0}, {0.5, 0.5, 0.5}, {0, 0, 0.75}};
+  su2double Normal[nPlane][3] = {{0, 0, 1}, {0, 0, 1}, {0, 1, 0}, {0.2, 0.3, 1}, {0, 0, 1}};
+  su2double* Plane_P0[nPlane];
+  su2double* Plane_Normal[nPlane];
+  for (unsigned short iPlane = 0; iPlane < nPlane; iPlane++) {
+    Plane_P0[iPlane] = P0[iPlane];
+    Plane_Normal[iPlane] = Normal[iPlane];
+  }
+
+  std::vector<su2double> X[nPlane], Y[nPlane], Z[nPlane], Var[nPlane];
+  geometry->ComputeAirfoil_Sections(nPlane, Plane_P0, Plane_Normal, X, Y, Z, Var, true, config.get());
+
+  /*--- Same sections as when the planes are cut one at a time. ---*/
+  for (unsigned short iPlane = 0; iPlane < nPlane; iPlane++) {
+    std::vector<su2double> x, y, z, var;
+    geometry->ComputeAirfoil_Section(Plane_P0[iPlane], Plane_Normal[iPlane], -1E6, 1E6, -1E6, 1E6, -1E6, 1E6,
+                                     nullptr, x, y, z, var, true, config.get());
+
+    if (SU2_MPI::GetRank() != MASTER_NODE) continue;
+
+    REQUIRE(!x.empty());
+    REQUIRE(X[iPlane].size() == x.size());
+    REQUIRE(Var[iPlane].size() == var.size());
+    for (auto iPoint = 0ul; iPoint < x.size(); iPoint++) {
+      CHECK(SU2_TYPE::GetValue(X[iPlane][iPoint]) == Approx(SU2_TYPE::GetValue(x[iPoint])).margin(1e-12));
+      CHECK(SU2_TYPE::GetValue(Y[iPlane][iPoint]) == Approx(SU2_TYPE::GetValue(y[iPoint])).margin(1e-12));
+      CHECK(SU2_TYPE::GetValue(Z[iPlane][iPoint]) == Approx(SU2_TYPE::GetValue(z[iPoint])).margin(1e-12));
+
+      /*--- The points are on the plane (up to the perturbation of the planes through nodes). ---*/
+      const su2double dist = (x[iPoint] - P0[iPlane][0]) * Normal[iPlane][0] +
+                             (y[iPoint] - P0[iPlane][1]) * Normal[iPlane][1] +
+                             (z[iPoint] - P0[iPlane][2]) * Normal[iPlane][2];
+      CHECK(SU2_TYPE::GetValue(dist) == Approx(0.0).margin(1e-5));
+    }
+  }
+}
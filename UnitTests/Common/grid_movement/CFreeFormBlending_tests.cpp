@@ -0,0 +1,73 @@
+/*!
+ * \file CFreeFormBlending_tests.cpp
+ * \brief Unit tests for the evaluation of all the FFD basis functions at once.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../Common/include/grid_movement/CBSplineBlending.hpp"
+#include "../../Common/include/grid_movement/CBezierBlending.hpp"
+#include <vector>
+
+namespace {
+/*--- Compare GetAllBasis with the evaluation of one function at a time, the latter is not exact at t = 0. ---*/
+void CheckAllBasis(CFreeFormBlending& blending, int nControl, bool secondDerivative) {
+  std::vector<su2double> N(nControl), dN(nControl), d2N(nControl);
+
+  for (const su2double t : {0.013, 0.25, 0.5, 0.61, 0.999}) {
+    blending.GetAllBasis(t, N.data(), dN.data(), d2N.data());
+
+    su2double sumN = 0.0, sumdN = 0.0;
+    for (int i = 0; i < nControl; ++i) {
+      sumN += N[i];
+      sumdN += dN[i];
+      CHECK(SU2_TYPE::GetValue(N[i]) == Approx(SU2_TYPE::GetValue(blending.GetBasis(i, t))).margin(1e-12));
+      CHECK(SU2_TYPE::GetValue(dN[i]) ==
+            Approx(SU2_TYPE::GetValue(blending.GetDerivative(i, t, 1))).epsilon(1e-6).margin(1e-6));
+      if (secondDerivative) {
+        CHECK(SU2_TYPE::GetValue(d2N[i]) ==
+              Approx(SU2_TYPE::GetValue(blending.GetDerivative(i, t, 2))).epsilon(1e-6).margin(1e-4));
+      }
+    }
+    /*--- Partition of unity. ---*/
+    CHECK(SU2_TYPE::GetValue(sumN) == Approx(1.0));
+    CHECK(SU2_TYPE::GetValue(sumdN) == Approx(0.0).margin(1e-8));
+  }
+}
+}  // namespace
+
+TEST_CASE("FFD B-spline basis", "[FFD]") {
+  /*--- The last order exceeds the size of the work arrays kept on the stack. ---*/
+  for (const auto& orderControl : {std::make_pair(2, 6), std::make_pair(3, 6), std::make_pair(4, 9),
+                                   std::make_pair(20, 24)}) {
+    CBSplineBlending bspline(orderControl.first, orderControl.second);
+    CheckAllBasis(bspline, orderControl.second, orderControl.first > 2);
+  }
+}
+
+TEST_CASE("FFD Bezier basis", "[FFD]") {
+  for (const int nControl : {2, 4, 7}) {
+    CBezierBlending bezier(nControl, nControl);
+    CheckAllBasis(bezier, nControl, nControl > 2);
+  }
+}
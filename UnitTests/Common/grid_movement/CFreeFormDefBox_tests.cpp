@@ -0,0 +1,124 @@
+/*!
+ * \file CFreeFormDefBox_tests.cpp
+ * \brief Unit tests for the projection of sensitivities onto the FFD control points.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../Common/include/grid_movement/CFreeFormDefBox.hpp"
+#include <memory>
+#include <vector>
+
+namespace {
+/*--- Box [0,1]x[0,1]x[0,0.1] with control points on the parallelepiped. ---*/
+std::unique_ptr<CFreeFormDefBox> MakeBox(unsigned short lDegree, unsigned short mDegree) {
+  const unsigned short Degree[] = {lDegree, mDegree, 1};
+  unsigned short Order[] = {2, 2, 2};
+  std::unique_ptr<CFreeFormDefBox> box(new CFreeFormDefBox(Degree, Order, BEZIER));
+
+  const su2double corners[8][3] = {{0, 0, 0},   {1, 0, 0},   {1, 1, 0},   {0, 1, 0},
+                                   {0, 0, 0.1}, {1, 0, 0.1}, {1, 1, 0.1}, {0, 1, 0.1}};
+  for (unsigned short iCorner = 0; iCorner < 8; iCorner++) box->SetCoordCornerPoints(corners[iCorner], iCorner);
+  box->SetControlPoints_Parallelepiped();
+  return box;
+}
+
+/*--- Pseudo random displacement of all the control points. ---*/
+void MoveControlPoints(CFreeFormDefBox& box, su2double scale) {
+  unsigned long iCP = 0;
+  for (unsigned short i = 0; i < box.GetlOrder(); i++)
+    for (unsigned short j = 0; j < box.GetmOrder(); j++)
+      for (unsigned short k = 0; k < box.GetnOrder(); k++, iCP++) {
+        su2double coord[3];
+        for (unsigned short iDim = 0; iDim < 3; iDim++)
+          coord[iDim] = box.GetCoordControlPoints(i, j, k)[iDim] + scale * sin(1.0 + iCP + 7.0 * iDim);
+        box.SetCoordControlPoints(coord, i, j, k);
+      }
+}
+
+/*--- Sum over the control points of displacement times sensitivity, as in SU2_DOT. ---*/
+su2double ControlPointGradient(const CFreeFormDefBox& box, const std::vector<su2double>& coord0,
+                               const std::vector<su2double>& cpSens) {
+  su2double grad = 0.0;
+  unsigned long iCP = 0;
+  for (unsigned short i = 0; i < box.GetlOrder(); i++)
+    for (unsigned short j = 0; j < box.GetmOrder(); j++)
+      for (unsigned short k = 0; k < box.GetnOrder(); k++, iCP++)
+        for (unsigned short iDim = 0; iDim < 3; iDim++)
+          grad += (box.GetCoordControlPoints(i, j, k)[iDim] - coord0[3 * iCP + iDim]) * cpSens[3 * iCP + iDim];
+  return grad;
+}
+
+std::vector<su2double> ControlPointCoord(const CFreeFormDefBox& box) {
+  std::vector<su2double> coord;
+  for (unsigned short i = 0; i < box.GetlOrder(); i++)
+    for (unsigned short j = 0; j < box.GetmOrder(); j++)
+      for (unsigned short k = 0; k < box.GetnOrder(); k++)
+        for (unsigned short iDim = 0; iDim < 3; iDim++) coord.push_back(box.GetCoordControlPoints(i, j, k)[iDim]);
+  return coord;
+}
+}  // namespace
+
+TEST_CASE("FFD control point sensitivity", "[FFD]") {
+  /*--- Two overlapping boxes of different degree, all the points are inside both. ---*/
+  auto box1 = MakeBox(3, 2);
+  auto box2 = MakeBox(2, 4);
+
+  const su2double uvw[][3] = {{0.1, 0.2, 0.0}, {0.5, 0.5, 0.5}, {0.9, 0.3, 1.0}, {0.7, 0.95, 0.2}};
+  const su2double sens[][3] = {{1.0, -2.0, 0.5}, {0.3, 0.7, -1.0}, {-1.5, 0.2, 0.1}, {0.4, 0.4, 2.0}};
+  constexpr int nPoint = 4;
+
+  std::vector<su2double> xyz0(3 * nPoint), cpSens1(3 * box1->GetnControlPoints(), 0.0),
+      cpSens2(3 * box2->GetnControlPoints(), 0.0);
+  for (int iPoint = 0; iPoint < nPoint; iPoint++) {
+    box1->EvalCartesianCoord(uvw[iPoint], &xyz0[3 * iPoint]);
+    box1->AddControlPointSensitivity(uvw[iPoint], sens[iPoint], cpSens1.data());
+    box2->AddControlPointSensitivity(uvw[iPoint], sens[iPoint], cpSens2.data());
+  }
+  const auto coord1 = ControlPointCoord(*box1);
+  const auto coord2 = ControlPointCoord(*box2);
+
+  MoveControlPoints(*box1, 1e-2);
+  MoveControlPoints(*box2, -3e-3);
+
+  /*--- The map is linear in the control points, the displacements of the points caused by each box add up. ---*/
+  su2double reference1 = 0.0, reference = 0.0;
+  for (int iPoint = 0; iPoint < nPoint; iPoint++) {
+    su2double xyz1[3], xyz2[3], xyz2_0[3];
+    box1->EvalCartesianCoord(uvw[iPoint], xyz1);
+    box2->EvalCartesianCoord(uvw[iPoint], xyz2);
+    for (int iDim = 0; iDim < 3; iDim++) xyz2_0[iDim] = xyz0[3 * iPoint + iDim];
+
+    for (int iDim = 0; iDim < 3; iDim++) {
+      const su2double disp1 = xyz1[iDim] - xyz0[3 * iPoint + iDim];
+      const su2double disp2 = xyz2[iDim] - xyz2_0[iDim];
+      reference1 += disp1 * sens[iPoint][iDim];
+      reference += (disp1 + disp2) * sens[iPoint][iDim];
+    }
+  }
+  const su2double grad1 = ControlPointGradient(*box1, coord1, cpSens1);
+  const su2double grad2 = ControlPointGradient(*box2, coord2, cpSens2);
+
+  CHECK(SU2_TYPE::GetValue(grad1) == Approx(SU2_TYPE::GetValue(reference1)).epsilon(1e-12).margin(1e-14));
+  CHECK(SU2_TYPE::GetValue(grad1 + grad2) == Approx(SU2_TYPE::GetValue(reference)).epsilon(1e-12).margin(1e-14));
+}
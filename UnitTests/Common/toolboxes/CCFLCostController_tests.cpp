@@ -0,0 +1,81 @@
+/*!
+ * \file CCFLCostController_tests.cpp
+ * \brief Unit tests for the cost-aware CFL controller.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../Common/include/toolboxes/CCFLCostController.hpp"
+#include <vector>
+
+TEST_CASE("CFL cost controller", "[Toolboxes]") {
+  using C = CCFLCostController;
+  C control;
+  control.Initialize(5, 1, 0.01);
+  control.SetParameter(C::CFL_MAX, 1000.0, 10.0, 1000.0, 2.0);
+  control.SetParameter(C::LINSOL_TOL, 1e-6, 1e-8, 0.1, std::sqrt(10.0));
+  control.SetParameter(C::LINSOL_ITER, 20, 20, 20, 1.5, true);
+  control.SetParameter(C::PREC_PERIOD, 1, 1, 16, 2.0, true);
+
+  /*--- Synthetic rate with a maximum at CFL 100, tolerance 1e-2, and rebuilding every 4 solves. ---*/
+  auto rate = [&]() {
+    const double a = std::log10(control.GetValue(C::CFL_MAX) / 100);
+    const double b = std::log10(control.GetValue(C::LINSOL_TOL) / 1e-2);
+    const double c = std::log2(control.GetValue(C::PREC_PERIOD) / 4);
+    return std::exp(-a * a - b * b - 0.3 * c * c);
+  };
+
+  /*--- Nothing changes until the window is complete and during warm-up. ---*/
+  for (int i = 0; i < 4; ++i) CHECK_FALSE(control.Iterate());
+  CHECK(control.Iterate());
+  CHECK(control.InWarmup());
+  control.Update(rate());
+  CHECK_FALSE(control.InWarmup());
+  CHECK(control.GetTrial() == -1);
+  CHECK(control.GetValue(C::CFL_MAX) == 1000.0);
+
+  for (int iWindow = 0; iWindow < 100; ++iWindow) {
+    while (!control.Iterate()) {
+    }
+    control.Update(rate());
+  }
+  /*--- Each parameter ends within one step of the optimum, the fixed one does not move. ---*/
+  CHECK(std::abs(std::log2(control.GetValue(C::CFL_MAX) / 100)) <= 1.0);
+  CHECK(std::abs(std::log10(control.GetValue(C::LINSOL_TOL) / 1e-2)) <= 0.5);
+  CHECK(control.GetValue(C::PREC_PERIOD) == 4);
+  CHECK(control.GetValue(C::LINSOL_ITER) == 20);
+  CHECK(control.GetAccepted() > 0);
+
+  /*--- Restarting undoes the trial in progress. ---*/
+  if (control.GetTrial() < 0) control.Update(rate());
+  REQUIRE(control.GetTrial() >= 0);
+  const double before = rate();
+  control.Restart();
+  CHECK(control.GetTrial() == -1);
+  CHECK(rate() > before);
+
+  /*--- The preconditioner is built on the first solve and then every PREC_PERIOD solves. ---*/
+  std::vector<bool> builds;
+  for (int i = 0; i < 9; ++i) builds.push_back(control.BuildPreconditioner());
+  CHECK(builds == std::vector<bool>{true, false, false, false, true, false, false, false, true});
+}
@@ -0,0 +1,84 @@
+/*!
+ * \file CCommProfiler_tests.cpp
+ * \brief Unit tests for the communication profiler.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+#include "../../Common/include/option_structure.hpp"
+#include "../../Common/include/toolboxes/CCommProfiler.hpp"
+
+TEST_CASE("Communication profiler", "[Toolboxes]") {
+  CCommProfiler::Initialize(true);
+
+  /*--- Two exchanges of the solution with one neighbor, and one periodic exchange. ---*/
+  for (int i = 0; i < 2; ++i) {
+    CCommProfiler::AddExchange(CCommProfiler::HaloId(SOLUTION), 1);
+    CCommProfiler::AddMessage(CCommProfiler::HaloId(SOLUTION), 0, 800);
+    CCommProfiler::AddWait(CCommProfiler::HaloId(SOLUTION), 0.5);
+  }
+  CCommProfiler::AddExchange(CCommProfiler::PeriodicId(PERIODIC_RESIDUAL), 1);
+  CCommProfiler::AddMessage(CCommProfiler::PeriodicId(PERIODIC_RESIDUAL), 0, 100);
+
+  /*--- The collectives are recorded by the MPI wrappers. ---*/
+  int local = 1, global = 0;
+  SU2_MPI::Allreduce(&local, &global, 1, MPI_INT, MPI_SUM, SU2_MPI::GetComm());
+
+  std::vector<CCommProfiler::ExchangeStats> exchanges;
+  std::vector<CCommProfiler::CollectiveStats> collectives;
+  std::vector<CCommProfiler::Volume> volumes;
+  CCommProfiler::Reduce(exchanges, collectives, volumes);
+
+  /*--- Only the exchange types that were used are reported. ---*/
+  REQUIRE(exchanges.size() == 2);
+  CHECK(exchanges[0].name == "SOLUTION");
+  CHECK(exchanges[0].calls == 2);
+  CHECK(exchanges[0].messages == 1);
+  CHECK(exchanges[0].sumBytes == 1600 * SU2_MPI::GetSize());
+  CHECK(exchanges[0].maxBytes == 1600);
+  CHECK(exchanges[0].maxWait == Approx(1.0));
+  CHECK(exchanges[1].name == "PERIODIC_RESIDUAL");
+
+  /*--- The collectives of the reduction itself are not recorded, and the serial wrappers record none. ---*/
+#ifdef HAVE_MPI
+  REQUIRE(collectives.size() == 1);
+  CHECK(collectives[0].kind == "Allreduce");
+  CHECK(collectives[0].calls == 1);
+  CHECK(collectives[0].bytes == sizeof(int));
+#else
+  CHECK(collectives.empty());
+#endif
+
+  /*--- Only the non-zero volumes are gathered, each rank sent to rank 0. ---*/
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    REQUIRE(volumes.size() == static_cast<size_t>(SU2_MPI::GetSize()));
+    for (int iRank = 0; iRank < SU2_MPI::GetSize(); ++iRank) {
+      CHECK(volumes[iRank].rank == iRank);
+      CHECK(volumes[iRank].dest == 0);
+      CHECK(volumes[iRank].bytes == 1700);
+    }
+  }
+
+  CCommProfiler::Initialize(false);
+}
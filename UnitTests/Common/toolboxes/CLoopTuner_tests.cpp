@@ -0,0 +1,60 @@
+/*!
+ * \file CLoopTuner_tests.cpp
+ * \brief Unit tests for the loop parameter tuner.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../Common/include/toolboxes/CLoopTuner.hpp"
+
+TEST_CASE("Loop tuner", "[Toolboxes]") {
+  CLoopTuner tuner;
+  tuner.Initialize({512, 128, 256, 1024}, 1, 2);
+  REQUIRE(tuner.IsTuning());
+
+  /*--- Synthetic times with a minimum at 256, the warm-up call of each value is very slow and ignored. ---*/
+  auto time = [](unsigned long value, int call) {
+    const double x = value / 256.0;
+    return (call == 0) ? 100.0 : x + 1 / x + 0.01 * call;
+  };
+
+  std::vector<unsigned long> tried;
+  int changes = 0;
+  while (tuner.IsTuning()) {
+    const auto value = tuner.GetValue();
+    if (tried.empty() || tried.back() != value) tried.push_back(value);
+    for (int call = 0; call < 3; ++call) changes += tuner.Record(time(value, call));
+  }
+  CHECK(tried == std::vector<unsigned long>{512, 128, 256, 1024});
+  CHECK(tuner.GetValue() == 256);
+  CHECK(changes == 4);
+
+  /*--- Once tuned, the value does not change. ---*/
+  CHECK_FALSE(tuner.Record(0.0));
+  CHECK(tuner.GetValue() == 256);
+
+  /*--- A single candidate needs no tuning. ---*/
+  tuner.Initialize({64}, 1, 1);
+  CHECK_FALSE(tuner.IsTuning());
+  CHECK(tuner.GetValue() == 64);
+}
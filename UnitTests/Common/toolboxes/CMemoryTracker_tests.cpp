@@ -0,0 +1,96 @@
+/*!
+ * \file CMemoryTracker_tests.cpp
+ * \brief Unit tests for the memory tracker.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../Common/include/containers/C2DContainer.hpp"
+#include "../../Common/include/toolboxes/CMemoryTracker.hpp"
+
+namespace {
+/*--- Current memory of an owner in the calling rank. ---*/
+double CurrentMemory(const std::string& name) {
+  CMemoryTracker::OwnerStats total;
+  for (const auto& owner : CMemoryTracker::Reduce(total))
+    if (owner.name == name) return owner.sumCurrent;
+  return 0.0;
+}
+}  // namespace
+
+TEST_CASE("Memory tracker", "[Toolboxes]") {
+  const auto before = CurrentMemory("Tracked");
+  {
+    su2activematrix matrix;
+    {
+      SU2_MEMORY_SCOPE("Tracked");
+      matrix.resize(100, 10);
+    }
+    /*--- Allocations outside the scope are not attributed to the owner. ---*/
+    su2activematrix other(100, 10);
+
+    const auto during = CurrentMemory("Tracked");
+    CHECK(during - before >= 100 * 10 * sizeof(su2double));
+    CHECK(during - before < 100 * 10 * sizeof(su2double) + 1024);
+  }
+  /*--- The memory is returned to the owner that allocated it. ---*/
+  CHECK(CurrentMemory("Tracked") == before);
+
+  CMemoryTracker::Account("Explicit", 1000);
+  CMemoryTracker::Account("Explicit", -400);
+  CMemoryTracker::OwnerStats total;
+  for (const auto& owner : CMemoryTracker::Reduce(total)) {
+    if (owner.name != "Explicit") continue;
+    CHECK(owner.sumCurrent == 600);
+    CHECK(owner.maxPeak == 1000);
+  }
+  CMemoryTracker::Account("Explicit", -600);
+}
+
+TEST_CASE("Memory tracker with threads", "[Toolboxes]") {
+  const auto beforeShared = CurrentMemory("Shared");
+  const auto beforeThread = CurrentMemory("Thread");
+  const auto bytes = 100 * sizeof(su2double);
+
+  const int nThreads = omp_get_max_threads();
+  std::vector<su2activematrix> shared(nThreads), own(nThreads);
+  {
+    SU2_MEMORY_SCOPE("Shared");
+    SU2_OMP_PARALLEL {
+      /*--- The threads inherit the owner set outside the parallel region, unless they set their own. ---*/
+      const int thread = omp_get_thread_num();
+      shared[thread].resize(10, 10);
+      {
+        SU2_MEMORY_SCOPE("Thread");
+        own[thread].resize(20, 10);
+      }
+    }
+    END_SU2_OMP_PARALLEL
+  }
+  const auto sharedBytes = CurrentMemory("Shared") - beforeShared;
+  const auto threadBytes = CurrentMemory("Thread") - beforeThread;
+  CHECK(sharedBytes >= nThreads * bytes);
+  CHECK(sharedBytes < nThreads * (bytes + 1024));
+  CHECK(threadBytes >= nThreads * 2 * bytes);
+  CHECK(threadBytes < nThreads * (2 * bytes + 1024));
+}
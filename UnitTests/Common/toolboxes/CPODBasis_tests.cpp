@@ -0,0 +1,111 @@
+/*!
+ * \file CPODBasis_tests.cpp
+ * \brief Unit tests for the POD basis (method of snapshots).
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../Common/include/toolboxes/CPODBasis.hpp"
+#include <cmath>
+#include <vector>
+
+TEST_CASE("POD basis", "[Toolboxes]") {
+  const unsigned long nPoint = 50, nVar = 3, nSnap = 6;
+
+  /*--- Snapshots in a 3D affine subspace, the variables have very different magnitudes. ---*/
+  auto field = [](int k, unsigned long iPoint, unsigned long iVar) {
+    const double x = iPoint / 49.0;
+    return std::sin((k + 1) * M_PI * x + iVar) * std::pow(10.0, iVar);
+  };
+  const double coeffs[nSnap][3] = {{1.0, 0.2, 0.0},  {0.5, -0.3, 0.1}, {-0.4, 0.1, 0.3},
+                                   {0.0, 0.7, -0.2}, {0.3, 0.3, 0.3},  {-1.0, 0.0, 0.05}};
+  std::vector<su2passivematrix> snapshots(nSnap);
+  for (auto i = 0ul; i < nSnap; ++i) {
+    snapshots[i].resize(nPoint, nVar);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        double val = 2.0 * std::pow(10.0, iVar);
+        for (int k = 0; k < 3; ++k) val += coeffs[i][k] * field(k, iPoint, iVar);
+        snapshots[i](iPoint, iVar) = val;
+      }
+    }
+  }
+
+  CPODBasis basis;
+  basis.Build(snapshots, 10);
+
+  /*--- The snapshots span 3 dimensions around their mean, all the energy is captured. ---*/
+  REQUIRE(basis.GetnModes() == 3);
+  CHECK(basis.GetEnergyFraction() == Approx(1.0));
+  for (auto iMode = 1ul; iMode < basis.GetnModes(); ++iMode)
+    CHECK(basis.GetEigenvalue(iMode) <= basis.GetEigenvalue(iMode - 1));
+
+  /*--- Weights of the inner product, as documented. ---*/
+  std::vector<double> weights(nVar, 0.0);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) weights[iVar] += std::pow(basis.GetReference()(iPoint, iVar), 2);
+  for (auto& w : weights) w = nPoint / w;
+
+  auto dot = [&](const su2passivematrix& a, const su2passivematrix& b) {
+    double sum = 0.0;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) sum += weights[iVar] * a(iPoint, iVar) * b(iPoint, iVar);
+    return sum;
+  };
+
+  /*--- Orthonormality, and the eigenvalues add up to the energy of the fluctuations. ---*/
+  for (auto i = 0ul; i < basis.GetnModes(); ++i)
+    for (auto j = 0ul; j < basis.GetnModes(); ++j)
+      CHECK(dot(basis.GetMode(i), basis.GetMode(j)) == Approx(i == j ? 1.0 : 0.0).margin(1e-10));
+
+  double energy = 0.0, eigenSum = 0.0;
+  for (const auto& snap : snapshots) {
+    su2passivematrix fluct(nPoint, nVar);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        fluct(iPoint, iVar) = snap(iPoint, iVar) - basis.GetReference()(iPoint, iVar);
+    energy += dot(fluct, fluct);
+  }
+  for (auto iMode = 0ul; iMode < basis.GetnModes(); ++iMode) eigenSum += basis.GetEigenvalue(iMode);
+  CHECK(eigenSum == Approx(energy));
+
+  /*--- Projecting and reconstructing a snapshot recovers it. ---*/
+  for (const auto& snap : snapshots) {
+    std::vector<passivedouble> coords(basis.GetnModes());
+    basis.Project([&](unsigned long iPoint, unsigned long iVar) { return snap(iPoint, iVar); }, coords.data());
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      passivedouble state[nVar];
+      basis.Reconstruct(iPoint, coords.data(), state);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        CHECK(state[iVar] == Approx(snap(iPoint, iVar)).margin(1e-9 * std::pow(10.0, iVar)));
+    }
+  }
+
+  /*--- Truncation keeps the most energetic modes. ---*/
+  CPODBasis truncated;
+  truncated.Build(snapshots, 2);
+  REQUIRE(truncated.GetnModes() == 2);
+  CHECK(truncated.GetEnergyFraction() < 1.0);
+  for (auto iMode = 0ul; iMode < 2; ++iMode)
+    CHECK(truncated.GetEigenvalue(iMode) == Approx(basis.GetEigenvalue(iMode)));
+}
@@ -0,0 +1,174 @@
+/*!
+ * \file CProfiler_tests.cpp
+ * \brief Unit tests for the runtime profiler.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../Common/include/toolboxes/CProfiler.hpp"
+
+TEST_CASE("Profiler regions", "[Toolboxes]") {
+  CProfiler::Initialize(true);
+
+  for (int iter = 0; iter < 3; ++iter) {
+    SU2_PROFILE_REGION("Outer");
+    for (int i = 0; i < 2; ++i) {
+      SU2_PROFILE_REGION("Inner");
+    }
+    SU2_OMP_PARALLEL {
+      SU2_PROFILE_REGION("Threaded");
+    }
+    END_SU2_OMP_PARALLEL
+  }
+  {
+    SU2_PROFILE_REGION("Other");
+  }
+
+  double totalTime = 0.0;
+  const auto stats = CProfiler::Reduce(totalTime);
+
+  /*--- Depth-first order, the regions of the worker threads are nested in "Outer". ---*/
+  REQUIRE(stats.size() == 4);
+  CHECK(stats[0].path == "Outer");
+  CHECK(stats[1].path == "Outer/Inner");
+  CHECK(stats[2].path == "Outer/Threaded");
+  CHECK(stats[3].path == "Other");
+
+  CHECK(stats[0].depth == 0);
+  CHECK(stats[1].depth == 1);
+  CHECK(stats[0].calls == 3);
+  CHECK(stats[1].calls == 6);
+  CHECK(stats[2].calls == 3);
+
+  CHECK(stats[0].maxTime >= stats[1].maxTime);
+  CHECK(stats[0].minTime <= stats[0].avgTime);
+  CHECK(stats[0].avgTime <= stats[0].maxTime);
+  CHECK(totalTime >= stats[0].maxTime);
+
+  /*--- When disabled nothing is recorded. ---*/
+  CProfiler::Initialize(false);
+  {
+    SU2_PROFILE_REGION("Disabled");
+  }
+  CHECK(CProfiler::Reduce(totalTime).empty());
+}
+
+TEST_CASE("Profiler totals and work", "[Toolboxes]") {
+  CProfiler::Initialize(true);
+
+  for (int iter = 0; iter < 2; ++iter) {
+    SU2_PROFILE_REGION("Outer");
+    {
+      SU2_PROFILE_REGION("Kernel");
+      CProfiler::AddWork(100.0, 10.0);
+      {
+        /*--- Nested regions with the same name are not counted twice. ---*/
+        SU2_PROFILE_REGION("Kernel");
+        CProfiler::AddWork(1.0, 0.0);
+      }
+    }
+  }
+  {
+    SU2_PROFILE_REGION("Kernel");
+    SU2_OMP_PARALLEL {
+      CProfiler::AddWork(50.0, 5.0);
+    }
+    END_SU2_OMP_PARALLEL
+  }
+
+  const auto totals = CProfiler::GetTotals("Kernel");
+  CHECK(totals.calls == 3);
+  CHECK(totals.bytes == Approx(250.0));
+  CHECK(totals.flops == Approx(25.0));
+  CHECK(CProfiler::GetTotals("Missing").calls == 0);
+
+  /*--- The work is also reported by region (sum over ranks), for the roofline analysis. ---*/
+  double totalTime = 0.0;
+  for (const auto& region : CProfiler::Reduce(totalTime)) {
+    if (region.path == "Outer/Kernel") {
+      CHECK(region.bytes == Approx(200.0 * SU2_MPI::GetSize()));
+      CHECK(region.flops == Approx(20.0 * SU2_MPI::GetSize()));
+    }
+    if (region.path == "Kernel") CHECK(region.bytes == Approx(50.0 * SU2_MPI::GetSize()));
+  }
+
+  CProfiler::Initialize(false);
+}
+
+TEST_CASE("Profiler hardware counters", "[Toolboxes]") {
+  /*--- Depending on the platform and permissions the counters may not be available, in which case
+   *    only the times are reported. ---*/
+  CProfiler::Initialize(true, true);
+  CHECK(CProfiler::GetCounterNames().size() == 4);
+
+  {
+    SU2_PROFILE_REGION("Counted");
+    volatile double sum = 0.0;
+    for (int i = 0; i < 100000; ++i) sum = sum + i;
+  }
+
+  double totalTime = 0.0;
+  const auto stats = CProfiler::Reduce(totalTime);
+  REQUIRE(stats.size() == 1);
+  CHECK(stats[0].calls == 1);
+  if (!stats[0].counts.empty()) {
+    REQUIRE(stats[0].counts.size() == 4);
+    CHECK(stats[0].counts[0] > 0.0);
+    CHECK(stats[0].counts[1] > 0.0);
+  }
+
+  CProfiler::Initialize(true, true, {"0x01c7"});
+  CHECK(CProfiler::GetCounterNames().back() == "Raw_0x1c7");
+
+  CProfiler::Initialize(false);
+}
+
+TEST_CASE("Profiler thread imbalance", "[Toolboxes]") {
+  CProfiler::Initialize(true);
+
+  /*--- The work of each iteration grows with the index, with a large chunk the threads get uneven work. ---*/
+  const int nThread = omp_get_max_threads();
+  double sum = 0.0;
+  SU2_OMP_PARALLEL {
+    SU2_OMP_FOR_DYN_PROFILED("Loop", 64)
+    for (int i = 0; i < 64 * nThread; ++i) {
+      double local = 0.0;
+      for (int j = 0; j < 1000 * i; ++j) local += 1e-9 * j;
+      atomicAdd(local, sum);
+    }
+    END_SU2_OMP_FOR_PROFILED
+  }
+  END_SU2_OMP_PARALLEL
+
+  double totalTime = 0.0;
+  const auto stats = CProfiler::Reduce(totalTime);
+
+  REQUIRE(stats.size() == 1);
+  CHECK(stats[0].path == "Loop");
+  CHECK(sum > 0.0);
+  if (nThread == 1) {
+    CHECK(stats[0].imbalance == 0.0);
+  } else {
+    CHECK(stats[0].imbalance > 0.0);
+  }
+}
@@ -0,0 +1,161 @@
+/*!
+ * \file CMeshSolver_tests.cpp
+ * \brief Unit tests for the reuse of the mesh deformation operator.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <memory>
+#include <sstream>
+#include "../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../Common/include/grid_movement/CVolumetricMovement.hpp"
+#include "../../SU2_CFD/include/solvers/CMeshSolver.hpp"
+#include "../../SU2_CFD/include/numerics/elasticity/CFEALinearElasticity.hpp"
+
+namespace {
+
+/*--- Box mesh whose z_plus face is deformed by a bump, the other faces are clamped. With a uniform mesh and
+ * DEFORM_COEFF = DEFORM_POISSONS_RATIO, the legacy method (CVolumetricMovement) solves the same problem. ---*/
+const std::string boxOptions =
+    "SOLVER= EULER\n"
+    "MESH_FORMAT= BOX\n"
+    "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_plus, z_minus)\n"
+    "MESH_BOX_SIZE= 6,6,6\n"
+    "MESH_BOX_LENGTH= 1,1,1\n"
+    "MESH_BOX_OFFSET= 0,0,0\n"
+    "DEFORM_STIFFNESS_TYPE= INVERSE_VOLUME\n"
+    "DEFORM_POISSONS_RATIO= 0.3\n"
+    "DEFORM_COEFF= 0.3\n"
+    "DEFORM_LINEAR_SOLVER_ERROR= 1E-12\n";
+
+su2double Bump(const su2double* coord, su2double height) {
+  return height * sin(PI_NUMBER * coord[0]) * sin(PI_NUMBER * coord[1]);
+}
+
+struct BoxMesh {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+
+  BoxMesh(const std::string& options, SU2_COMPONENT component) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    std::stringstream ss(boxOptions + options);
+    config = std::unique_ptr<CConfig>(new CConfig(ss, component, false));
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->Check_IntElem_Orientation(config.get());
+    geometry->Check_BoundElem_Orientation(config.get());
+    geometry->SetEdges();
+    geometry->SetVertex(config.get());
+    geometry->SetControlVolume(config.get(), ALLOCATE);
+    geometry->SetBoundControlVolume(config.get(), ALLOCATE);
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+    cout.rdbuf(origBuf);
+  }
+
+  /*! \brief Index of the z_plus marker. */
+  unsigned short BumpMarker() const {
+    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); ++iMarker)
+      if (config->GetMarker_All_TagBound(iMarker) == "z_plus") return iMarker;
+    return 0;
+  }
+};
+
+/*--- Deformation with the linear elasticity solver, which keeps its operator between deformations. ---*/
+struct MeshSolverBox : BoxMesh {
+  std::unique_ptr<CMeshSolver> solver;
+  std::vector<std::unique_ptr<CNumerics>> numerics;
+  std::vector<CNumerics*> numericsPtr;
+
+  MeshSolverBox() : BoxMesh("DEFORM_MESH= YES\nMARKER_DEFORM_MESH= (z_plus)\n", SU2_COMPONENT::SU2_CFD) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    solver = std::unique_ptr<CMeshSolver>(new CMeshSolver(geometry.get(), config.get()));
+    numericsPtr.resize(MAX_TERMS * omp_get_max_threads(), nullptr);
+    for (int thread = 0; thread < omp_get_max_threads(); ++thread) {
+      numerics.emplace_back(new CFEAMeshElasticity(3, 3, geometry->GetnElem(), config.get()));
+      numericsPtr[FEA_TERM + thread * MAX_TERMS] = numerics.back().get();
+    }
+    cout.rdbuf(origBuf);
+  }
+
+  /*! \brief Deform the mesh for a bump of the given height, returns the iterations of the linear solver. */
+  unsigned long Deform(su2double height) {
+    const auto iMarker = BumpMarker();
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const su2double disp[] = {0.0, 0.0, Bump(solver->GetNodes()->GetMesh_Coord(iPoint), height)};
+      solver->GetNodes()->SetBound_Disp(iPoint, disp);
+    }
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    CGeometry* geometries[] = {geometry.get()};
+    solver->SetMesh_Stiffness(numericsPtr.data(), config.get());
+    solver->DeformMesh(geometries, numericsPtr.data(), config.get());
+    cout.rdbuf(origBuf);
+    return solver->GetIterLinSolver();
+  }
+};
+
+}  // namespace
+
+TEST_CASE("Mesh deformation with the kept operator", "[MeshDeformation]") {
+  MeshSolverBox kept;
+
+  CHECK(kept.Deform(0.1) > 0);
+
+  /*--- Same boundary displacements, the previous solution is the initial guess and is already converged. ---*/
+  CHECK(kept.Deform(0.1) == 0);
+
+  /*--- New boundary displacements, with the restored stiffness matrix and preconditioner. ---*/
+  kept.Deform(0.2);
+
+  /*--- Fresh deformation of the original mesh to the new displacements, with the legacy method. ---*/
+  BoxMesh fresh("DV_MARKER= (z_plus)\n", SU2_COMPONENT::SU2_DEF);
+  const auto iMarker = fresh.BumpMarker();
+  for (auto iVertex = 0ul; iVertex < fresh.geometry->GetnVertex(iMarker); ++iVertex) {
+    const auto iPoint = fresh.geometry->vertex[iMarker][iVertex]->GetNode();
+    const su2double varCoord[] = {0.0, 0.0, Bump(fresh.geometry->nodes->GetCoord(iPoint), 0.2)};
+    fresh.geometry->vertex[iMarker][iVertex]->SetVarCoord(varCoord);
+  }
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+  CVolumetricMovement movement(fresh.geometry.get(), fresh.config.get());
+  movement.SetVolume_Deformation(fresh.geometry.get(), fresh.config.get(), true);
+  cout.rdbuf(origBuf);
+
+  for (auto iPoint = 0ul; iPoint < kept.geometry->GetnPoint(); ++iPoint) {
+    for (auto iDim = 0u; iDim < 3; ++iDim) {
+      CHECK(kept.geometry->nodes->GetCoord(iPoint, iDim) ==
+            Approx(fresh.geometry->nodes->GetCoord(iPoint, iDim)).margin(1e-9));
+    }
+  }
+}
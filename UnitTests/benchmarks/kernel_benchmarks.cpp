@@ -0,0 +1,535 @@
+/*!
+ * \file kernel_benchmarks.cpp
+ * \brief Micro-benchmarks of the main computational kernels of the finite volume flow solvers.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*--- Each kernel is timed in isolation on a synthetic (RECTANGLE / BOX) or user provided mesh, the
+ *    statistics over the repetitions are printed and written to a CSV or JSON file. Usage example:
+ *      mpirun -n 2 kernel_benchmarks -t 4 --mesh box --size 65 --repeats 20 --format json ---*/
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+#include "CLI11.hpp"
+#include "../../Common/include/CConfig.hpp"
+#include "../../Common/include/containers/CLookUpTable.hpp"
+#include "../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../Common/include/linear_algebra/CPreconditioner.hpp"
+#include "../../Common/include/parallelization/vectorization.hpp"
+#include "../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../SU2_CFD/include/solvers/CSolver.hpp"
+#include "../../SU2_CFD/include/solvers/CSolverFactory.hpp"
+#if defined(HAVE_MLPCPP)
+#include "../../subprojects/MLPCpp/include/CLookUp_ANN.hpp"
+#define USE_MLPCPP
+#endif
+
+namespace {
+
+using MPIWrapper = SelectMPIWrapper<passivedouble>::W;
+
+/*!
+ * \brief Timings of one kernel, the times are the maximum over ranks of each repetition.
+ */
+struct KernelTimes {
+  std::string name;          /*!< \brief Name of the kernel. */
+  unsigned long items = 0;   /*!< \brief Global number of items (edges, points, lookups) processed per call. */
+  std::vector<double> times; /*!< \brief Wall time of each timed repetition. */
+
+  double Min() const { return *std::min_element(times.begin(), times.end()); }
+  double Max() const { return *std::max_element(times.begin(), times.end()); }
+  double Mean() const {
+    double sum = 0.0;
+    for (const auto t : times) sum += t;
+    return sum / times.size();
+  }
+  double Median() const {
+    auto sorted = times;
+    std::sort(sorted.begin(), sorted.end());
+    const auto n = sorted.size();
+    return (n % 2) ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+  }
+};
+
+/*!
+ * \brief Runs and times the kernels.
+ */
+class CKernelTimer {
+ private:
+  unsigned long warmup, repeats;
+  std::vector<KernelTimes> results;
+
+ public:
+  CKernelTimer(unsigned long warmup_, unsigned long repeats_) : warmup(warmup_), repeats(std::max(repeats_, 1ul)) {}
+
+  /*!
+   * \brief Time a kernel.
+   * \param[in] name - Name of the kernel.
+   * \param[in] items - Global number of items processed by each call.
+   * \param[in] parallel - Whether the kernel is called by all threads (like in the solvers) or only by one.
+   * \param[in] kernel - The kernel.
+   * \param[in] setup - Optional preparation before each call, not timed.
+   */
+  void Run(const std::string& name, unsigned long items, bool parallel, const std::function<void()>& kernel,
+           const std::function<void()>& setup = nullptr) {
+    std::vector<double> times;
+
+    SU2_OMP_PARALLEL_(if(parallel)) {
+      double start = 0.0;
+      for (auto iRep = 0ul; iRep < warmup + repeats; ++iRep) {
+        if (setup) setup();
+        SU2_OMP_BARRIER
+        SU2_OMP_MASTER {
+          SU2_MPI::Barrier(SU2_MPI::GetComm());
+          start = SU2_MPI::Wtime();
+        }
+        END_SU2_OMP_MASTER
+        SU2_OMP_BARRIER
+
+        kernel();
+
+        SU2_OMP_BARRIER
+        SU2_OMP_MASTER {
+          if (iRep >= warmup) times.push_back(SU2_MPI::Wtime() - start);
+        }
+        END_SU2_OMP_MASTER
+      }
+    }
+    END_SU2_OMP_PARALLEL
+
+    results.emplace_back();
+    auto& result = results.back();
+    result.name = name;
+    result.items = items;
+    result.times.resize(times.size());
+    MPIWrapper::Allreduce(times.data(), result.times.data(), times.size(), MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  }
+
+  /*! \brief Timings of the kernels run so far. */
+  const std::vector<KernelTimes>& GetResults() const { return results; }
+};
+
+/*!
+ * \brief Global sum of a local count.
+ */
+unsigned long GlobalSum(unsigned long local) {
+  unsigned long global = 0;
+  SU2_MPI::Allreduce(&local, &global, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  return global;
+}
+
+/*!
+ * \brief Config of the synthetic case, an implicit Euler solver with the vectorized Roe scheme.
+ */
+std::string SyntheticConfig(const std::string& mesh, unsigned short size) {
+  const bool box = (mesh == "box");
+  std::ostringstream cfg;
+  cfg << "SOLVER= EULER\n"
+      << "MESH_FORMAT= " << (box ? "BOX" : "RECTANGLE") << "\n"
+      << "MESH_BOX_SIZE= " << size << ", " << size << ", " << size << "\n"
+      << "MESH_BOX_LENGTH= 1.0, 1.0, 1.0\n"
+      << "MESH_BOX_OFFSET= 0.0, 0.0, 0.0\n"
+      << "MARKER_FAR= ( x_minus, x_plus, y_minus, y_plus" << (box ? ", z_minus, z_plus" : "") << " )\n"
+      << "MACH_NUMBER= 0.8\n"
+      << "AOA= 1.25\n"
+      << "FREESTREAM_PRESSURE= 101325.0\n"
+      << "FREESTREAM_TEMPERATURE= 288.15\n"
+      << "REF_ORIGIN_MOMENT_X= 0.0\n"
+      << "REF_ORIGIN_MOMENT_Y= 0.0\n"
+      << "REF_ORIGIN_MOMENT_Z= 0.0\n"
+      << "CONV_NUM_METHOD_FLOW= ROE\n"
+      << "MUSCL_FLOW= YES\n"
+      << "SLOPE_LIMITER_FLOW= VENKATAKRISHNAN\n"
+      << "NUM_METHOD_GRAD= GREEN_GAUSS\n"
+      << "NUM_METHOD_GRAD_RECON= WEIGHTED_LEAST_SQUARES\n"
+      << "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+      << "CFL_NUMBER= 10.0\n"
+      << "MGLEVEL= 0\n"
+      << "LINEAR_SOLVER= FGMRES\n"
+      << "LINEAR_SOLVER_PREC= ILU\n"
+      << "LINEAR_SOLVER_ILU_FILL_IN= 0\n";
+  return cfg.str();
+}
+
+/*!
+ * \brief Geometry preprocessing, the subset of CDriver::InitializeGeometryFVM needed by the kernels.
+ */
+CGeometry* PreprocessGeometry(CConfig* config) {
+  CGeometry* geometry = nullptr;
+  {
+    CPhysicalGeometry aux(config, 0, 1);
+    aux.SetColorGrid_Parallel(config);
+    geometry = new CPhysicalGeometry(&aux, config);
+  }
+  geometry->SetSendReceive(config);
+  geometry->SetBoundaries(config);
+  geometry->SetPoint_Connectivity();
+  geometry->SetRCM_Ordering(config);
+  geometry->SetPoint_Connectivity();
+  geometry->SetElement_Connectivity();
+  geometry->SetBoundVolume();
+  geometry->Check_IntElem_Orientation(config);
+  geometry->Check_BoundElem_Orientation(config);
+  geometry->SetEdges();
+  geometry->SetVertex(config);
+  SU2_OMP_PARALLEL {
+    geometry->SetControlVolume(config, ALLOCATE);
+    geometry->SetBoundControlVolume(config, ALLOCATE);
+  }
+  END_SU2_OMP_PARALLEL
+  geometry->FindNormal_Neighbor(config);
+  geometry->SetGlobal_to_Local_Point();
+  geometry->PreprocessP2PComms(geometry, config);
+  geometry->SetMGLevel(MESH_0);
+  geometry->SetMaxLength(config);
+  return geometry;
+}
+
+/*!
+ * \brief Evaluate the residual and Jacobian of the flow solver and add the pseudo-time term to the
+ *        diagonal of the latter, like an implicit iteration does (must be called by all threads).
+ */
+void AssembleSystem(CGeometry* geometry, CSolver** solvers, CConfig* config) {
+  CSolver* solver = solvers[FLOW_SOL];
+  const CVariable* nodes = solver->GetNodes();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  solver->LinSysRes.SetValZero();
+  solver->Jacobian.SetValZero();
+  solver->Upwind_Residual(geometry, solvers, nullptr, config, MESH_0);
+
+  SU2_OMP_FOR_STAT(computeStaticChunkSize(nPointDomain, omp_get_num_threads(), 1024))
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    const su2double Delta = geometry->nodes->GetVolume(iPoint) / nodes->GetDelta_Time(iPoint);
+    solver->Jacobian.AddVal2Diag(iPoint, Delta);
+  }
+  END_SU2_OMP_FOR
+}
+
+/*!
+ * \brief Write the statistics to file, CSV (one row per kernel) or JSON.
+ */
+void WriteResults(const std::vector<KernelTimes>& results, const std::string& fileName, const std::string& format,
+                  const std::string& mesh, unsigned long nPoint, unsigned long nEdge) {
+  const int nRank = SU2_MPI::GetSize();
+  const int nThread = omp_get_max_threads();
+  const auto simdWidth = simd::preferredLen<su2double>();
+
+  std::ofstream file;
+  file.precision(8);
+
+  if (format == "csv") {
+    file.open(fileName + ".csv");
+    file << "\"Kernel\",\"Mesh\",\"Points\",\"Edges\",\"Ranks\",\"Threads\",\"SIMD_Width\",\"Items\",\"Repeats\","
+            "\"Min_Time\",\"Median_Time\",\"Mean_Time\",\"Max_Time\",\"Items_Per_Second\"\n";
+    for (const auto& kernel : results) {
+      file << "\"" << kernel.name << "\",\"" << mesh << "\"," << nPoint << "," << nEdge << "," << nRank << ","
+           << nThread << "," << simdWidth << "," << kernel.items << "," << kernel.times.size() << ","
+           << kernel.Min() << "," << kernel.Median() << "," << kernel.Mean() << "," << kernel.Max() << ","
+           << kernel.items / std::max(kernel.Median(), 1e-300) << "\n";
+    }
+  } else {
+    file.open(fileName + ".json");
+    file << "{\n  \"mesh\": \"" << mesh << "\",\n  \"points\": " << nPoint << ",\n  \"edges\": " << nEdge
+         << ",\n  \"ranks\": " << nRank << ",\n  \"threads\": " << nThread << ",\n  \"simd_width\": " << simdWidth
+         << ",\n  \"kernels\": [";
+    for (auto i = 0ul; i < results.size(); ++i) {
+      const auto& kernel = results[i];
+      file << (i ? ",\n" : "\n") << "    {\"name\": \"" << kernel.name << "\", \"items\": " << kernel.items
+           << ", \"repeats\": " << kernel.times.size() << ", \"min_time\": " << kernel.Min()
+           << ", \"median_time\": " << kernel.Median() << ", \"mean_time\": " << kernel.Mean()
+           << ", \"max_time\": " << kernel.Max()
+           << ", \"items_per_second\": " << kernel.items / std::max(kernel.Median(), 1e-300) << "}";
+    }
+    file << "\n  ]\n}\n";
+  }
+}
+
+/*!
+ * \brief Print a summary table of the statistics.
+ */
+void PrintResults(const std::vector<KernelTimes>& results) {
+  PrintingToolbox::CTablePrinter table(&std::cout);
+  table.AddColumn("Kernel", 24);
+  table.AddColumn("Items", 10);
+  table.AddColumn("Min [s]", 11);
+  table.AddColumn("Median [s]", 11);
+  table.AddColumn("Max [s]", 11);
+  table.AddColumn("Items/s", 11);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.PrintHeader();
+
+  for (const auto& kernel : results) {
+    std::ostringstream minTime, medTime, maxTime, rate;
+    minTime << std::setprecision(4) << kernel.Min();
+    medTime << std::setprecision(4) << kernel.Median();
+    maxTime << std::setprecision(4) << kernel.Max();
+    rate << std::setprecision(4) << kernel.items / std::max(kernel.Median(), 1e-300);
+    table << kernel.name << kernel.items << minTime.str() << medTime.str() << maxTime.str() << rate.str();
+  }
+  table.PrintFooter();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int num_threads = omp_get_max_threads();
+  std::string mesh = "box", configFile, format = "csv", outFile = "kernel_benchmarks";
+  std::string lutFile, mlpFile;
+  std::vector<std::string> lutNames = {"ProgressVariable", "EnthalpyTot", "Density"};
+  std::vector<std::string> mlpNames = {"x", "y", "z"};
+  unsigned short size = 33;
+  unsigned long warmup = 2, repeats = 20, nLookUps = 100000;
+  bool verbose = false;
+
+  /*--- Command line parsing ---*/
+
+  CLI::App app{"SU2 v8.0.0 \"Harrier\", kernel micro-benchmarks"};
+  app.add_option("-t,--threads", num_threads, "Number of OpenMP threads per MPI rank.");
+  app.add_option("-m,--mesh", mesh, "Synthetic mesh, rectangle (2D) or box (3D).")
+      ->check(CLI::IsMember({"rectangle", "box"}));
+  app.add_option("-n,--size", size, "Number of points in each direction of the synthetic mesh.");
+  app.add_option("-c,--config", configFile, "Config file of a real case (compressible, ROE, ideal gas).")
+      ->check(CLI::ExistingFile);
+  app.add_option("-w,--warmup", warmup, "Number of untimed calls of each kernel.");
+  app.add_option("-r,--repeats", repeats, "Number of timed calls of each kernel.");
+  app.add_option("-f,--format", format, "Format of the output file, csv or json.")
+      ->check(CLI::IsMember({"csv", "json"}));
+  app.add_option("-o,--output", outFile, "Name of the output file without extension.");
+  app.add_option("--lut", lutFile, "Look-up table file (.drg) for the CLookUpTable benchmark.")
+      ->check(CLI::ExistingFile);
+  app.add_option("--lut_names", lutNames, "Names of the two controlling variables and of the looked-up variable.")
+      ->expected(3);
+  app.add_option("--mlp", mlpFile, "MLP file (.mlp) for the MLP benchmark.")->check(CLI::ExistingFile);
+  app.add_option("--mlp_names", mlpNames, "Names of the two inputs and of the output of the MLP.")->expected(3);
+  app.add_option("--lookups", nLookUps, "Number of table / MLP evaluations per call.");
+  app.add_flag("-v,--verbose", verbose, "Show the output of the preprocessing.");
+
+  CLI11_PARSE(app, argc, argv)
+
+  omp_set_num_threads(num_threads);
+
+#if defined(HAVE_OMP) && defined(HAVE_MPI)
+  int provided;
+  SU2_MPI::Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+#else
+  SU2_MPI::Init(&argc, &argv);
+#endif
+  const int rank = SU2_MPI::GetRank();
+
+  /*--- Preprocessing, the solver is initialized with a smooth perturbation of the free-stream
+   *    (otherwise gradients and limiters would be trivial), its residual and Jacobian are
+   *    evaluated once so that the linear algebra kernels operate on a representative matrix. ---*/
+
+  auto* orig_buf = std::cout.rdbuf();
+  if (!verbose) std::cout.rdbuf(nullptr);
+
+  CConfig* config = nullptr;
+  if (configFile.empty()) {
+    std::stringstream ss(SyntheticConfig(mesh, size));
+    config = new CConfig(ss, SU2_COMPONENT::SU2_CFD, false);
+  } else {
+    char fileName[MAX_STRING_SIZE];
+    strcpy(fileName, configFile.c_str());
+    config = new CConfig(fileName, SU2_COMPONENT::SU2_CFD, false);
+    mesh = config->GetMesh_FileName();
+  }
+
+  const auto kindSolver = config->GetKind_Solver();
+  const bool compressible = (kindSolver == MAIN_SOLVER::EULER) || (kindSolver == MAIN_SOLVER::NAVIER_STOKES) ||
+                            (kindSolver == MAIN_SOLVER::RANS);
+  const bool idealGas = (config->GetKind_FluidModel() == STANDARD_AIR) || (config->GetKind_FluidModel() == IDEAL_GAS);
+  if (!compressible || config->GetKind_Upwind_Flow() != UPWIND::ROE || !idealGas ||
+      config->GetKind_TimeIntScheme_Flow() != EULER_IMPLICIT) {
+    SU2_MPI::Error("The benchmarks require a compressible flow case with the ROE scheme, an ideal gas, "
+                   "and implicit time integration.", CURRENT_FUNCTION);
+  }
+
+  CGeometry* geometry = PreprocessGeometry(config);
+  CSolver** solvers = CSolverFactory::CreateSolverContainer(config->GetKind_Solver(), config, geometry, MESH_0);
+  CSolver* solver = solvers[FLOW_SOL];
+  CVariable* nodes = solver->GetNodes();
+
+  const auto nDim = geometry->GetnDim();
+  const auto nVar = solver->GetnVar();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    const auto coord = geometry->nodes->GetCoord(iPoint);
+    su2double factor = 1.0;
+    for (auto iDim = 0u; iDim < nDim; ++iDim) factor += 0.05 * sin(2 * PI_NUMBER * coord[iDim]);
+    for (auto iVar = 0u; iVar < nVar; ++iVar) {
+      nodes->SetSolution(iPoint, iVar, factor * nodes->GetSolution(iPoint, iVar));
+    }
+  }
+
+  SU2_OMP_PARALLEL {
+    solver->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    solver->SetTime_Step(geometry, solvers, config, MESH_0, 0);
+    AssembleSystem(geometry, solvers, config);
+  }
+  END_SU2_OMP_PARALLEL
+
+  std::cout.rdbuf(orig_buf);
+
+  const auto nPoint = geometry->GetGlobal_nPointDomain();
+  const auto nEdge = GlobalSum(geometry->GetnEdge());
+  const auto nHalo = GlobalSum(geometry->GetnPoint() - nPointDomain);
+
+  if (rank == MASTER_NODE) {
+    std::cout << "Kernel benchmarks on " << mesh << ": " << nPoint << " points, " << nEdge << " edges, "
+              << SU2_MPI::GetSize() << " rank(s), " << omp_get_max_threads() << " thread(s) per rank, SIMD width "
+              << simd::preferredLen<su2double>() << ".\n" << std::endl;
+  }
+
+  CKernelTimer timer(warmup, repeats);
+
+  /*--- Spatial discretization. ---*/
+
+  timer.Run("Edge fluxes (Roe)", nEdge, true,
+            [&]() { solver->Upwind_Residual(geometry, solvers, nullptr, config, MESH_0); },
+            [&]() {
+              solver->LinSysRes.SetValZero();
+              solver->Jacobian.SetValZero();
+            });
+
+  timer.Run("Gradients (GG)", nPoint, true, [&]() { solver->SetPrimitive_Gradient_GG(geometry, config); });
+
+  timer.Run("Gradients (WLS)", nPoint, true, [&]() { solver->SetPrimitive_Gradient_LS(geometry, config, true); });
+
+  timer.Run("Limiters (Venkat.)", nPoint, true, [&]() { solver->SetPrimitive_Limiter(geometry, config); });
+
+  /*--- Restore the Jacobian evaluated in the preprocessing (with the pseudo-time term). ---*/
+
+  SU2_OMP_PARALLEL {
+    AssembleSystem(geometry, solvers, config);
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Sparse linear algebra. ---*/
+
+  auto& jacobian = solver->Jacobian;
+  CSysVector<su2mixedfloat> x(geometry->GetnPoint(), nPointDomain, nVar, 1.0);
+  CSysVector<su2mixedfloat> y(geometry->GetnPoint(), nPointDomain, nVar, 0.0);
+
+  timer.Run("SpMV", nPoint, true, [&]() { jacobian.MatrixVectorProduct(x, y, geometry, config); });
+
+  auto* ilu = CPreconditioner<su2mixedfloat>::Create(ILU, jacobian, geometry, config);
+  auto* lusgs = CPreconditioner<su2mixedfloat>::Create(LU_SGS, jacobian, geometry, config);
+
+  timer.Run("ILU build", nPoint, true, [&]() { ilu->Build(); });
+  timer.Run("ILU apply", nPoint, true, [&]() { (*ilu)(x, y); });
+  timer.Run("LU-SGS apply", nPoint, true, [&]() { (*lusgs)(x, y); });
+
+  delete ilu;
+  delete lusgs;
+
+  /*--- BLAS-1, the result of dot is stored to prevent the call from being optimized away. ---*/
+
+  su2mixedfloat dotResult = 0.0;
+  timer.Run("Vector dot", nPoint, true, [&]() {
+    const auto dot = x.dot(y);
+    SU2_OMP_MASTER
+    dotResult += dot;
+    END_SU2_OMP_MASTER
+  });
+  timer.Run("Vector axpy", nPoint, true, [&]() { y += su2mixedfloat(1e-3) * x; });
+
+  /*--- Halo exchange of the solution. ---*/
+
+  timer.Run("Halo exchange", nHalo, true, [&]() {
+    solver->InitiateComms(geometry, config, SOLUTION);
+    solver->CompleteComms(geometry, config, SOLUTION);
+  });
+
+  /*--- Thermodynamic look-ups at random states within the range of the table, single threaded. ---*/
+
+  std::mt19937 gen(rank);
+  std::uniform_real_distribution<passivedouble> uniform(0.0, 1.0);
+
+  if (!lutFile.empty()) {
+    CLookUpTable table(lutFile, lutNames[0], lutNames[1]);
+    const auto limitsX = table.GetTableLimitsX();
+    const auto limitsY = table.GetTableLimitsY();
+    std::vector<su2double> cv1(nLookUps), cv2(nLookUps);
+    for (auto i = 0ul; i < nLookUps; ++i) {
+      cv1[i] = *limitsX.first + uniform(gen) * (*limitsX.second - *limitsX.first);
+      cv2[i] = *limitsY.first + uniform(gen) * (*limitsY.second - *limitsY.first);
+    }
+    su2double value = 0.0;
+    timer.Run("LUT lookup", GlobalSum(nLookUps), false, [&]() {
+      for (auto i = 0ul; i < nLookUps; ++i) table.LookUp_XY(lutNames[2], &value, cv1[i], cv2[i]);
+    });
+  }
+
+  if (!mlpFile.empty()) {
+#ifdef USE_MLPCPP
+    std::string files[] = {mlpFile};
+    MLPToolbox::CLookUp_ANN ann(1, files);
+    std::vector<std::string> inputNames = {mlpNames[0], mlpNames[1]}, outputNames = {mlpNames[2]};
+    MLPToolbox::CIOMap iomap(inputNames, outputNames);
+    ann.PairVariableswithMLPs(iomap);
+    std::vector<su2double> inputs(2);
+    su2double output = 0.0;
+    std::vector<su2double*> outputs = {&output};
+    std::vector<su2double> in1(nLookUps), in2(nLookUps);
+    for (auto i = 0ul; i < nLookUps; ++i) {
+      in1[i] = uniform(gen);
+      in2[i] = uniform(gen);
+    }
+    timer.Run("MLP evaluation", GlobalSum(nLookUps), false, [&]() {
+      for (auto i = 0ul; i < nLookUps; ++i) {
+        inputs[0] = in1[i];
+        inputs[1] = in2[i];
+        ann.PredictANN(&iomap, inputs, outputs);
+      }
+    });
+#else
+    SU2_MPI::Error("SU2 was not compiled with MLPCpp enabled (-Denable-mlpcpp=true).", CURRENT_FUNCTION);
+#endif
+  }
+
+  /*--- Report. ---*/
+
+  if (rank == MASTER_NODE) {
+    PrintResults(timer.GetResults());
+    WriteResults(timer.GetResults(), outFile, format, mesh, nPoint, nEdge);
+    std::cout << "Statistics written to " << outFile << "." << format << " (dot check " << dotResult << ")."
+              << std::endl;
+  }
+
+  delete solver;
+  delete[] solvers;
+  delete geometry;
+  delete config;
+
+  SU2_MPI::Finalize();
+  omp_finalize();
+
+  return EXIT_SUCCESS;
+}